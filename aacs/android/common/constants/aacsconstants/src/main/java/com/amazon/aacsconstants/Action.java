@@ -233,6 +233,7 @@ public class Action {
     public static class LocationProvider {
         public static final String GET_COUNTRY = "GetCountry";
         public static final String GET_LOCATION = "GetLocation";
+        public static final String LOCATION_CHANGED = "LocationChanged";
         public static final String LOCATION_SERVICE_ACCESS_CHANGED = "LocationServiceAccessChanged";
     }
 
@@ -93,6 +93,11 @@ def imports(obj, dest_folder):
                 cmake_file_path_sep.join(utils.list_files(source_path, "testing/unit/tests", "cpp", False, False))
             )
             out.write(")\n")
+            out.write(f"set(AAC_TEST_TOOLS{cmake_file_path_sep}")
+            out.writelines(
+                cmake_file_path_sep.join(utils.list_files(source_path, "testing/tools", "cpp", False, False))
+            )
+            out.write(")\n")
 
         # write includes cmake variable list
         out.write(f"set(AAC_INCLUDES{cmake_file_path_sep}")
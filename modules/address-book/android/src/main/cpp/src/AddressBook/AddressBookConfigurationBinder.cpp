@@ -23,10 +23,12 @@ extern "C" {
 JNIEXPORT jlong JNICALL Java_com_amazon_aace_addressbook_config_AddressBookConfiguration_createAddressBookConfigBinder(
     JNIEnv* env,
     jobject obj,
-    jboolean cleanAllAddressBooksAtStart) {
+    jboolean cleanAllAddressBooksAtStart,
+    jint maxConcurrentUploads,
+    jint removeGracePeriodSeconds) {
     try {
-        auto config =
-            aace::addressBook::config::AddressBookConfiguration::createAddressBookConfig(cleanAllAddressBooksAtStart);
+        auto config = aace::addressBook::config::AddressBookConfiguration::createAddressBookConfig(
+            cleanAllAddressBooksAtStart, maxConcurrentUploads, removeGracePeriodSeconds);
         ThrowIfNull(config, "createAddressBookConfig failed");
 
         return reinterpret_cast<long>(new aace::jni::core::config::EngineConfigurationBinder(config));
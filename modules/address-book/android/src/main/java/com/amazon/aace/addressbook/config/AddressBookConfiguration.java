@@ -30,26 +30,45 @@ public class AddressBookConfiguration {
      * @code{.json}
      * {
      *   "aace.addressBook" : {
-     *      "cleanAllAddressBooksAtStart" : <true/false>
+     *      "cleanAllAddressBooksAtStart" : <true/false>,
+     *      "maxConcurrentUploads" : <NUMBER_OF_BATCHES>,
+     *      "removeGracePeriodSeconds" : <SECONDS>
      *   }
      * }
      * @endcode
      *
      * @param [in] cleanAllAddressBooksAtStart indicates whether to clean all address books at start. The default value
      *         is @c true.
+     * @param [in] maxConcurrentUploads The number of batches of address book entries uploaded at the same time. The
+     *         default value is @c 2.
+     * @param [in] removeGracePeriodSeconds The time a removed address book is kept in Alexa, during which uploading
+     *         the same address book again uploads only its changes. The default value is @c 0, which deletes removed
+     *         address books right away.
      */
-    public static EngineConfiguration createAddressBookConfig(final boolean cleanAllAddressBooksAtStart) {
+    public static EngineConfiguration createAddressBookConfig(final boolean cleanAllAddressBooksAtStart,
+            final int maxConcurrentUploads, final int removeGracePeriodSeconds) {
         return new EngineConfiguration() {
             @Override
             protected long createNativeRef() {
-                return createAddressBookConfigBinder(cleanAllAddressBooksAtStart);
+                return createAddressBookConfigBinder(
+                        cleanAllAddressBooksAtStart, maxConcurrentUploads, removeGracePeriodSeconds);
             }
         };
     }
 
+    public static EngineConfiguration createAddressBookConfig(
+            final boolean cleanAllAddressBooksAtStart, final int maxConcurrentUploads) {
+        return createAddressBookConfig(cleanAllAddressBooksAtStart, maxConcurrentUploads, 0);
+    }
+
+    public static EngineConfiguration createAddressBookConfig(final boolean cleanAllAddressBooksAtStart) {
+        return createAddressBookConfig(cleanAllAddressBooksAtStart, 2);
+    }
+
     public static EngineConfiguration createAddressBookConfig() {
         return createAddressBookConfig(true);
     }
 
-    private static native long createAddressBookConfigBinder(boolean cleanAllAddressBooksAtStart);
+    private static native long createAddressBookConfigBinder(
+            boolean cleanAllAddressBooksAtStart, int maxConcurrentUploads, int removeGracePeriodSeconds);
 };
@@ -17,9 +17,12 @@
 #define AACE_ENGINE_ADDRESS_BOOK_ADDRESS_BOOK_CLOUD_UPLOADER_H
 
 #include <atomic>
+#include <chrono>
 #include <thread>
 #include <deque>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include <condition_variable>
 
 #include <AVSCommon/SDKInterfaces/AuthObserverInterface.h>
@@ -34,6 +37,8 @@
 #include "AddressBookObserver.h"
 #include "AddressBookServiceInterface.h"
 #include "AddressBookCloudUploaderRESTAgent.h"
+#include "AddressBookSyncStore.h"
+#include "AddressBookUploadPipeline.h"
 
 namespace aace {
 namespace engine {
@@ -108,9 +113,27 @@ private:
         NetworkInfoObserver::NetworkStatus networkStatus,
         std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
         std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
-        bool cleanAllAddressBooksAtStart);
+        bool cleanAllAddressBooksAtStart,
+        std::shared_ptr<AddressBookSyncStore> syncStore,
+        std::shared_ptr<AddressBookCloudUploaderRESTAgentInterface> restAgent,
+        int maxConcurrentUploads,
+        std::chrono::milliseconds removeGracePeriod);
 
 public:
+    /// The default number of batches of entries uploaded at the same time.
+    static constexpr int DEFAULT_MAX_CONCURRENT_UPLOADS = 2;
+
+    /**
+     * Creates the uploader.
+     *
+     * @param syncStore The record of the last upload of each address book, used to upload only the changes
+     *        of an address book which is uploaded again, or @c nullptr to always upload address books in full.
+     * @param restAgent The agent for the address books in the cloud, or @c nullptr to use the ACMS REST agent.
+     * @param maxConcurrentUploads The number of batches of entries uploaded at the same time. Entries are converted
+     *        to batches while the platform provides them, and at most this many batches wait for an upload.
+     * @param removeGracePeriod The time a removed address book is kept in the cloud, during which adding the same
+     *        address book again cancels its removal and uploads only its changes. Zero removes it right away.
+     */
     static std::shared_ptr<AddressBookCloudUploader> create(
         std::shared_ptr<aace::engine::addressBook::AddressBookServiceInterface> addressBookService,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
@@ -118,7 +141,11 @@ public:
         NetworkInfoObserver::NetworkStatus networkStatus,
         std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
         std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
-        bool cleanAllAddressBooksAtStart);
+        bool cleanAllAddressBooksAtStart,
+        std::shared_ptr<AddressBookSyncStore> syncStore = nullptr,
+        std::shared_ptr<AddressBookCloudUploaderRESTAgentInterface> restAgent = nullptr,
+        int maxConcurrentUploads = DEFAULT_MAX_CONCURRENT_UPLOADS,
+        std::chrono::milliseconds removeGracePeriod = std::chrono::milliseconds::zero());
 
     // AddressBookObserver
     bool addressBookAdded(std::shared_ptr<AddressBookEntity> addressBookEntity) override;
@@ -140,7 +167,55 @@ protected:
     void doShutdown() override;
 
 private:
-    using HTTPResponse = AddressBookCloudUploaderRESTAgent::HTTPResponse;
+    using HTTPResponse = AddressBookCloudUploaderRESTAgentInterface::HTTPResponse;
+
+    enum class UploadResult { SUCCESS, DROPPED, FULL_UPLOAD_REQUIRED };
+
+    /**
+     * The state of one upload of an address book, whose entries are uploaded while the platform provides them.
+     */
+    struct UploadState {
+        std::shared_ptr<AddressBookEntity> addressBookEntity;
+
+        /// The record of the last upload when only the changes are uploaded, or @c nullptr to upload in full.
+        const AddressBookSyncRecord* previousRecord = nullptr;
+
+        /// The id of the address book in the cloud, empty until a full upload has entries to upload.
+        std::string cloudAddressBookId;
+
+        /// The record of this upload.
+        AddressBookSyncRecord record;
+
+        int numberOfEntries = 0;
+
+        /// The changed entries which are not uploaded yet, or @c nullptr if there are none.
+        std::shared_ptr<rapidjson::Document> changedDocument;
+
+        /// The requests made and the entry bytes uploaded to upload the changes.
+        size_t deltaRequests = 0;
+        size_t deltaBytes = 0;
+
+        /// The cost of uploading the last address book in full, in bytes, which uploading the changes may not exceed.
+        size_t maxDeltaCost = 0;
+
+        /// Whether uploading the changes costs more than uploading the address book in full.
+        bool deltaAbandoned = false;
+
+        /// Serializes access to @c failedEntries, which the upload threads add to.
+        std::mutex failedEntriesMutex;
+        std::unordered_set<std::string> failedEntries;
+
+        /// Declared last so that its upload threads stop before the members above are destroyed.
+        std::shared_ptr<AddressBookUploadPipeline> pipeline;
+    };
+
+    /**
+     * The removal of an address book, which is deferred until its grace period is over.
+     */
+    struct PendingRemoval {
+        Event event;
+        std::chrono::steady_clock::time_point deadline;
+    };
 
     void eventLoop(bool cleanAllAddressBooksAtStart);  // Infinite loop
     const Event popNextEventFromQ();
@@ -150,14 +225,32 @@ private:
 
     bool checkAndAutoProvisionAccount();
     std::string prepareForUpload(std::shared_ptr<AddressBookEntity> addressBookEntity);
-    bool upload(const std::string& cloudAddressBookId, std::shared_ptr<rapidjson::Document>);
-    bool uploadEntries(const std::string& cloudAddressBookId, std::shared_ptr<rapidjson::Document> document);
+    std::string prepareForDeltaUpload(
+        std::shared_ptr<AddressBookEntity> addressBookEntity,
+        const AddressBookSyncRecord& previousRecord);
+    UploadResult streamUpload(
+        std::shared_ptr<AddressBookEntity> addressBookEntity,
+        const AddressBookSyncRecord* previousRecord,
+        const std::string& cloudAddressBookId);
+    bool handleBatch(UploadState& state, std::shared_ptr<rapidjson::Document> document);
+    bool finishDeltaUpload(UploadState& state);
+    bool spendDeltaCost(UploadState& state, size_t requests, size_t bytes);
+    bool upload(
+        const std::string& cloudAddressBookId,
+        std::shared_ptr<rapidjson::Document>,
+        std::unordered_set<std::string>& failedEntries);
+    bool uploadEntries(
+        const std::string& cloudAddressBookId,
+        std::shared_ptr<rapidjson::Document> document,
+        std::unordered_set<std::string>& failedEntries);
 
     std::string createAddressBook(std::shared_ptr<AddressBookEntity> addressBookEntity);
     bool deleteAddressBook(std::shared_ptr<AddressBookEntity> addressBookEntity);
 
     bool isEventEnqueuedLocked(Event::Type type, std::shared_ptr<AddressBookEntity> addressBookEntity);
     void removeMatchingAddEventFromQueueLocked(std::shared_ptr<AddressBookEntity> addressBookEntity);
+    bool cancelPendingRemovalLocked(std::shared_ptr<AddressBookEntity> addressBookEntity);
+    void enqueueDueRemovalsLocked();
 
     enum class UploadFlowState { POST, PARSE, ERROR, FINISH };
 
@@ -165,7 +258,9 @@ private:
         const std::string& addressBookId,
         std::shared_ptr<rapidjson::Document> document,
         HTTPResponse& httpResponse);
-    UploadFlowState handleParseHTTPResponse(const HTTPResponse& httpResponse);
+    UploadFlowState handleParseHTTPResponse(
+        const HTTPResponse& httpResponse,
+        std::unordered_set<std::string>& failedEntries);
     UploadFlowState handleError(const std::string& addressBookId);
 
     void logNetworkMetrics(const HTTPResponse& httpResponse);
@@ -173,7 +268,7 @@ private:
     friend std::ostream& operator<<(std::ostream& stream, const UploadFlowState& state);
 
 private:
-    /// Serialize access to member variables  m_authDelegate, m_networkStatus and m_addressBookEventQ
+    /// Serialize access to member variables  m_authDelegate, m_networkStatus, m_addressBookEventQ and m_pendingRemovals
     std::mutex m_mutex;
 
     /// reference to AddressBookService
@@ -191,8 +286,20 @@ private:
     /// Queue holding the address book events.
     std::deque<Event> m_addressBookEventQ;
 
+    /// The removals waiting for their grace period to be over, in the order they were requested.
+    std::deque<PendingRemoval> m_pendingRemovals;
+
+    /// The time a removed address book is kept in the cloud in case it is added again.
+    std::chrono::milliseconds m_removeGracePeriod;
+
     std::shared_ptr<aace::engine::network::NetworkObservableInterface> m_networkObserver;
-    std::shared_ptr<AddressBookCloudUploaderRESTAgent> m_addressBookCloudUploaderRESTAgent;
+    std::shared_ptr<AddressBookCloudUploaderRESTAgentInterface> m_addressBookCloudUploaderRESTAgent;
+
+    /// The record of the last upload of each address book, or @c nullptr to always upload address books in full.
+    std::shared_ptr<AddressBookSyncStore> m_syncStore;
+
+    /// The number of batches of entries uploaded at the same time.
+    int m_maxConcurrentUploads;
 
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> m_authDelegate;
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> m_deviceInfo;
@@ -32,12 +32,15 @@
 
 #include <AACE/Engine/Alexa/AlexaEndpointInterface.h>
 #include "AACE/Engine/Utils/JSON/JSON.h"
+#include "AddressBookCloudUploaderRESTAgentInterface.h"
 
 namespace aace {
 namespace engine {
 namespace addressBook {
 
-class AddressBookCloudUploaderRESTAgent : public alexaClientSDK::avsCommon::utils::RequiresShutdown {
+class AddressBookCloudUploaderRESTAgent
+        : public AddressBookCloudUploaderRESTAgentInterface
+        , public alexaClientSDK::avsCommon::utils::RequiresShutdown {
 private:
     AddressBookCloudUploaderRESTAgent(
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
@@ -46,8 +49,6 @@ private:
     bool initialize(std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
 
 public:
-    using HTTPResponse = alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse;
-
     static std::shared_ptr<AddressBookCloudUploaderRESTAgent> create(
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
         std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
@@ -55,27 +56,30 @@ public:
 
     virtual ~AddressBookCloudUploaderRESTAgent() = default;
 
-    bool isAccountProvisioned();
+    // AddressBookCloudUploaderRESTAgentInterface
+    bool isAccountProvisioned() override;
 
     std::string createAndGetCloudAddressBook(
         const std::string& addressBookSourceId,
-        const std::string& addressBookType);
+        const std::string& addressBookType) override;
     bool getCloudAddressBookId(
         const std::string& addressBookSourceId,
         const std::string& addressBookType,
-        std::string& cloudAddressBookId);
-    bool deleteCloudAddressBook(const std::string& cloudAddressBookId);
+        std::string& cloudAddressBookId) override;
+    bool deleteCloudAddressBook(const std::string& cloudAddressBookId) override;
+    bool deleteCloudAddressBookEntry(const std::string& cloudAddressBookId, const std::string& entrySourceId)
+        override;
 
     HTTPResponse uploadDocumentToCloud(
         std::shared_ptr<rapidjson::Document> document,
-        const std::string& cloudAddressBookId);
-    bool parseCreateAddressBookEntryResponse(const HTTPResponse& response, std::queue<std::string>& failedEntries);
+        const std::string& cloudAddressBookId) override;
+    bool parseCreateAddressBookEntryResponse(const HTTPResponse& response, std::queue<std::string>& failedEntries)
+        override;
     std::string buildFailedEntriesJson(std::queue<std::string>& failedContact);
 
     std::string getHTTPErrorString(const HTTPResponse& response);
 
-    /// Resets the internal ACMS REST attributes
-    void reset();
+    void reset() override;
 
 protected:
     // RequiresShutdown
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ADDRESS_BOOK_ADDRESSBOOK_CLOUD_UPLOADER_REST_AGENT_INTERFACE_H
+#define AACE_ENGINE_ADDRESS_BOOK_ADDRESSBOOK_CLOUD_UPLOADER_REST_AGENT_INTERFACE_H
+
+#include <memory>
+#include <queue>
+#include <string>
+
+#include <AVSCommon/Utils/LibcurlUtils/HTTPResponse.h>
+#include <rapidjson/document.h>
+
+namespace aace {
+namespace engine {
+namespace addressBook {
+
+/**
+ * The operations of @c AddressBookCloudUploader on the address books in the cloud.
+ */
+class AddressBookCloudUploaderRESTAgentInterface {
+public:
+    using HTTPResponse = alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse;
+
+    virtual ~AddressBookCloudUploaderRESTAgentInterface() = default;
+
+    virtual bool isAccountProvisioned() = 0;
+
+    virtual std::string createAndGetCloudAddressBook(
+        const std::string& addressBookSourceId,
+        const std::string& addressBookType) = 0;
+    virtual bool getCloudAddressBookId(
+        const std::string& addressBookSourceId,
+        const std::string& addressBookType,
+        std::string& cloudAddressBookId) = 0;
+    virtual bool deleteCloudAddressBook(const std::string& cloudAddressBookId) = 0;
+
+    /**
+     * Deletes an entry from an address book in the cloud.
+     *
+     * @param cloudAddressBookId The id of the address book in the cloud.
+     * @param entrySourceId The id of the entry, as provided by the platform.
+     * @return @c true if the entry was deleted.
+     */
+    virtual bool deleteCloudAddressBookEntry(
+        const std::string& cloudAddressBookId,
+        const std::string& entrySourceId) = 0;
+
+    virtual HTTPResponse uploadDocumentToCloud(
+        std::shared_ptr<rapidjson::Document> document,
+        const std::string& cloudAddressBookId) = 0;
+    virtual bool parseCreateAddressBookEntryResponse(
+        const HTTPResponse& response,
+        std::queue<std::string>& failedEntries) = 0;
+
+    /// Resets the internal ACMS REST attributes
+    virtual void reset() = 0;
+};
+
+}  // namespace addressBook
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ADDRESS_BOOK_ADDRESSBOOK_CLOUD_UPLOADER_REST_AGENT_INTERFACE_H
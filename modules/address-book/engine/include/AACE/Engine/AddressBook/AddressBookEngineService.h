@@ -31,7 +31,7 @@ public:
 
 protected:
     // EngineService
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) override;
     bool shutdown() override;
     AddressBookEngineService(const aace::engine::core::ServiceDescription& description);
 
@@ -54,6 +54,8 @@ private:
     std::shared_ptr<AddressBookEngineImpl> m_addressBookEngineImpl;
     std::shared_ptr<AddressBookCloudUploader> m_addressBookCloudUploader;
     bool m_cleanAllAddressBooksAtStart;
+    int m_maxConcurrentUploads;
+    std::chrono::seconds m_removeGracePeriod;
 };
 
 }  // namespace addressBook
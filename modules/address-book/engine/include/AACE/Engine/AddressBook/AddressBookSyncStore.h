@@ -0,0 +1,106 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ADDRESS_BOOK_ADDRESS_BOOK_SYNC_STORE_H
+#define AACE_ENGINE_ADDRESS_BOOK_ADDRESS_BOOK_SYNC_STORE_H
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <AACE/Engine/Storage/LocalStorageInterface.h>
+
+namespace aace {
+namespace engine {
+namespace addressBook {
+
+/**
+ * The contents of an address book in the cloud, as of its last upload.
+ */
+struct AddressBookSyncRecord {
+    /// The id of the address book provided by the platform.
+    std::string addressBookSourceId;
+
+    /// The id of the address book in the cloud.
+    std::string cloudAddressBookId;
+
+    /// The time until which the address book can be updated with its changes, after which it is uploaded in full.
+    std::chrono::system_clock::time_point validUntil;
+
+    /// The content hash of each uploaded entry, by entry id.
+    std::unordered_map<std::string, std::string> entryHashes;
+
+    /// The size of the uploaded entries, in bytes.
+    size_t uploadedBytes = 0;
+};
+
+/**
+ * Persists an @c AddressBookSyncRecord for each address book type, so that an address book which is
+ * uploaded again only needs its changes to be uploaded. Records written with a different schema version
+ * are discarded. All functions are thread safe.
+ */
+class AddressBookSyncStore {
+private:
+    AddressBookSyncStore(std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage);
+
+public:
+    /**
+     * Creates a store.
+     *
+     * @param localStorage The storage to persist records in, or @c nullptr to keep them in memory only.
+     */
+    static std::shared_ptr<AddressBookSyncStore> create(
+        std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage);
+
+    /**
+     * Returns the record of an address book type.
+     *
+     * @param addressBookType The type of the address book in the cloud.
+     * @param [out] record The record.
+     * @return @c true if a record of the current schema version is available.
+     */
+    bool load(const std::string& addressBookType, AddressBookSyncRecord& record);
+
+    /**
+     * Stores the record of an address book type, replacing the previous one.
+     */
+    bool store(const std::string& addressBookType, const AddressBookSyncRecord& record);
+
+    /**
+     * Removes the record of an address book type, so that it is uploaded in full next time.
+     */
+    void remove(const std::string& addressBookType);
+
+    /**
+     * Returns the content hash of a serialized address book entry.
+     */
+    static std::string hashEntry(const std::string& entry);
+
+private:
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> m_localStorage;
+
+    std::mutex m_mutex;
+
+    /// Serialized records, used when there is no local storage.
+    std::unordered_map<std::string, std::string> m_records;
+};
+
+}  // namespace addressBook
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ADDRESS_BOOK_ADDRESS_BOOK_SYNC_STORE_H
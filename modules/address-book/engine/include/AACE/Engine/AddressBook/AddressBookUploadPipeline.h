@@ -0,0 +1,108 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ADDRESS_BOOK_ADDRESS_BOOK_UPLOAD_PIPELINE_H
+#define AACE_ENGINE_ADDRESS_BOOK_ADDRESS_BOOK_UPLOAD_PIPELINE_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <rapidjson/document.h>
+
+namespace aace {
+namespace engine {
+namespace addressBook {
+
+/**
+ * Uploads batches of address book entries while more batches are being built. A fixed number of uploads
+ * are in flight, and at most as many batches wait for an upload, so the memory used by the batches of an
+ * address book does not depend on its size. The upload stops at the first batch which fails to upload.
+ */
+class AddressBookUploadPipeline {
+public:
+    /// Uploads a batch, returning @c true on success. Called concurrently from the upload threads.
+    using UploadFunction = std::function<bool(std::shared_ptr<rapidjson::Document> batch)>;
+
+    /**
+     * Creates a pipeline and starts its upload threads.
+     *
+     * @param upload The function uploading a batch.
+     * @param maxConcurrentUploads The number of batches uploaded at the same time, at least 1.
+     */
+    static std::shared_ptr<AddressBookUploadPipeline> create(UploadFunction upload, int maxConcurrentUploads);
+
+    /**
+     * Stops the upload threads, dropping the batches which are not uploaded yet.
+     */
+    ~AddressBookUploadPipeline();
+
+    /**
+     * Queues a batch for upload, waiting while the queue is full.
+     *
+     * @return @c false if a batch failed to upload, in which case the batch is dropped.
+     */
+    bool submit(std::shared_ptr<rapidjson::Document> batch);
+
+    /**
+     * Waits until all the queued batches are uploaded and stops the upload threads.
+     *
+     * @return @c true if all the batches were uploaded.
+     */
+    bool finish();
+
+    /**
+     * Returns the number of batches queued for upload.
+     */
+    int getSubmittedBatches();
+
+private:
+    AddressBookUploadPipeline(UploadFunction upload, int maxConcurrentUploads);
+
+    void uploadLoop();
+    void stop();
+
+    UploadFunction m_upload;
+
+    /// The maximum number of batches waiting for an upload.
+    size_t m_maxQueuedBatches;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Notified when a batch is queued or the pipeline stops.
+    std::condition_variable m_batchQueued;
+
+    /// Notified when a batch is taken from the queue or finishes uploading.
+    std::condition_variable m_batchTaken;
+
+    std::deque<std::shared_ptr<rapidjson::Document>> m_queue;
+    int m_uploadsInFlight;
+    int m_submittedBatches;
+    bool m_failed;
+    bool m_stopping;
+
+    std::vector<std::thread> m_threads;
+};
+
+}  // namespace addressBook
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ADDRESS_BOOK_ADDRESS_BOOK_UPLOAD_PIPELINE_H
@@ -16,6 +16,7 @@
 // JSON for Modern C++
 #include <nlohmann/json.hpp>
 
+#include <functional>
 #include <typeinfo>
 #include <rapidjson/error/en.h>
 #include <rapidjson/pointer.h>
@@ -43,6 +44,13 @@ static const std::string TAG("aace.addressBook.addressBookCloudUploader");
 /// Upload entries batch size
 static const int UPLOAD_BATCH_SIZE = 100;
 
+/// The time an address book is updated with its changes after it was uploaded in full. The cloud removes address
+/// books after 30 days, so they are uploaded in full again before then.
+static const std::chrono::hours MAX_DELTA_UPLOAD_PERIOD = std::chrono::hours(29 * 24);
+
+/// The bytes each request costs besides its payload, for its headers, including the access token, and its response.
+static const size_t REQUEST_OVERHEAD_BYTES = 2048;
+
 /// Max allowed phone numbers per entry
 static const int MAX_ALLOWED_ADDRESSES_PER_ENTRY = 30;
 
@@ -85,6 +93,12 @@ static const std::string METRIC_TIME_TO_UPLOAD_SINCE_REMOVE = "Latency.Remove";
 /// Latency metric uploading a one batch of entries to cloud (average time)
 static const std::string METRIC_TIME_TO_UPLOAD_ONE_BATCH = "Network.BatchUploadLatency";
 
+/// Count metric for uploading an address book in full
+static const std::string METRIC_UPLOAD_FULL = "Upload.Full";
+
+/// Count metric for uploading only the changes of an address book
+static const std::string METRIC_UPLOAD_DELTA = "Upload.Delta";
+
 /// Metric for Bad User Input network response
 static const std::string METRIC_NETWORK_BAD_USER_INPUT = "Network.BadUserInput";
 
@@ -96,8 +110,24 @@ static const std::string ADDRESS_BOOK_SERVICE_TYPE_AVS = "AVS";
 
 using json = nlohmann::json;
 
+constexpr int AddressBookCloudUploader::DEFAULT_MAX_CONCURRENT_UPLOADS;
+
+/// Returns the number of batches to upload a number of entries.
+static size_t batches(size_t entries) {
+    return (entries + UPLOAD_BATCH_SIZE - 1) / UPLOAD_BATCH_SIZE;
+}
+
+/// Returns the bytes a number of requests with a payload of a number of bytes cost.
+static size_t uploadCost(size_t requests, size_t bytes) {
+    return requests * REQUEST_OVERHEAD_BYTES + bytes;
+}
+
 AddressBookCloudUploader::AddressBookCloudUploader() :
-        alexaClientSDK::avsCommon::utils::RequiresShutdown(TAG), m_isShuttingDown(false), m_isAuthRefreshed(false) {
+        alexaClientSDK::avsCommon::utils::RequiresShutdown(TAG),
+        m_isShuttingDown(false),
+        m_removeGracePeriod(std::chrono::milliseconds::zero()),
+        m_maxConcurrentUploads(DEFAULT_MAX_CONCURRENT_UPLOADS),
+        m_isAuthRefreshed(false) {
 }
 
 std::shared_ptr<AddressBookCloudUploader> AddressBookCloudUploader::create(
@@ -107,7 +137,11 @@ std::shared_ptr<AddressBookCloudUploader> AddressBookCloudUploader::create(
     NetworkInfoObserver::NetworkStatus networkStatus,
     std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
     std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
-    bool cleanAllAddressBooksAtStart) {
+    bool cleanAllAddressBooksAtStart,
+    std::shared_ptr<AddressBookSyncStore> syncStore,
+    std::shared_ptr<AddressBookCloudUploaderRESTAgentInterface> restAgent,
+    int maxConcurrentUploads,
+    std::chrono::milliseconds removeGracePeriod) {
     try {
         auto addressBookCloudUploader = std::shared_ptr<AddressBookCloudUploader>(new AddressBookCloudUploader());
         ThrowIfNot(
@@ -118,7 +152,11 @@ std::shared_ptr<AddressBookCloudUploader> AddressBookCloudUploader::create(
                 networkStatus,
                 networkObserver,
                 alexaEndpoints,
-                cleanAllAddressBooksAtStart),
+                cleanAllAddressBooksAtStart,
+                syncStore,
+                restAgent,
+                maxConcurrentUploads,
+                removeGracePeriod),
             "initializeAddressBookCloudUploaderFailed");
 
         return addressBookCloudUploader;
@@ -135,16 +173,28 @@ bool AddressBookCloudUploader::initialize(
     NetworkInfoObserver::NetworkStatus networkStatus,
     std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
     std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
-    bool cleanAllAddressBooksAtStart) {
+    bool cleanAllAddressBooksAtStart,
+    std::shared_ptr<AddressBookSyncStore> syncStore,
+    std::shared_ptr<AddressBookCloudUploaderRESTAgentInterface> restAgent,
+    int maxConcurrentUploads,
+    std::chrono::milliseconds removeGracePeriod) {
     try {
+        ThrowIf(maxConcurrentUploads < 1, "invalidMaxConcurrentUploads");
+        ThrowIf(removeGracePeriod < std::chrono::milliseconds::zero(), "invalidRemoveGracePeriod");
+        m_maxConcurrentUploads = maxConcurrentUploads;
+        m_removeGracePeriod = removeGracePeriod;
         m_addressBookService = addressBookService;
         m_authDelegate = authDelegate;
         m_deviceInfo = deviceInfo;
         m_networkStatus = networkStatus;
         m_networkObserver = networkObserver;
 
-        m_addressBookCloudUploaderRESTAgent = aace::engine::addressBook::AddressBookCloudUploaderRESTAgent::create(
-            authDelegate, m_deviceInfo, alexaEndpoints);
+        m_syncStore = syncStore;
+        m_addressBookCloudUploaderRESTAgent = restAgent;
+        if (m_addressBookCloudUploaderRESTAgent == nullptr) {
+            m_addressBookCloudUploaderRESTAgent = aace::engine::addressBook::AddressBookCloudUploaderRESTAgent::create(
+                authDelegate, m_deviceInfo, alexaEndpoints);
+        }
         ThrowIfNull(m_addressBookCloudUploaderRESTAgent, "createAddressBookCloudRESTAgentFailed");
 
         m_authDelegate->addAuthObserver(shared_from_this());
@@ -169,7 +219,11 @@ void AddressBookCloudUploader::doShutdown() {
     m_isShuttingDown = true;
     m_waitForEvent.notify_all();
 
-    m_addressBookCloudUploaderRESTAgent->shutdown();
+    auto requiresShutdown = std::dynamic_pointer_cast<alexaClientSDK::avsCommon::utils::RequiresShutdown>(
+        m_addressBookCloudUploaderRESTAgent);
+    if (requiresShutdown != nullptr) {
+        requiresShutdown->shutdown();
+    }
 
     if (m_eventThread.joinable()) {
         m_eventThread.join();
@@ -195,6 +249,7 @@ void AddressBookCloudUploader::onAuthStateChange(
         case AuthObserverInterface::State::UNINITIALIZED:
         case AuthObserverInterface::State::UNRECOVERABLE_ERROR:
             m_addressBookEventQ.clear();
+            m_pendingRemovals.clear();
             m_addressBookCloudUploaderRESTAgent->reset();
             break;
         case AuthObserverInterface::State::REFRESHED:
@@ -237,6 +292,11 @@ bool AddressBookCloudUploader::addressBookAdded(std::shared_ptr<AddressBookEntit
         }
 
         std::lock_guard<std::mutex> guard(m_mutex);
+        if (cancelPendingRemovalLocked(addressBookEntity)) {
+            AACE_INFO(LX(TAG, "addressBookAdded")
+                          .m("cancelledPendingRemoval")
+                          .d("addressBookSourceId", addressBookSourceId));
+        }
         m_addressBookEventQ.emplace_back(Event::Type::ADD, addressBookEntity);
 
         m_waitForEvent.notify_all();
@@ -269,11 +329,19 @@ bool AddressBookCloudUploader::addressBookRemoved(std::shared_ptr<AddressBookEnt
                               .m("removingCorrespondingAddEvent")
                               .d("addressBookSourceId", addressBookSourceId));
                 removeMatchingAddEventFromQueueLocked(addressBookEntity);
-                return true;
+                // With a grace period the add may have cancelled a removal, so the cloud may still have it
+                ReturnIf(m_removeGracePeriod == std::chrono::milliseconds::zero(), true);
             }
         }
 
-        m_addressBookEventQ.emplace_back(Event::Type::REMOVE, addressBookEntity);
+        if (m_removeGracePeriod > std::chrono::milliseconds::zero()) {
+            // The address book stays in the cloud for a while, so that it is updated if it is added again soon
+            m_pendingRemovals.push_back(
+                {Event(Event::Type::REMOVE, addressBookEntity),
+                 std::chrono::steady_clock::now() + m_removeGracePeriod});
+        } else {
+            m_addressBookEventQ.emplace_back(Event::Type::REMOVE, addressBookEntity);
+        }
 
         m_waitForEvent.notify_all();
 
@@ -309,80 +377,114 @@ void AddressBookCloudUploader::removeMatchingAddEventFromQueueLocked(
     }
 }
 
+bool AddressBookCloudUploader::cancelPendingRemovalLocked(std::shared_ptr<AddressBookEntity> addressBookEntity) {
+    bool cancelled = false;
+    for (auto it = m_pendingRemovals.begin(); it != m_pendingRemovals.end();) {
+        auto removedAddressBookEntity = it->event.getAddressBookEntity();
+        if (removedAddressBookEntity->getType() != addressBookEntity->getType()) {
+            it++;
+            continue;
+        }
+        if (removedAddressBookEntity->getSourceId() == addressBookEntity->getSourceId()) {
+            cancelled = true;
+        } else {
+            // A different address book replaces the removed one in the cloud, so the removal happens before it
+            m_addressBookEventQ.push_back(it->event);
+        }
+        it = m_pendingRemovals.erase(it);
+    }
+    return cancelled;
+}
+
+void AddressBookCloudUploader::enqueueDueRemovalsLocked() {
+    auto now = std::chrono::steady_clock::now();
+    while (!m_pendingRemovals.empty() && m_pendingRemovals.front().deadline <= now) {
+        m_addressBookEventQ.push_back(m_pendingRemovals.front().event);
+        m_pendingRemovals.pop_front();
+    }
+}
+
 class AddressBookEntriesFactory : public aace::addressBook::AddressBook::IAddressBookEntriesFactory {
 public:
-    AddressBookEntriesFactory(
-        std::shared_ptr<AddressBookEntity> addressBookEntity,
-        std::vector<std::shared_ptr<rapidjson::Document>>& documents) :
-            m_addressBookEntity(std::move(addressBookEntity)), m_documents(documents) {
+    /// Takes a complete batch of entries, returning @c false if the batch cannot be uploaded.
+    using BatchHandler = std::function<bool(std::shared_ptr<rapidjson::Document> document)>;
+
+    AddressBookEntriesFactory(std::shared_ptr<AddressBookEntity> addressBookEntity, BatchHandler batchHandler) :
+            m_addressBookEntity(std::move(addressBookEntity)), m_batchHandler(std::move(batchHandler)) {
+    }
+
+    /**
+     * Hands over the last batch of entries, after the platform provided all of them.
+     *
+     * @return @c false if a batch could not be uploaded.
+     */
+    bool finish() {
+        return flush();
     }
 
 private:
     bool isEntryPresent(const std::string& entryId) {
-        auto it = m_ids.find(entryId);
-        if (it == m_ids.end()) {
-            return false;
+        return m_ids.find(entryId) != m_ids.end() || m_handedOverIds.find(entryId) != m_handedOverIds.end();
+    }
+
+    // Entries are kept in the current batch only, so the batch is handed over once it is full and an entry which
+    // does not fit in it is created. An entry can not be changed after its batch was handed over.
+    bool flush() {
+        if (m_document == nullptr) {
+            return !m_failed;
         }
-        return true;
+        for (const auto& id : m_ids) {
+            m_handedOverIds.insert(id.first);
+        }
+        m_ids.clear();
+
+        auto document = std::move(m_document);
+        m_document.reset();
+        if (!m_failed && !m_batchHandler(document)) {
+            m_failed = true;
+        }
+        return !m_failed;
     }
 
     void createEntryDataField(const std::string& entryId) {
         auto it = m_ids.find(entryId);
         if (it == m_ids.end()) {
-            // For "m_ids[id] = m_ids.size();" on Ubuntu platform, [] seems to increment the m_ids
-            // size before assignment that causes incorrect indexes for later usage.
-            auto index = m_ids.size();
-            m_ids[entryId] = index;
-
-            auto bucketIndex = m_ids[entryId] / UPLOAD_BATCH_SIZE;
-            auto entriesIndex = m_ids[entryId] % UPLOAD_BATCH_SIZE;
-
-            // Check if bucket mapping to bucketIndex is new bucket to be created.
-            if (bucketIndex + 1 > (m_documents.size())) {
-                auto document = std::make_shared<rapidjson::Document>();
-                document->SetObject();
-
-                m_documents.push_back(document);
-                auto& allocator = document->GetAllocator();
+            ThrowIf(m_failed, "uploadFailed");
+            if (m_ids.size() >= static_cast<size_t>(UPLOAD_BATCH_SIZE)) {
+                ThrowIfNot(flush(), "uploadFailed");
+            }
 
+            if (m_document == nullptr) {
+                m_document = std::make_shared<rapidjson::Document>();
+                m_document->SetObject();
                 rapidjson::Value entries(rapidjson::kArrayType);
-
-                document->AddMember("entries", entries, allocator);
+                m_document->AddMember("entries", entries, m_document->GetAllocator());
             }
 
-            auto& document = *m_documents[bucketIndex];
-            auto& allocator = document.GetAllocator();
-
-            auto& entries = document["entries"];
-
-            if (entriesIndex + 1 > entries.Size()) {
-                rapidjson::Value entry(rapidjson::kObjectType);
-
-                entry.AddMember("entrySourceId", entryId, allocator);
-                rapidjson::Value data(rapidjson::kObjectType);
+            // For "m_ids[id] = m_ids.size();" on Ubuntu platform, [] seems to increment the m_ids
+            // size before assignment that causes incorrect indexes for later usage.
+            auto index = m_ids.size();
+            m_ids[entryId] = index;
 
-                entry.AddMember("data", data, allocator);
+            auto& allocator = m_document->GetAllocator();
+            rapidjson::Value entry(rapidjson::kObjectType);
+            entry.AddMember("entrySourceId", entryId, allocator);
+            rapidjson::Value data(rapidjson::kObjectType);
+            entry.AddMember("data", data, allocator);
 
-                entries.PushBack(entry, allocator);
-            }
+            (*m_document)["entries"].PushBack(entry, allocator);
         }
     }
 
     rapidjson::Value& getEntryDataNode(const std::string& entryId) {
-        auto bucketIndex = m_ids[entryId] / UPLOAD_BATCH_SIZE;
-        auto entriesIndex = m_ids[entryId] % UPLOAD_BATCH_SIZE;
-
-        auto& document = *m_documents[bucketIndex];
-        auto& entries = document["entries"];
+        auto it = m_ids.find(entryId);
+        ThrowIf(it == m_ids.end(), "entryAlreadyUploaded");
 
-        return entries[entriesIndex]["data"];
+        return (*m_document)["entries"][it->second]["data"];
     }
 
     rapidjson::Document::AllocatorType& GetAllocator(const std::string& entryId) {
-        auto bucketIndex = m_ids[entryId] / UPLOAD_BATCH_SIZE;
-        auto& document = *m_documents[bucketIndex];
-
-        return document.GetAllocator();
+        return m_document->GetAllocator();
     }
 
 public:
@@ -867,8 +969,19 @@ public:
 
 private:
     std::shared_ptr<AddressBookEntity> m_addressBookEntity;
-    std::vector<std::shared_ptr<rapidjson::Document>>& m_documents;
+    BatchHandler m_batchHandler;
+
+    /// The batch being built, or @c nullptr before its first entry.
+    std::shared_ptr<rapidjson::Document> m_document;
+
+    /// The index of each entry of the batch being built.
     std::unordered_map<std::string, rapidjson::SizeType> m_ids;
+
+    /// The ids of the entries of the batches handed over.
+    std::unordered_set<std::string> m_handedOverIds;
+
+    /// Whether a batch could not be uploaded, after which entries are rejected.
+    bool m_failed = false;
 };
 
 bool AddressBookCloudUploader::handleUpload(std::shared_ptr<AddressBookEntity> addressBookEntity) {
@@ -876,67 +989,281 @@ bool AddressBookCloudUploader::handleUpload(std::shared_ptr<AddressBookEntity> a
     try {
         addressBookSourceId = addressBookEntity->getSourceId();
 
-        std::vector<std::shared_ptr<rapidjson::Document>> documents;
-        auto factory = std::make_shared<AddressBookEntriesFactory>(addressBookEntity, documents);
+        // Upload only the changes if the address book in the cloud is the one uploaded last time
+        AddressBookSyncRecord previousRecord;
+        if (m_syncStore != nullptr && m_syncStore->load(addressBookEntity->toJSONAddressBookType(), previousRecord)) {
+            auto cloudAddressBookId = prepareForDeltaUpload(addressBookEntity, previousRecord);
+            if (!cloudAddressBookId.empty() &&
+                streamUpload(addressBookEntity, &previousRecord, cloudAddressBookId) !=
+                    UploadResult::FULL_UPLOAD_REQUIRED) {
+                return true;
+            }
+        }
 
-        AACE_INFO(LX(TAG, "handleUpload").m("GettingAddressBookEntries").d("addressBookSourceId", addressBookSourceId));
+        // A full upload never requires another one, and a dropped address book is not retried
+        streamUpload(addressBookEntity, nullptr, std::string());
 
-        if (!m_addressBookService->getEntries(addressBookSourceId, factory)) {
-            // getEntries can return false, it probably means OEM was not successful in providing all the entries.
-            // The common reason could be the address book may have become unavailable or not accessible, so do not retry.
-            AACE_WARN(
-                LX(TAG, "handleUpload").d("addressBookSourceId", addressBookSourceId).d("reason", "getEntriesFailed"));
-            // Return true to drop this address book from retry.
-            return true;
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "handleUpload").d("addressBookSourceId", addressBookSourceId).d("reason", ex.what()));
+        if (m_syncStore != nullptr) {
+            // The contents of the address book in the cloud are unknown
+            m_syncStore->remove(addressBookEntity->toJSONAddressBookType());
         }
+        return false;
+    }
+}
 
-        if (documents.size() <= 0) {
-            // Its the empty document.
-            AACE_WARN(LX(TAG, "handleUpload")
-                          .d("addressBookSourceId", addressBookSourceId)
-                          .d("reason", "emptyDocumentToUpload"));
-            // Return true to drop this address book from retry.
-            return true;
-        }
+AddressBookCloudUploader::UploadResult AddressBookCloudUploader::streamUpload(
+    std::shared_ptr<AddressBookEntity> addressBookEntity,
+    const AddressBookSyncRecord* previousRecord,
+    const std::string& cloudAddressBookId) {
+    auto addressBookSourceId = addressBookEntity->getSourceId();
+
+    UploadState state;
+    state.addressBookEntity = addressBookEntity;
+    state.previousRecord = previousRecord;
+    state.cloudAddressBookId = cloudAddressBookId;
+    state.record.addressBookSourceId = addressBookSourceId;
+    if (previousRecord != nullptr) {
+        // Uploading the changes should not cost more than uploading the last address book in full
+        state.maxDeltaCost = uploadCost(2 + batches(previousRecord->entryHashes.size()), previousRecord->uploadedBytes);
+        state.record.validUntil = previousRecord->validUntil;
+    } else if (m_syncStore != nullptr) {
+        m_syncStore->remove(addressBookEntity->toJSONAddressBookType());
+    }
 
-        int numberOfEntries = 0;
-        for (auto document : documents) {
-            auto entries = document->FindMember("entries");
-            if (entries != document->MemberEnd()) {
-                numberOfEntries += entries->value.Size();
-            }
+    state.pipeline = AddressBookUploadPipeline::create(
+        [this, &state](std::shared_ptr<rapidjson::Document> document) {
+            std::unordered_set<std::string> failedEntries;
+            bool success = upload(state.cloudAddressBookId, document, failedEntries);
+            std::lock_guard<std::mutex> lock(state.failedEntriesMutex);
+            state.failedEntries.insert(failedEntries.begin(), failedEntries.end());
+            return success;
+        },
+        m_maxConcurrentUploads);
+    ThrowIfNull(state.pipeline, "createUploadPipelineFailed");
+
+    // Entries are converted to batches and uploaded while the platform provides them
+    auto factory = std::make_shared<AddressBookEntriesFactory>(
+        addressBookEntity,
+        [this, &state](std::shared_ptr<rapidjson::Document> document) { return handleBatch(state, document); });
+
+    AACE_INFO(LX(TAG, "streamUpload")
+                  .m("GettingAddressBookEntries")
+                  .d("addressBookSourceId", addressBookSourceId)
+                  .d("delta", previousRecord != nullptr));
+
+    double uploadStartTimer = getCurrentTimeInMs();
+
+    // getEntries can return false, it probably means OEM was not successful in providing all the entries.
+    // The common reason could be the address book may have become unavailable or not accessible, so do not retry.
+    bool entriesProvided = m_addressBookService->getEntries(addressBookSourceId, factory);
+
+    bool success = factory->finish();
+    if (success && entriesProvided && previousRecord != nullptr && !state.deltaAbandoned) {
+        success = finishDeltaUpload(state);
+    }
+    success = state.pipeline->finish() && success;
+
+    if (!success) {
+        if (!state.cloudAddressBookId.empty()) {
+            handleError(state.cloudAddressBookId);
         }
+        Throw("uploadDocumentFailed");
+    }
 
-        //Preparing for the upload
-        auto cloudAddressBookId = prepareForUpload(addressBookEntity);
-        ThrowIf(cloudAddressBookId.empty(), "prepareUploadFailed");
+    if (!entriesProvided) {
+        AACE_WARN(
+            LX(TAG, "streamUpload").d("addressBookSourceId", addressBookSourceId).d("reason", "getEntriesFailed"));
+        if (previousRecord == nullptr && !state.cloudAddressBookId.empty()) {
+            // Remove the partially uploaded address book
+            handleError(state.cloudAddressBookId);
+        } else if (state.deltaRequests > 0 && m_syncStore != nullptr) {
+            m_syncStore->remove(addressBookEntity->toJSONAddressBookType());
+        }
+        return UploadResult::DROPPED;
+    }
 
-        double uploadStartTimer = getCurrentTimeInMs();
+    if (state.deltaAbandoned) {
+        return UploadResult::FULL_UPLOAD_REQUIRED;
+    }
 
-        //Upload json document in a loop.
-        for (auto document : documents) {
-            ThrowIfNot(upload(cloudAddressBookId, document), "uploadDocumentFailed");
+    if (state.numberOfEntries == 0) {
+        // Its the empty document.
+        AACE_WARN(LX(TAG, "streamUpload")
+                      .d("addressBookSourceId", addressBookSourceId)
+                      .d("reason", "emptyDocumentToUpload"));
+        if (previousRecord != nullptr && m_syncStore != nullptr) {
+            // The previous entries were deleted from the cloud, so none of them is unchanged next time
+            state.record.cloudAddressBookId = state.cloudAddressBookId;
+            m_syncStore->store(addressBookEntity->toJSONAddressBookType(), state.record);
         }
+        return UploadResult::DROPPED;
+    }
+
+    emitCounterMetrics(
+        METRIC_PROGRAM_NAME_SUFFIX,
+        "streamUpload",
+        previousRecord != nullptr ? METRIC_UPLOAD_DELTA : METRIC_UPLOAD_FULL,
+        1);
 
-        // It is assumed that between contacts and navigation addresses the difference is payload that should not
-        // influence the latency for uploading one batch of address book entries.
+    // It is assumed that between contacts and navigation addresses the difference is payload that should not
+    // influence the latency for uploading one batch of address book entries.
+    auto submittedBatches = state.pipeline->getSubmittedBatches();
+    if (submittedBatches > 0) {
         double totalDuration = getCurrentTimeInMs() - uploadStartTimer;
-        double timeToUploadOneBatch = totalDuration / documents.size();
+        double timeToUploadOneBatch = totalDuration / submittedBatches;
         emitTimerMetrics(
-            METRIC_PROGRAM_NAME_SUFFIX, "handleUpload", METRIC_TIME_TO_UPLOAD_ONE_BATCH, timeToUploadOneBatch);
+            METRIC_PROGRAM_NAME_SUFFIX, "streamUpload", METRIC_TIME_TO_UPLOAD_ONE_BATCH, timeToUploadOneBatch);
+    }
 
-        AACE_INFO(LX(TAG, "handleUpload")
-                      .m("SuccessfullyUploaded")
-                      .d("addressBookSourceId", addressBookSourceId)
-                      .d("numberOfEntries", numberOfEntries));
+    if (m_syncStore != nullptr) {
+        // Entries which failed to upload are uploaded again next time
+        for (const auto& entryId : state.failedEntries) {
+            state.record.entryHashes.erase(entryId);
+        }
+        state.record.cloudAddressBookId = state.cloudAddressBookId;
+        m_syncStore->store(addressBookEntity->toJSONAddressBookType(), state.record);
+    }
+
+    AACE_INFO(LX(TAG, "streamUpload")
+                  .m("SuccessfullyUploaded")
+                  .d("addressBookSourceId", addressBookSourceId)
+                  .d("numberOfEntries", state.numberOfEntries)
+                  .d("uploadedBatches", submittedBatches));
+
+    return UploadResult::SUCCESS;
+}
+
+bool AddressBookCloudUploader::handleBatch(UploadState& state, std::shared_ptr<rapidjson::Document> document) {
+    try {
+        // The remaining entries are not needed once the address book is going to be uploaded in full
+        ReturnIf(state.deltaAbandoned, true);
+
+        auto& entries = (*document)["entries"];
+        state.numberOfEntries += entries.Size();
+
+        // Without a sync store the address book is always uploaded in full, and its entries are not recorded
+        for (auto entry = entries.Begin(); m_syncStore != nullptr && entry != entries.End(); entry++) {
+            std::string entryId = (*entry)["entrySourceId"].GetString();
+            rapidjson::StringBuffer buffer;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            entry->Accept(writer);
+            auto hash = AddressBookSyncStore::hashEntry(buffer.GetString());
+            state.record.entryHashes[entryId] = hash;
+            state.record.uploadedBytes += buffer.GetSize();
+
+            if (state.previousRecord == nullptr) {
+                continue;
+            }
+            auto previousEntry = state.previousRecord->entryHashes.find(entryId);
+            if (previousEntry != state.previousRecord->entryHashes.end() && previousEntry->second == hash) {
+                continue;
+            }
+
+            // Modified entries are deleted and uploaded again
+            if (previousEntry != state.previousRecord->entryHashes.end()) {
+                ReturnIfNot(spendDeltaCost(state, 1, 0), true);
+                ThrowIfNot(
+                    m_addressBookCloudUploaderRESTAgent->deleteCloudAddressBookEntry(state.cloudAddressBookId, entryId),
+                    "deleteCloudAddressBookEntryFailed");
+            }
+
+            if (state.changedDocument == nullptr) {
+                state.changedDocument = std::make_shared<rapidjson::Document>();
+                state.changedDocument->SetObject();
+                state.changedDocument->AddMember(
+                    "entries", rapidjson::Value(rapidjson::kArrayType), state.changedDocument->GetAllocator());
+            }
+            ReturnIfNot(spendDeltaCost(state, 0, buffer.GetSize()), true);
+            auto& allocator = state.changedDocument->GetAllocator();
+            auto& changedEntries = (*state.changedDocument)["entries"];
+            changedEntries.PushBack(rapidjson::Value(*entry, allocator), allocator);
+
+            if (changedEntries.Size() == static_cast<rapidjson::SizeType>(UPLOAD_BATCH_SIZE)) {
+                ReturnIfNot(spendDeltaCost(state, 1, 0), true);
+                ThrowIfNot(state.pipeline->submit(std::move(state.changedDocument)), "submitBatchFailed");
+            }
+        }
+
+        if (state.previousRecord == nullptr) {
+            if (state.cloudAddressBookId.empty()) {
+                // The address book in the cloud is replaced once there are entries to upload
+                state.cloudAddressBookId = prepareForUpload(state.addressBookEntity);
+                ThrowIf(state.cloudAddressBookId.empty(), "prepareUploadFailed");
+                state.record.validUntil = std::chrono::system_clock::now() + MAX_DELTA_UPLOAD_PERIOD;
+            }
+            ThrowIfNot(state.pipeline->submit(document), "submitBatchFailed");
+        }
 
         return true;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "handleUpload").d("addressBookSourceId", addressBookSourceId).d("reason", ex.what()));
+        AACE_ERROR(LX(TAG, "handleBatch").d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool AddressBookCloudUploader::finishDeltaUpload(UploadState& state) {
+    try {
+        std::vector<std::string> removedEntries;
+        for (const auto& previousEntry : state.previousRecord->entryHashes) {
+            if (state.record.entryHashes.find(previousEntry.first) == state.record.entryHashes.end()) {
+                removedEntries.push_back(previousEntry.first);
+            }
+        }
+
+        // Entries are deleted one request at a time, so a full upload of a small address book may cost less
+        size_t pendingBatches = state.changedDocument != nullptr ? 1 : 0;
+        auto deltaUploadRequests = state.deltaRequests + pendingBatches + removedEntries.size();
+        auto deltaUploadCost = uploadCost(deltaUploadRequests, state.deltaBytes);
+        auto fullUploadCost = uploadCost(2 + batches(state.record.entryHashes.size()), state.record.uploadedBytes);
+        AACE_INFO(LX(TAG, "finishDeltaUpload")
+                      .d("addressBookSourceId", state.record.addressBookSourceId)
+                      .d("removedEntries", removedEntries.size())
+                      .d("deltaUploadRequests", deltaUploadRequests)
+                      .d("deltaUploadCost", deltaUploadCost)
+                      .d("fullUploadCost", fullUploadCost));
+        if (deltaUploadCost > fullUploadCost) {
+            state.deltaAbandoned = true;
+            state.changedDocument.reset();
+            return true;
+        }
+
+        if (state.changedDocument != nullptr) {
+            ThrowIfNot(state.pipeline->submit(std::move(state.changedDocument)), "submitBatchFailed");
+        }
+        for (const auto& entryId : removedEntries) {
+            ThrowIfNot(
+                m_addressBookCloudUploaderRESTAgent->deleteCloudAddressBookEntry(state.cloudAddressBookId, entryId),
+                "deleteCloudAddressBookEntryFailed");
+        }
+        state.deltaRequests = deltaUploadRequests;
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "finishDeltaUpload").d("reason", ex.what()));
         return false;
     }
 }
 
+bool AddressBookCloudUploader::spendDeltaCost(UploadState& state, size_t requests, size_t bytes) {
+    auto deltaCost = uploadCost(state.deltaRequests + requests, state.deltaBytes + bytes);
+    if (deltaCost > state.maxDeltaCost) {
+        AACE_INFO(LX(TAG, "spendDeltaCost")
+                      .m("uploadingInFull")
+                      .d("addressBookSourceId", state.record.addressBookSourceId)
+                      .d("deltaCost", deltaCost)
+                      .d("maxDeltaCost", state.maxDeltaCost));
+        state.deltaAbandoned = true;
+        state.changedDocument.reset();
+        return false;
+    }
+    state.deltaRequests += requests;
+    state.deltaBytes += bytes;
+    return true;
+}
+
 bool AddressBookCloudUploader::handleRemove(std::shared_ptr<AddressBookEntity> addressBookEntity) {
     std::string addressBookSourceId = INVALID_ADDRESS_BOOK_SOURCE_ID;
     try {
@@ -944,6 +1271,10 @@ bool AddressBookCloudUploader::handleRemove(std::shared_ptr<AddressBookEntity> a
 
         addressBookSourceId = addressBookEntity->getSourceId();
 
+        // The record describes the address book in the cloud, so it goes with it once the grace period is over
+        if (m_syncStore != nullptr) {
+            m_syncStore->remove(addressBookEntity->toJSONAddressBookType());
+        }
         ThrowIfNot(deleteAddressBook(addressBookEntity), "addressBookDeleteFailed");
 
         AACE_INFO(LX(TAG, "handleRemove")
@@ -1047,8 +1378,15 @@ const Event AddressBookCloudUploader::popNextEventFromQ() {
             (!m_addressBookEventQ.empty() && m_networkStatus == NetworkStatus::CONNECTED && m_isAuthRefreshed));
     };
 
-    if (!shouldNotWait()) {
-        m_waitForEvent.wait(queueLock, shouldNotWait);
+    // Removals are queued once their grace period is over
+    enqueueDueRemovalsLocked();
+    while (!shouldNotWait()) {
+        if (m_pendingRemovals.empty()) {
+            m_waitForEvent.wait(queueLock);
+        } else {
+            m_waitForEvent.wait_until(queueLock, m_pendingRemovals.front().deadline);
+        }
+        enqueueDueRemovalsLocked();
     }
 
     if (!m_addressBookEventQ.empty()) {
@@ -1078,13 +1416,38 @@ std::string AddressBookCloudUploader::prepareForUpload(std::shared_ptr<AddressBo
     }
 }
 
+std::string AddressBookCloudUploader::prepareForDeltaUpload(
+    std::shared_ptr<AddressBookEntity> addressBookEntity,
+    const AddressBookSyncRecord& previousRecord) {
+    AACE_DEBUG(LX(TAG));
+    try {
+        ThrowIfNot(m_addressBookCloudUploaderRESTAgent->isAccountProvisioned(), "accountNotProvisioned");
+        ReturnIf(previousRecord.addressBookSourceId != addressBookEntity->getSourceId(), std::string());
+        ReturnIf(std::chrono::system_clock::now() >= previousRecord.validUntil, std::string());
+
+        // The address book in the cloud may have been removed or replaced since the last upload
+        std::string cloudAddressBookId;
+        ThrowIfNot(
+            m_addressBookCloudUploaderRESTAgent->getCloudAddressBookId(
+                m_deviceInfo->getDeviceSerialNumber(), addressBookEntity->toJSONAddressBookType(), cloudAddressBookId),
+            "getCloudAddressBookIdFailed");
+        ReturnIf(cloudAddressBookId.empty() || cloudAddressBookId != previousRecord.cloudAddressBookId, std::string());
+
+        return cloudAddressBookId;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "prepareForDeltaUpload").d("reason", ex.what()));
+        return std::string();
+    }
+}
+
 bool AddressBookCloudUploader::upload(
     const std::string& cloudAddressBookId,
-    std::shared_ptr<rapidjson::Document> document) {
+    std::shared_ptr<rapidjson::Document> document,
+    std::unordered_set<std::string>& failedEntries) {
     try {
         AACE_DEBUG(LX(TAG, "upload").d("entries.Size()", document->FindMember("entries")->value.Size()));
 
-        ThrowIfNot(uploadEntries(cloudAddressBookId, document), "uploadEntriesFailed");
+        ThrowIfNot(uploadEntries(cloudAddressBookId, document, failedEntries), "uploadEntriesFailed");
 
         return true;
     } catch (std::exception& ex) {
@@ -1095,7 +1458,8 @@ bool AddressBookCloudUploader::upload(
 
 bool AddressBookCloudUploader::uploadEntries(
     const std::string& cloudAddressBookId,
-    std::shared_ptr<rapidjson::Document> document) {
+    std::shared_ptr<rapidjson::Document> document,
+    std::unordered_set<std::string>& failedEntries) {
     HTTPResponse httpResponse;
     auto flowState = UploadFlowState::POST;
     bool success = true;
@@ -1110,10 +1474,11 @@ bool AddressBookCloudUploader::uploadEntries(
                 nextFlowState = handleUploadEntries(cloudAddressBookId, document, httpResponse);
                 break;
             case UploadFlowState::PARSE:
-                nextFlowState = handleParseHTTPResponse(httpResponse);
+                nextFlowState = handleParseHTTPResponse(httpResponse, failedEntries);
                 break;
             case UploadFlowState::ERROR:
-                nextFlowState = handleError(cloudAddressBookId);
+                // Batches are uploaded concurrently, so the address book is removed once by the caller
+                nextFlowState = UploadFlowState::FINISH;
                 success = false;
                 break;
             case UploadFlowState::FINISH:
@@ -1161,16 +1526,22 @@ AddressBookCloudUploader::UploadFlowState AddressBookCloudUploader::handleUpload
 }
 
 AddressBookCloudUploader::UploadFlowState AddressBookCloudUploader::handleParseHTTPResponse(
-    const HTTPResponse& httpResponse) {
+    const HTTPResponse& httpResponse,
+    std::unordered_set<std::string>& failedEntries) {
     try {
-        std::queue<std::string> failedEntries;
+        std::queue<std::string> responseFailedEntries;
         ThrowIfNot(
-            m_addressBookCloudUploaderRESTAgent->parseCreateAddressBookEntryResponse(httpResponse, failedEntries),
+            m_addressBookCloudUploaderRESTAgent->parseCreateAddressBookEntryResponse(
+                httpResponse, responseFailedEntries),
             "responseJsonParseFailed");
 
         // Continue to upload rest of the entries, even if there are one or more failed entries.
-        if (failedEntries.size()) {
-            AACE_WARN(LX(TAG, "handleParse").d("NumberOfFailedEntries", failedEntries.size()));
+        if (responseFailedEntries.size()) {
+            AACE_WARN(LX(TAG, "handleParse").d("NumberOfFailedEntries", responseFailedEntries.size()));
+        }
+        while (!responseFailedEntries.empty()) {
+            failedEntries.insert(responseFailedEntries.front());
+            responseFailedEntries.pop();
         }
 
         return UploadFlowState::FINISH;
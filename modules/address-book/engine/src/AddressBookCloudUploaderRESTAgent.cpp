@@ -17,11 +17,13 @@
 #include <AVSCommon/Utils/RetryTimer.h>
 
 #include <AACE/Engine/Core/EngineMacros.h>
+#include <AACE/Engine/Alexa/HttpClientPool.h>
 #include <AACE/Engine/Core/EngineVersion.h>
 #include <AACE/Engine/AddressBook/AddressBookCloudUploaderRESTAgent.h>
 
 #include "zlib.h"
 
+#include <cctype>
 #include <chrono>
 #include <iomanip>
 #include <sstream>
@@ -270,11 +272,8 @@ std::pair<bool, AddressBookCloudUploaderRESTAgent::HTTPResponse> AddressBookClou
     try {
         int retry = 0;
         do {
-            // Creating the HttpPost on every doPost ensures most updated curl options set in libCurlUtils are used.
-            auto httpPost = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpPost::create();
-            ThrowIfNull(httpPost, "nullHttpPost");
-
-            auto httpResponse = httpPost->doPost(url, headerLines, data, timeout);
+            auto httpResponse =
+                aace::engine::alexa::HttpClientPool::getInstance()->doPost(url, headerLines, data, timeout);
 
             auto status = parseHTTPResponseCode(httpResponse.code);
 
@@ -314,11 +313,8 @@ std::pair<bool, AddressBookCloudUploaderRESTAgent::HTTPResponse> AddressBookClou
     try {
         int retry = 0;
         do {
-            // Creating the HttpGet on every doGet ensures most updated curl options set in libCurlUtils are used.
-            auto httpGet = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpGet::create();
-            ThrowIfNull(httpGet, "nullHttpGet");
-
-            auto httpResponse = httpGet->doGet(url, headers, DEFAULT_HTTP_TIMEOUT);
+            auto httpResponse =
+                aace::engine::alexa::HttpClientPool::getInstance()->doGet(url, headers, DEFAULT_HTTP_TIMEOUT);
 
             auto status = parseHTTPResponseCode(httpResponse.code);
 
@@ -358,11 +354,8 @@ std::pair<bool, AddressBookCloudUploaderRESTAgent::HTTPResponse> AddressBookClou
     try {
         int retry = 0;
         do {
-            // Creating the HttpDelete on every doDelete ensures most updated curl options set in libCurlUtils are used.
-            auto httpDelete = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpDelete::create();
-            ThrowIfNull(httpDelete, "nullHttpDelete");
-
-            auto httpResponse = httpDelete->doDelete(url, headers, DEFAULT_HTTP_TIMEOUT);
+            auto httpResponse =
+                aace::engine::alexa::HttpClientPool::getInstance()->doDelete(url, headers, DEFAULT_HTTP_TIMEOUT);
 
             auto status = parseHTTPResponseCode(httpResponse.code);
 
@@ -764,6 +757,48 @@ bool AddressBookCloudUploaderRESTAgent::deleteCloudAddressBook(const std::string
     }
 }
 
+/**
+ * Percent-encodes a string for use as a URL path segment.
+ */
+static std::string encodePathSegment(const std::string& value) {
+    std::ostringstream encoded;
+    encoded << std::hex << std::uppercase << std::setfill('0');
+    for (auto c : value) {
+        if (std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_' || c == '.' || c == '~') {
+            encoded << c;
+        } else {
+            encoded << '%' << std::setw(2) << static_cast<int>(static_cast<unsigned char>(c));
+        }
+    }
+    return encoded.str();
+}
+
+bool AddressBookCloudUploaderRESTAgent::deleteCloudAddressBookEntry(
+    const std::string& addressBookId,
+    const std::string& entrySourceId) {
+    AACE_DEBUG(LX(TAG));
+    try {
+        auto url = m_acmsEndpoint + FORWARD_SLASH + USERS_PATH + FORWARD_SLASH + getPceId() + FORWARD_SLASH +
+                   ADDRESSBOOK_PATH + FORWARD_SLASH + addressBookId + FORWARD_SLASH + ENTRIES_PATH + FORWARD_SLASH +
+                   encodePathSegment(entrySourceId);
+
+        auto httpHeader = buildCommonHTTPHeader();
+        if (httpHeader.size() == 0) {
+            // When auth token is empty the size returned is 0.
+            AACE_WARN(LX(TAG).m("httpHeaderEmpty"));
+            return false;
+        }
+        auto result = doDelete(url, httpHeader);
+
+        ThrowIfNot(result.first, "doDeleteFailed:" + responseCodeToString((HTTPResponseCode)result.second.code));
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
 std::string AddressBookCloudUploaderRESTAgent::buildFailedEntriesJson(std::queue<std::string>& failedList) {
     rapidjson::Document document;
     document.SetObject();
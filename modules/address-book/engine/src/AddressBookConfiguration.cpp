@@ -22,11 +22,15 @@ namespace addressBook {
 namespace config {
 
 std::shared_ptr<aace::core::config::EngineConfiguration> AddressBookConfiguration::createAddressBookConfig(
-    bool cleanAllAddressBooksAtStart) {
+    bool cleanAllAddressBooksAtStart,
+    int maxConcurrentUploads,
+    int removeGracePeriodSeconds) {
     // clang-format off
     nlohmann::json config = {
         {"aace.addressBook", {
-            {"cleanAllAddressBooksAtStart", cleanAllAddressBooksAtStart}
+            {"cleanAllAddressBooksAtStart", cleanAllAddressBooksAtStart},
+            {"maxConcurrentUploads", maxConcurrentUploads},
+            {"removeGracePeriodSeconds", removeGracePeriodSeconds}
         }}
     };
     // clang-format on
@@ -20,6 +20,7 @@
 #include <AACE/Engine/Core/EngineMacros.h>
 #include <AACE/Engine/Alexa/AlexaEngineService.h>
 #include <AACE/Engine/Network/NetworkEngineService.h>
+#include <AACE/Engine/Storage/LocalStorageInterface.h>
 #include <AACE/Engine/Utils/Metrics/Metrics.h>
 
 #include <AACE/Engine/AddressBook/AddressBookEngineService.h>
@@ -40,7 +41,10 @@ static const std::string METRIC_PROGRAM_NAME_SUFFIX = "AddressBookEngineService"
 REGISTER_SERVICE(AddressBookEngineService);
 
 AddressBookEngineService::AddressBookEngineService(const aace::engine::core::ServiceDescription& description) :
-        aace::engine::core::EngineService(description), m_cleanAllAddressBooksAtStart(true) {
+        aace::engine::core::EngineService(description),
+        m_cleanAllAddressBooksAtStart(true),
+        m_maxConcurrentUploads(AddressBookCloudUploader::DEFAULT_MAX_CONCURRENT_UPLOADS),
+        m_removeGracePeriod(std::chrono::seconds::zero()) {
 }
 
 AddressBookEngineService::~AddressBookEngineService() = default;
@@ -69,12 +73,22 @@ bool AddressBookEngineService::registerPlatformInterface(
     }
 }
 
-bool AddressBookEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool AddressBookEngineService::configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) {
     try {
-        auto config = nlohmann::json::parse(*configuration);
+        auto& config = *configuration;
         m_cleanAllAddressBooksAtStart = config.value("cleanAllAddressBooksAtStart", m_cleanAllAddressBooksAtStart);
-    } catch (nlohmann::json::parse_error& ex) {
-        AACE_ERROR(LX(TAG).m("configuration is not valid JSON").d("exception", ex.what()));
+        m_maxConcurrentUploads = config.value("maxConcurrentUploads", m_maxConcurrentUploads);
+        if (m_maxConcurrentUploads < 1) {
+            AACE_WARN(LX(TAG).m("invalidMaxConcurrentUploads").d("maxConcurrentUploads", m_maxConcurrentUploads));
+            m_maxConcurrentUploads = AddressBookCloudUploader::DEFAULT_MAX_CONCURRENT_UPLOADS;
+        }
+        m_removeGracePeriod = std::chrono::seconds(config.value("removeGracePeriodSeconds", 0));
+        if (m_removeGracePeriod < std::chrono::seconds::zero()) {
+            AACE_WARN(LX(TAG).m("invalidRemoveGracePeriod").d("removeGracePeriodSeconds", m_removeGracePeriod.count()));
+            m_removeGracePeriod = std::chrono::seconds::zero();
+        }
+    } catch (nlohmann::json::type_error& ex) {
+        AACE_ERROR(LX(TAG).m("configuration is not valid").d("exception", ex.what()));
         return false;
     }
     return true;
@@ -122,6 +136,11 @@ bool AddressBookEngineService::registerPlatformInterfaceType(
             getContext()->getServiceInterface<aace::engine::alexa::AlexaEndpointInterface>("aace.alexa");
         ThrowIfNull(alexaEndpoints, "alexaEndpointsInvalid");
 
+        // the sync store lets an address book which is uploaded again upload only its changes
+        auto localStorage =
+            getContext()->getServiceInterface<aace::engine::storage::LocalStorageInterface>("aace.storage");
+        auto syncStore = AddressBookSyncStore::create(localStorage);
+
         m_addressBookCloudUploader = aace::engine::addressBook::AddressBookCloudUploader::create(
             m_addressBookEngineImpl,
             authDelegate,
@@ -129,7 +148,11 @@ bool AddressBookEngineService::registerPlatformInterfaceType(
             networkStatus,
             networkObserver,
             alexaEndpoints,
-            m_cleanAllAddressBooksAtStart);
+            m_cleanAllAddressBooksAtStart,
+            syncStore,
+            nullptr,
+            m_maxConcurrentUploads,
+            m_removeGracePeriod);
         ThrowIfNull(m_addressBookCloudUploader, "createAddressBookCloudUploaderFailed");
 
         // set the engine interface reference
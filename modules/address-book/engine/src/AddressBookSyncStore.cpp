@@ -0,0 +1,121 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <nlohmann/json.hpp>
+
+#include <AACE/Engine/Core/EngineMacros.h>
+#include <AACE/Engine/AddressBook/AddressBookSyncStore.h>
+#include <AACE/Engine/Utils/Hash/Hash.h>
+
+namespace aace {
+namespace engine {
+namespace addressBook {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.addressBook.addressBookSyncStore");
+
+/// The local storage table of the records.
+static const std::string SYNC_STORE_TABLE = "aace.addressBook.sync";
+
+/// The version of the record schema, which changes whenever the entries uploaded for the same contents change.
+static const int SCHEMA_VERSION = 1;
+
+AddressBookSyncStore::AddressBookSyncStore(
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage) :
+        m_localStorage(std::move(localStorage)) {
+}
+
+std::shared_ptr<AddressBookSyncStore> AddressBookSyncStore::create(
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage) {
+    return std::shared_ptr<AddressBookSyncStore>(new AddressBookSyncStore(localStorage));
+}
+
+bool AddressBookSyncStore::load(const std::string& addressBookType, AddressBookSyncRecord& record) {
+    try {
+        std::string value;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_localStorage != nullptr) {
+                value = m_localStorage->get(SYNC_STORE_TABLE, addressBookType, "");
+            } else {
+                auto it = m_records.find(addressBookType);
+                if (it != m_records.end()) {
+                    value = it->second;
+                }
+            }
+        }
+        ReturnIf(value.empty(), false);
+
+        auto root = nlohmann::json::parse(value);
+        ThrowIfNot(root.value("schemaVersion", 0) == SCHEMA_VERSION, "schemaVersionChanged");
+
+        record.addressBookSourceId = root.at("addressBookSourceId").get<std::string>();
+        record.cloudAddressBookId = root.at("cloudAddressBookId").get<std::string>();
+        record.validUntil =
+            std::chrono::system_clock::time_point(std::chrono::seconds(root.at("validUntil").get<int64_t>()));
+        record.entryHashes = root.at("entries").get<std::unordered_map<std::string, std::string>>();
+        record.uploadedBytes = root.at("uploadedBytes").get<size_t>();
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG).d("addressBookType", addressBookType).d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool AddressBookSyncStore::store(const std::string& addressBookType, const AddressBookSyncRecord& record) {
+    try {
+        nlohmann::json root;
+        root["schemaVersion"] = SCHEMA_VERSION;
+        root["addressBookSourceId"] = record.addressBookSourceId;
+        root["cloudAddressBookId"] = record.cloudAddressBookId;
+        root["validUntil"] =
+            std::chrono::duration_cast<std::chrono::seconds>(record.validUntil.time_since_epoch()).count();
+        root["entries"] = record.entryHashes;
+        root["uploadedBytes"] = record.uploadedBytes;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_localStorage != nullptr) {
+            ThrowIfNot(m_localStorage->put(SYNC_STORE_TABLE, addressBookType, root.dump()), "putFailed");
+        } else {
+            m_records[addressBookType] = root.dump();
+        }
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("addressBookType", addressBookType).d("reason", ex.what()));
+        return false;
+    }
+}
+
+void AddressBookSyncStore::remove(const std::string& addressBookType) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_localStorage != nullptr) {
+        if (m_localStorage->containsKey(SYNC_STORE_TABLE, addressBookType) &&
+            !m_localStorage->removeKey(SYNC_STORE_TABLE, addressBookType)) {
+            AACE_ERROR(LX(TAG).d("addressBookType", addressBookType).d("reason", "removeKeyFailed"));
+        }
+    } else {
+        m_records.erase(addressBookType);
+    }
+}
+
+std::string AddressBookSyncStore::hashEntry(const std::string& entry) {
+    return aace::engine::utils::hash::toHex(aace::engine::utils::hash::fnv1a(entry));
+}
+
+}  // namespace addressBook
+}  // namespace engine
+}  // namespace aace
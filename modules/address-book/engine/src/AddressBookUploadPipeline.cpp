@@ -0,0 +1,140 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/Core/EngineMacros.h>
+#include <AACE/Engine/AddressBook/AddressBookUploadPipeline.h>
+
+namespace aace {
+namespace engine {
+namespace addressBook {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.addressBook.addressBookUploadPipeline");
+
+AddressBookUploadPipeline::AddressBookUploadPipeline(UploadFunction upload, int maxConcurrentUploads) :
+        m_upload(std::move(upload)),
+        m_maxQueuedBatches(maxConcurrentUploads),
+        m_uploadsInFlight(0),
+        m_submittedBatches(0),
+        m_failed(false),
+        m_stopping(false) {
+}
+
+std::shared_ptr<AddressBookUploadPipeline> AddressBookUploadPipeline::create(
+    UploadFunction upload,
+    int maxConcurrentUploads) {
+    try {
+        ThrowIfNull(upload, "invalidUploadFunction");
+        ThrowIf(maxConcurrentUploads < 1, "invalidMaxConcurrentUploads");
+
+        auto pipeline = std::shared_ptr<AddressBookUploadPipeline>(
+            new AddressBookUploadPipeline(std::move(upload), maxConcurrentUploads));
+        for (int i = 0; i < maxConcurrentUploads; i++) {
+            pipeline->m_threads.emplace_back(&AddressBookUploadPipeline::uploadLoop, pipeline.get());
+        }
+
+        return pipeline;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "create").d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+AddressBookUploadPipeline::~AddressBookUploadPipeline() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.clear();
+    }
+    stop();
+}
+
+bool AddressBookUploadPipeline::submit(std::shared_ptr<rapidjson::Document> batch) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_batchTaken.wait(lock, [this] { return m_failed || m_stopping || m_queue.size() < m_maxQueuedBatches; });
+    if (m_failed || m_stopping) {
+        return false;
+    }
+
+    m_queue.push_back(std::move(batch));
+    m_submittedBatches++;
+    m_batchQueued.notify_one();
+
+    return true;
+}
+
+bool AddressBookUploadPipeline::finish() {
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_batchTaken.wait(lock, [this] { return m_failed || (m_queue.empty() && m_uploadsInFlight == 0); });
+        m_queue.clear();
+    }
+    stop();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return !m_failed;
+}
+
+int AddressBookUploadPipeline::getSubmittedBatches() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_submittedBatches;
+}
+
+void AddressBookUploadPipeline::uploadLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_batchQueued.wait(lock, [this] { return m_stopping || m_failed || !m_queue.empty(); });
+        if (m_stopping || m_failed) {
+            return;
+        }
+
+        auto batch = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_uploadsInFlight++;
+        m_batchTaken.notify_all();
+
+        lock.unlock();
+        bool success = m_upload(batch);
+        batch.reset();
+        lock.lock();
+
+        m_uploadsInFlight--;
+        if (!success) {
+            AACE_WARN(LX(TAG, "uploadLoop").m("batchUploadFailed"));
+            m_failed = true;
+            m_batchQueued.notify_all();
+        }
+        m_batchTaken.notify_all();
+    }
+}
+
+void AddressBookUploadPipeline::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_batchQueued.notify_all();
+    m_batchTaken.notify_all();
+
+    for (auto& thread : m_threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+    m_threads.clear();
+}
+
+}  // namespace addressBook
+}  // namespace engine
+}  // namespace aace
@@ -37,15 +37,24 @@ public:
      * @code{.json}
      * {
      *   "aace.addressBook" : {
-     *      "cleanAllAddressBooksAtStart" : <true/false>
+     *      "cleanAllAddressBooksAtStart" : <true/false>,
+     *      "maxConcurrentUploads" : <NUMBER_OF_BATCHES>,
+     *      "removeGracePeriodSeconds" : <SECONDS>
      *   }
      * }
      * @endcode
      *
      * @param [in] cleanAllAddressBooksAtStart indicates whether to clean all address books at start. The default value is @c true.
+     * @param [in] maxConcurrentUploads The number of batches of address book entries uploaded at the same time. The
+     *             default value is @c 2.
+     * @param [in] removeGracePeriodSeconds The time a removed address book is kept in Alexa, during which uploading
+     *             the same address book again uploads only its changes. The default value is @c 0, which deletes
+     *             removed address books right away.
      */
     static std::shared_ptr<aace::core::config::EngineConfiguration> createAddressBookConfig(
-        bool cleanAllAddressBooksAtStart = true);
+        bool cleanAllAddressBooksAtStart = true,
+        int maxConcurrentUploads = 2,
+        int removeGracePeriodSeconds = 0);
 };
 
 }  // namespace config
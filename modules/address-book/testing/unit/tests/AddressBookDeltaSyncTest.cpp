@@ -0,0 +1,736 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <nlohmann/json.hpp>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
+#include <AVSCommon/Utils/HTTP/HttpResponseCode.h>
+#include <AVSCommon/Utils/WaitEvent.h>
+
+#include <AACE/AddressBook/AddressBook.h>
+#include <AACE/Engine/AddressBook/AddressBookCloudUploader.h>
+#include <AACE/Engine/AddressBook/AddressBookCloudUploaderRESTAgentInterface.h>
+#include <AACE/Engine/AddressBook/AddressBookSyncStore.h>
+#include <AACE/Engine/Storage/LocalStorageInterface.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace addressBook {
+
+/// Plenty of timeout to upload the address books
+static std::chrono::seconds TIMEOUT(20);
+
+/// The number of contacts of the phone in the benchmark
+static const int BENCHMARK_CONTACTS = 5000;
+
+/// The number of entries uploaded in one request
+static const int UPLOAD_BATCH_SIZE = 100;
+
+/// The time the local cloud takes to upload a batch in the streaming benchmark
+static const std::chrono::milliseconds BENCHMARK_UPLOAD_LATENCY(20);
+
+/// A grace period which is not over before the removed address book is added again
+static const std::chrono::milliseconds LONG_REMOVE_GRACE_PERIOD(std::chrono::minutes(5));
+
+/// A grace period which is over while the test waits for the removed address book to be deleted
+static const std::chrono::milliseconds SHORT_REMOVE_GRACE_PERIOD(100);
+
+using json = nlohmann::json;
+using HTTPResponse = aace::engine::addressBook::AddressBookCloudUploaderRESTAgentInterface::HTTPResponse;
+
+class MockAuthDelegateInterface : public alexaClientSDK::avsCommon::sdkInterfaces::AuthDelegateInterface {
+public:
+    MOCK_METHOD1(
+        addAuthObserver,
+        void(std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthObserverInterface> observer));
+    MOCK_METHOD1(
+        removeAuthObserver,
+        void(std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::AuthObserverInterface> observer));
+    MOCK_METHOD0(getAuthToken, std::string());
+    MOCK_METHOD1(onAuthFailure, void(const std::string& token));
+};
+
+class MockNetworkObservableInterface : public aace::engine::network::NetworkObservableInterface {
+public:
+    MOCK_METHOD1(addObserver, void(std::shared_ptr<aace::engine::network::NetworkInfoObserver> observer));
+    MOCK_METHOD1(removeObserver, void(std::shared_ptr<aace::engine::network::NetworkInfoObserver> observer));
+};
+
+class MockAddressBookServiceInterface : public aace::engine::addressBook::AddressBookServiceInterface {
+public:
+    MOCK_METHOD2(
+        addObserver,
+        void(std::shared_ptr<aace::engine::addressBook::AddressBookObserver> observer, const std::string& serviceType));
+    MOCK_METHOD1(removeObserver, void(std::shared_ptr<aace::engine::addressBook::AddressBookObserver> observer));
+    MOCK_METHOD2(
+        getEntries,
+        bool(const std::string& id, std::weak_ptr<aace::addressBook::AddressBook::IAddressBookEntriesFactory> factory));
+    MOCK_METHOD1(setDelegate, void(std::shared_ptr<aace::engine::addressBook::AddressBookDelegateInterface> delegate));
+    MOCK_METHOD0(servicesEnablementChanged, void());
+};
+
+class DummyAlexaEndpointInterface : public aace::engine::alexa::AlexaEndpointInterface {
+public:
+    std::string getAVSGateway() override {
+        return "";
+    }
+    std::string getLWAEndpoint() override {
+        return "";
+    }
+    std::string getACMSEndpoint() override {
+        return "http://localhost";
+    }
+    std::string getFeatureDiscoveryEndpoint() override {
+        return "";
+    }
+};
+
+/**
+ * A local stand-in for the address book cloud, which counts the requests and the uploaded bytes.
+ */
+class LocalAddressBookCloud : public aace::engine::addressBook::AddressBookCloudUploaderRESTAgentInterface {
+public:
+    bool isAccountProvisioned() override {
+        return true;
+    }
+
+    std::string createAndGetCloudAddressBook(const std::string& addressBookSourceId, const std::string& addressBookType)
+        override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_requests++;
+        auto cloudAddressBookId = "cloud-" + std::to_string(++m_lastCloudAddressBookId);
+        m_addressBooks[addressBookSourceId + "/" + addressBookType] = cloudAddressBookId;
+        m_entries[cloudAddressBookId].clear();
+        return cloudAddressBookId;
+    }
+
+    bool getCloudAddressBookId(
+        const std::string& addressBookSourceId,
+        const std::string& addressBookType,
+        std::string& cloudAddressBookId) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_requests++;
+        auto it = m_addressBooks.find(addressBookSourceId + "/" + addressBookType);
+        cloudAddressBookId = it != m_addressBooks.end() ? it->second : "";
+        return true;
+    }
+
+    bool deleteCloudAddressBook(const std::string& cloudAddressBookId) override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_requests++;
+            for (auto it = m_addressBooks.begin(); it != m_addressBooks.end(); ++it) {
+                if (it->second == cloudAddressBookId) {
+                    m_addressBooks.erase(it);
+                    break;
+                }
+            }
+            m_entries.erase(cloudAddressBookId);
+        }
+        m_deleteEvent.wakeUp();
+        return true;
+    }
+
+    bool deleteCloudAddressBookEntry(const std::string& cloudAddressBookId, const std::string& entrySourceId)
+        override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_requests++;
+        m_entries[cloudAddressBookId].erase(entrySourceId);
+        return true;
+    }
+
+    HTTPResponse uploadDocumentToCloud(
+        std::shared_ptr<rapidjson::Document> document,
+        const std::string& cloudAddressBookId) override {
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        document->Accept(writer);
+
+        std::chrono::milliseconds uploadLatency;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_maxUploadsInFlight = std::max(m_maxUploadsInFlight, ++m_uploadsInFlight);
+            uploadLatency = m_uploadLatency;
+        }
+        std::this_thread::sleep_for(uploadLatency);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_uploadsInFlight--;
+        m_requests++;
+        m_uploadedBytes += buffer.GetSize();
+        const auto& entries = (*document)["entries"];
+        for (auto entry = entries.Begin(); entry != entries.End(); entry++) {
+            m_entries[cloudAddressBookId].insert((*entry)["entrySourceId"].GetString());
+            m_uploadedEntries++;
+        }
+
+        HTTPResponse response;
+        response.code = static_cast<long>(alexaClientSDK::avsCommon::utils::http::HTTPResponseCode::SUCCESS_OK);
+        return response;
+    }
+
+    bool parseCreateAddressBookEntryResponse(const HTTPResponse& response, std::queue<std::string>& failedEntries)
+        override {
+        return true;
+    }
+
+    void reset() override {
+    }
+
+    /// Starts counting from zero.
+    void resetCounters() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_requests = 0;
+        m_uploadedBytes = 0;
+        m_uploadedEntries = 0;
+        m_maxUploadsInFlight = 0;
+    }
+
+    /// Sets the time each upload of a batch takes.
+    void setUploadLatency(std::chrono::milliseconds uploadLatency) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_uploadLatency = uploadLatency;
+    }
+
+    /// Waits for the next address book to be deleted.
+    bool waitForDelete(std::chrono::milliseconds timeout) {
+        auto result = m_deleteEvent.wait(timeout);
+        m_deleteEvent.reset();
+        return result;
+    }
+
+    /// Returns the largest number of batches uploaded at the same time.
+    int getMaxUploadsInFlight() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_maxUploadsInFlight;
+    }
+
+    int getRequests() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_requests;
+    }
+
+    size_t getUploadedBytes() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_uploadedBytes;
+    }
+
+    int getUploadedEntries() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_uploadedEntries;
+    }
+
+    /// Returns the ids of the entries of the address book of a type.
+    std::vector<std::string> getEntryIds(const std::string& addressBookSourceId, const std::string& addressBookType) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<std::string> entryIds;
+        auto it = m_addressBooks.find(addressBookSourceId + "/" + addressBookType);
+        if (it != m_addressBooks.end()) {
+            entryIds.assign(m_entries[it->second].begin(), m_entries[it->second].end());
+        }
+        return entryIds;
+    }
+
+private:
+    std::mutex m_mutex;
+    int m_lastCloudAddressBookId = 0;
+    std::map<std::string, std::string> m_addressBooks;
+    std::map<std::string, std::set<std::string>> m_entries;
+    int m_requests = 0;
+    size_t m_uploadedBytes = 0;
+    int m_uploadedEntries = 0;
+    int m_uploadsInFlight = 0;
+    int m_maxUploadsInFlight = 0;
+    std::chrono::milliseconds m_uploadLatency{0};
+    alexaClientSDK::avsCommon::utils::WaitEvent m_deleteEvent;
+};
+
+/**
+ * An in-memory local storage, which signals every time a value is stored.
+ */
+class InMemoryLocalStorage : public aace::engine::storage::LocalStorageInterface {
+public:
+    bool put(const std::string& table, const std::string& key, const std::string& value) override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tables[table][key] = value;
+        }
+        m_putEvent.wakeUp();
+        return true;
+    }
+    std::string get(const std::string& table, const std::string& key) override {
+        return get(table, key, "");
+    }
+    std::string get(const std::string& table, const std::string& key, const std::string& defaultValue) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_tables[table].find(key);
+        return it != m_tables[table].end() ? it->second : defaultValue;
+    }
+    bool removeKey(const std::string& table, const std::string& key) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_tables[table].erase(key) > 0;
+    }
+    bool removeTable(const std::string& table) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_tables.erase(table) > 0;
+    }
+    bool containsKey(const std::string& table, const std::string& key) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_tables[table].count(key) > 0;
+    }
+    bool containsTable(const std::string& table) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_tables.count(table) > 0;
+    }
+    std::vector<std::string> keys(const std::string& table) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<std::string> keys;
+        for (const auto& entry : m_tables[table]) {
+            keys.push_back(entry.first);
+        }
+        return keys;
+    }
+    std::vector<KeyValuePair> list(const std::string& table) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return std::vector<KeyValuePair>(m_tables[table].begin(), m_tables[table].end());
+    }
+    bool begin() override {
+        return true;
+    }
+    bool commit() override {
+        return true;
+    }
+    bool cancel() override {
+        return true;
+    }
+
+    /// Waits for the next value to be stored.
+    bool waitForPut(std::chrono::milliseconds timeout) {
+        auto result = m_putEvent.wait(timeout);
+        m_putEvent.reset();
+        return result;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::map<std::string, std::map<std::string, std::string>> m_tables;
+    alexaClientSDK::avsCommon::utils::WaitEvent m_putEvent;
+};
+
+// clang-format off
+static const std::string CAPABILITIES_CONFIG_JSON =
+    "{"
+    "    \"deviceInfo\":{"
+    "        \"deviceSerialNumber\":\"MockAddressBookTest\", "
+    "        \"clientId\":\"MockClientId\","
+    "        \"productId\":\"MockProductID\","
+    "        \"manufacturerName\":\"MockManufacturerName\","
+    "        \"description\":\"MockDescription\""
+    "    }"
+    " }";
+// clang-format on
+
+static std::string buildContact(int index, const std::string& number) {
+    json payload = {{"entryId", "contact-" + std::to_string(index)},
+                    {"name", {{"firstName", "First" + std::to_string(index)}, {"lastName", "Last"}}},
+                    {"phoneNumbers", {{{"label", "mobile"}, {"number", number}}}}};
+    return payload.dump();
+}
+
+class AddressBookDeltaSyncTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        auto inString = std::shared_ptr<std::istringstream>(new std::istringstream(CAPABILITIES_CONFIG_JSON));
+        alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::initialize({inString});
+
+        m_deviceInfo = alexaClientSDK::avsCommon::utils::DeviceInfo::create(
+            alexaClientSDK::avsCommon::utils::configuration::ConfigurationNode::getRoot());
+        m_cloud = std::make_shared<LocalAddressBookCloud>();
+        m_localStorage = std::make_shared<InMemoryLocalStorage>();
+        m_alexaEndpointInterface = std::make_shared<DummyAlexaEndpointInterface>();
+        m_contactAddressBook = std::make_shared<aace::engine::addressBook::AddressBookEntity>(
+            "1000", "TestAddressBook", aace::engine::addressBook::AddressBookType::CONTACT);
+    }
+
+    void TearDown() override {
+        if (m_addressBookCloudUploader != nullptr) {
+            m_addressBookCloudUploader->shutdown();
+        }
+        if (alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::isInitialized()) {
+            alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
+        }
+    }
+
+    /**
+     * Starts an uploader with the same sync store contents as the previous one, as after an engine restart.
+     */
+    void startUploader(
+        int maxConcurrentUploads = aace::engine::addressBook::AddressBookCloudUploader::DEFAULT_MAX_CONCURRENT_UPLOADS,
+        std::chrono::milliseconds removeGracePeriod = std::chrono::milliseconds::zero()) {
+        if (m_addressBookCloudUploader != nullptr) {
+            m_addressBookCloudUploader->shutdown();
+        }
+        m_mockAuthDelegate = std::make_shared<testing::NiceMock<MockAuthDelegateInterface>>();
+        m_mockNetworkObservableInterface = std::make_shared<testing::NiceMock<MockNetworkObservableInterface>>();
+        m_mockAddressBookServiceInterface = std::make_shared<testing::NiceMock<MockAddressBookServiceInterface>>();
+        ON_CALL(*m_mockAddressBookServiceInterface, getEntries(testing::_, testing::_))
+            .WillByDefault(testing::Invoke(
+                [this](
+                    const std::string& id,
+                    std::weak_ptr<aace::addressBook::AddressBook::IAddressBookEntriesFactory> factory) -> bool {
+                    if (auto sharedRef = factory.lock()) {
+                        int providedEntries = 0;
+                        for (const auto& contact : m_contacts) {
+                            EXPECT_TRUE(sharedRef->addEntry(contact.second));
+                            // the entries provided but not uploaded yet are the ones held in memory
+                            int bufferedEntries = ++providedEntries - m_cloud->getUploadedEntries();
+                            m_maxBufferedEntries = std::max(m_maxBufferedEntries, bufferedEntries);
+                        }
+                        m_uploadedEntriesWhenProvided = m_cloud->getUploadedEntries();
+                    }
+                    return true;
+                }));
+
+        m_addressBookCloudUploader = aace::engine::addressBook::AddressBookCloudUploader::create(
+            m_mockAddressBookServiceInterface,
+            m_mockAuthDelegate,
+            m_deviceInfo,
+            aace::network::NetworkInfoProvider::NetworkStatus::CONNECTED,
+            m_mockNetworkObservableInterface,
+            m_alexaEndpointInterface,
+            false,
+            aace::engine::addressBook::AddressBookSyncStore::create(m_localStorage),
+            m_cloud,
+            maxConcurrentUploads,
+            removeGracePeriod);
+        ASSERT_NE(nullptr, m_addressBookCloudUploader);
+
+        m_addressBookCloudUploader->onNetworkInfoChanged(
+            aace::network::NetworkInfoProvider::NetworkStatus::CONNECTED, 123);
+        m_addressBookCloudUploader->onAuthStateChange(
+            alexaClientSDK::avsCommon::sdkInterfaces::AuthObserverInterface::State::REFRESHED,
+            alexaClientSDK::avsCommon::sdkInterfaces::AuthObserverInterface::Error::SUCCESS);
+    }
+
+    /**
+     * Connects the phone and waits until its address book is uploaded.
+     *
+     * @return The time it took to upload the address book, in milliseconds.
+     */
+    double connectPhone(std::shared_ptr<aace::engine::addressBook::AddressBookEntity> addressBook) {
+        m_cloud->resetCounters();
+        m_maxBufferedEntries = 0;
+        m_uploadedEntriesWhenProvided = 0;
+        auto start = std::chrono::steady_clock::now();
+        m_addressBookCloudUploader->addressBookAdded(addressBook);
+        EXPECT_TRUE(m_localStorage->waitForPut(TIMEOUT));
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void addContacts(int count) {
+        for (int i = 0; i < count; i++) {
+            m_contacts[i] = buildContact(i, "+1206555" + std::to_string(1000 + i));
+        }
+    }
+
+    size_t getCloudEntries() {
+        return m_cloud->getEntryIds(m_deviceInfo->getDeviceSerialNumber(), "automotive").size();
+    }
+
+protected:
+    std::map<int, std::string> m_contacts;
+    int m_maxBufferedEntries = 0;
+    int m_uploadedEntriesWhenProvided = 0;
+    std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> m_deviceInfo;
+    std::shared_ptr<LocalAddressBookCloud> m_cloud;
+    std::shared_ptr<InMemoryLocalStorage> m_localStorage;
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> m_alexaEndpointInterface;
+    std::shared_ptr<aace::engine::addressBook::AddressBookEntity> m_contactAddressBook;
+    std::shared_ptr<aace::engine::addressBook::AddressBookCloudUploader> m_addressBookCloudUploader;
+    std::shared_ptr<testing::NiceMock<MockAuthDelegateInterface>> m_mockAuthDelegate;
+    std::shared_ptr<testing::NiceMock<MockNetworkObservableInterface>> m_mockNetworkObservableInterface;
+    std::shared_ptr<testing::NiceMock<MockAddressBookServiceInterface>> m_mockAddressBookServiceInterface;
+};
+
+TEST_F(AddressBookDeltaSyncTest, unchangedAddressBookAfterRestartUploadsNothing) {
+    addContacts(1000);
+    startUploader();
+    connectPhone(m_contactAddressBook);
+    EXPECT_EQ(1000, m_cloud->getUploadedEntries());
+    EXPECT_EQ(1000u, getCloudEntries());
+
+    // the engine restarts with the same phone connected, and the address book is uploaded again
+    startUploader();
+    connectPhone(m_contactAddressBook);
+    EXPECT_EQ(1, m_cloud->getRequests());
+    EXPECT_EQ(0u, m_cloud->getUploadedBytes());
+    EXPECT_EQ(1000u, getCloudEntries());
+}
+
+TEST_F(AddressBookDeltaSyncTest, phoneReconnectedWithinGracePeriodUploadsNothing) {
+    addContacts(BENCHMARK_CONTACTS);
+    startUploader(
+        aace::engine::addressBook::AddressBookCloudUploader::DEFAULT_MAX_CONCURRENT_UPLOADS, LONG_REMOVE_GRACE_PERIOD);
+    connectPhone(m_contactAddressBook);
+    EXPECT_EQ(BENCHMARK_CONTACTS, m_cloud->getUploadedEntries());
+
+    // the phone disconnects and reconnects with the same contacts before its address book is deleted
+    m_addressBookCloudUploader->addressBookRemoved(m_contactAddressBook);
+    connectPhone(m_contactAddressBook);
+    EXPECT_EQ(1, m_cloud->getRequests());
+    EXPECT_EQ(0u, m_cloud->getUploadedBytes());
+    EXPECT_EQ(static_cast<size_t>(BENCHMARK_CONTACTS), getCloudEntries());
+}
+
+TEST_F(AddressBookDeltaSyncTest, removedAddressBookIsDeletedAfterGracePeriod) {
+    addContacts(200);
+    startUploader(
+        aace::engine::addressBook::AddressBookCloudUploader::DEFAULT_MAX_CONCURRENT_UPLOADS, SHORT_REMOVE_GRACE_PERIOD);
+    connectPhone(m_contactAddressBook);
+
+    m_addressBookCloudUploader->addressBookRemoved(m_contactAddressBook);
+    ASSERT_TRUE(m_cloud->waitForDelete(TIMEOUT));
+    EXPECT_EQ(0u, getCloudEntries());
+
+    // the record went with the address book, so the phone reconnecting later is uploaded in full
+    connectPhone(m_contactAddressBook);
+    EXPECT_EQ(200, m_cloud->getUploadedEntries());
+    EXPECT_EQ(200u, getCloudEntries());
+}
+
+TEST_F(AddressBookDeltaSyncTest, differentPhoneWithinGracePeriodReplacesRemovedAddressBook) {
+    addContacts(200);
+    startUploader(
+        aace::engine::addressBook::AddressBookCloudUploader::DEFAULT_MAX_CONCURRENT_UPLOADS, SHORT_REMOVE_GRACE_PERIOD);
+    connectPhone(m_contactAddressBook);
+
+    // the removal of the first phone is not cancelled by a different phone, and happens before its upload
+    m_addressBookCloudUploader->addressBookRemoved(m_contactAddressBook);
+    auto otherAddressBook = std::make_shared<aace::engine::addressBook::AddressBookEntity>(
+        "2000", "OtherAddressBook", aace::engine::addressBook::AddressBookType::CONTACT);
+    connectPhone(otherAddressBook);
+    EXPECT_TRUE(m_cloud->waitForDelete(TIMEOUT));
+    EXPECT_EQ(200, m_cloud->getUploadedEntries());
+
+    // the address book of the other phone is not deleted once the grace period is over
+    EXPECT_FALSE(m_cloud->waitForDelete(SHORT_REMOVE_GRACE_PERIOD * 5));
+    EXPECT_EQ(200u, getCloudEntries());
+}
+
+TEST_F(AddressBookDeltaSyncTest, reconnectedPhoneWithoutGracePeriodUploadsInFull) {
+    addContacts(200);
+    startUploader();
+    connectPhone(m_contactAddressBook);
+
+    // the phone disconnects, which removes its address book from the cloud, and reconnects with the same contacts
+    m_addressBookCloudUploader->addressBookRemoved(m_contactAddressBook);
+    connectPhone(m_contactAddressBook);
+    EXPECT_EQ(200, m_cloud->getUploadedEntries());
+    EXPECT_EQ(200u, getCloudEntries());
+}
+
+TEST_F(AddressBookDeltaSyncTest, changedContactsUploadOnlyTheChanges) {
+    addContacts(BENCHMARK_CONTACTS);
+    startUploader();
+    connectPhone(m_contactAddressBook);
+
+    // one contact is modified, one is removed and one is added
+    m_contacts[10] = buildContact(10, "+12065550000");
+    m_contacts.erase(20);
+    m_contacts[BENCHMARK_CONTACTS] = buildContact(BENCHMARK_CONTACTS, "+12065559999");
+
+    startUploader();
+    connectPhone(m_contactAddressBook);
+
+    // a lookup, two deletions, and one upload of the modified and the added contact
+    EXPECT_EQ(4, m_cloud->getRequests());
+    EXPECT_EQ(2, m_cloud->getUploadedEntries());
+    auto entryIds = m_cloud->getEntryIds(m_deviceInfo->getDeviceSerialNumber(), "automotive");
+    EXPECT_EQ(static_cast<size_t>(BENCHMARK_CONTACTS), entryIds.size());
+    EXPECT_EQ(entryIds.end(), std::find(entryIds.begin(), entryIds.end(), "contact-20"));
+    EXPECT_NE(
+        entryIds.end(),
+        std::find(entryIds.begin(), entryIds.end(), "contact-" + std::to_string(BENCHMARK_CONTACTS)));
+}
+
+TEST_F(AddressBookDeltaSyncTest, manyChangesUploadInFull) {
+    addContacts(200);
+    startUploader();
+    connectPhone(m_contactAddressBook);
+
+    // deleting the modified contacts one by one costs more requests than uploading all of them saves bytes
+    for (int i = 0; i < 50; i++) {
+        m_contacts[i] = buildContact(i, "+12065550000");
+    }
+    connectPhone(m_contactAddressBook);
+    EXPECT_EQ(200, m_cloud->getUploadedEntries());
+    EXPECT_EQ(200u, getCloudEntries());
+}
+
+TEST_F(AddressBookDeltaSyncTest, fewChangesUploadOnlyTheChangesDespiteMoreRequests) {
+    addContacts(200);
+    startUploader();
+    connectPhone(m_contactAddressBook);
+    auto fullBytes = m_cloud->getUploadedBytes();
+
+    // deleting and uploading the modified contacts takes more requests than a full upload, but fewer bytes
+    for (int i = 0; i < 5; i++) {
+        m_contacts[i] = buildContact(i, "+12065550000");
+    }
+    connectPhone(m_contactAddressBook);
+    EXPECT_GT(m_cloud->getRequests(), 2 + 200 / UPLOAD_BATCH_SIZE);
+    EXPECT_EQ(5, m_cloud->getUploadedEntries());
+    EXPECT_LT(m_cloud->getUploadedBytes(), fullBytes / 10);
+    EXPECT_EQ(200u, getCloudEntries());
+}
+
+TEST_F(AddressBookDeltaSyncTest, differentPhoneUploadsInFull) {
+    addContacts(200);
+    startUploader();
+    connectPhone(m_contactAddressBook);
+
+    auto otherAddressBook = std::make_shared<aace::engine::addressBook::AddressBookEntity>(
+        "2000", "OtherAddressBook", aace::engine::addressBook::AddressBookType::CONTACT);
+    connectPhone(otherAddressBook);
+    EXPECT_EQ(200, m_cloud->getUploadedEntries());
+    EXPECT_EQ(200u, getCloudEntries());
+}
+
+TEST_F(AddressBookDeltaSyncTest, removedCloudAddressBookUploadsInFull) {
+    addContacts(200);
+    startUploader();
+    connectPhone(m_contactAddressBook);
+
+    // the address book is removed from the cloud, as when it expires
+    std::string cloudAddressBookId;
+    m_cloud->getCloudAddressBookId(m_deviceInfo->getDeviceSerialNumber(), "automotive", cloudAddressBookId);
+    m_cloud->deleteCloudAddressBook(cloudAddressBookId);
+
+    connectPhone(m_contactAddressBook);
+    EXPECT_EQ(200, m_cloud->getUploadedEntries());
+    EXPECT_EQ(200u, getCloudEntries());
+}
+
+TEST_F(AddressBookDeltaSyncTest, emptiedThenRefilledAddressBookUploadsEveryEntry) {
+    addContacts(2);
+    startUploader();
+    connectPhone(m_contactAddressBook);
+    EXPECT_EQ(2u, getCloudEntries());
+
+    // the phone reconnects with no contacts, which deletes them from the cloud
+    auto contacts = m_contacts;
+    m_contacts.clear();
+    connectPhone(m_contactAddressBook);
+    EXPECT_EQ(0u, getCloudEntries());
+
+    // the same contacts come back, and are not mistaken for unchanged ones
+    m_contacts = contacts;
+    connectPhone(m_contactAddressBook);
+    EXPECT_EQ(2, m_cloud->getUploadedEntries());
+    EXPECT_EQ(2u, getCloudEntries());
+}
+
+TEST_F(AddressBookDeltaSyncTest, largeAddressBookUploadsWithBoundedMemory) {
+    const int maxConcurrentUploads = 4;
+    addContacts(BENCHMARK_CONTACTS);
+    startUploader(maxConcurrentUploads);
+    connectPhone(m_contactAddressBook);
+    EXPECT_EQ(BENCHMARK_CONTACTS, m_cloud->getUploadedEntries());
+    EXPECT_EQ(static_cast<size_t>(BENCHMARK_CONTACTS), getCloudEntries());
+
+    // the batch being built, the queued batches and the batches in flight, independent of the address book size
+    EXPECT_LE(m_maxBufferedEntries, (2 * maxConcurrentUploads + 1) * UPLOAD_BATCH_SIZE);
+    EXPECT_LE(m_cloud->getMaxUploadsInFlight(), maxConcurrentUploads);
+
+    // uploading started before the platform provided all the entries
+    EXPECT_GT(m_uploadedEntriesWhenProvided, 0);
+}
+
+TEST_F(AddressBookDeltaSyncTest, concurrentUploadsOverlap) {
+    addContacts(1000);
+    m_cloud->setUploadLatency(BENCHMARK_UPLOAD_LATENCY);
+    startUploader(4);
+    connectPhone(m_contactAddressBook);
+    EXPECT_EQ(1000u, getCloudEntries());
+    EXPECT_GT(m_cloud->getMaxUploadsInFlight(), 1);
+    EXPECT_LE(m_cloud->getMaxUploadsInFlight(), 4);
+}
+
+TEST_F(AddressBookDeltaSyncTest, DISABLED_benchmarkUnchangedAddressBookUpload) {
+    addContacts(BENCHMARK_CONTACTS);
+    startUploader();
+    auto fullDuration = connectPhone(m_contactAddressBook);
+    RecordProperty("fullUpload.requests", m_cloud->getRequests());
+    RecordProperty("fullUpload.bytes", static_cast<int>(m_cloud->getUploadedBytes()));
+    RecordProperty("fullUpload.ms", static_cast<int>(fullDuration));
+
+    startUploader();
+    auto deltaDuration = connectPhone(m_contactAddressBook);
+    RecordProperty("unchangedUpload.requests", m_cloud->getRequests());
+    RecordProperty("unchangedUpload.bytes", static_cast<int>(m_cloud->getUploadedBytes()));
+    RecordProperty("unchangedUpload.ms", static_cast<int>(deltaDuration));
+}
+
+TEST_F(AddressBookDeltaSyncTest, DISABLED_benchmarkUnchangedPhoneReconnect) {
+    addContacts(BENCHMARK_CONTACTS);
+
+    // without a grace period the removed address book is deleted, and uploaded in full when the phone reconnects
+    startUploader();
+    connectPhone(m_contactAddressBook);
+    m_addressBookCloudUploader->addressBookRemoved(m_contactAddressBook);
+    auto fullDuration = connectPhone(m_contactAddressBook);
+    RecordProperty("reconnectWithoutGracePeriod.requests", m_cloud->getRequests());
+    RecordProperty("reconnectWithoutGracePeriod.bytes", static_cast<int>(m_cloud->getUploadedBytes()));
+    RecordProperty("reconnectWithoutGracePeriod.ms", static_cast<int>(fullDuration));
+
+    startUploader(
+        aace::engine::addressBook::AddressBookCloudUploader::DEFAULT_MAX_CONCURRENT_UPLOADS, LONG_REMOVE_GRACE_PERIOD);
+    m_addressBookCloudUploader->addressBookRemoved(m_contactAddressBook);
+    auto deltaDuration = connectPhone(m_contactAddressBook);
+    RecordProperty("reconnectWithinGracePeriod.requests", m_cloud->getRequests());
+    RecordProperty("reconnectWithinGracePeriod.bytes", static_cast<int>(m_cloud->getUploadedBytes()));
+    RecordProperty("reconnectWithinGracePeriod.ms", static_cast<int>(deltaDuration));
+}
+
+TEST_F(AddressBookDeltaSyncTest, DISABLED_benchmarkConcurrentUploads) {
+    addContacts(BENCHMARK_CONTACTS);
+    m_cloud->setUploadLatency(BENCHMARK_UPLOAD_LATENCY);
+    startUploader(1);
+    RecordProperty("sequentialUpload.ms", static_cast<int>(connectPhone(m_contactAddressBook)));
+
+    // a different phone is uploaded in full
+    auto otherAddressBook = std::make_shared<aace::engine::addressBook::AddressBookEntity>(
+        "2000", "OtherAddressBook", aace::engine::addressBook::AddressBookType::CONTACT);
+    startUploader(4);
+    RecordProperty("concurrentUpload.ms", static_cast<int>(connectPhone(otherAddressBook)));
+}
+
+}  // namespace addressBook
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
@@ -47,10 +47,13 @@ private:
 
 protected:
     bool postRegister() override;
-    bool configureMessageInterface(const std::string& name, bool enabled, std::istream& configuration) override;
+    bool configureMessageInterface(
+        const std::string& name,
+        bool enabled,
+        const aace::engine::utils::json::Value& configuration) override;
 
 private:
-    bool configureLocalMediaSource(std::istream& configuration);
+    bool configureLocalMediaSource(const aace::engine::utils::json::Value& configuration);
 
 public:
     virtual ~AASBAlexaEngineService() = default;
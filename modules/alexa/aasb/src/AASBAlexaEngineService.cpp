@@ -80,7 +80,7 @@ AASBAlexaEngineService::AASBAlexaEngineService(const aace::engine::core::Service
 bool AASBAlexaEngineService::configureMessageInterface(
     const std::string& name,
     bool enabled,
-    std::istream& configuration) {
+    const aace::engine::utils::json::Value& configuration) {
     try {
         // call inherited configure method
         ThrowIfNot(
@@ -99,10 +99,10 @@ bool AASBAlexaEngineService::configureMessageInterface(
     }
 }
 
-bool AASBAlexaEngineService::configureLocalMediaSource(std::istream& configuration) {
+bool AASBAlexaEngineService::configureLocalMediaSource(const aace::engine::utils::json::Value& configuration) {
     try {
-        auto root = nlohmann::json::parse(configuration);
-        auto localMediaSourceTypes = root["/types"_json_pointer];
+        ThrowIfNot(configuration.is_object(), "invalidLocalMediaSourceConfiguration");
+        auto localMediaSourceTypes = configuration.value("types", nlohmann::json());
 
         // configure the local media source type configurations
         if (localMediaSourceTypes != nullptr) {
@@ -43,6 +43,7 @@
 #include <AASB/Message/Alexa/ExternalMediaAdapter/SeekMessage.h>
 #include <AASB/Message/Alexa/ExternalMediaAdapter/SessionStateExternal.h>
 #include <AASB/Message/Alexa/ExternalMediaAdapter/SetFocusMessage.h>
+#include <AASB/Message/Alexa/ExternalMediaAdapter/StateChangedMessage.h>
 #include <AASB/Message/Alexa/ExternalMediaAdapter/SupportedPlaybackOperation.h>
 #include <AASB/Message/Alexa/ExternalMediaAdapter/ValidationData.h>
 #include <AASB/Message/Alexa/ExternalMediaAdapter/ValidationMethod.h>
@@ -317,6 +318,23 @@ bool AASBExternalMediaAdapter::initialize(
                 }
             });
 
+        messageBroker->subscribe(
+            aasb::message::alexa::externalMediaAdapter::StateChangedMessage::topic(),
+            aasb::message::alexa::externalMediaAdapter::StateChangedMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+
+                    aasb::message::alexa::externalMediaAdapter::StateChangedMessage::Payload payload =
+                        nlohmann::json::parse(message.payload());
+
+                    sp->stateChanged(payload.localPlayerId);
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG, "StateChangedMessage").d("reason", ex.what()));
+                }
+            });
+
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -533,4 +533,18 @@ JNIEXPORT void JNICALL Java_com_amazon_aace_alexa_ExternalMediaAdapter_removeDis
         AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_alexa_ExternalMediaAdapter_removeDiscoveredPlayer", ex.what());
     }
 }
+
+JNIEXPORT void JNICALL Java_com_amazon_aace_alexa_ExternalMediaAdapter_stateChanged(
+    JNIEnv* env,
+    jobject /* this */,
+    jlong ref,
+    jstring localPlayerId) {
+    try {
+        auto externalMediaAdapterBinder = EXTERNAL_MEDIA_ADAPTER_BINDER(ref);
+        ThrowIfNull(externalMediaAdapterBinder, "invalidExternalMediaAdapterBinder");
+        externalMediaAdapterBinder->getExternalMediaAdapter()->stateChanged(JString(localPlayerId).toStdStr());
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, "Java_com_amazon_aace_alexa_ExternalMediaAdapter_stateChanged", ex.what());
+    }
+}
 }
@@ -796,6 +796,16 @@ abstract public class ExternalMediaAdapter extends PlatformInterface {
         removeDiscoveredPlayer(getNativeRef(), localPlayerId);
     }
 
+    /**
+     * Should be called when the state of a local external media player changes. The Engine calls
+     * {@link #getState} outside of context requests and reports the latest state in context from then on.
+     *
+     * @param localPlayerId The opaque token that uniquely identifies the local external player app
+     */
+    final public void stateChanged(String localPlayerId) {
+        stateChanged(getNativeRef(), localPlayerId);
+    }
+
     // NativeRef implementation
     final protected long createNativeRef() {
         return createBinder();
@@ -817,4 +827,5 @@ abstract public class ExternalMediaAdapter extends PlatformInterface {
             long nativeObject, String localPlayerId, String errorName, long code, String description, boolean fatal);
     private native void setFocus(long nativeObject, String localPlayerId);
     private native void removeDiscoveredPlayer(long nativeObject, String localPlayerId);
+    private native void stateChanged(long nativeObject, String localPlayerId);
 }
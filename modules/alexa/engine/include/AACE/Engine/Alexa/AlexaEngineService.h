@@ -314,7 +314,7 @@ public:
 
 protected:
     bool initialize() override;
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) override;
     bool preRegister() override;
     bool setup() override;
     bool start() override;
@@ -446,6 +446,7 @@ private:
     std::mutex m_connectionMutex;
     bool m_encoderEnabled;
     std::string m_encoderName;
+    AudioInputStreamConfiguration m_speechRecognizerAudioInputStreamConfiguration;
     alexaClientSDK::avsCommon::sdkInterfaces::softwareInfo::FirmwareVersion m_firmwareVersion = 1;
     NetworkInfoObserver::NetworkStatus m_networkStatus;
     std::string m_externalMediaPlayerAgent;
@@ -19,6 +19,7 @@
 #include <istream>
 #include <set>
 #include <atomic>
+#include <mutex>
 
 #include <AVSCommon/SDKInterfaces/SpeakerInterface.h>
 #include <AVSCommon/SDKInterfaces/SpeakerManagerInterface.h>
@@ -33,6 +34,7 @@
 #include <AACE/Engine/Audio/IStreamAudioStream.h>
 
 #include "DuckingInterface.h"
+#include "PlaybackPositionTracker.h"
 
 namespace aace {
 namespace engine {
@@ -196,6 +198,7 @@ private:
     std::chrono::milliseconds execGetOffset(
         alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id);
     uint64_t execGetNumBytesBuffered();
+    void execSyncPosition();
     alexaClientSDK::avsCommon::utils::Optional<alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState>
     execGetMediaPlayerState(alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id);
 
@@ -223,6 +226,15 @@ private:
     alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId m_currentId;
     std::string m_url;
     std::chrono::milliseconds m_savedOffset;
+
+    // position of the current source, which answers offset queries without a platform request
+    PlaybackPositionTracker m_positionTracker;
+
+    // last number of bytes buffered reported by the platform, and when it was read
+    std::mutex m_numBytesBufferedMutex;
+    uint64_t m_numBytesBuffered;
+    std::chrono::steady_clock::time_point m_numBytesBufferedTime;
+
     bool m_muted;
     int8_t m_volume;
 
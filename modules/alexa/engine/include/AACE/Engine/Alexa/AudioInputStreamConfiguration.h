@@ -0,0 +1,81 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ALEXA_AUDIO_INPUT_STREAM_CONFIGURATION_H
+#define AACE_ENGINE_ALEXA_AUDIO_INPUT_STREAM_CONFIGURATION_H
+
+#include <chrono>
+#include <memory>
+
+#include <AVSCommon/AVS/AudioInputStream.h>
+#include <AVSCommon/Utils/AudioFormat.h>
+
+#include <AACE/Engine/Utils/JSON/JSON.h>
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+/**
+ * Sizing of an @c AudioInputStream ring buffer. The buffer is resident for as long as the stream
+ * exists, so components that own a stream expose this in their engine configuration:
+ *
+ * @code{.json}
+ * "audioBuffer": {
+ *     "duration": <MILLISECONDS OF AUDIO>,
+ *     "maxReaders": <MAXIMUM NUMBER OF READERS>
+ * }
+ * @endcode
+ */
+class AudioInputStreamConfiguration {
+public:
+    AudioInputStreamConfiguration(std::chrono::milliseconds bufferDuration, size_t maxReaders);
+
+    /**
+     * Updates the configuration from an "audioBuffer" JSON object. Fields that are not present keep
+     * their current value.
+     *
+     * @param configuration The "audioBuffer" JSON object.
+     * @return @c true if the configuration is valid, otherwise @c false and the configuration is unchanged.
+     */
+    bool configure(const aace::engine::utils::json::Value& configuration);
+
+    /**
+     * Creates a stream sized for this configuration.
+     *
+     * @param audioFormat The format of the audio written to the stream.
+     * @return The new stream, or @c nullptr if the stream could not be created.
+     */
+    std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> createStream(
+        const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat) const;
+
+    /**
+     * Returns the size in bytes of the buffer used by @c createStream() for @c audioFormat.
+     */
+    size_t getBufferSize(const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat) const;
+
+    std::chrono::milliseconds getBufferDuration() const;
+    size_t getMaxReaders() const;
+
+private:
+    std::chrono::milliseconds m_bufferDuration;
+    size_t m_maxReaders;
+};
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ALEXA_AUDIO_INPUT_STREAM_CONFIGURATION_H
@@ -16,6 +16,7 @@
 #ifndef AACE_ENGINE_ALEXA_EXTERNAL_MEDIA_ADAPTER_ENGINE_IMPL_H
 #define AACE_ENGINE_ALEXA_EXTERNAL_MEDIA_ADAPTER_ENGINE_IMPL_H
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <set>
@@ -28,8 +29,10 @@
 #include <AVSCommon/SDKInterfaces/MessageSenderInterface.h>
 #include <AVSCommon/SDKInterfaces/SpeakerManagerInterface.h>
 #include <AVSCommon/Utils/RequiresShutdown.h>
+#include <AVSCommon/Utils/Threading/Executor.h>
 
 #include "AACE/Alexa/AlexaEngineInterfaces.h"
+#include "AACE/Engine/Utils/Context/ContextSnapshot.h"
 #include "AACE/Alexa/ExternalMediaAdapter.h"
 
 #include "ExternalMediaAdapterHandler.h"
@@ -45,19 +48,30 @@ private:
     ExternalMediaAdapterEngineImpl(
         std::shared_ptr<aace::alexa::ExternalMediaAdapter> platformMediaAdapter,
         std::shared_ptr<DiscoveredPlayerSenderInterface> discoveredPlayerSender,
-        std::shared_ptr<FocusHandlerInterface> focusHandler);
+        std::shared_ptr<FocusHandlerInterface> focusHandler,
+        std::chrono::milliseconds maxStateAge);
 
     bool initialize(
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerManagerInterface> speakerManager);
 
 public:
+    /// Default age after which the state read when a player reported a change is read again from the platform.
+    static const std::chrono::milliseconds DEFAULT_MAX_STATE_AGE;
+
+    /**
+     * Creates the engine implementation of an external media adapter.
+     *
+     * @param maxStateAge The age after which the state read when a player reported a change is not used for
+     * context, and the state is read from the platform instead.
+     */
     static std::shared_ptr<ExternalMediaAdapterEngineImpl> create(
         std::shared_ptr<aace::alexa::ExternalMediaAdapter> platformMediaAdapter,
         std::shared_ptr<DiscoveredPlayerSenderInterface> discoveredPlayerSender,
         std::shared_ptr<FocusHandlerInterface> focusHandler,
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
-        std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerManagerInterface> speakerManager);
+        std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerManagerInterface> speakerManager,
+        std::chrono::milliseconds maxStateAge = DEFAULT_MAX_STATE_AGE);
 
     // aace::alexa::ExternalMediaAdapterEngineInterface
     void onReportDiscoveredPlayers(const std::vector<DiscoveredPlayerInfo>& discoveredPlayers) override;
@@ -73,6 +87,7 @@ public:
         bool fatal) override;
     void onSetFocus(const std::string& localPlayerId) override;
     void onRemoveDiscoveredPlayer(const std::string& localPlayerId) override;
+    void onStateChanged(const std::string& localPlayerId) override;
 
 protected:
     // ExternalMediaAdapterHandler
@@ -108,8 +123,29 @@ protected:
     void doShutdown() override;
 
 private:
+    /// The state of a player read from the platform, with the time it was read.
+    struct PlatformStateSnapshot {
+        aace::alexa::ExternalMediaAdapter::ExternalMediaAdapterState state;
+        std::chrono::steady_clock::time_point time;
+    };
+
+    /// Reads the state of a player from the platform after it reported a change.
+    void refreshState(const std::string& localPlayerId);
+
+    /// Forgets the state of a player now, and again once the state refreshes queued before this call are done.
+    void removeStateSnapshot(const std::string& localPlayerId);
+
     std::shared_ptr<aace::alexa::ExternalMediaAdapter> m_platformMediaAdapter;
     std::weak_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> m_messageSender;
+
+    /// The latest state of each player which reported a change, keyed by local player id.
+    aace::engine::utils::context::ContextSnapshot<PlatformStateSnapshot> m_stateSnapshot;
+
+    /// The age after which a player state in @c m_stateSnapshot is read again from the platform.
+    const std::chrono::milliseconds m_maxStateAge;
+
+    /// Reads player states off the thread that reported the change.
+    alexaClientSDK::avsCommon::utils::threading::Executor m_stateExecutor;
 };
 
 }  // namespace alexa
@@ -16,7 +16,9 @@
 #ifndef AACE_ENGINE_ALEXA_EXTERNAL_MEDIA_ADAPTER_HANDLER_H
 #define AACE_ENGINE_ALEXA_EXTERNAL_MEDIA_ADAPTER_HANDLER_H
 
+#include <chrono>
 #include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -49,10 +51,15 @@ class ExternalMediaAdapterHandler
         : public alexaClientSDK::avsCommon::sdkInterfaces::ChannelVolumeInterface
         , public ExternalMediaAdapterHandlerInterface
         , public std::enable_shared_from_this<ExternalMediaAdapterHandler> {
+public:
+    /// The time a player is given to provide its state before its last known state is reported instead.
+    static const std::chrono::milliseconds DEFAULT_STATE_REQUEST_TIMEOUT;
+
 protected:
     ExternalMediaAdapterHandler(
         std::shared_ptr<DiscoveredPlayerSenderInterface> discoveredPlayerSender,
-        std::shared_ptr<FocusHandlerInterface> focusHandler);
+        std::shared_ptr<FocusHandlerInterface> focusHandler,
+        std::chrono::milliseconds stateRequestTimeout = DEFAULT_STATE_REQUEST_TIMEOUT);
 
     bool initializeAdapterHandler(
         std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerManagerInterface> speakerManager);
@@ -129,6 +136,7 @@ public:
     bool adjustSeek(const std::string& playerId, std::chrono::milliseconds deltaOffset) override;
     std::vector<AdapterState> getAdapterStates(bool all) override;
     std::chrono::milliseconds getOffset(const std::string& playerId) override;
+    void prefetchAdapterStates() override;
 
     //
     // alexaClientSDK::avsCommon::sdkInterfaces::ChannelVolumeInterface
@@ -149,6 +157,19 @@ protected:
     alexaClientSDK::avsCommon::utils::threading::Executor m_executor;
 
 private:
+    /// A state request to a player, which may outlive the @c getAdapterStates() call that started it.
+    struct StateRequest {
+        /// The state read from the platform, or @c nullptr if the platform failed to provide it.
+        std::shared_future<std::shared_ptr<AdapterState>> result;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    /**
+     * Starts a state request to a player on the executor of the player, or returns the request in progress.
+     * Only one request per player is in progress at any time, so a slow player does not accumulate requests.
+     */
+    StateRequest requestAdapterState(const PlayerInfo& playerInfo);
+
     std::weak_ptr<DiscoveredPlayerSenderInterface> m_discoveredPlayerSender;
 
     std::unordered_map<std::string, PlayerInfo> m_playerInfoMap;
@@ -166,6 +187,24 @@ private:
      * Serializes generic condition. Used for delaying focus state change.
      */
     std::condition_variable m_attemptedSetFocusPlayerInFocusCondition;
+
+    const std::chrono::milliseconds m_stateRequestTimeout;
+
+    /// Serializes access to the state requests and the last known states.
+    std::mutex m_stateMutex;
+
+    /// Whether the handler is shut down, and no more state requests may be started.
+    bool m_stateRequestsStopped;
+
+    /// State requests in progress, keyed by local player id.
+    std::unordered_map<std::string, StateRequest> m_stateRequests;
+
+    /// The last state each player provided, reported when a later request misses its deadline.
+    std::unordered_map<std::string, AdapterState> m_lastAdapterStates;
+
+    /// One executor per player, so that players are queried in parallel and a slow player only delays itself.
+    std::unordered_map<std::string, std::shared_ptr<alexaClientSDK::avsCommon::utils::threading::Executor>>
+        m_stateExecutors;
 };
 
 class FocusHandlerInterface {
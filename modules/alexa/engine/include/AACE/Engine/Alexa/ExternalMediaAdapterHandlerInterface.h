@@ -66,6 +66,13 @@ public:
     virtual bool adjustSeek(const std::string& playerId, std::chrono::milliseconds deltaOffset) = 0;
     virtual std::vector<aace::engine::alexa::AdapterState> getAdapterStates(bool all = true) = 0;
     virtual std::chrono::milliseconds getOffset(const std::string& playerId) = 0;
+
+    /**
+     * Starts reading the state of every player without waiting for it, so that the following calls to
+     * @c getAdapterStates() for several handlers wait for all of their players at the same time.
+     */
+    virtual void prefetchAdapterStates() {
+    }
 };
 
 inline ExternalMediaAdapterHandlerInterface::ExternalMediaAdapterHandlerInterface(const std::string& name) :
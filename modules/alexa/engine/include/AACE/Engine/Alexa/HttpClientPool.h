@@ -0,0 +1,124 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ALEXA_HTTP_CLIENT_POOL_H
+#define AACE_ENGINE_ALEXA_HTTP_CLIENT_POOL_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <AVSCommon/Utils/LibcurlUtils/HttpDelete.h>
+#include <AVSCommon/Utils/LibcurlUtils/HttpGet.h>
+#include <AVSCommon/Utils/LibcurlUtils/HttpPost.h>
+#include <AVSCommon/Utils/LibcurlUtils/HttpPut.h>
+#include <AVSCommon/Utils/LibcurlUtils/HTTPResponse.h>
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+/**
+ * Keeps the curl handles of the engine's REST requests between requests. A handle keeps its connections, DNS
+ * entries and TLS sessions, so requests to the same host reuse a kept-alive connection instead of connecting and
+ * completing a TLS handshake for every request.
+ *
+ * A request takes an idle handle, or creates one when all of them are in use, and gives it back when it completes.
+ * The handles use the curl options set in @c CurlEasyHandleWrapper when they are created, so the pool must be
+ * reset when these options change. A request running while the pool is reset completes with its handle, which is
+ * then discarded. The Alexa engine service resets the pool whenever it changes these options, such as the network
+ * interface or the proxy headers, so a request through the pool always uses the latest options, as a request with
+ * a new handle did.
+ */
+class HttpClientPool {
+private:
+    HttpClientPool(size_t maxIdleClients);
+
+public:
+    using HTTPResponse = alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse;
+
+    /// The number of idle handles of each request method kept by the engine's pool.
+    static const size_t DEFAULT_MAX_IDLE_CLIENTS;
+
+    /**
+     * Returns the pool shared by the engine's REST requests.
+     */
+    static std::shared_ptr<HttpClientPool> getInstance();
+
+    /**
+     * Creates a pool, keeping at most @c maxIdleClients idle handles of each request method.
+     */
+    static std::shared_ptr<HttpClientPool> create(size_t maxIdleClients);
+
+    HTTPResponse doPost(
+        const std::string& url,
+        const std::vector<std::string>& headerLines,
+        const std::vector<std::pair<std::string, std::string>>& data,
+        std::chrono::seconds timeout);
+
+    HTTPResponse doPost(
+        const std::string& url,
+        const std::vector<std::string>& headerLines,
+        const std::string& data,
+        std::chrono::seconds timeout);
+
+    HTTPResponse doGet(const std::string& url, const std::vector<std::string>& headers, std::chrono::seconds timeout);
+
+    HTTPResponse doDelete(
+        const std::string& url,
+        const std::vector<std::string>& headers,
+        std::chrono::seconds timeout);
+
+    HTTPResponse doPut(const std::string& url, const std::vector<std::string>& headers, const std::string& data);
+
+    /**
+     * Closes the idle handles and their connections, so the next requests use the current curl options.
+     */
+    void reset();
+
+    /**
+     * Returns the number of idle handles in the pool.
+     */
+    size_t getIdleClientCount();
+
+private:
+    template <typename Client>
+    HTTPResponse execute(
+        std::vector<std::unique_ptr<Client>> HttpClientPool::*idleClients,
+        std::function<HTTPResponse(Client&)> request);
+
+    size_t m_maxIdleClients;
+
+    /// Incremented when the pool is reset, so the handles in use at that time are not given back to the pool.
+    uint64_t m_generation;
+
+    std::vector<std::unique_ptr<alexaClientSDK::avsCommon::utils::libcurlUtils::HttpPost>> m_idlePostClients;
+    std::vector<std::unique_ptr<alexaClientSDK::avsCommon::utils::libcurlUtils::HttpGet>> m_idleGetClients;
+    std::vector<std::unique_ptr<alexaClientSDK::avsCommon::utils::libcurlUtils::HttpDelete>> m_idleDeleteClients;
+    std::vector<std::unique_ptr<alexaClientSDK::avsCommon::utils::libcurlUtils::HttpPut>> m_idlePutClients;
+
+    std::mutex m_mutex;
+};
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ALEXA_HTTP_CLIENT_POOL_H
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ALEXA_PLAYBACK_POSITION_TRACKER_H
+#define AACE_ENGINE_ALEXA_PLAYBACK_POSITION_TRACKER_H
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+
+#include <AVSCommon/Utils/MediaPlayer/MediaPlayerInterface.h>
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+/**
+ * Estimates the playback position of the current media source without asking the platform.
+ *
+ * The position reported by the platform at each state transition is recorded with the time it was read.
+ * While the media is playing, the position is extrapolated from that point at normal playback speed.
+ * The platform position should be read again every sync interval to correct for drift, buffering
+ * and seeks that are not reported as a state change. All functions are thread safe.
+ */
+class PlaybackPositionTracker {
+public:
+    using SourceId = alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId;
+    using Clock = std::function<std::chrono::steady_clock::time_point()>;
+
+    /**
+     * Constructor.
+     *
+     * @param syncInterval The time after which the estimate should be synchronized with the platform.
+     * @param clock The time source, which may be replaced for testing.
+     */
+    PlaybackPositionTracker(std::chrono::milliseconds syncInterval, Clock clock = std::chrono::steady_clock::now);
+
+    /**
+     * Starts tracking a new source, which is stopped at @c position.
+     *
+     * @param id The source, or @c MediaPlayerInterface::ERROR to stop tracking.
+     * @param position The initial position of the source.
+     */
+    void reset(SourceId id, std::chrono::milliseconds position = std::chrono::milliseconds(0));
+
+    /**
+     * Records a position read from the platform. The update is ignored if @c id is not the tracked source.
+     *
+     * @param id The source the position was read for.
+     * @param position The position reported by the platform.
+     * @param playing Whether the position advances from now on.
+     */
+    void update(SourceId id, std::chrono::milliseconds position, bool playing);
+
+    /**
+     * Returns the estimated position of the tracked source.
+     *
+     * @param id The source to get the position of.
+     * @param [out] position The estimated position.
+     * @return @c false if @c id is not the tracked source, and @c position is not set.
+     */
+    bool getPosition(SourceId id, std::chrono::milliseconds& position) const;
+
+    /**
+     * Claims the next synchronization with the platform if it is due. The caller must then call
+     * @c update() or @c cancelSync().
+     *
+     * @return @c true if a synchronization is due and no other synchronization is pending.
+     */
+    bool startSync();
+
+    /**
+     * Releases a synchronization claimed with @c startSync() which did not produce an update.
+     */
+    void cancelSync();
+
+private:
+    /// Returns the position at @c now. Only call this function on a thread holding @c m_mutex.
+    std::chrono::milliseconds getPositionLocked(std::chrono::steady_clock::time_point now) const;
+
+    const std::chrono::milliseconds m_syncInterval;
+    const Clock m_clock;
+
+    mutable std::mutex m_mutex;
+    SourceId m_id;
+
+    /// Position reported by the platform, at @c m_anchorTime.
+    std::chrono::milliseconds m_anchorPosition;
+    std::chrono::steady_clock::time_point m_anchorTime;
+    bool m_playing;
+    bool m_syncPending;
+};
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ALEXA_PLAYBACK_POSITION_TRACKER_H
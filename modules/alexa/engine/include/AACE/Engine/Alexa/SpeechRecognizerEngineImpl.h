@@ -60,6 +60,7 @@
 #include "AACE/Engine/Wakeword/WakewordManagerDelegateInterface.h"
 #include <AACE/Alexa/AlexaClient.h>
 
+#include "AudioInputStreamConfiguration.h"
 #include "InitiatorVerifier.h"
 #include "WakewordEngineAdapter.h"
 #include "WakewordObserverInterface.h"
@@ -85,7 +86,8 @@ class SpeechRecognizerEngineImpl
 private:
     SpeechRecognizerEngineImpl(
         std::shared_ptr<aace::alexa::SpeechRecognizer> speechRecognizerPlatformInterface,
-        const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat);
+        const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
+        const AudioInputStreamConfiguration& audioInputStreamConfiguration);
 
     bool initialize(
         std::shared_ptr<aace::engine::audio::AudioManagerInterface> audioManager,
@@ -142,7 +144,11 @@ public:
         const std::vector<std::shared_ptr<aace::engine::alexa::InitiatorVerifier>>& initiatorVerifiers =
             std::vector<std::shared_ptr<aace::engine::alexa::InitiatorVerifier>>(),
         std::shared_ptr<alexaClientSDK::multiAgentInterface::AgentManagerInterface> agentManager = nullptr,
-        std::shared_ptr<aace::engine::arbitrator::ArbitratorServiceInterface> arbitratorService = nullptr);
+        std::shared_ptr<aace::engine::arbitrator::ArbitratorServiceInterface> arbitratorService = nullptr,
+        const AudioInputStreamConfiguration& audioInputStreamConfiguration = DEFAULT_AUDIO_INPUT_STREAM_CONFIGURATION);
+
+    /// The default sizing of the speech recognizer audio input stream: 15 seconds of audio and 10 readers.
+    static const AudioInputStreamConfiguration DEFAULT_AUDIO_INPUT_STREAM_CONFIGURATION;
 
     /// @name @c aace::alexa::SpeechRecognizerEngineInterface functions
     /// @{
@@ -313,6 +319,7 @@ private:
     std::shared_ptr<alexaClientSDK::capabilityAgents::aip::AudioInputProcessor> m_audioInputProcessor;
 
     alexaClientSDK::avsCommon::utils::AudioFormat m_audioFormat;
+    AudioInputStreamConfiguration m_audioInputStreamConfiguration;
     std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> m_audioInputStream;
     std::unique_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream::Writer> m_audioInputWriter;
 
@@ -14,12 +14,12 @@
  */
 
 #include <climits>
+#include <future>
 #include <iostream>
+#include <limits>
+#include <sstream>
 #include <typeinfo>
 
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
-
 #include <acsdk/MultiAgent/AgentManagerFactory.h>
 #include <acsdkShutdownManager/ShutdownManager.h>
 #include <ACL/Transport/HTTP2TransportFactory.h>
@@ -59,6 +59,7 @@
 #include <AACE/Engine/Alexa/AlexaAuthorizationProvider.h>
 #include <AACE/Engine/Alexa/AlexaEngineService.h>
 #include <AACE/Engine/Alexa/AuthorizationManagerStorage.h>
+#include <AACE/Engine/Alexa/HttpClientPool.h>
 #include <AACE/Engine/Alexa/VehicleData.h>
 #include <AACE/Engine/Alexa/WakewordObservableInterface.h>
 #include <AACE/Engine/Alexa/InitiatorVerifier.h>
@@ -129,6 +130,8 @@ AlexaEngineService::AlexaEngineService(const aace::engine::core::ServiceDescript
         m_configured(false),
         m_previouslyStarted(false),
         m_encoderEnabled(false),
+        m_speechRecognizerAudioInputStreamConfiguration(
+            SpeechRecognizerEngineImpl::DEFAULT_AUDIO_INPUT_STREAM_CONFIGURATION),
         m_networkStatus(NetworkInfoObserver::NetworkStatus::UNKNOWN),
         m_externalMediaPlayerAgent(""),
         m_speakerManagerEnabled(true),
@@ -297,14 +300,23 @@ bool AlexaEngineService::configureDeviceSDK(std::shared_ptr<std::istream> config
         ThrowIfNull(m_httpPutDelegate, "couldNotCreateHttpPutDelegate");
 
         // Create the capabilities delegate - Allows the client to publish the device's capabilities to Alexa through
-        // the Discovery.AddOrUpdateReport event
-        auto capabilitiesDelegateStorage =
-            alexaClientSDK::capabilitiesDelegate::storage::SQLiteCapabilitiesDelegateStorage::create(config);
-        ThrowIfNull(capabilitiesDelegateStorage, "createCapabilitiesDelegateStorageFailed");
-        m_capabilitiesDelegate = alexaClientSDK::capabilitiesDelegate::CapabilitiesDelegate::create(
-            m_authorizationManager, std::move(capabilitiesDelegateStorage), m_customerDataManager);
-        ThrowIfNull(m_capabilitiesDelegate, "createCapabilitiesDelegateFailed");
-        m_capabilitiesDelegate->addCapabilitiesObserver(shared_from_this());
+        // the Discovery.AddOrUpdateReport event. It opens its database while the components below are created, and
+        // is not used before the post-connect sequencer factory. The task gets its own references to the shared
+        // components, which are not replaced until it is joined. It only registers the delegate as a data handler
+        // of the customer data manager, which the components created meanwhile also do under the manager's lock,
+        // and keeps the authorization manager for later. If this method throws before the task is joined, the
+        // future waits for the task when it is destroyed.
+        auto authorizationManager = m_authorizationManager;
+        auto customerDataManager = m_customerDataManager;
+        auto capabilitiesDelegateFuture =
+            std::async(std::launch::async, [authorizationManager, customerDataManager, config]() {
+                auto capabilitiesDelegateStorage =
+                    alexaClientSDK::capabilitiesDelegate::storage::SQLiteCapabilitiesDelegateStorage::create(config);
+                return capabilitiesDelegateStorage != nullptr
+                           ? alexaClientSDK::capabilitiesDelegate::CapabilitiesDelegate::create(
+                                 authorizationManager, std::move(capabilitiesDelegateStorage), customerDataManager)
+                           : nullptr;
+            });
 
         // Create the Metric Sink in Auto SDK to capture AVS Device SDK metrics
         auto alexaMetricSink = std::unique_ptr<aace::engine::alexa::AlexaMetricSink>(new AlexaMetricSink());
@@ -351,6 +363,10 @@ bool AlexaEngineService::configureDeviceSDK(std::shared_ptr<std::istream> config
                 m_contextManager, m_metricRecorder);
         ThrowIfNull(synchronizeStateSenderFactory, "createSynchronizeStateSenderFactoryFailed");
 
+        m_capabilitiesDelegate = capabilitiesDelegateFuture.get();
+        ThrowIfNull(m_capabilitiesDelegate, "createCapabilitiesDelegateFailed");
+        m_capabilitiesDelegate->addCapabilitiesObserver(shared_from_this());
+
         // Create the post-connect sequencer factory - Creates objects that handle tasks right after the AVS
         // connection is established
         m_postConnectSequencerFactory = alexaClientSDK::acl::PostConnectSequencerFactory::create(
@@ -410,47 +426,56 @@ bool AlexaEngineService::configureDeviceSDK(std::shared_ptr<std::istream> config
     }
 }
 
-bool AlexaEngineService::configure(std::shared_ptr<std::istream> configuration) {
+/// Returns whether a JSON value is an unsigned 32 bit integer.
+static bool isUint(const aace::engine::utils::json::Value& value) {
+    return value.is_number_unsigned() && value.get<uint64_t>() <= std::numeric_limits<uint32_t>::max();
+}
+
+/// Returns whether a JSON object has a member of a type.
+static bool hasMember(
+    const aace::engine::utils::json::Value& object,
+    const std::string& name,
+    aace::engine::utils::json::Type type) {
+    return object.contains(name) && object.at(name).type() == type;
+}
+
+bool AlexaEngineService::configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) {
     try {
-        auto document = aace::engine::utils::json::parse(configuration);
-        ThrowIfNull(document, "parseConfigurationStreamFailed");
+        using Type = aace::engine::utils::json::Type;
 
-        auto alexaConfigRoot = document->GetObject();
+        const auto& alexaConfigRoot = *configuration;
+        ThrowIfNot(alexaConfigRoot.is_object(), "invalidConfiguration");
 
-        rapidjson::Document deviceSDKConfig(rapidjson::kObjectType);
-        auto deviceSDKConfigRoot = deviceSDKConfig.GetObject();
-        // copy the device sdk config from "aace.alexa" first
-        if (alexaConfigRoot.HasMember("avsDeviceSDK") && alexaConfigRoot["avsDeviceSDK"].IsObject()) {
-            ThrowIfNot(
-                aace::engine::utils::json::merge(
-                    deviceSDKConfigRoot, alexaConfigRoot["avsDeviceSDK"].GetObject(), deviceSDKConfig.GetAllocator()),
-                "mergeConfigurationFailed");
+        // copy the device sdk config from "aace.alexa" only, since the defaults are added to it
+        auto deviceSDKConfig = aace::engine::utils::json::Value::object();
+        if (hasMember(alexaConfigRoot, "avsDeviceSDK", Type::object)) {
+            deviceSDKConfig = alexaConfigRoot.at("avsDeviceSDK");
         }
 
-        if (alexaConfigRoot.HasMember("system") && alexaConfigRoot["system"].IsObject()) {
-            auto system = alexaConfigRoot["system"].GetObject();
+        if (hasMember(alexaConfigRoot, "system", Type::object)) {
+            const auto& system = alexaConfigRoot.at("system");
 
-            if (system.HasMember("firmwareVersion") && system["firmwareVersion"].IsUint()) {
-                m_firmwareVersion = system["firmwareVersion"].GetUint();
+            if (system.contains("firmwareVersion") && isUint(system.at("firmwareVersion"))) {
+                m_firmwareVersion = system.at("firmwareVersion").get<uint32_t>();
             }
         }
 
-        if (alexaConfigRoot.HasMember("speakerManager") && alexaConfigRoot["speakerManager"].IsObject()) {
-            auto speakerManager = alexaConfigRoot["speakerManager"].GetObject();
+        if (hasMember(alexaConfigRoot, "speakerManager", Type::object)) {
+            const auto& speakerManager = alexaConfigRoot.at("speakerManager");
 
-            if (speakerManager.HasMember("enabled") && speakerManager["enabled"].IsBool()) {
-                m_speakerManagerEnabled = speakerManager["enabled"].GetBool();
+            if (hasMember(speakerManager, "enabled", Type::boolean)) {
+                m_speakerManagerEnabled = speakerManager.at("enabled").get<bool>();
             }
         }
 
-        if (alexaConfigRoot.HasMember("speechRecognizer") && alexaConfigRoot["speechRecognizer"].IsObject()) {
-            auto speechRecognizer = alexaConfigRoot["speechRecognizer"].GetObject();
+        if (hasMember(alexaConfigRoot, "speechRecognizer", Type::object)) {
+            const auto& speechRecognizer = alexaConfigRoot.at("speechRecognizer");
 
-            if (speechRecognizer.HasMember("encoder") && speechRecognizer["encoder"].IsObject()) {
-                auto encoder = speechRecognizer["encoder"].GetObject();
+            if (hasMember(speechRecognizer, "encoder", Type::object)) {
+                const auto& encoder = speechRecognizer.at("encoder");
 
-                ThrowIfNot(encoder.HasMember("name") && encoder["name"].IsString(), "encoderNameNotSpecified");
-                std::string name = encoder["name"].GetString();
+                ThrowIfNot(hasMember(encoder, "name", Type::string), "encoderNameNotSpecified");
+                std::string name = encoder.at("name").get<std::string>();
 
                 // convert the name to lower case
                 std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) -> unsigned char {
@@ -460,237 +485,128 @@ bool AlexaEngineService::configure(std::shared_ptr<std::istream> configuration)
                 m_encoderName = name;
                 m_encoderEnabled = true;
             }
+
+            if (speechRecognizer.contains("audioBuffer")) {
+                ThrowIfNot(
+                    m_speechRecognizerAudioInputStreamConfiguration.configure(speechRecognizer.at("audioBuffer")),
+                    "invalidSpeechRecognizerAudioBufferConfiguration");
+            }
         }
 
-        if (alexaConfigRoot.HasMember("endpoints") && alexaConfigRoot["endpoints"].IsObject()) {
-            auto endpoints = alexaConfigRoot["endpoints"].GetObject();
+        if (hasMember(alexaConfigRoot, "endpoints", Type::object)) {
+            const auto& endpoints = alexaConfigRoot.at("endpoints");
 
-            if (endpoints.HasMember("avs") && endpoints["avs"].IsString()) {
-                m_avsGateway = endpoints["avs"].GetString();
+            if (hasMember(endpoints, "avs", Type::string)) {
+                m_avsGateway = endpoints.at("avs").get<std::string>();
             }
 
-            if (endpoints.HasMember("lwa") && endpoints["lwa"].IsString()) {
-                m_lwaEndpoint = endpoints["lwa"].GetString();
+            if (hasMember(endpoints, "lwa", Type::string)) {
+                m_lwaEndpoint = endpoints.at("lwa").get<std::string>();
             }
 
-            if (endpoints.HasMember("acms") && endpoints["acms"].IsString()) {
-                m_acmsEndpoint = endpoints["acms"].GetString();
+            if (hasMember(endpoints, "acms", Type::string)) {
+                m_acmsEndpoint = endpoints.at("acms").get<std::string>();
             }
 
-            if (endpoints.HasMember("featureDiscovery") && endpoints["featureDiscovery"].IsString()) {
-                m_featureDiscoveryEndpoint = endpoints["featureDiscovery"].GetString();
+            if (hasMember(endpoints, "featureDiscovery", Type::string)) {
+                m_featureDiscoveryEndpoint = endpoints.at("featureDiscovery").get<std::string>();
             }
         }
 
-        if (alexaConfigRoot.HasMember("externalMediaPlayer") && alexaConfigRoot["externalMediaPlayer"].IsObject()) {
-            auto externalMediaPlayer = alexaConfigRoot["externalMediaPlayer"].GetObject();
+        if (hasMember(alexaConfigRoot, "externalMediaPlayer", Type::object)) {
+            const auto& externalMediaPlayer = alexaConfigRoot.at("externalMediaPlayer");
 
-            if (externalMediaPlayer.HasMember("agent") && externalMediaPlayer["agent"].IsString()) {
-                m_externalMediaPlayerAgent = externalMediaPlayer["agent"].GetString();
+            if (hasMember(externalMediaPlayer, "agent", Type::string)) {
+                m_externalMediaPlayerAgent = externalMediaPlayer.at("agent").get<std::string>();
             }
         }
 
-        if (alexaConfigRoot.HasMember("wakewordEngine") && alexaConfigRoot["wakewordEngine"].IsString()) {
-            m_wakewordEngineName = alexaConfigRoot["wakewordEngine"].GetString();
-        }
-
-        if (deviceSDKConfigRoot.HasMember("deviceSettings")) {
-            if (!deviceSDKConfigRoot["deviceSettings"].HasMember("locales")) {
-                rapidjson::Value locales(rapidjson::kArrayType);
-                auto& allocator = deviceSDKConfig.GetAllocator();
-
-                locales.PushBack("en-US", allocator)
-                    .PushBack("en-GB", allocator)
-                    .PushBack("de-DE", allocator)
-                    .PushBack("en-IN", allocator)
-                    .PushBack("en-CA", allocator)
-                    .PushBack("ja-JP", allocator)
-                    .PushBack("en-AU", allocator)
-                    .PushBack("fr-FR", allocator)
-                    .PushBack("it-IT", allocator)
-                    .PushBack("es-ES", allocator)
-                    .PushBack("es-MX", allocator)
-                    .PushBack("fr-CA", allocator)
-                    .PushBack("es-US", allocator)
-                    .PushBack("hi-IN", allocator)
-                    .PushBack("pt-BR", allocator)
-                    .PushBack("ar-SA", allocator);
-
-                deviceSDKConfigRoot["deviceSettings"].AddMember("locales", std::move(locales), allocator);
-                if (!deviceSDKConfigRoot["deviceSettings"].HasMember("localeCombinations")) {
-                    rapidjson::Value localeCombinations(rapidjson::kArrayType);
-                    localeCombinations.PushBack(
-                        rapidjson::Value(rapidjson::kArrayType)
-                            .Move()
-                            .PushBack("en-US", allocator)
-                            .PushBack("es-US", allocator),
-                        allocator);
-                    localeCombinations.PushBack(
-                        rapidjson::Value(rapidjson::kArrayType)
-                            .Move()
-                            .PushBack("es-US", allocator)
-                            .PushBack("en-US", allocator),
-                        allocator);
-                    localeCombinations.PushBack(
-                        rapidjson::Value(rapidjson::kArrayType)
-                            .Move()
-                            .PushBack("en-IN", allocator)
-                            .PushBack("hi-IN", allocator),
-                        allocator);
-                    localeCombinations.PushBack(
-                        rapidjson::Value(rapidjson::kArrayType)
-                            .Move()
-                            .PushBack("hi-IN", allocator)
-                            .PushBack("en-IN", allocator),
-                        allocator);
-                    localeCombinations.PushBack(
-                        rapidjson::Value(rapidjson::kArrayType)
-                            .Move()
-                            .PushBack("en-CA", allocator)
-                            .PushBack("fr-CA", allocator),
-                        allocator);
-                    localeCombinations.PushBack(
-                        rapidjson::Value(rapidjson::kArrayType)
-                            .Move()
-                            .PushBack("fr-CA", allocator)
-                            .PushBack("en-CA", allocator),
-                        allocator);
-                    localeCombinations.PushBack(
-                        rapidjson::Value(rapidjson::kArrayType)
-                            .Move()
-                            .PushBack("en-US", allocator)
-                            .PushBack("es-ES", allocator),
-                        allocator);
-                    localeCombinations.PushBack(
-                        rapidjson::Value(rapidjson::kArrayType)
-                            .Move()
-                            .PushBack("es-ES", allocator)
-                            .PushBack("en-US", allocator),
-                        allocator);
-                    localeCombinations.PushBack(
-                        rapidjson::Value(rapidjson::kArrayType)
-                            .Move()
-                            .PushBack("en-US", allocator)
-                            .PushBack("de-DE", allocator),
-                        allocator);
-                    localeCombinations.PushBack(
-                        rapidjson::Value(rapidjson::kArrayType)
-                            .Move()
-                            .PushBack("de-DE", allocator)
-                            .PushBack("en-US", allocator),
-                        allocator);
-                    localeCombinations.PushBack(
-                        rapidjson::Value(rapidjson::kArrayType)
-                            .Move()
-                            .PushBack("en-US", allocator)
-                            .PushBack("fr-FR", allocator),
-                        allocator);
-                    localeCombinations.PushBack(
-                        rapidjson::Value(rapidjson::kArrayType)
-                            .Move()
-                            .PushBack("fr-FR", allocator)
-                            .PushBack("en-US", allocator),
-                        allocator);
-                    localeCombinations.PushBack(
-                        rapidjson::Value(rapidjson::kArrayType)
-                            .Move()
-                            .PushBack("en-US", allocator)
-                            .PushBack("it-IT", allocator),
-                        allocator);
-                    localeCombinations.PushBack(
-                        rapidjson::Value(rapidjson::kArrayType)
-                            .Move()
-                            .PushBack("it-IT", allocator)
-                            .PushBack("en-US", allocator),
-                        allocator);
-                    localeCombinations.PushBack(
-                        rapidjson::Value(rapidjson::kArrayType)
-                            .Move()
-                            .PushBack("en-US", allocator)
-                            .PushBack("ja-JP", allocator),
-                        allocator);
-                    localeCombinations.PushBack(
-                        rapidjson::Value(rapidjson::kArrayType)
-                            .Move()
-                            .PushBack("ja-JP", allocator)
-                            .PushBack("en-US", allocator),
-                        allocator);
-                    deviceSDKConfigRoot["deviceSettings"].AddMember(
-                        "localeCombinations", std::move(localeCombinations), allocator);
+        if (hasMember(alexaConfigRoot, "wakewordEngine", Type::string)) {
+            m_wakewordEngineName = alexaConfigRoot.at("wakewordEngine").get<std::string>();
+        }
+
+        if (deviceSDKConfig.contains("deviceSettings")) {
+            auto& deviceSettings = deviceSDKConfig["deviceSettings"];
+            if (!deviceSettings.contains("locales")) {
+                using Value = aace::engine::utils::json::Value;
+
+                deviceSettings["locales"] = Value::array(
+                    {"en-US",
+                     "en-GB",
+                     "de-DE",
+                     "en-IN",
+                     "en-CA",
+                     "ja-JP",
+                     "en-AU",
+                     "fr-FR",
+                     "it-IT",
+                     "es-ES",
+                     "es-MX",
+                     "fr-CA",
+                     "es-US",
+                     "hi-IN",
+                     "pt-BR",
+                     "ar-SA"});
+
+                if (!deviceSettings.contains("localeCombinations")) {
+                    // each combination is an array, since a pair of strings would be read as an object member
+                    deviceSettings["localeCombinations"] = Value::array(
+                        {Value::array({"en-US", "es-US"}),
+                         Value::array({"es-US", "en-US"}),
+                         Value::array({"en-IN", "hi-IN"}),
+                         Value::array({"hi-IN", "en-IN"}),
+                         Value::array({"en-CA", "fr-CA"}),
+                         Value::array({"fr-CA", "en-CA"}),
+                         Value::array({"en-US", "es-ES"}),
+                         Value::array({"es-ES", "en-US"}),
+                         Value::array({"en-US", "de-DE"}),
+                         Value::array({"de-DE", "en-US"}),
+                         Value::array({"en-US", "fr-FR"}),
+                         Value::array({"fr-FR", "en-US"}),
+                         Value::array({"en-US", "it-IT"}),
+                         Value::array({"it-IT", "en-US"}),
+                         Value::array({"en-US", "ja-JP"}),
+                         Value::array({"ja-JP", "en-US"})});
                 }
             }
 
-            if (deviceSDKConfigRoot["deviceSettings"].HasMember("defaultTimezone")) {
-                m_timezone = deviceSDKConfigRoot["deviceSettings"]["defaultTimezone"].GetString();
+            if (deviceSettings.contains("defaultTimezone")) {
+                m_timezone = deviceSettings.at("defaultTimezone").get<std::string>();
             }
         }
 
-        if (deviceSDKConfigRoot.HasMember("templateRuntimeCapabilityAgent")) {
-            auto& allocator = deviceSDKConfig.GetAllocator();
+        // Add the automotive defaults for any fields not provided in configuration
+        auto& templateRuntimeCapabilityAgent = deviceSDKConfig["templateRuntimeCapabilityAgent"];
+        if (!templateRuntimeCapabilityAgent.contains("displayCardTTSFinishedTimeout")) {
+            templateRuntimeCapabilityAgent["displayCardTTSFinishedTimeout"] = DEFAULT_TTS_FINISHED_TIMEOUT_MS.count();
+        }
+        if (!templateRuntimeCapabilityAgent.contains("displayCardAudioPlaybackFinishedTimeout")) {
+            templateRuntimeCapabilityAgent["displayCardAudioPlaybackFinishedTimeout"] =
+                DEFAULT_AUDIO_FINISHED_TIMEOUT_MS.count();
+        }
+        if (!templateRuntimeCapabilityAgent.contains("displayCardAudioPlaybackStoppedPausedTimeout")) {
+            templateRuntimeCapabilityAgent["displayCardAudioPlaybackStoppedPausedTimeout"] =
+                DEFAULT_AUDIO_STOPPED_PAUSED_TIMEOUT_MS.count();
+        }
 
-            // Add defaults for any fields not provided in configuration
-            auto templateRuntimeCapabilityAgentNode = deviceSDKConfigRoot["templateRuntimeCapabilityAgent"].GetObject();
-            if (!templateRuntimeCapabilityAgentNode.HasMember("displayCardTTSFinishedTimeout")) {
-                templateRuntimeCapabilityAgentNode.AddMember(
-                    "displayCardTTSFinishedTimeout",
-                    rapidjson::Value().SetUint64(DEFAULT_TTS_FINISHED_TIMEOUT_MS.count()),
-                    allocator);
-            }
-            if (!templateRuntimeCapabilityAgentNode.HasMember("displayCardAudioPlaybackFinishedTimeout")) {
-                templateRuntimeCapabilityAgentNode.AddMember(
-                    "displayCardAudioPlaybackFinishedTimeout",
-                    rapidjson::Value().SetUint64(DEFAULT_AUDIO_FINISHED_TIMEOUT_MS.count()),
-                    allocator);
-            }
-            if (!templateRuntimeCapabilityAgentNode.HasMember("displayCardAudioPlaybackStoppedPausedTimeout")) {
-                templateRuntimeCapabilityAgentNode.AddMember(
-                    "displayCardAudioPlaybackStoppedPausedTimeout",
-                    rapidjson::Value().SetUint64(DEFAULT_AUDIO_STOPPED_PAUSED_TIMEOUT_MS.count()),
-                    allocator);
-            }
-        } else {
-            auto& allocator = deviceSDKConfig.GetAllocator();
-            rapidjson::Document templateRuntimeCapabilityAgentConfig(rapidjson::kObjectType);
-            auto templateRuntimeCapabilityAgentConfigRoot = templateRuntimeCapabilityAgentConfig.GetObject();
-
-            // Config not provided, adding the automotive default values
-            templateRuntimeCapabilityAgentConfigRoot.AddMember(
-                "displayCardTTSFinishedTimeout",
-                rapidjson::Value().SetUint64(DEFAULT_TTS_FINISHED_TIMEOUT_MS.count()),
-                allocator);
-            templateRuntimeCapabilityAgentConfigRoot.AddMember(
-                "displayCardAudioPlaybackFinishedTimeout",
-                rapidjson::Value().SetUint64(DEFAULT_AUDIO_FINISHED_TIMEOUT_MS.count()),
-                allocator);
-            templateRuntimeCapabilityAgentConfigRoot.AddMember(
-                "displayCardAudioPlaybackStoppedPausedTimeout",
-                rapidjson::Value().SetUint64(DEFAULT_AUDIO_STOPPED_PAUSED_TIMEOUT_MS.count()),
-                allocator);
-
-            deviceSDKConfigRoot.AddMember(
-                "templateRuntimeCapabilityAgent", std::move(templateRuntimeCapabilityAgentConfigRoot), allocator);
-        }
-
-        if (alexaConfigRoot.HasMember("authProvider") && alexaConfigRoot["authProvider"].IsObject()) {
-            auto authProvider = alexaConfigRoot["authProvider"].GetObject();
-            if (authProvider.HasMember("providers") && authProvider["providers"].IsArray()) {
-                for (rapidjson::Value::ConstValueIterator itr = authProvider["providers"].Begin();
-                     itr != authProvider["providers"].End();
-                     itr++) {
-                    ThrowIfNot((*itr).IsString(), "invalidProviders");
-                    m_authProviderNames.push_back((*itr).GetString());
+        if (hasMember(alexaConfigRoot, "authProvider", Type::object)) {
+            const auto& authProvider = alexaConfigRoot.at("authProvider");
+            if (hasMember(authProvider, "providers", Type::array)) {
+                for (const auto& provider : authProvider.at("providers")) {
+                    ThrowIfNot(provider.is_string(), "invalidProviders");
+                    m_authProviderNames.push_back(provider.get<std::string>());
                 }
             }
         }
 
-        if (alexaConfigRoot.HasMember("audio") && alexaConfigRoot["audio"].IsObject()) {
-            auto audio = alexaConfigRoot["audio"].GetObject();
-            if (audio.HasMember("audioOutputType.music") && audio["audioOutputType.music"].IsObject()) {
-                auto audioOutMusic = audio["audioOutputType.music"].GetObject();
-                if (audioOutMusic.HasMember("ducking") && audioOutMusic["ducking"].IsObject()) {
-                    auto ducking = audioOutMusic["ducking"].GetObject();
-                    if (ducking.HasMember("enabled") && ducking["enabled"].IsBool()) {
-                        m_duckingEnabled = ducking["enabled"].GetBool();
+        if (hasMember(alexaConfigRoot, "audio", Type::object)) {
+            const auto& audio = alexaConfigRoot.at("audio");
+            if (hasMember(audio, "audioOutputType.music", Type::object)) {
+                const auto& audioOutMusic = audio.at("audioOutputType.music");
+                if (hasMember(audioOutMusic, "ducking", Type::object)) {
+                    const auto& ducking = audioOutMusic.at("ducking");
+                    if (hasMember(ducking, "enabled", Type::boolean)) {
+                        m_duckingEnabled = ducking.at("enabled").get<bool>();
                         AACE_DEBUG(LX(TAG).d("m_duckingEnabled:", m_duckingEnabled));
                     }
                 } else {
@@ -702,22 +618,20 @@ bool AlexaEngineService::configure(std::shared_ptr<std::istream> configuration)
         } else {
             AACE_WARN(LX(TAG, "m_duckingEnabled")
                           .d("audio", "not found")
-                          .d("check aace.alexa", alexaConfigRoot.HasMember("aace.alexa")));
+                          .d("check aace.alexa", alexaConfigRoot.contains("aace.alexa")));
         }
 
         // MediaPlaybackRequestor
-        if (alexaConfigRoot.HasMember("requestMediaPlayback") && alexaConfigRoot["requestMediaPlayback"].IsObject()) {
-            auto requestMediaPlayback = alexaConfigRoot["requestMediaPlayback"].GetObject();
-            if (requestMediaPlayback.HasMember("mediaResumeThreshold") &&
-                requestMediaPlayback["mediaResumeThreshold"].IsUint64()) {
-                m_mediaResumeThreshold = requestMediaPlayback["mediaResumeThreshold"].GetUint64();
+        if (hasMember(alexaConfigRoot, "requestMediaPlayback", Type::object)) {
+            const auto& requestMediaPlayback = alexaConfigRoot.at("requestMediaPlayback");
+            if (hasMember(requestMediaPlayback, "mediaResumeThreshold", Type::number_unsigned)) {
+                m_mediaResumeThreshold = requestMediaPlayback.at("mediaResumeThreshold").get<uint64_t>();
             }
         }
 
-        rapidjson::StringBuffer buffer;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-        deviceSDKConfig.Accept(writer);
-        AACE_DEBUG(LX(TAG, "Final config").m(buffer.GetString()));
+        // the device sdk config is the only part of the configuration which is serialized
+        auto deviceSDKConfigString = deviceSDKConfig.dump();
+        AACE_DEBUG(LX(TAG, "Final config").m(deviceSDKConfigString));
 
         // configure defaults
         m_audioFormat.sampleRateHz = 16000;
@@ -744,7 +658,8 @@ bool AlexaEngineService::configure(std::shared_ptr<std::istream> configuration)
 
         // configure the avs device sdk
         ThrowIfNot(
-            configureDeviceSDK(aace::engine::utils::json::toStream(deviceSDKConfig)), "configureDeviceSDKFailed");
+            configureDeviceSDK(std::make_shared<std::stringstream>(deviceSDKConfigString)),
+            "configureDeviceSDKFailed");
 
         m_configured = true;
 
@@ -781,18 +696,33 @@ bool AlexaEngineService::preRegister() {
         ThrowIfNull(m_connectionManager, "createConnectionManagerFailed");
         m_avsGatewayManager->setAVSGatewayAssigner(m_connectionManager);
 
-        // Create the device settings delegate - Configures the settings manager
+        // Create the device settings delegate - Configures the settings manager. The settings database is opened
+        // while the certified sender opens the message database and the components below are created. As in
+        // configureDeviceSDK, the task gets its own references to the shared components: the settings manager
+        // registers with the customer data manager under the manager's lock, and the connection manager and metric
+        // recorder are only kept by the delegate until the settings are configured after the task is joined.
         AACE_INFO(LX(TAG).m("Create the device settings delegate"));
-        m_deviceSettingsDelegate = DeviceSettingsDelegate::createDeviceSettingsDelegate(
-            config, m_customerDataManager, m_connectionManager, m_metricRecorder);
-
-        // Create the certified sender - Guarantees messages given to it will be sent to AVS
+        auto customerDataManager = m_customerDataManager;
+        auto connectionManager = m_connectionManager;
+        auto metricRecorder = m_metricRecorder;
+        auto deviceSettingsDelegateFuture =
+            std::async(std::launch::async, [customerDataManager, connectionManager, metricRecorder, config]() {
+                return DeviceSettingsDelegate::createDeviceSettingsDelegate(
+                    config, customerDataManager, connectionManager, metricRecorder);
+            });
+
+        // Create the certified sender - Guarantees messages given to it will be sent to AVS. The certified sender
+        // opens the message database and loads the stored messages when it is created, so it is created on its own
+        // task as well. Like the settings manager, it registers with the customer data manager and adds itself as a
+        // connection status observer under the managers' locks, and it is not used until the task is joined below.
         std::shared_ptr<alexaClientSDK::certifiedSender::SQLiteMessageStorage> messageStorage =
             alexaClientSDK::certifiedSender::SQLiteMessageStorage::create(config);
         ThrowIfNull(messageStorage, "createMessageStorageFailed");
-        m_certifiedSender = alexaClientSDK::certifiedSender::CertifiedSender::create(
-            m_connectionManager, m_connectionManager, messageStorage, m_customerDataManager);
-        ThrowIfNull(m_certifiedSender, "createCertifiedSenderFailed");
+        auto certifiedSenderFuture =
+            std::async(std::launch::async, [connectionManager, messageStorage, customerDataManager]() {
+                return alexaClientSDK::certifiedSender::CertifiedSender::create(
+                    connectionManager, connectionManager, messageStorage, customerDataManager);
+            });
 
         // Create the Alexa interface message sender - Allows capability agents to send Alexa interface response events
         m_alexaMessageSender = alexaClientSDK::capabilityAgents::alexa::AlexaInterfaceMessageSender::create(
@@ -965,6 +895,12 @@ bool AlexaEngineService::preRegister() {
             m_defaultEndpointBuilder->withCapability(m_speakerManager, m_speakerManager);
         }
 
+        m_certifiedSender = certifiedSenderFuture.get();
+        ThrowIfNull(m_certifiedSender, "createCertifiedSenderFailed");
+
+        m_deviceSettingsDelegate = deviceSettingsDelegateFuture.get();
+        ThrowIfNull(m_deviceSettingsDelegate, "createDeviceSettingsDelegateFailed");
+
         if (!m_timezone.empty()) {
             ThrowIfNot(m_deviceSettingsDelegate->configureTimeZoneSetting(m_timezone), "createTimeZoneSettingFailed");
         } else {
@@ -1503,6 +1439,9 @@ bool AlexaEngineService::shutdown() {
         // shutdown the executor
         m_executor.shutdown();
 
+        // close the pooled connections before curl is cleaned up
+        HttpClientPool::getInstance()->reset();
+
         // uninitialize the alexa client
         alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
 
@@ -1985,6 +1924,8 @@ void AlexaEngineService::onNetworkInterfaceChangeStatusChanged(
                 if (currentNetworkInterface != networkInterface) {
                     alexaClientSDK::avsCommon::utils::libcurlUtils::CurlEasyHandleWrapper::setInterfaceName(
                         networkInterface);
+                    // close the pooled connections bound to the previous network interface
+                    HttpClientPool::getInstance()->reset();
                 }
             } else if (NetworkInfoObserver::NetworkInterfaceChangeStatus::COMPLETED == status) {
                 // Enable the AVS connection if it was previously disabled at the begin of
@@ -2006,6 +1947,7 @@ void AlexaEngineService::onNetworkProxyHeadersAvailable(const std::vector<std::s
 
         if (isRunning()) {
             alexaClientSDK::avsCommon::utils::libcurlUtils::CurlEasyHandleWrapper::setProxyHeaders(headers);
+            HttpClientPool::getInstance()->reset();
         }
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -2129,7 +2071,8 @@ bool AlexaEngineService::registerPlatformInterfaceType(
             wakewordService,
             initiatorVerifiers,
             m_agentManager,
-            arbitratorService);
+            arbitratorService,
+            m_speechRecognizerAudioInputStreamConfiguration);
 
         ThrowIfNull(m_speechRecognizerEngineImpl, "createSpeechRecognizerEngineImplFailed");
         m_connectionManager->addConnectionStatusObserver(m_speechRecognizerEngineImpl);
@@ -2827,13 +2770,7 @@ alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse HttpPutDelegate::do
     const std::vector<std::string>& headers,
     const std::string& data) {
     try {
-        // Creating the HttpPut on every doPut is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpPut = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpPut::create();
-        ThrowIfNull(httpPut, "httpPutCreateFailed");
-
-        return httpPut->doPut(url, headers, data);
-
+        return HttpClientPool::getInstance()->doPut(url, headers, data);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "doPut").d("reason", ex.what()));
         return alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse();
@@ -40,6 +40,12 @@ static const std::string METRIC_PROGRAM_NAME_SUFFIX = "AudioChannelEngineImpl";
 static const std::string METRIC_AUDIO_OUTPUT_MEDIA_STATE_CHANGED = "MediaStateChanged";
 static const std::string METRIC_AUDIO_OUTPUT_MEDIA_ERROR = "MediaError";
 
+/// Time after which the extrapolated playback position is corrected with the platform position.
+static const std::chrono::milliseconds POSITION_SYNC_INTERVAL = std::chrono::seconds(5);
+
+/// Time for which the number of bytes buffered reported by the platform is reused.
+static const std::chrono::milliseconds NUM_BYTES_BUFFERED_CACHE_DURATION = std::chrono::seconds(1);
+
 #define LXT LX(TAG).d("name", m_name)
 
 alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId AudioChannelEngineImpl::s_nextId =
@@ -53,6 +59,8 @@ AudioChannelEngineImpl::AudioChannelEngineImpl(
         m_channelVolumeType(channelVolumeType),
         m_currentId(ERROR),
         m_savedOffset(std::chrono::milliseconds(0)),
+        m_positionTracker(POSITION_SYNC_INTERVAL),
+        m_numBytesBuffered(0),
         m_muted(false),
         m_volume(DEFAULT_SPEAKER_VOLUME),
         m_pendingEventState(PendingEventState::NONE),
@@ -363,6 +371,7 @@ void AudioChannelEngineImpl::executeMediaError(SourceId id, MediaError error, co
         });
 
         m_currentId = ERROR;
+        m_positionTracker.reset(ERROR);
     } catch (std::exception& ex) {
         AACE_ERROR(LXT.d("reason", ex.what()).d("id", id));
     }
@@ -373,6 +382,7 @@ void AudioChannelEngineImpl::executePlaybackStarted(SourceId id) {
         ThrowIf(id == ERROR, "invalidSource");
 
         auto offset = std::chrono::milliseconds(m_audioOutputChannel->getPosition());
+        m_positionTracker.update(id, offset, true);
         m_callbackExecutor.submit([this, id, offset] {
             for (auto&& observer : m_mediaPlayerObservers) {
                 if (auto observer_lock = observer.lock()) {
@@ -403,6 +413,7 @@ void AudioChannelEngineImpl::executePlaybackFinished(SourceId id) {
         // save the player offset
         m_savedOffset = offset;
         m_currentId = ERROR;
+        m_positionTracker.reset(ERROR);
     } catch (std::exception& ex) {
         AACE_ERROR(LXT.d("reason", ex.what()).d("expectedState", m_pendingEventState).d("id", id));
     }
@@ -413,6 +424,7 @@ void AudioChannelEngineImpl::executePlaybackPaused(SourceId id) {
         ThrowIf(id == ERROR, "invalidSource");
 
         auto offset = std::chrono::milliseconds(m_audioOutputChannel->getPosition());
+        m_positionTracker.update(id, offset, false);
         m_callbackExecutor.submit([this, id, offset] {
             for (auto&& observer : m_mediaPlayerObservers) {
                 if (auto observer_lock = observer.lock()) {
@@ -434,6 +446,7 @@ void AudioChannelEngineImpl::executePlaybackResumed(SourceId id) {
         ThrowIf(id == ERROR, "invalidSource");
 
         auto offset = std::chrono::milliseconds(m_audioOutputChannel->getPosition());
+        m_positionTracker.update(id, offset, true);
         m_callbackExecutor.submit([this, id, offset] {
             for (auto&& observer : m_mediaPlayerObservers) {
                 if (auto observer_lock = observer.lock()) {
@@ -452,6 +465,7 @@ void AudioChannelEngineImpl::executePlaybackStopped(SourceId id) {
         ThrowIf(id == ERROR, "invalidSource");
 
         auto offset = std::chrono::milliseconds(m_audioOutputChannel->getPosition());
+        m_positionTracker.update(id, offset, false);
         m_callbackExecutor.submit([this, id, offset] {
             for (auto&& observer : m_mediaPlayerObservers) {
                 if (auto observer_lock = observer.lock()) {
@@ -486,6 +500,7 @@ void AudioChannelEngineImpl::executePlaybackError(SourceId id, MediaError error,
         });
 
         m_currentId = ERROR;
+        m_positionTracker.reset(ERROR);
     } catch (std::exception& ex) {
         AACE_ERROR(LXT.d("reason", ex.what()).d("id", id).d("error", error).d("description", description));
     }
@@ -496,6 +511,7 @@ void AudioChannelEngineImpl::executeBufferUnderrun(SourceId id) {
         ThrowIf(id == ERROR, "invalidSource");
 
         auto offset = std::chrono::milliseconds(m_audioOutputChannel->getPosition());
+        m_positionTracker.update(id, offset, false);
         m_callbackExecutor.submit([this, id, offset] {
             for (auto&& observer : m_mediaPlayerObservers) {
                 if (auto observer_lock = observer.lock()) {
@@ -514,6 +530,7 @@ void AudioChannelEngineImpl::executeBufferRefilled(SourceId id) {
         ThrowIf(id == ERROR, "invalidSource");
 
         auto offset = std::chrono::milliseconds(m_audioOutputChannel->getPosition());
+        m_positionTracker.update(id, offset, true);
         m_callbackExecutor.submit([this, id, offset] {
             for (auto&& observer : m_mediaPlayerObservers) {
                 if (auto observer_lock = observer.lock()) {
@@ -535,6 +552,10 @@ void AudioChannelEngineImpl::resetSource() {
     m_mediaStateChangeInitiator = MediaStateChangeInitiator::NONE;
     m_url.clear();
     m_savedOffset = std::chrono::milliseconds(0);
+    m_positionTracker.reset(ERROR);
+
+    std::lock_guard<std::mutex> lock(m_numBytesBufferedMutex);
+    m_numBytesBufferedTime = std::chrono::steady_clock::time_point();
 }
 
 void AudioChannelEngineImpl::execDuckingStarted() {
@@ -598,6 +619,8 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
             m_attachmentReader = reader;
             ThrowIfNot(outputChannel->prepare(reader, false), "audioOutputChannelPrepareFailed");
         }
+
+        m_positionTracker.reset(m_currentId);
     } catch (std::exception& ex) {
         AACE_ERROR(LXT.d("reason", ex.what()).d("id", m_currentId).d("type", "attachment"));
         resetSource();
@@ -638,6 +661,8 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
             ThrowIfNot(outputChannel->prepare(reader, false), "audioOutputChannelPrepareFailed");
             ThrowIfNot(outputChannel->setPosition(offsetAdjustment.count()), "platformMediaPlayerSetPositionFailed");
         }
+
+        m_positionTracker.reset(m_currentId, offsetAdjustment);
     } catch (std::exception& ex) {
         AACE_ERROR(LXT.d("reason", ex.what()).d("id", m_currentId).d("type", "attachment"));
         resetSource();
@@ -699,6 +724,8 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
                 m_mayDuck = false;
             }
         }
+
+        m_positionTracker.reset(m_currentId);
     } catch (std::exception& ex) {
         AACE_ERROR(LXT.d("reason", ex.what())
                        .d("expectedState", m_pendingEventState)
@@ -749,6 +776,8 @@ alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId Au
             }
             ThrowIfNot(outputChannel->setPosition(offset.count()), "audioOutputChannelSetPositionFailed");
         }
+
+        m_positionTracker.reset(m_currentId, offset);
     } catch (std::exception& ex) {
         AACE_ERROR(LXT.d("reason", ex.what()).d("url", url).d("repeat", repeat).d("id", m_currentId));
         resetSource();
@@ -897,6 +926,13 @@ bool AudioChannelEngineImpl::execResume(
 
 std::chrono::milliseconds AudioChannelEngineImpl::getOffset(
     alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId id) {
+    std::chrono::milliseconds offset;
+    if (m_positionTracker.getPosition(id, offset)) {
+        if (m_positionTracker.startSync()) {
+            m_executor.submit([this] { execSyncPosition(); });
+        }
+        return offset;
+    }
     return m_executor.submit([this, id] { return execGetOffset(id); }).get();
 }
 
@@ -917,6 +953,7 @@ std::chrono::milliseconds AudioChannelEngineImpl::execGetOffset(
 
         std::chrono::milliseconds offset = std::chrono::milliseconds(m_audioOutputChannel->getPosition());
         ThrowIf(offset.count() < 0, "invalidMediaTime");
+        m_positionTracker.update(id, offset, m_currentMediaState == MediaState::PLAYING);
 
         return offset;
     } catch (std::exception& ex) {
@@ -925,21 +962,55 @@ std::chrono::milliseconds AudioChannelEngineImpl::execGetOffset(
     }
 }
 
+void AudioChannelEngineImpl::execSyncPosition() {
+    try {
+        ThrowIf(m_currentId == ERROR, "invalidSource");
+        ThrowIfNull(m_audioOutputChannel, "invalidAudioOutputChannel");
+
+        std::chrono::milliseconds offset = std::chrono::milliseconds(m_audioOutputChannel->getPosition());
+        ThrowIf(offset.count() < 0, "invalidMediaTime");
+        m_positionTracker.update(m_currentId, offset, m_currentMediaState == MediaState::PLAYING);
+    } catch (std::exception& ex) {
+        AACE_WARN(LXT.d("reason", ex.what()).d("id", m_currentId));
+        m_positionTracker.cancelSync();
+    }
+}
+
 uint64_t AudioChannelEngineImpl::getNumBytesBuffered() {
+    {
+        std::lock_guard<std::mutex> lock(m_numBytesBufferedMutex);
+        if (std::chrono::steady_clock::now() - m_numBytesBufferedTime < NUM_BYTES_BUFFERED_CACHE_DURATION) {
+            return m_numBytesBuffered;
+        }
+    }
     auto future = m_executor.submit([this] { return execGetNumBytesBuffered(); });
     return future.valid() ? future.get() : 0;
 }
 
 uint64_t AudioChannelEngineImpl::execGetNumBytesBuffered() {
+    uint64_t numBytesBuffered = 0;
     if (m_audioOutputChannel != nullptr) {
-        return (uint64_t)m_audioOutputChannel->getNumBytesBuffered();
+        numBytesBuffered = (uint64_t)m_audioOutputChannel->getNumBytesBuffered();
     }
-    return 0;
+    std::lock_guard<std::mutex> lock(m_numBytesBufferedMutex);
+    m_numBytesBuffered = numBytesBuffered;
+    m_numBytesBufferedTime = std::chrono::steady_clock::now();
+    return numBytesBuffered;
 }
 
 alexaClientSDK::avsCommon::utils::Optional<alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState>
 AudioChannelEngineImpl::getMediaPlayerState(SourceId id) {
     AACE_INFO(LXT);
+    std::chrono::milliseconds offset;
+    if (m_positionTracker.getPosition(id, offset)) {
+        if (m_positionTracker.startSync()) {
+            m_executor.submit([this] { execSyncPosition(); });
+        }
+        auto optional = alexaClientSDK::avsCommon::utils::Optional<
+            alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState>();
+        optional.set(alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState{offset});
+        return optional;
+    }
     return m_executor.submit([this, id] { return execGetMediaPlayerState(id); }).get();
 }
 
@@ -953,8 +1024,9 @@ AudioChannelEngineImpl::execGetMediaPlayerState(SourceId id) {
         return optional;
     }
     if (m_audioOutputChannel != nullptr) {
-        optional.set(alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState{
-            std::chrono::milliseconds(m_audioOutputChannel->getPosition())});
+        auto offset = std::chrono::milliseconds(m_audioOutputChannel->getPosition());
+        m_positionTracker.update(id, offset, m_currentMediaState == MediaState::PLAYING);
+        optional.set(alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerState{offset});
     }
     return optional;
 }
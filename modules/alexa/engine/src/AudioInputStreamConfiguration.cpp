@@ -0,0 +1,111 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <climits>
+
+#include "AACE/Engine/Alexa/AudioInputStreamConfiguration.h"
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.alexa.AudioInputStreamConfiguration");
+
+/// Largest accepted buffer duration, which guards against a misconfigured unit.
+static const uint64_t MAX_BUFFER_DURATION_MS = std::chrono::milliseconds(std::chrono::minutes(1)).count();
+
+AudioInputStreamConfiguration::AudioInputStreamConfiguration(
+    std::chrono::milliseconds bufferDuration,
+    size_t maxReaders) :
+        m_bufferDuration(bufferDuration), m_maxReaders(maxReaders) {
+}
+
+bool AudioInputStreamConfiguration::configure(const aace::engine::utils::json::Value& configuration) {
+    try {
+        ThrowIfNot(configuration.is_object(), "invalidConfiguration");
+
+        auto bufferDuration = m_bufferDuration;
+        auto maxReaders = m_maxReaders;
+
+        if (configuration.contains("duration")) {
+            auto& duration = configuration.at("duration");
+            ThrowIfNot(duration.is_number_unsigned(), "invalidDuration");
+            auto durationMs = duration.get<uint64_t>();
+            ThrowIf(durationMs == 0 || durationMs > MAX_BUFFER_DURATION_MS, "durationOutOfRange");
+            bufferDuration = std::chrono::milliseconds(durationMs);
+        }
+
+        if (configuration.contains("maxReaders")) {
+            auto& readers = configuration.at("maxReaders");
+            ThrowIfNot(readers.is_number_unsigned() && readers.get<uint64_t>() <= UINT_MAX, "invalidMaxReaders");
+            maxReaders = readers.get<size_t>();
+            ThrowIf(maxReaders == 0, "maxReadersOutOfRange");
+        }
+
+        m_bufferDuration = bufferDuration;
+        m_maxReaders = maxReaders;
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+size_t AudioInputStreamConfiguration::getBufferSize(
+    const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat) const {
+    size_t wordSize = audioFormat.sampleSizeInBits / CHAR_BIT;
+    size_t words = static_cast<size_t>(audioFormat.sampleRateHz) * m_bufferDuration.count() / 1000;
+    return alexaClientSDK::avsCommon::avs::AudioInputStream::calculateBufferSize(words, wordSize, m_maxReaders);
+}
+
+std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> AudioInputStreamConfiguration::createStream(
+    const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat) const {
+    try {
+        size_t wordSize = audioFormat.sampleSizeInBits / CHAR_BIT;
+        size_t size = getBufferSize(audioFormat);
+        ThrowIf(size == 0, "invalidBufferSize");
+
+        auto buffer = std::make_shared<alexaClientSDK::avsCommon::avs::AudioInputStream::Buffer>(size);
+        ThrowIfNull(buffer, "couldNotCreateAudioInputBuffer");
+
+        auto stream = alexaClientSDK::avsCommon::avs::AudioInputStream::create(buffer, wordSize, m_maxReaders);
+        ThrowIfNull(stream, "couldNotCreateAudioInputStream");
+
+        AACE_DEBUG(LX(TAG)
+                       .d("bufferSize", size)
+                       .d("durationMs", m_bufferDuration.count())
+                       .d("maxReaders", m_maxReaders));
+
+        return stream;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+std::chrono::milliseconds AudioInputStreamConfiguration::getBufferDuration() const {
+    return m_bufferDuration;
+}
+
+size_t AudioInputStreamConfiguration::getMaxReaders() const {
+    return m_maxReaders;
+}
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
@@ -60,13 +60,18 @@ static const std::string METRIC_EXTERNALMEDIAPLAYER_PLAYER_EVENT = "PlayerEvent"
 static const std::string METRIC_EXTERNALMEDIAPLAYER_PLAYER_ERROR = "PlayerError";
 static const std::string METRIC_EXTERNALMEDIAPLAYER_SET_FOCUS = "SetFocus";
 static const std::string METRIC_EXTERNALMEDIAPLAYER_REMOVE_DISCOVERED_PLAYER = "RemoveDiscoveredPlayer";
+static const std::string METRIC_EXTERNALMEDIAPLAYER_STATE_CHANGED = "StateChanged";
+
+const std::chrono::milliseconds ExternalMediaAdapterEngineImpl::DEFAULT_MAX_STATE_AGE = std::chrono::seconds(30);
 
 ExternalMediaAdapterEngineImpl::ExternalMediaAdapterEngineImpl(
     std::shared_ptr<aace::alexa::ExternalMediaAdapter> platformMediaAdapter,
     std::shared_ptr<DiscoveredPlayerSenderInterface> discoveredPlayerSender,
-    std::shared_ptr<FocusHandlerInterface> focusHandler) :
+    std::shared_ptr<FocusHandlerInterface> focusHandler,
+    std::chrono::milliseconds maxStateAge) :
         aace::engine::alexa::ExternalMediaAdapterHandler(discoveredPlayerSender, focusHandler),
-        m_platformMediaAdapter(platformMediaAdapter) {
+        m_platformMediaAdapter(platformMediaAdapter),
+        m_maxStateAge(maxStateAge) {
 }
 
 std::shared_ptr<ExternalMediaAdapterEngineImpl> ExternalMediaAdapterEngineImpl::create(
@@ -74,17 +79,20 @@ std::shared_ptr<ExternalMediaAdapterEngineImpl> ExternalMediaAdapterEngineImpl::
     std::shared_ptr<DiscoveredPlayerSenderInterface> discoveredPlayerSender,
     std::shared_ptr<FocusHandlerInterface> focusHandler,
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
-    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerManagerInterface> speakerManager) {
+    std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerManagerInterface> speakerManager,
+    std::chrono::milliseconds maxStateAge) {
     std::shared_ptr<ExternalMediaAdapterEngineImpl> externalMediaAdapterEngineImpl = nullptr;
 
     try {
         ThrowIfNull(platformMediaAdapter, "invalidPlatformMediaAdapter");
         ThrowIfNull(discoveredPlayerSender, "invalidDiscoveredPlayerSender");
         ThrowIfNull(focusHandler, "invalidFocusHandler");
+        ThrowIf(maxStateAge.count() < 0, "invalidMaxStateAge");
 
         // create the external media adapter engine implementation
-        externalMediaAdapterEngineImpl = std::shared_ptr<ExternalMediaAdapterEngineImpl>(
-            new ExternalMediaAdapterEngineImpl(platformMediaAdapter, discoveredPlayerSender, focusHandler));
+        externalMediaAdapterEngineImpl =
+            std::shared_ptr<ExternalMediaAdapterEngineImpl>(new ExternalMediaAdapterEngineImpl(
+                platformMediaAdapter, discoveredPlayerSender, focusHandler, maxStateAge));
         ThrowIfNot(
             externalMediaAdapterEngineImpl->initialize(messageSender, speakerManager),
             "initializeExternalMediaAdapterEngineImplFailed");
@@ -240,12 +248,33 @@ bool ExternalMediaAdapterEngineImpl::handleGetAdapterState(
     const std::string& localPlayerId,
     aace::engine::alexa::AdapterState& state) {
     try {
-        aace::alexa::ExternalMediaAdapter::ExternalMediaAdapterState platformState;
+        PlatformStateSnapshot snapshot;
+        auto& platformState = snapshot.state;
+
+        // a player which stopped reporting its changes is queried again once its last state is too old
+        auto age = std::chrono::milliseconds::max();
+        if (m_stateSnapshot.get(localPlayerId, snapshot)) {
+            age = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - snapshot.time);
+        }
 
-        // get the external media adapter state from the platform interface
-        ThrowIfNot(
-            m_platformMediaAdapter->getState(localPlayerId, platformState),
-            "getPlatformExternalMediaAdapterStateFailed");
+        if (age < m_maxStateAge) {
+            // the state was read when the platform reported the change, so only the offset has moved since, and it
+            // cannot move past the end of a track of known duration
+            auto& playbackState = platformState.playbackState;
+            if (playbackState.state == "PLAYING") {
+                playbackState.trackOffset += age;
+                if (playbackState.duration.count() > 0 && playbackState.trackOffset > playbackState.duration) {
+                    playbackState.trackOffset = playbackState.duration;
+                }
+            }
+        } else {
+            // get the external media adapter state from the platform interface, without the fields of a stale state
+            snapshot = PlatformStateSnapshot();
+            ThrowIfNot(
+                m_platformMediaAdapter->getState(localPlayerId, platformState),
+                "getPlatformExternalMediaAdapterStateFailed");
+        }
 
         // session state
         if (platformState.sessionState.spiVersion.empty() == false) {
@@ -410,6 +439,10 @@ void ExternalMediaAdapterEngineImpl::onReportDiscoveredPlayers(
         "onReportDiscoveredPlayers",
         {METRIC_EXTERNALMEDIAPLAYER_REPORT_DISCOVERED_PLAYERS});
     try {
+        // a rediscovered player reports its state again
+        for (const auto& next : discoveredPlayers) {
+            removeStateSnapshot(next.localPlayerId);
+        }
         reportDiscoveredPlayers(discoveredPlayers);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "onReportDiscoveredPlayers").d("reason", ex.what()));
@@ -563,17 +596,54 @@ void ExternalMediaAdapterEngineImpl::onRemoveDiscoveredPlayer(const std::string&
     emitCounterMetrics(
         METRIC_PROGRAM_NAME_SUFFIX, "onRemoveDiscoveredPlayer", {METRIC_EXTERNALMEDIAPLAYER_REMOVE_DISCOVERED_PLAYER});
     try {
+        removeStateSnapshot(localPlayerId);
         ThrowIfNot(removeDiscoveredPlayer(localPlayerId), "removeDiscoveredPlayerFailed");
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "onRemoveDiscoveredPlayer").d("reason", ex.what()).d("localPlayerId", localPlayerId));
     }
 }
 
+void ExternalMediaAdapterEngineImpl::onStateChanged(const std::string& localPlayerId) {
+    emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "onStateChanged", {METRIC_EXTERNALMEDIAPLAYER_STATE_CHANGED});
+    try {
+        ThrowIfNot(validatePlayer(localPlayerId, false), "invalidPlayerId");
+        // the platform may only answer getState() once this call returns
+        m_stateExecutor.submit([this, localPlayerId]() { refreshState(localPlayerId); });
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "onStateChanged").d("reason", ex.what()).d("localPlayerId", localPlayerId));
+    }
+}
+
+void ExternalMediaAdapterEngineImpl::refreshState(const std::string& localPlayerId) {
+    try {
+        PlatformStateSnapshot snapshot;
+        snapshot.time = std::chrono::steady_clock::now();
+        ThrowIfNot(
+            m_platformMediaAdapter->getState(localPlayerId, snapshot.state),
+            "getPlatformExternalMediaAdapterStateFailed");
+        m_stateSnapshot.update(localPlayerId, std::move(snapshot));
+    } catch (std::exception& ex) {
+        // query the platform during the next context request instead
+        m_stateSnapshot.remove(localPlayerId);
+        AACE_ERROR(LX(TAG, "refreshState").d("reason", ex.what()).d("localPlayerId", localPlayerId));
+    }
+}
+
+void ExternalMediaAdapterEngineImpl::removeStateSnapshot(const std::string& localPlayerId) {
+    // remove the state again after the refreshes already queued for the player, which would otherwise store it
+    m_stateSnapshot.remove(localPlayerId);
+    m_stateExecutor.submit([this, localPlayerId]() { m_stateSnapshot.remove(localPlayerId); });
+}
+
 //
 // alexaClientSDK::avsCommon::utils::RequiresShutdown
 //
 
 void ExternalMediaAdapterEngineImpl::doShutdown() {
+    // stop reading player states before releasing the platform interface
+    m_stateExecutor.shutdown();
+    m_stateSnapshot.clear();
+
     if (m_platformMediaAdapter != nullptr) {
         m_platformMediaAdapter->setEngineInterface(nullptr);
         m_platformMediaAdapter.reset();
@@ -17,6 +17,7 @@
 
 #include "AACE/Engine/Alexa/ExternalMediaAdapterHandler.h"
 #include "AACE/Engine/Core/EngineMacros.h"
+#include "AACE/Engine/Utils/Metrics/Metrics.h"
 
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
@@ -27,6 +28,8 @@ namespace aace {
 namespace engine {
 namespace alexa {
 
+using namespace aace::engine::utils::metrics;
+
 static const uint8_t DEFAULT_SPEAKER_VOLUME = 50;
 
 /// Timeout for setting focus operation.
@@ -38,14 +41,45 @@ static const std::string TAG("aace.alexa.ExternalMediaAdapterHandler");
 // external media player agent constant
 static const std::string EXTERNAL_MEDIA_PLAYER_AGENT = "alexaAutoSDK";
 
+/// Program Name for Metrics
+static const std::string METRIC_PROGRAM_NAME_SUFFIX = "ExternalMediaAdapterHandler";
+
+/// Metric for the time a player took to provide its state
+static const std::string METRIC_EXTERNALMEDIAPLAYER_GET_ADAPTER_STATE_LATENCY = "GetAdapterStateLatency";
+
+/// Metric for a player which did not provide its state before the deadline
+static const std::string METRIC_EXTERNALMEDIAPLAYER_GET_ADAPTER_STATE_TIMEOUT = "GetAdapterStateTimeout";
+
+const std::chrono::milliseconds ExternalMediaAdapterHandler::DEFAULT_STATE_REQUEST_TIMEOUT =
+    std::chrono::milliseconds(1000);
+
+/// Sets the fields of @c state which the engine owns, rather than the platform.
+static void applyPlayerInfo(const PlayerInfo& playerInfo, AdapterState& state) {
+    state.sessionState.playerId = playerInfo.playerId;
+    state.sessionState.skillToken = playerInfo.skillToken;
+    state.sessionState.playbackSessionId = playerInfo.playbackSessionId;
+    state.playbackState.playerId = playerInfo.playerId;
+}
+
+/// Returns the state reported for a player before the platform provides it.
+static AdapterState createDefaultAdapterState(const PlayerInfo& playerInfo) {
+    AdapterState state;
+    state.sessionState.spiVersion = playerInfo.spiVersion;
+    applyPlayerInfo(playerInfo, state);
+    return state;
+}
+
 ExternalMediaAdapterHandler::ExternalMediaAdapterHandler(
     std::shared_ptr<DiscoveredPlayerSenderInterface> discoveredPlayerSender,
-    std::shared_ptr<FocusHandlerInterface> focusHandler) :
+    std::shared_ptr<FocusHandlerInterface> focusHandler,
+    std::chrono::milliseconds stateRequestTimeout) :
         ExternalMediaAdapterHandlerInterface::ExternalMediaAdapterHandlerInterface(TAG),
         m_focusHandler(focusHandler),
         m_discoveredPlayerSender(discoveredPlayerSender),
         m_muted(false),
-        m_volume(DEFAULT_SPEAKER_VOLUME) {
+        m_volume(DEFAULT_SPEAKER_VOLUME),
+        m_stateRequestTimeout(stateRequestTimeout),
+        m_stateRequestsStopped(false) {
 }
 
 bool ExternalMediaAdapterHandler::initializeAdapterHandler(
@@ -369,24 +403,49 @@ bool ExternalMediaAdapterHandler::adjustSeek(const std::string& playerId, std::c
 std::vector<aace::engine::alexa::AdapterState> ExternalMediaAdapterHandler::getAdapterStates(bool all) {
     try {
         std::vector<aace::engine::alexa::AdapterState> adapterStateList;
+        std::vector<std::pair<PlayerInfo, StateRequest>> stateRequests;
 
         for (const auto& next : m_playerInfoMap) {
-            auto playerInfo = next.second;
-            aace::engine::alexa::AdapterState state;
+            if (all) {
+                // ask every player before waiting for any of them
+                stateRequests.emplace_back(next.second, requestAdapterState(next.second));
+            } else {
+                adapterStateList.push_back(createDefaultAdapterState(next.second));
+            }
+        }
 
-            // default session state
-            state.sessionState.playerId = playerInfo.playerId;
-            state.sessionState.skillToken = playerInfo.skillToken;
-            state.sessionState.playbackSessionId = playerInfo.playbackSessionId;
-            state.sessionState.spiVersion = playerInfo.spiVersion;
+        for (const auto& next : stateRequests) {
+            const auto& playerInfo = next.first;
+            const auto& stateRequest = next.second;
+            auto state = createDefaultAdapterState(playerInfo);
 
-            // default playback state
-            state.playbackState.playerId = playerInfo.playerId;
+            std::shared_ptr<AdapterState> result;
+            if (stateRequest.result.valid() &&
+                stateRequest.result.wait_until(stateRequest.deadline) == std::future_status::ready) {
+                result = stateRequest.result.get();
+            }
 
-            if (all) {
-                // get the player state from the adapter implementation
-                ThrowIfNot(handleGetAdapterState(playerInfo.localPlayerId, state), "handleGetAdapterStateFailed");
+            if (result != nullptr) {
+                state = *result;
+            } else {
+                emitCounterMetrics(
+                    METRIC_PROGRAM_NAME_SUFFIX,
+                    "getAdapterStates",
+                    {METRIC_EXTERNALMEDIAPLAYER_GET_ADAPTER_STATE_TIMEOUT});
+                std::lock_guard<std::mutex> lock(m_stateMutex);
+                auto it = m_lastAdapterStates.find(playerInfo.localPlayerId);
+                bool hasLastState = it != m_lastAdapterStates.end();
+                if (hasLastState) {
+                    state = it->second;
+                }
+                AACE_WARN(LX(TAG, "getAdapterStates")
+                              .d("reason", "adapterStateUnavailable")
+                              .d("localPlayerId", playerInfo.localPlayerId)
+                              .d("usingLastState", hasLastState));
             }
+
+            // the player info may have changed since the state was read
+            applyPlayerInfo(playerInfo, state);
             adapterStateList.push_back(state);
         }
 
@@ -397,6 +456,68 @@ std::vector<aace::engine::alexa::AdapterState> ExternalMediaAdapterHandler::getA
     }
 }
 
+void ExternalMediaAdapterHandler::prefetchAdapterStates() {
+    for (const auto& next : m_playerInfoMap) {
+        requestAdapterState(next.second);
+    }
+}
+
+ExternalMediaAdapterHandler::StateRequest ExternalMediaAdapterHandler::requestAdapterState(
+    const PlayerInfo& playerInfo) {
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+    auto localPlayerId = playerInfo.localPlayerId;
+
+    auto it = m_stateRequests.find(localPlayerId);
+    if (it != m_stateRequests.end()) {
+        return it->second;
+    }
+    if (m_stateRequestsStopped) {
+        return StateRequest();
+    }
+
+    auto& executor = m_stateExecutors[localPlayerId];
+    if (executor == nullptr) {
+        executor = std::make_shared<alexaClientSDK::avsCommon::utils::threading::Executor>();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto state = createDefaultAdapterState(playerInfo);
+
+    // the task removes the request when it completes, which cannot happen before the request is added below
+    auto future = executor->submit([this, localPlayerId, state, start]() -> std::shared_ptr<AdapterState> {
+        auto result = std::make_shared<AdapterState>(state);
+        bool success = handleGetAdapterState(localPlayerId, *result);
+
+        auto latency =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        emitTimerMetrics(
+            METRIC_PROGRAM_NAME_SUFFIX,
+            "requestAdapterState",
+            METRIC_EXTERNALMEDIAPLAYER_GET_ADAPTER_STATE_LATENCY,
+            latency.count());
+        AACE_DEBUG(LX(TAG, "requestAdapterState")
+                       .d("localPlayerId", localPlayerId)
+                       .d("success", success)
+                       .d("latencyMs", latency.count()));
+
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        m_stateRequests.erase(localPlayerId);
+        if (!success) {
+            return nullptr;
+        }
+        m_lastAdapterStates[localPlayerId] = *result;
+        return result;
+    });
+
+    StateRequest stateRequest;
+    stateRequest.deadline = start + m_stateRequestTimeout;
+    if (future.valid()) {
+        stateRequest.result = future.share();
+        m_stateRequests[localPlayerId] = stateRequest;
+    }
+    return stateRequest;
+}
+
 std::chrono::milliseconds ExternalMediaAdapterHandler::getOffset(const std::string& playerId) {
     try {
         auto it = m_alexaToLocalPlayerIdMap.find(playerId);
@@ -544,6 +665,27 @@ bool ExternalMediaAdapterHandler::removeDiscoveredPlayer(const std::string& loca
         // remove the player info map entry
         m_playerInfoMap.erase(it);
 
+        // stop querying the player, without holding m_stateMutex which a state request in progress needs to complete
+        std::shared_ptr<alexaClientSDK::avsCommon::utils::threading::Executor> stateExecutor;
+        {
+            std::lock_guard<std::mutex> lock(m_stateMutex);
+            auto executorIt = m_stateExecutors.find(localPlayerId);
+            if (executorIt != m_stateExecutors.end()) {
+                stateExecutor = executorIt->second;
+                m_stateExecutors.erase(executorIt);
+            }
+            m_stateRequests.erase(localPlayerId);
+        }
+        if (stateExecutor != nullptr) {
+            stateExecutor->shutdown();
+        }
+
+        // forget the last state of the player, including one stored by the request that was in progress
+        {
+            std::lock_guard<std::mutex> lock(m_stateMutex);
+            m_lastAdapterStates.erase(localPlayerId);
+        }
+
         auto m_discoveredPlayerSender_lock = m_discoveredPlayerSender.lock();
         ThrowIfNull(m_discoveredPlayerSender_lock, "invalidDiscoveredPlayerSender");
 
@@ -575,6 +717,23 @@ void ExternalMediaAdapterHandler::reportPlaybackSessionId(
 void ExternalMediaAdapterHandler::doShutdown() {
     m_executor.shutdown();
 
+    // state requests in progress need m_stateMutex to complete, so shut down their executors without holding it
+    std::unordered_map<std::string, std::shared_ptr<alexaClientSDK::avsCommon::utils::threading::Executor>>
+        stateExecutors;
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        m_stateRequestsStopped = true;
+        stateExecutors.swap(m_stateExecutors);
+    }
+    for (auto& next : stateExecutors) {
+        next.second->shutdown();
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        m_stateRequests.clear();
+        m_lastAdapterStates.clear();
+    }
+
     if (!m_discoveredPlayerSender.expired()) {
         m_discoveredPlayerSender.reset();
     }
@@ -459,6 +459,16 @@ std::vector<aace::engine::alexa::AdapterState> ExternalMediaPlayerEngineImpl::ge
         std::lock_guard<std::mutex> lock(m_playersMutex);
         std::vector<aace::engine::alexa::AdapterState> adapterStateList;
 
+        // ask the players of every adapter first, so that all of them are waited for at the same time
+        if (all) {
+            for (auto next : m_externalMediaAdapterList) {
+                next->prefetchAdapterStates();
+            }
+            if (m_defaultExternalMediaAdapter != nullptr) {
+                m_defaultExternalMediaAdapter->prefetchAdapterStates();
+            }
+        }
+
         // iterate through the media adapter list and add all of the adapter states
         // for the players that the adapter handles...
         for (auto next : m_externalMediaAdapterList) {
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/Alexa/HttpClientPool.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+using namespace alexaClientSDK::avsCommon::utils::libcurlUtils;
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.alexa.HttpClientPool");
+
+const size_t HttpClientPool::DEFAULT_MAX_IDLE_CLIENTS = 4;
+
+HttpClientPool::HttpClientPool(size_t maxIdleClients) : m_maxIdleClients(maxIdleClients), m_generation(0) {
+}
+
+std::shared_ptr<HttpClientPool> HttpClientPool::getInstance() {
+    static std::shared_ptr<HttpClientPool> s_instance(new HttpClientPool(DEFAULT_MAX_IDLE_CLIENTS));
+    return s_instance;
+}
+
+std::shared_ptr<HttpClientPool> HttpClientPool::create(size_t maxIdleClients) {
+    return std::shared_ptr<HttpClientPool>(new HttpClientPool(maxIdleClients));
+}
+
+template <typename Client>
+HttpClientPool::HTTPResponse HttpClientPool::execute(
+    std::vector<std::unique_ptr<Client>> HttpClientPool::*idleClients,
+    std::function<HTTPResponse(Client&)> request) {
+    try {
+        std::unique_ptr<Client> client;
+        uint64_t generation;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto& idle = this->*idleClients;
+            if (!idle.empty()) {
+                client = std::move(idle.back());
+                idle.pop_back();
+            }
+            generation = m_generation;
+        }
+
+        if (client == nullptr) {
+            client = Client::create();
+            ThrowIfNull(client, "createClientFailed");
+        }
+
+        auto response = request(*client);
+
+        // the handle is destroyed after the lock is released when it is not given back to the pool
+        std::unique_ptr<Client> discarded;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& idle = this->*idleClients;
+        if (generation == m_generation && idle.size() < m_maxIdleClients) {
+            idle.push_back(std::move(client));
+        } else {
+            discarded = std::move(client);
+        }
+
+        return response;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "execute").d("reason", ex.what()));
+        return HTTPResponse();
+    }
+}
+
+HttpClientPool::HTTPResponse HttpClientPool::doPost(
+    const std::string& url,
+    const std::vector<std::string>& headerLines,
+    const std::vector<std::pair<std::string, std::string>>& data,
+    std::chrono::seconds timeout) {
+    return execute<HttpPost>(&HttpClientPool::m_idlePostClients, [&](HttpPost& client) {
+        return client.doPost(url, headerLines, data, timeout);
+    });
+}
+
+HttpClientPool::HTTPResponse HttpClientPool::doPost(
+    const std::string& url,
+    const std::vector<std::string>& headerLines,
+    const std::string& data,
+    std::chrono::seconds timeout) {
+    return execute<HttpPost>(&HttpClientPool::m_idlePostClients, [&](HttpPost& client) {
+        return client.doPost(url, headerLines, data, timeout);
+    });
+}
+
+HttpClientPool::HTTPResponse HttpClientPool::doGet(
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    std::chrono::seconds timeout) {
+    return execute<HttpGet>(
+        &HttpClientPool::m_idleGetClients, [&](HttpGet& client) { return client.doGet(url, headers, timeout); });
+}
+
+HttpClientPool::HTTPResponse HttpClientPool::doDelete(
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    std::chrono::seconds timeout) {
+    return execute<HttpDelete>(&HttpClientPool::m_idleDeleteClients, [&](HttpDelete& client) {
+        return client.doDelete(url, headers, timeout);
+    });
+}
+
+HttpClientPool::HTTPResponse HttpClientPool::doPut(
+    const std::string& url,
+    const std::vector<std::string>& headers,
+    const std::string& data) {
+    return execute<HttpPut>(
+        &HttpClientPool::m_idlePutClients, [&](HttpPut& client) { return client.doPut(url, headers, data); });
+}
+
+void HttpClientPool::reset() {
+    AACE_DEBUG(LX(TAG));
+
+    // the idle handles are closed after the lock is released
+    std::vector<std::unique_ptr<HttpPost>> postClients;
+    std::vector<std::unique_ptr<HttpGet>> getClients;
+    std::vector<std::unique_ptr<HttpDelete>> deleteClients;
+    std::vector<std::unique_ptr<HttpPut>> putClients;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_generation++;
+    postClients.swap(m_idlePostClients);
+    getClients.swap(m_idleGetClients);
+    deleteClients.swap(m_idleDeleteClients);
+    putClients.swap(m_idlePutClients);
+}
+
+size_t HttpClientPool::getIdleClientCount() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_idlePostClients.size() + m_idleGetClients.size() + m_idleDeleteClients.size() + m_idlePutClients.size();
+}
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AACE/Engine/Alexa/PlaybackPositionTracker.h"
+
+namespace aace {
+namespace engine {
+namespace alexa {
+
+using MediaPlayerInterface = alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface;
+
+PlaybackPositionTracker::PlaybackPositionTracker(std::chrono::milliseconds syncInterval, Clock clock) :
+        m_syncInterval(syncInterval),
+        m_clock(std::move(clock)),
+        m_id(MediaPlayerInterface::ERROR),
+        m_anchorPosition(0),
+        m_anchorTime(m_clock()),
+        m_playing(false),
+        m_syncPending(false) {
+}
+
+void PlaybackPositionTracker::reset(SourceId id, std::chrono::milliseconds position) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_id = id;
+    m_anchorPosition = position;
+    m_anchorTime = m_clock();
+    m_playing = false;
+    m_syncPending = false;
+}
+
+void PlaybackPositionTracker::update(SourceId id, std::chrono::milliseconds position, bool playing) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (id != m_id) {
+        return;
+    }
+    m_anchorPosition = position;
+    m_anchorTime = m_clock();
+    m_playing = playing;
+    m_syncPending = false;
+}
+
+bool PlaybackPositionTracker::getPosition(SourceId id, std::chrono::milliseconds& position) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (id != m_id || id == MediaPlayerInterface::ERROR) {
+        return false;
+    }
+    position = getPositionLocked(m_clock());
+    return true;
+}
+
+bool PlaybackPositionTracker::startSync() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_id == MediaPlayerInterface::ERROR || m_syncPending || m_clock() - m_anchorTime < m_syncInterval) {
+        return false;
+    }
+    m_syncPending = true;
+    return true;
+}
+
+void PlaybackPositionTracker::cancelSync() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_syncPending = false;
+}
+
+std::chrono::milliseconds PlaybackPositionTracker::getPositionLocked(std::chrono::steady_clock::time_point now) const {
+    if (!m_playing || now <= m_anchorTime) {
+        return m_anchorPosition;
+    }
+    return m_anchorPosition + std::chrono::duration_cast<std::chrono::milliseconds>(now - m_anchorTime);
+}
+
+}  // namespace alexa
+}  // namespace engine
+}  // namespace aace
@@ -32,11 +32,11 @@ namespace alexa {
 using namespace aace::engine::utils::metrics;
 using namespace aace::engine::utils::string;
 
-/// The maximum number of readers of the stream.
-static const size_t MAX_READERS = 10;
+/// The default maximum number of readers of the stream.
+static const size_t DEFAULT_MAX_READERS = 10;
 
-/// The amount of audio data to keep in the ring buffer.
-static const std::chrono::seconds AMOUNT_OF_AUDIO_DATA_IN_BUFFER = std::chrono::seconds(15);
+/// The default amount of audio data to keep in the ring buffer.
+static const std::chrono::seconds DEFAULT_AMOUNT_OF_AUDIO_DATA_IN_BUFFER = std::chrono::seconds(15);
 
 /// The amount of time for wake-word verification
 static const std::chrono::milliseconds VERIFICATION_TIMEOUT = std::chrono::milliseconds(500);
@@ -125,12 +125,18 @@ static void computeStartOfSpeechTimestamp(
                           .count()));
 }
 
+const AudioInputStreamConfiguration SpeechRecognizerEngineImpl::DEFAULT_AUDIO_INPUT_STREAM_CONFIGURATION(
+    DEFAULT_AMOUNT_OF_AUDIO_DATA_IN_BUFFER,
+    DEFAULT_MAX_READERS);
+
 SpeechRecognizerEngineImpl::SpeechRecognizerEngineImpl(
     std::shared_ptr<aace::alexa::SpeechRecognizer> speechRecognizerPlatformInterface,
-    const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat) :
+    const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
+    const AudioInputStreamConfiguration& audioInputStreamConfiguration) :
         alexaClientSDK::avsCommon::utils::RequiresShutdown(TAG),
         m_speechRecognizerPlatformInterface(speechRecognizerPlatformInterface),
         m_audioFormat(audioFormat),
+        m_audioInputStreamConfiguration(audioInputStreamConfiguration),
         m_wordSize(audioFormat.sampleSizeInBits / CHAR_BIT),
         m_state(alexaClientSDK::avsCommon::sdkInterfaces::AudioInputProcessorObserverInterface::State::IDLE) {
 }
@@ -283,7 +289,8 @@ std::shared_ptr<SpeechRecognizerEngineImpl> SpeechRecognizerEngineImpl::create(
     std::shared_ptr<aace::engine::wakeword::WakewordManagerServiceInterface> wakewordService,
     const std::vector<std::shared_ptr<aace::engine::alexa::InitiatorVerifier>>& initiatorVerifiers,
     std::shared_ptr<alexaClientSDK::multiAgentInterface::AgentManagerInterface> agentManager,
-    std::shared_ptr<aace::engine::arbitrator::ArbitratorServiceInterface> arbitratorService
+    std::shared_ptr<aace::engine::arbitrator::ArbitratorServiceInterface> arbitratorService,
+    const AudioInputStreamConfiguration& audioInputStreamConfiguration
     ) {
     std::shared_ptr<SpeechRecognizerEngineImpl> speechRecognizerEngineImpl = nullptr;
 
@@ -306,8 +313,8 @@ std::shared_ptr<SpeechRecognizerEngineImpl> SpeechRecognizerEngineImpl::create(
         ThrowIfNull(arbitratorService, "invalidArbitratorService");
 	 ThrowIfNull(visualFocusManager, "invalidVisualFocusManager");
 
-        speechRecognizerEngineImpl = std::shared_ptr<SpeechRecognizerEngineImpl>(
-            new SpeechRecognizerEngineImpl(speechRecognizerPlatformInterface, audioFormat));
+        speechRecognizerEngineImpl = std::shared_ptr<SpeechRecognizerEngineImpl>(new SpeechRecognizerEngineImpl(
+            speechRecognizerPlatformInterface, audioFormat, audioInputStreamConfiguration));
 
         ThrowIfNot(
             speechRecognizerEngineImpl->initialize(
@@ -390,13 +397,8 @@ void SpeechRecognizerEngineImpl::doShutdown() {
 
 bool SpeechRecognizerEngineImpl::initializeAudioInputStream() {
     try {
-        size_t size = alexaClientSDK::avsCommon::avs::AudioInputStream::calculateBufferSize(
-            m_audioFormat.sampleRateHz * AMOUNT_OF_AUDIO_DATA_IN_BUFFER.count(), m_wordSize, MAX_READERS);
-        auto buffer = std::make_shared<alexaClientSDK::avsCommon::avs::AudioInputStream::Buffer>(size);
-        ThrowIfNull(buffer, "couldNotCreateAudioInputBuffer");
-
         // create the audio input stream
-        m_audioInputStream = alexaClientSDK::avsCommon::avs::AudioInputStream::create(buffer, m_wordSize, MAX_READERS);
+        m_audioInputStream = m_audioInputStreamConfiguration.createStream(m_audioFormat);
         ThrowIfNull(m_audioInputStream, "couldNotCreateAudioInputStream");
 
         // create the audio input writer
@@ -455,6 +455,7 @@ public:
         bool fatal) = 0;
     virtual void onSetFocus(const std::string& playerId) = 0;
     virtual void onRemoveDiscoveredPlayer(const std::string& localPlayerId) = 0;
+    virtual void onStateChanged(const std::string& localPlayerId) = 0;
 };
 
 /**
@@ -682,6 +682,16 @@ public:
 
     void removeDiscoveredPlayer(const std::string& localPlayerId);
 
+    /**
+     * Should be called when the @c ExternalMediaAdapterState of a local external media player changes. The Engine
+     * reads the new state with @c getState() outside of context requests and reports the latest state in context
+     * from then on, so @c getState() is only called during a context request for a player whose state
+     * has never changed.
+     *
+     * @param [in] localPlayerId The opaque token that uniquely identifies the local external player app
+     */
+    void stateChanged(const std::string& localPlayerId);
+
     /**
      * @internal
      * Sets the Engine interface delegate.
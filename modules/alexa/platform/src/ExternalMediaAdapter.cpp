@@ -138,6 +138,12 @@ void ExternalMediaAdapter::removeDiscoveredPlayer(const std::string& localPlayer
     }
 }
 
+void ExternalMediaAdapter::stateChanged(const std::string& localPlayerId) {
+    if (auto m_externalMediaAdapterEngineInterface_lock = m_externalMediaAdapterEngineInterface.lock()) {
+        m_externalMediaAdapterEngineInterface_lock->onStateChanged(localPlayerId);
+    }
+}
+
 void ExternalMediaAdapter::setEngineInterface(
     std::shared_ptr<aace::alexa::ExternalMediaAdapterEngineInterface> externalMediaAdapterEngineInterface) {
     m_externalMediaAdapterEngineInterface = externalMediaAdapterEngineInterface;
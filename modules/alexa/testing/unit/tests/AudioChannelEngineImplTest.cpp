@@ -0,0 +1,116 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
+
+#include <AACE/Engine/Alexa/AudioChannelEngineImpl.h>
+#include <AACE/Test/Unit/Alexa/AlexaTestHelper.h>
+#include <AACE/Test/Unit/Audio/MockAudioOutputChannelInterface.h>
+
+using namespace aace::engine::alexa;
+using namespace aace::test::unit::alexa;
+using namespace aace::test::unit::audio;
+using namespace ::testing;
+using MediaPlayerInterface = alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface;
+
+/// The position the platform reports for the playing source.
+static const int64_t PLATFORM_POSITION_MS = 5000;
+
+class AudioChannelEngineImplTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_alexaMockFactory = AlexaTestHelper::createAlexaMockComponentFactory();
+
+        // initialize the avs device SDK
+        ASSERT_TRUE(alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::initialize(
+            {AlexaTestHelper::getAVSConfig()}))
+            << "Initialize AVS Device SDK Failed!";
+
+        // initialized succeeded
+        m_initialized = true;
+
+        m_audioOutputChannel = std::make_shared<NiceMock<MockAudioOutputChannelInterface>>();
+        ON_CALL(*m_audioOutputChannel, prepare(An<const std::string&>(), _)).WillByDefault(Return(true));
+        ON_CALL(*m_audioOutputChannel, setPosition(_)).WillByDefault(Return(true));
+        ON_CALL(*m_audioOutputChannel, play()).WillByDefault(Return(true));
+        ON_CALL(*m_audioOutputChannel, stop()).WillByDefault(Return(true));
+        ON_CALL(*m_audioOutputChannel, getPosition()).WillByDefault(Return(PLATFORM_POSITION_MS));
+
+        m_audioChannel = std::make_shared<AudioChannelEngineImpl>(
+            alexaClientSDK::avsCommon::sdkInterfaces::ChannelVolumeInterface::Type::AVS_SPEAKER_VOLUME, "Test");
+        ASSERT_TRUE(m_audioChannel->initializeAudioChannel(
+            m_audioOutputChannel, m_alexaMockFactory->getSpeakerManagerInterfaceMock()));
+    }
+
+    void TearDown() override {
+        if (m_audioChannel != nullptr) {
+            m_audioChannel->shutdown();
+        }
+        if (m_initialized) {
+            m_alexaMockFactory->shutdown();
+
+            alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
+
+            m_initialized = false;
+        }
+    }
+
+protected:
+    /// Waits for the media state changes and errors reported so far, by querying a source which is not tracked.
+    void waitForExecutor(MediaPlayerInterface::SourceId id) {
+        m_audioChannel->getOffset(id + 1);
+    }
+
+    std::shared_ptr<AlexaMockComponentFactory> m_alexaMockFactory;
+    std::shared_ptr<NiceMock<MockAudioOutputChannelInterface>> m_audioOutputChannel;
+    std::shared_ptr<AudioChannelEngineImpl> m_audioChannel;
+
+private:
+    bool m_initialized = false;
+};
+
+/**
+ * @test A source which failed is no longer reported as playing.
+ */
+TEST_F(AudioChannelEngineImplTest, mediaErrorStopsTrackingPosition) {
+    auto id = m_audioChannel->setSource(
+        "https://example.com/track.mp3",
+        std::chrono::milliseconds(0),
+        alexaClientSDK::avsCommon::utils::mediaPlayer::emptySourceConfig(),
+        false,
+        alexaClientSDK::avsCommon::utils::mediaPlayer::PlaybackContext());
+    ASSERT_NE(MediaPlayerInterface::ERROR, id);
+    ASSERT_TRUE(m_audioChannel->play(id));
+    m_audioChannel->onMediaStateChanged(aace::audio::AudioOutputEngineInterface::MediaState::PLAYING);
+    waitForExecutor(id);
+
+    auto playingState = m_audioChannel->getMediaPlayerState(id);
+    ASSERT_TRUE(playingState.hasValue());
+    ASSERT_GE(playingState.value().offset, std::chrono::milliseconds(PLATFORM_POSITION_MS));
+
+    m_audioChannel->onMediaError(aace::audio::AudioOutputEngineInterface::MediaError::MEDIA_ERROR_UNKNOWN, "test");
+    waitForExecutor(id);
+
+    EXPECT_FALSE(m_audioChannel->getMediaPlayerState(id).hasValue());
+    auto offset = m_audioChannel->getOffset(id);
+    EXPECT_LT(offset, std::chrono::milliseconds(PLATFORM_POSITION_MS));
+    EXPECT_EQ(offset, m_audioChannel->getOffset(id));
+}
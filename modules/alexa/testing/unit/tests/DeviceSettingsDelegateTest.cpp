@@ -0,0 +1,118 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+#include <RegistrationManager/CustomerDataHandler.h>
+#include <RegistrationManager/CustomerDataManagerFactory.h>
+
+#include <AACE/Engine/Alexa/DeviceSettingsDelegate.h>
+#include <AACE/Test/Unit/Alexa/AlexaTestHelper.h>
+
+using namespace aace::engine::alexa;
+using namespace aace::test::unit::alexa;
+
+/// The number of data handlers registered while the device settings delegate is created.
+static const int DATA_HANDLER_COUNT = 100;
+
+/**
+ * A customer data handler which records whether its data was cleared.
+ */
+class TestDataHandler : public alexaClientSDK::registrationManager::CustomerDataHandler {
+public:
+    TestDataHandler(std::shared_ptr<alexaClientSDK::registrationManager::CustomerDataManagerInterface> dataManager) :
+            CustomerDataHandler(dataManager), m_cleared(false) {
+    }
+
+    void clearData() override {
+        m_cleared = true;
+    }
+
+    bool isCleared() {
+        return m_cleared;
+    }
+
+private:
+    std::atomic<bool> m_cleared;
+};
+
+class DeviceSettingsDelegateTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_alexaMockFactory = AlexaTestHelper::createAlexaMockComponentFactory();
+
+        // initialize the avs device SDK
+        ASSERT_TRUE(alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::initialize(
+            {AlexaTestHelper::getAVSConfig()}))
+            << "Initialize AVS Device SDK Failed!";
+
+        // initialized succeeded
+        m_initialized = true;
+    }
+
+    void TearDown() override {
+        if (m_initialized) {
+            m_alexaMockFactory->shutdown();
+
+            alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
+
+            m_initialized = false;
+        }
+    }
+
+protected:
+    std::shared_ptr<AlexaMockComponentFactory> m_alexaMockFactory;
+
+private:
+    bool m_initialized = false;
+};
+
+/**
+ * @test The Alexa engine service creates the device settings delegate on a separate task while other components
+ * register with the same customer data manager, so every handler must be registered once both are done.
+ */
+TEST_F(DeviceSettingsDelegateTest, createWhileDataHandlersAreRegistered) {
+    auto dataManager =
+        alexaClientSDK::registrationManager::CustomerDataManagerFactory::createCustomerDataManagerInterface();
+    auto connectionManager = m_alexaMockFactory->getAVSConnectionManagerMock();
+    auto metricRecorder = m_alexaMockFactory->getMetricRecorder();
+    auto config = alexaClientSDK::avsCommon::utils::configuration::ConfigurationNode::getRoot();
+
+    auto deviceSettingsDelegateFuture =
+        std::async(std::launch::async, [dataManager, connectionManager, metricRecorder, config]() {
+            return DeviceSettingsDelegate::createDeviceSettingsDelegate(
+                config, dataManager, connectionManager, metricRecorder);
+        });
+    std::vector<std::unique_ptr<TestDataHandler>> dataHandlers;
+    for (int i = 0; i < DATA_HANDLER_COUNT; i++) {
+        dataHandlers.emplace_back(new TestDataHandler(dataManager));
+    }
+    auto deviceSettingsDelegate = deviceSettingsDelegateFuture.get();
+    ASSERT_NE(nullptr, deviceSettingsDelegate);
+
+    dataManager->clearData();
+    for (auto& next : dataHandlers) {
+        EXPECT_TRUE(next->isCleared());
+    }
+    deviceSettingsDelegate->getDeviceSettingStorage()->close();
+}
@@ -0,0 +1,288 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
+
+#include <AACE/Engine/Alexa/ExternalMediaAdapterEngineImpl.h>
+#include <AACE/Test/Unit/Alexa/AlexaTestHelper.h>
+
+using namespace aace::engine::alexa;
+using namespace aace::test::unit::alexa;
+using DiscoveredPlayerInfo = aace::alexa::ExternalMediaAdapter::DiscoveredPlayerInfo;
+using ExternalMediaAdapterState = aace::alexa::ExternalMediaAdapter::ExternalMediaAdapterState;
+
+static const std::string LOCAL_PLAYER_ID = "com.amazon.test.player";
+
+/// A second player, discovered by the tests which need one.
+static const std::string OTHER_LOCAL_PLAYER_ID = "com.amazon.test.otherPlayer";
+
+/// The duration of the track played in these tests.
+static const std::chrono::milliseconds TRACK_DURATION(1000);
+
+/// The time the test waits for the engine to read the state of the player.
+static const std::chrono::seconds STATE_READ_TIMEOUT(5);
+
+/// Accepts discovered players without reporting them to the cloud.
+class TestPlayerSender : public DiscoveredPlayerSenderInterface {
+public:
+    void reportDiscoveredPlayers(const std::vector<DiscoveredPlayerInfo>& discoveredPlayers) override {
+    }
+    void removeDiscoveredPlayer(const std::string& localPlayerId) override {
+    }
+};
+
+class TestFocusHandler : public FocusHandlerInterface {
+public:
+    void setFocus(const std::string& playerId, bool focusAcquire) override {
+    }
+    void setDefaultPlayerFocus() override {
+    }
+};
+
+/// A player which plays to the end of its track, and names the state after the number of times it was read.
+class TestExternalMediaAdapter : public aace::alexa::ExternalMediaAdapter {
+public:
+    TestExternalMediaAdapter() : m_stateReadCount(0), m_stateReadsHeld(false) {
+    }
+
+    bool getState(const std::string& localPlayerId, ExternalMediaAdapterState& state) override {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_stateRead.wait_for(lock, STATE_READ_TIMEOUT, [this]() { return !m_stateReadsHeld; });
+        m_stateReadCount++;
+        state.playbackState.state = "PLAYING";
+        state.playbackState.trackName = "track" + std::to_string(m_stateReadCount);
+        state.playbackState.trackOffset = TRACK_DURATION;
+        state.playbackState.duration = TRACK_DURATION;
+        m_stateRead.notify_all();
+        return true;
+    }
+
+    /// Waits until the state has been read @c count times.
+    bool waitForStateReadCount(int count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_stateRead.wait_for(lock, STATE_READ_TIMEOUT, [this, count]() { return m_stateReadCount >= count; });
+    }
+
+    int getStateReadCount() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stateReadCount;
+    }
+
+    /// Makes the state reads wait until @c releaseStateReads() is called.
+    void holdStateReads() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stateReadsHeld = true;
+    }
+
+    void releaseStateReads() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stateReadsHeld = false;
+        m_stateRead.notify_all();
+    }
+
+    bool login(
+        const std::string& localPlayerId,
+        const std::string& accessToken,
+        const std::string& userName,
+        bool forceLogin,
+        std::chrono::milliseconds tokenRefreshInterval) override {
+        return true;
+    }
+    bool logout(const std::string& localPlayerId) override {
+        return true;
+    }
+    bool play(
+        const std::string& localPlayerId,
+        const std::string& playContextToken,
+        int64_t index,
+        std::chrono::milliseconds offset,
+        bool preload,
+        Navigation navigation) override {
+        return true;
+    }
+    bool playControl(const std::string& localPlayerId, PlayControlType controlType) override {
+        return true;
+    }
+    bool seek(const std::string& localPlayerId, std::chrono::milliseconds offset) override {
+        return true;
+    }
+    bool adjustSeek(const std::string& localPlayerId, std::chrono::milliseconds deltaOffset) override {
+        return true;
+    }
+    bool authorize(const std::vector<AuthorizedPlayerInfo>& authorizedPlayers) override {
+        return true;
+    }
+    bool volumeChanged(float volume) override {
+        return true;
+    }
+    bool mutedStateChanged(MutedState state) override {
+        return true;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_stateRead;
+    int m_stateReadCount;
+    bool m_stateReadsHeld;
+};
+
+class ExternalMediaAdapterEngineImplTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_alexaMockFactory = AlexaTestHelper::createAlexaMockComponentFactory();
+
+        // initialize the avs device SDK
+        ASSERT_TRUE(alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::initialize(
+            {AlexaTestHelper::getAVSConfig()}))
+            << "Initialize AVS Device SDK Failed!";
+
+        // initialized succeeded
+        m_initialized = true;
+        m_platformMediaAdapter = std::make_shared<TestExternalMediaAdapter>();
+        m_playerSender = std::make_shared<TestPlayerSender>();
+    }
+
+    void TearDown() override {
+        if (m_externalMediaAdapterEngineImpl != nullptr) {
+            m_externalMediaAdapterEngineImpl->shutdown();
+        }
+        if (m_initialized) {
+            m_alexaMockFactory->shutdown();
+
+            alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
+
+            m_initialized = false;
+        }
+    }
+
+protected:
+    /// Creates the engine implementation and discovers the test player.
+    void createExternalMediaAdapterEngineImpl(std::chrono::milliseconds maxStateAge) {
+        m_externalMediaAdapterEngineImpl = ExternalMediaAdapterEngineImpl::create(
+            m_platformMediaAdapter,
+            m_playerSender,
+            std::make_shared<TestFocusHandler>(),
+            m_alexaMockFactory->getMessageSenderInterfaceMock(),
+            m_alexaMockFactory->getSpeakerManagerInterfaceMock(),
+            maxStateAge);
+        ASSERT_NE(nullptr, m_externalMediaAdapterEngineImpl);
+
+        discoverPlayer(LOCAL_PLAYER_ID);
+    }
+
+    void discoverPlayer(const std::string& localPlayerId) {
+        DiscoveredPlayerInfo player;
+        player.localPlayerId = localPlayerId;
+        player.spiVersion = "1.0";
+        m_platformMediaAdapter->reportDiscoveredPlayers({player});
+    }
+
+    AdapterState getAdapterState() {
+        auto adapterStates = m_externalMediaAdapterEngineImpl->getAdapterStates(true);
+        EXPECT_EQ(1u, adapterStates.size());
+        return adapterStates.empty() ? AdapterState() : adapterStates[0];
+    }
+
+    std::shared_ptr<AlexaMockComponentFactory> m_alexaMockFactory;
+    std::shared_ptr<TestExternalMediaAdapter> m_platformMediaAdapter;
+    std::shared_ptr<TestPlayerSender> m_playerSender;
+    std::shared_ptr<ExternalMediaAdapterEngineImpl> m_externalMediaAdapterEngineImpl;
+
+private:
+    bool m_initialized = false;
+};
+
+/**
+ * @test The reported state of a playing player is advanced to the end of its track, not past it.
+ */
+TEST_F(ExternalMediaAdapterEngineImplTest, reportedTrackOffsetIsClampedToDuration) {
+    createExternalMediaAdapterEngineImpl(ExternalMediaAdapterEngineImpl::DEFAULT_MAX_STATE_AGE);
+
+    // the engine reads the states one after the other, so the first state is kept once the second one is read
+    m_platformMediaAdapter->stateChanged(LOCAL_PLAYER_ID);
+    m_platformMediaAdapter->stateChanged(LOCAL_PLAYER_ID);
+    ASSERT_TRUE(m_platformMediaAdapter->waitForStateReadCount(2));
+
+    auto state = getAdapterState();
+    EXPECT_EQ(TRACK_DURATION, state.playbackState.trackOffset);
+    EXPECT_EQ(2, m_platformMediaAdapter->getStateReadCount());
+}
+
+/**
+ * @test A reported state older than the maximum age is read again from the platform.
+ */
+TEST_F(ExternalMediaAdapterEngineImplTest, staleReportedStateIsReadAgain) {
+    // a zero maximum age makes every reported state stale
+    createExternalMediaAdapterEngineImpl(std::chrono::milliseconds(0));
+
+    m_platformMediaAdapter->stateChanged(LOCAL_PLAYER_ID);
+    ASSERT_TRUE(m_platformMediaAdapter->waitForStateReadCount(1));
+
+    auto state = getAdapterState();
+    EXPECT_EQ("track2", state.playbackState.trackName);
+    EXPECT_EQ(2, m_platformMediaAdapter->getStateReadCount());
+}
+
+/**
+ * @test A state read before a player was removed is not kept for the player once it is discovered again.
+ */
+TEST_F(ExternalMediaAdapterEngineImplTest, stateReadBeforeRemovalIsNotKept) {
+    createExternalMediaAdapterEngineImpl(ExternalMediaAdapterEngineImpl::DEFAULT_MAX_STATE_AGE);
+
+    // the second state read is queued behind the first one, which waits until the player is discovered again
+    m_platformMediaAdapter->holdStateReads();
+    m_platformMediaAdapter->stateChanged(LOCAL_PLAYER_ID);
+    m_platformMediaAdapter->stateChanged(LOCAL_PLAYER_ID);
+    m_platformMediaAdapter->removeDiscoveredPlayer(LOCAL_PLAYER_ID);
+    discoverPlayer(LOCAL_PLAYER_ID);
+    m_platformMediaAdapter->releaseStateReads();
+
+    // the engine reads the states one after the other, so the queued states are read once the other player's is
+    discoverPlayer(OTHER_LOCAL_PLAYER_ID);
+    m_platformMediaAdapter->stateChanged(OTHER_LOCAL_PLAYER_ID);
+    ASSERT_TRUE(m_platformMediaAdapter->waitForStateReadCount(3));
+
+    // the rediscovered player is read again instead of reporting the second state
+    auto adapterStates = m_externalMediaAdapterEngineImpl->getAdapterStates(true);
+    ASSERT_EQ(2u, adapterStates.size());
+    for (const auto& next : adapterStates) {
+        EXPECT_NE("track2", next.playbackState.trackName);
+    }
+    EXPECT_LE(4, m_platformMediaAdapter->getStateReadCount());
+}
+
+/**
+ * @test The maximum age of the reported states cannot be negative.
+ */
+TEST_F(ExternalMediaAdapterEngineImplTest, createWithNegativeMaxStateAge) {
+    auto externalMediaAdapterEngineImpl = ExternalMediaAdapterEngineImpl::create(
+        m_platformMediaAdapter,
+        std::make_shared<TestPlayerSender>(),
+        std::make_shared<TestFocusHandler>(),
+        m_alexaMockFactory->getMessageSenderInterfaceMock(),
+        m_alexaMockFactory->getSpeakerManagerInterfaceMock(),
+        std::chrono::milliseconds(-1));
+    EXPECT_EQ(nullptr, externalMediaAdapterEngineImpl);
+}
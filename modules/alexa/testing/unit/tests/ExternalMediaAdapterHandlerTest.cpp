@@ -0,0 +1,260 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "AACE/Engine/Alexa/ExternalMediaAdapterHandler.h"
+
+using namespace aace::engine::alexa;
+using DiscoveredPlayerInfo = aace::alexa::ExternalMediaAdapter::DiscoveredPlayerInfo;
+
+/// The time a player is given to provide its state in these tests.
+static const std::chrono::milliseconds STATE_REQUEST_TIMEOUT(300);
+
+/// Delay of a player which provides its state in time, but not if players are queried one after the other.
+static const std::chrono::milliseconds SLOW_PLAYER_DELAY(150);
+
+/// Delay of a player which misses the deadline.
+static const std::chrono::milliseconds STALLED_PLAYER_DELAY(1000);
+
+/// Accepts discovered players without reporting them to the cloud.
+class TestDiscoveredPlayerSender : public DiscoveredPlayerSenderInterface {
+public:
+    void reportDiscoveredPlayers(const std::vector<DiscoveredPlayerInfo>& discoveredPlayers) override {
+    }
+    void removeDiscoveredPlayer(const std::string& localPlayerId) override {
+    }
+};
+
+/// A stand-in for the platform, whose players take a configurable time to provide their state.
+class SlowExternalMediaAdapterHandler : public ExternalMediaAdapterHandler {
+public:
+    SlowExternalMediaAdapterHandler(std::shared_ptr<DiscoveredPlayerSenderInterface> discoveredPlayerSender) :
+            ExternalMediaAdapterHandler(discoveredPlayerSender, nullptr, STATE_REQUEST_TIMEOUT) {
+    }
+
+    /// Sets the state a player provides, and the time it takes to provide it.
+    void setPlayer(
+        const std::string& localPlayerId,
+        const std::string& trackName,
+        std::chrono::milliseconds delay = std::chrono::milliseconds(0),
+        bool available = true) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& player = m_players[localPlayerId];
+        player.trackName = trackName;
+        player.delay = delay;
+        player.available = available;
+    }
+
+    int getRequestCount(const std::string& localPlayerId) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_players[localPlayerId].requestCount;
+    }
+
+protected:
+    bool handleGetAdapterState(const std::string& localPlayerId, AdapterState& state) override {
+        Player player;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_players[localPlayerId].requestCount++;
+            player = m_players[localPlayerId];
+        }
+        std::this_thread::sleep_for(player.delay);
+        if (!player.available) {
+            return false;
+        }
+        state.playbackState.trackName = player.trackName;
+        state.playbackState.state = "PLAYING";
+        return true;
+    }
+
+    bool handleAuthorization(
+        const std::vector<aace::alexa::ExternalMediaAdapter::AuthorizedPlayerInfo>& authorizedPlayerList) override {
+        return true;
+    }
+    bool handleLogin(
+        const std::string& localPlayerId,
+        const std::string& accessToken,
+        const std::string& userName,
+        bool forceLogin,
+        std::chrono::milliseconds tokenRefreshInterval) override {
+        return false;
+    }
+    bool handleLogout(const std::string& localPlayerId) override {
+        return false;
+    }
+    bool handlePlay(
+        const std::string& localPlayerId,
+        const std::string& playContextToken,
+        int64_t index,
+        std::chrono::milliseconds offset,
+        bool preload,
+        aace::alexa::ExternalMediaAdapter::Navigation navigation,
+        const std::string& playbackSessionId,
+        const std::string& skillToken) override {
+        return false;
+    }
+    bool handlePlayControl(
+        const std::string& localPlayerId,
+        aace::alexa::ExternalMediaAdapter::PlayControlType playControlType) override {
+        return false;
+    }
+    bool handleSeek(const std::string& localPlayerId, std::chrono::milliseconds offset) override {
+        return false;
+    }
+    bool handleAdjustSeek(const std::string& localPlayerId, std::chrono::milliseconds deltaOffset) override {
+        return false;
+    }
+    std::chrono::milliseconds handleGetOffset(const std::string& localPlayerId) override {
+        return std::chrono::milliseconds(0);
+    }
+    bool handleSetVolume(int8_t volume) override {
+        return true;
+    }
+    bool handleSetMute(bool mute) override {
+        return true;
+    }
+
+private:
+    struct Player {
+        std::string trackName;
+        std::chrono::milliseconds delay{0};
+        bool available = true;
+        int requestCount = 0;
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<std::string, Player> m_players;
+};
+
+/// Test harness for the state collection of @c ExternalMediaAdapterHandler.
+class ExternalMediaAdapterHandlerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_discoveredPlayerSender = std::make_shared<TestDiscoveredPlayerSender>();
+        m_handler = std::make_shared<SlowExternalMediaAdapterHandler>(m_discoveredPlayerSender);
+    }
+
+    void TearDown() override {
+        m_handler->shutdown();
+    }
+
+    /// Discovers and authorizes players, using the local player id as the cloud player id.
+    void addPlayers(const std::vector<std::string>& localPlayerIds) {
+        std::vector<DiscoveredPlayerInfo> discoveredPlayers;
+        std::vector<PlayerInfo> authorizedPlayers;
+        for (const auto& localPlayerId : localPlayerIds) {
+            DiscoveredPlayerInfo discoveredPlayer;
+            discoveredPlayer.localPlayerId = localPlayerId;
+            discoveredPlayer.spiVersion = "1.0";
+            discoveredPlayers.push_back(discoveredPlayer);
+
+            PlayerInfo authorizedPlayer(localPlayerId, "1.0", true);
+            authorizedPlayer.playerId = localPlayerId;
+            authorizedPlayers.push_back(authorizedPlayer);
+        }
+        m_handler->reportDiscoveredPlayers(discoveredPlayers);
+        ASSERT_EQ(m_handler->authorizeDiscoveredPlayers(authorizedPlayers).size(), localPlayerIds.size());
+    }
+
+    /// Returns the track name reported for each player.
+    static std::unordered_map<std::string, std::string> trackNames(const std::vector<AdapterState>& states) {
+        std::unordered_map<std::string, std::string> result;
+        for (const auto& state : states) {
+            EXPECT_EQ(state.sessionState.playerId, state.playbackState.playerId);
+            result[state.sessionState.playerId] = state.playbackState.trackName;
+        }
+        return result;
+    }
+
+protected:
+    std::shared_ptr<TestDiscoveredPlayerSender> m_discoveredPlayerSender;
+    std::shared_ptr<SlowExternalMediaAdapterHandler> m_handler;
+};
+
+TEST_F(ExternalMediaAdapterHandlerTest, slowPlayersAreQueriedInParallel) {
+    addPlayers({"player1", "player2", "player3"});
+    m_handler->setPlayer("player1", "track1", SLOW_PLAYER_DELAY);
+    m_handler->setPlayer("player2", "track2", SLOW_PLAYER_DELAY);
+    m_handler->setPlayer("player3", "track3", SLOW_PLAYER_DELAY);
+
+    // queried one after the other, the last player would miss the deadline and not report its track
+    auto names = trackNames(m_handler->getAdapterStates(true));
+    ASSERT_EQ(names.size(), 3u);
+    ASSERT_EQ(names["player1"], "track1");
+    ASSERT_EQ(names["player2"], "track2");
+    ASSERT_EQ(names["player3"], "track3");
+}
+
+TEST_F(ExternalMediaAdapterHandlerTest, stalledPlayerReportsLastState) {
+    addPlayers({"fast", "stalled"});
+    m_handler->setPlayer("fast", "fastTrack1");
+    m_handler->setPlayer("stalled", "stalledTrack1");
+    auto names = trackNames(m_handler->getAdapterStates(true));
+    ASSERT_EQ(names["stalled"], "stalledTrack1");
+
+    m_handler->setPlayer("fast", "fastTrack2");
+    m_handler->setPlayer("stalled", "stalledTrack2", STALLED_PLAYER_DELAY);
+    auto start = std::chrono::steady_clock::now();
+    names = trackNames(m_handler->getAdapterStates(true));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // the call waits until the deadline, and returns before the stalled player answers
+    ASSERT_GE(elapsed, STATE_REQUEST_TIMEOUT);
+    ASSERT_EQ(names["fast"], "fastTrack2");
+    ASSERT_EQ(names["stalled"], "stalledTrack1");
+
+    // the request in progress is not repeated, and its deadline has already passed
+    start = std::chrono::steady_clock::now();
+    names = trackNames(m_handler->getAdapterStates(true));
+    elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_LT(elapsed, STATE_REQUEST_TIMEOUT);
+    ASSERT_EQ(names["stalled"], "stalledTrack1");
+    ASSERT_EQ(m_handler->getRequestCount("stalled"), 2);
+    ASSERT_EQ(m_handler->getRequestCount("fast"), 3);
+}
+
+TEST_F(ExternalMediaAdapterHandlerTest, failedPlayerDoesNotHideOtherPlayers) {
+    addPlayers({"player1", "player2"});
+    m_handler->setPlayer("player1", "track1");
+    m_handler->setPlayer("player2", "track2", std::chrono::milliseconds(0), false);
+
+    auto states = m_handler->getAdapterStates(true);
+    ASSERT_EQ(states.size(), 2u);
+    auto names = trackNames(states);
+    ASSERT_EQ(names["player1"], "track1");
+    ASSERT_EQ(names["player2"], "");
+    for (const auto& state : states) {
+        ASSERT_EQ(state.sessionState.spiVersion, "1.0");
+    }
+}
+
+TEST_F(ExternalMediaAdapterHandlerTest, sessionStatesDoNotQueryPlayers) {
+    addPlayers({"player1"});
+    m_handler->setPlayer("player1", "track1", STALLED_PLAYER_DELAY);
+
+    auto states = m_handler->getAdapterStates(false);
+    ASSERT_EQ(states.size(), 1u);
+    ASSERT_EQ(states[0].sessionState.playerId, "player1");
+    ASSERT_EQ(m_handler->getRequestCount("player1"), 0);
+}
@@ -0,0 +1,477 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <openssl/err.h>
+#include <openssl/pem.h>
+#include <openssl/ssl.h>
+#include <openssl/x509v3.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
+#include <AVSCommon/Utils/LibcurlUtils/HttpGet.h>
+
+#include <AACE/Test/Unit/Alexa/AlexaTestHelper.h>
+#include <AACE/Engine/Alexa/HttpClientPool.h>
+
+using namespace aace::test::unit::alexa;
+using HttpClientPool = aace::engine::alexa::HttpClientPool;
+
+static const std::chrono::seconds TEST_TIMEOUT(5);
+static const std::string TEST_RESPONSE = "HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nContent-Length: 2\r\n\r\nok";
+static const std::string TEST_CLOSE_RESPONSE =
+    "HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nContent-Length: 2\r\nConnection: close\r\n\r\nok";
+
+/**
+ * A self-signed certificate for 127.0.0.1, and the TLS server context using it. The certificate is written to a
+ * temporary directory in the hashed form expected by @c CURLOPT_CAPATH, so curl trusts the test server.
+ */
+class TestCertificate {
+public:
+    TestCertificate() : m_context(nullptr, SSL_CTX_free) {
+    }
+
+    ~TestCertificate() {
+        if (!m_certificatePath.empty()) {
+            std::remove(m_certificatePath.c_str());
+        }
+        if (!m_directory.empty()) {
+            rmdir(m_directory.c_str());
+        }
+    }
+
+    bool create() {
+        char directory[] = "/tmp/aace-http-client-pool-test-XXXXXX";
+        if (mkdtemp(directory) == nullptr) {
+            return false;
+        }
+        m_directory = directory;
+
+        std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)> keyContext(
+            EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr), EVP_PKEY_CTX_free);
+        EVP_PKEY* generatedKey = nullptr;
+        if (keyContext == nullptr || EVP_PKEY_keygen_init(keyContext.get()) <= 0 ||
+            EVP_PKEY_CTX_set_ec_paramgen_curve_nid(keyContext.get(), NID_X9_62_prime256v1) <= 0 ||
+            EVP_PKEY_keygen(keyContext.get(), &generatedKey) <= 0) {
+            return false;
+        }
+        std::unique_ptr<EVP_PKEY, decltype(&EVP_PKEY_free)> key(generatedKey, EVP_PKEY_free);
+
+        std::unique_ptr<X509, decltype(&X509_free)> certificate(X509_new(), X509_free);
+        X509_set_version(certificate.get(), 2);
+        ASN1_INTEGER_set(X509_get_serialNumber(certificate.get()), 1);
+        X509_gmtime_adj(X509_getm_notBefore(certificate.get()), -60);
+        X509_gmtime_adj(X509_getm_notAfter(certificate.get()), 3600);
+        X509_set_pubkey(certificate.get(), key.get());
+        auto name = X509_get_subject_name(certificate.get());
+        X509_NAME_add_entry_by_txt(
+            name, "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char*>("127.0.0.1"), -1, -1, 0);
+        X509_set_issuer_name(certificate.get(), name);
+
+        // curl matches the address of the URL with the subject alternative names
+        X509V3_CTX extensionContext;
+        X509V3_set_ctx_nodb(&extensionContext);
+        X509V3_set_ctx(&extensionContext, certificate.get(), certificate.get(), nullptr, nullptr, 0);
+        auto extension = X509V3_EXT_conf_nid(
+            nullptr, &extensionContext, NID_subject_alt_name, const_cast<char*>("IP:127.0.0.1"));
+        if (extension == nullptr) {
+            return false;
+        }
+        X509_add_ext(certificate.get(), extension, -1);
+        X509_EXTENSION_free(extension);
+        if (X509_sign(certificate.get(), key.get(), EVP_sha256()) <= 0) {
+            return false;
+        }
+
+        char hash[16];
+        snprintf(hash, sizeof(hash), "%08lx", X509_subject_name_hash(certificate.get()));
+        m_certificatePath = m_directory + "/" + hash + ".0";
+        auto file = fopen(m_certificatePath.c_str(), "w");
+        if (file == nullptr) {
+            return false;
+        }
+        auto written = PEM_write_X509(file, certificate.get());
+        fclose(file);
+        if (written != 1) {
+            return false;
+        }
+
+        m_context.reset(SSL_CTX_new(TLS_server_method()));
+        return m_context != nullptr && SSL_CTX_use_certificate(m_context.get(), certificate.get()) == 1 &&
+               SSL_CTX_use_PrivateKey(m_context.get(), key.get()) == 1;
+    }
+
+    /// The AVS configuration making curl trust the certificate.
+    std::shared_ptr<std::stringstream> getAVSConfig() {
+        return std::make_shared<std::stringstream>(
+            "{\"libcurlUtils\":{\"CURLOPT_CAPATH\":\"" + m_directory + "\"}}");
+    }
+
+    SSL_CTX* getContext() {
+        return m_context.get();
+    }
+
+private:
+    std::string m_directory;
+    std::string m_certificatePath;
+    std::unique_ptr<SSL_CTX, decltype(&SSL_CTX_free)> m_context;
+};
+
+/**
+ * A local HTTP server, which counts the connections opened by the clients. With a TLS context the server is an
+ * HTTPS server, which also counts the handshakes resuming a TLS session. Unless @c keepAlive is set, the server
+ * closes the connection after each response.
+ */
+class TestHttpServer {
+public:
+    TestHttpServer(SSL_CTX* tlsContext = nullptr, bool keepAlive = true) :
+            m_tlsContext(tlsContext),
+            m_keepAlive(keepAlive),
+            m_socket(-1),
+            m_port(0),
+            m_connections(0),
+            m_resumedSessions(0),
+            m_requests(0),
+            m_stopping(false) {
+    }
+
+    ~TestHttpServer() {
+        stop();
+    }
+
+    bool start() {
+        m_socket = socket(AF_INET, SOCK_STREAM, 0);
+        if (m_socket < 0) {
+            return false;
+        }
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+        if (bind(m_socket, reinterpret_cast<sockaddr*>(&address), length) != 0 || listen(m_socket, 16) != 0 ||
+            getsockname(m_socket, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+            return false;
+        }
+        m_port = ntohs(address.sin_port);
+        m_acceptThread = std::thread(&TestHttpServer::acceptLoop, this);
+        return true;
+    }
+
+    void stop() {
+        m_stopping = true;
+        if (m_acceptThread.joinable()) {
+            m_acceptThread.join();
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& next : m_connectionThreads) {
+            next.join();
+        }
+        m_connectionThreads.clear();
+        if (m_socket >= 0) {
+            close(m_socket);
+            m_socket = -1;
+        }
+    }
+
+    std::string getUrl(const std::string& path = "/") {
+        return (m_tlsContext != nullptr ? "https://127.0.0.1:" : "http://127.0.0.1:") + std::to_string(m_port) + path;
+    }
+
+    /// The number of connections, each of which is a handshake with an HTTPS server.
+    int getConnections() {
+        return m_connections;
+    }
+
+    /// The number of handshakes with an HTTPS server which resumed a previous TLS session.
+    int getResumedSessions() {
+        return m_resumedSessions;
+    }
+
+    int getRequests() {
+        return m_requests;
+    }
+
+private:
+    /// Waits for a socket to be readable, returning @c false when the server stops.
+    bool waitReadable(int socket) {
+        pollfd descriptor{socket, POLLIN, 0};
+        while (!m_stopping) {
+            if (poll(&descriptor, 1, 20) > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void acceptLoop() {
+        while (waitReadable(m_socket)) {
+            int connection = accept(m_socket, nullptr, nullptr);
+            if (connection >= 0) {
+                m_connections++;
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_connectionThreads.emplace_back(&TestHttpServer::connectionLoop, this, connection);
+            }
+        }
+    }
+
+    void connectionLoop(int connection) {
+        std::unique_ptr<SSL, decltype(&SSL_free)> ssl(nullptr, SSL_free);
+        if (m_tlsContext != nullptr) {
+            ssl.reset(SSL_new(m_tlsContext));
+            if (ssl == nullptr || SSL_set_fd(ssl.get(), connection) != 1 || SSL_accept(ssl.get()) != 1) {
+                close(connection);
+                return;
+            }
+            if (SSL_session_reused(ssl.get())) {
+                m_resumedSessions++;
+            }
+        }
+        auto receive = [&](char* data, size_t size) -> int {
+            return ssl != nullptr ? SSL_read(ssl.get(), data, static_cast<int>(size))
+                                  : static_cast<int>(recv(connection, data, size, 0));
+        };
+        auto reply = [&](const std::string& response) {
+            if (ssl != nullptr) {
+                SSL_write(ssl.get(), response.data(), static_cast<int>(response.size()));
+            } else {
+                send(connection, response.data(), response.size(), MSG_NOSIGNAL);
+            }
+        };
+
+        std::string buffer;
+        char data[4096];
+        bool open = true;
+        while (open && ((ssl != nullptr && SSL_pending(ssl.get()) > 0) || waitReadable(connection))) {
+            auto count = receive(data, sizeof(data));
+            if (count <= 0) {
+                break;
+            }
+            buffer.append(data, count);
+
+            // answer each complete request of the buffer on the same connection
+            while (open) {
+                auto headerEnd = buffer.find("\r\n\r\n");
+                if (headerEnd == std::string::npos) {
+                    break;
+                }
+                auto header = buffer.substr(0, headerEnd);
+                std::transform(header.begin(), header.end(), header.begin(), ::tolower);
+                size_t contentLength = 0;
+                auto field = header.find("content-length:");
+                if (field != std::string::npos) {
+                    contentLength = std::stoul(header.substr(field + 15));
+                }
+                if (buffer.size() < headerEnd + 4 + contentLength) {
+                    break;
+                }
+                buffer.erase(0, headerEnd + 4 + contentLength);
+                m_requests++;
+                reply(m_keepAlive ? TEST_RESPONSE : TEST_CLOSE_RESPONSE);
+                open = m_keepAlive;
+            }
+        }
+        if (ssl != nullptr) {
+            SSL_shutdown(ssl.get());
+        }
+        close(connection);
+    }
+
+    SSL_CTX* m_tlsContext;
+    bool m_keepAlive;
+    int m_socket;
+    int m_port;
+    std::atomic<int> m_connections;
+    std::atomic<int> m_resumedSessions;
+    std::atomic<int> m_requests;
+    std::atomic<bool> m_stopping;
+    std::thread m_acceptThread;
+    std::vector<std::thread> m_connectionThreads;
+    std::mutex m_mutex;
+};
+
+/// Test harness for @c HttpClientPool class
+class HttpClientPoolTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        ASSERT_TRUE(m_certificate.create()) << "Create test certificate failed!";
+        ASSERT_TRUE(alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::initialize(
+            {AlexaTestHelper::getAVSConfig(), m_certificate.getAVSConfig()}))
+            << "Initialize AVS Device SDK Failed!";
+        m_initialized = true;
+        ASSERT_TRUE(m_server.start()) << "Start test HTTP server failed!";
+    }
+
+    void TearDown() override {
+        m_server.stop();
+        if (m_initialized) {
+            alexaClientSDK::avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
+            m_initialized = false;
+        }
+    }
+
+protected:
+    TestCertificate m_certificate;
+    TestHttpServer m_server;
+    bool m_initialized = false;
+};
+
+TEST_F(HttpClientPoolTest, pooledRequestsReuseConnection) {
+    auto pool = HttpClientPool::create(HttpClientPool::DEFAULT_MAX_IDLE_CLIENTS);
+    ASSERT_NE(pool, nullptr);
+
+    for (int i = 0; i < 20; i++) {
+        auto response = pool->doGet(m_server.getUrl("/get"), {}, TEST_TIMEOUT);
+        ASSERT_EQ(response.code, 200);
+        ASSERT_EQ(response.body, "ok");
+    }
+    for (int i = 0; i < 20; i++) {
+        auto data = "{\"index\":" + std::to_string(i) + "}";
+        ASSERT_EQ(pool->doPost(m_server.getUrl("/post"), {}, data, TEST_TIMEOUT).code, 200);
+    }
+
+    EXPECT_EQ(m_server.getRequests(), 40);
+    EXPECT_EQ(m_server.getConnections(), 2) << "Pooled requests did not reuse the connection of their method!";
+    EXPECT_EQ(pool->getIdleClientCount(), 2u);
+}
+
+TEST_F(HttpClientPoolTest, resetClosesPooledConnections) {
+    auto pool = HttpClientPool::create(HttpClientPool::DEFAULT_MAX_IDLE_CLIENTS);
+    ASSERT_NE(pool, nullptr);
+
+    for (int i = 0; i < 5; i++) {
+        ASSERT_EQ(pool->doDelete(m_server.getUrl("/delete"), {}, TEST_TIMEOUT).code, 200);
+    }
+    pool->reset();
+    EXPECT_EQ(pool->getIdleClientCount(), 0u);
+
+    // the requests after the curl options changed use a new handle
+    for (int i = 0; i < 5; i++) {
+        ASSERT_EQ(pool->doDelete(m_server.getUrl("/delete"), {}, TEST_TIMEOUT).code, 200);
+    }
+    EXPECT_EQ(m_server.getConnections(), 2);
+}
+
+TEST_F(HttpClientPoolTest, concurrentRequestsKeepBoundedIdleClients) {
+    auto pool = HttpClientPool::create(2);
+    ASSERT_NE(pool, nullptr);
+
+    std::atomic<int> failures(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 10; i++) {
+                if (pool->doGet(m_server.getUrl("/get"), {}, TEST_TIMEOUT).code != 200) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (auto& next : threads) {
+        next.join();
+    }
+
+    EXPECT_EQ(failures, 0);
+    EXPECT_EQ(m_server.getRequests(), 40);
+    EXPECT_LE(pool->getIdleClientCount(), 2u);
+    EXPECT_LT(m_server.getConnections(), 40) << "Concurrent requests did not reuse connections!";
+}
+
+TEST_F(HttpClientPoolTest, pooledRequestsResumeTlsSessions) {
+    // the server closes each connection, so every request completes a handshake
+    TestHttpServer server(m_certificate.getContext(), false);
+    ASSERT_TRUE(server.start()) << "Start test HTTPS server failed!";
+    auto pool = HttpClientPool::create(HttpClientPool::DEFAULT_MAX_IDLE_CLIENTS);
+    ASSERT_NE(pool, nullptr);
+
+    for (int i = 0; i < 10; i++) {
+        auto response = pool->doGet(server.getUrl("/get"), {}, TEST_TIMEOUT);
+        ASSERT_EQ(response.code, 200);
+        ASSERT_EQ(response.body, "ok");
+    }
+    EXPECT_EQ(server.getConnections(), 10);
+    EXPECT_EQ(server.getResumedSessions(), 9) << "Pooled requests did not resume the TLS session of their handle!";
+
+    // a new handle has no session to resume
+    for (int i = 0; i < 10; i++) {
+        auto httpGet = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpGet::create();
+        ASSERT_NE(httpGet, nullptr);
+        ASSERT_EQ(httpGet->doGet(server.getUrl("/get"), {}, TEST_TIMEOUT).code, 200);
+    }
+    EXPECT_EQ(server.getConnections(), 20);
+    EXPECT_EQ(server.getResumedSessions(), 9);
+}
+
+TEST_F(HttpClientPoolTest, pooledRequestsReuseTlsConnection) {
+    TestHttpServer server(m_certificate.getContext());
+    ASSERT_TRUE(server.start()) << "Start test HTTPS server failed!";
+    auto pool = HttpClientPool::create(HttpClientPool::DEFAULT_MAX_IDLE_CLIENTS);
+    ASSERT_NE(pool, nullptr);
+
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQ(pool->doGet(server.getUrl("/get"), {}, TEST_TIMEOUT).code, 200);
+    }
+    EXPECT_EQ(server.getRequests(), 10);
+    EXPECT_EQ(server.getConnections(), 1) << "Pooled requests did not reuse the TLS connection!";
+}
+
+TEST_F(HttpClientPoolTest, DISABLED_benchmarkPooledRequests) {
+    const int requests = 50;
+    TestHttpServer server(m_certificate.getContext());
+    ASSERT_TRUE(server.start()) << "Start test HTTPS server failed!";
+    auto pool = HttpClientPool::create(HttpClientPool::DEFAULT_MAX_IDLE_CLIENTS);
+    ASSERT_NE(pool, nullptr);
+
+    // a new handle for each request, as the REST agents did before the pool
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < requests; i++) {
+        auto httpGet = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpGet::create();
+        ASSERT_NE(httpGet, nullptr);
+        ASSERT_EQ(httpGet->doGet(server.getUrl("/get"), {}, TEST_TIMEOUT).code, 200);
+    }
+    auto oneOffDuration = std::chrono::steady_clock::now() - start;
+    auto oneOffConnections = server.getConnections();
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < requests; i++) {
+        ASSERT_EQ(pool->doGet(server.getUrl("/get"), {}, TEST_TIMEOUT).code, 200);
+    }
+    auto pooledDuration = std::chrono::steady_clock::now() - start;
+
+    RecordProperty("requests", requests);
+    RecordProperty("oneOffConnections", oneOffConnections);
+    RecordProperty(
+        "oneOffUs", static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(oneOffDuration).count()));
+    RecordProperty("pooledConnections", server.getConnections() - oneOffConnections);
+    RecordProperty(
+        "pooledUs", static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(pooledDuration).count()));
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+
+#include <AACE/Engine/Alexa/PlaybackPositionTracker.h>
+
+using namespace aace::engine::alexa;
+using MediaPlayerInterface = alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerInterface;
+
+/// Interval used by the tests between synchronizations with the platform.
+static const std::chrono::milliseconds SYNC_INTERVAL = std::chrono::seconds(5);
+
+/// Source id used by the tests.
+static const PlaybackPositionTracker::SourceId SOURCE_ID = 7;
+
+/// Test harness for @c PlaybackPositionTracker, with a manually advanced clock.
+class PlaybackPositionTrackerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_now = std::chrono::steady_clock::time_point() + std::chrono::hours(1);
+        m_tracker = std::unique_ptr<PlaybackPositionTracker>(
+            new PlaybackPositionTracker(SYNC_INTERVAL, [this] { return m_now; }));
+    }
+
+    void advance(std::chrono::milliseconds duration) {
+        m_now += duration;
+    }
+
+    std::chrono::milliseconds position(PlaybackPositionTracker::SourceId id = SOURCE_ID) {
+        std::chrono::milliseconds result(-1);
+        EXPECT_TRUE(m_tracker->getPosition(id, result));
+        return result;
+    }
+
+protected:
+    std::chrono::steady_clock::time_point m_now;
+    std::unique_ptr<PlaybackPositionTracker> m_tracker;
+};
+
+TEST_F(PlaybackPositionTrackerTest, unknownSourceHasNoPosition) {
+    std::chrono::milliseconds result(-1);
+    ASSERT_FALSE(m_tracker->getPosition(SOURCE_ID, result));
+    ASSERT_FALSE(m_tracker->getPosition(MediaPlayerInterface::ERROR, result));
+
+    m_tracker->reset(SOURCE_ID);
+    ASSERT_FALSE(m_tracker->getPosition(SOURCE_ID + 1, result));
+    ASSERT_EQ(result.count(), -1);
+
+    m_tracker->reset(MediaPlayerInterface::ERROR);
+    ASSERT_FALSE(m_tracker->getPosition(SOURCE_ID, result));
+}
+
+TEST_F(PlaybackPositionTrackerTest, positionIsExtrapolatedOnlyWhilePlaying) {
+    m_tracker->reset(SOURCE_ID, std::chrono::milliseconds(1500));
+    advance(std::chrono::seconds(2));
+    ASSERT_EQ(position(), std::chrono::milliseconds(1500));
+
+    m_tracker->update(SOURCE_ID, std::chrono::milliseconds(1500), true);
+    advance(std::chrono::milliseconds(2250));
+    ASSERT_EQ(position(), std::chrono::milliseconds(3750));
+
+    m_tracker->update(SOURCE_ID, std::chrono::milliseconds(3700), false);
+    advance(std::chrono::seconds(10));
+    ASSERT_EQ(position(), std::chrono::milliseconds(3700));
+}
+
+TEST_F(PlaybackPositionTrackerTest, updatesForOtherSourcesAreIgnored) {
+    m_tracker->reset(SOURCE_ID);
+    m_tracker->update(SOURCE_ID, std::chrono::milliseconds(0), true);
+    m_tracker->update(SOURCE_ID - 1, std::chrono::seconds(100), false);
+    advance(std::chrono::seconds(1));
+    ASSERT_EQ(position(), std::chrono::seconds(1));
+}
+
+TEST_F(PlaybackPositionTrackerTest, platformPositionCorrectsDrift) {
+    m_tracker->reset(SOURCE_ID);
+    m_tracker->update(SOURCE_ID, std::chrono::milliseconds(0), true);
+    advance(std::chrono::seconds(6));
+    ASSERT_EQ(position(), std::chrono::seconds(6));
+
+    // the platform stalled for a second without reporting buffering
+    ASSERT_TRUE(m_tracker->startSync());
+    m_tracker->update(SOURCE_ID, std::chrono::seconds(5), true);
+    advance(std::chrono::seconds(1));
+    ASSERT_EQ(position(), std::chrono::seconds(6));
+}
+
+TEST_F(PlaybackPositionTrackerTest, syncIsClaimedOncePerInterval) {
+    m_tracker->reset(SOURCE_ID);
+    ASSERT_FALSE(m_tracker->startSync());
+
+    advance(SYNC_INTERVAL);
+    ASSERT_TRUE(m_tracker->startSync());
+    ASSERT_FALSE(m_tracker->startSync());
+
+    // a failed sync can be retried
+    m_tracker->cancelSync();
+    ASSERT_TRUE(m_tracker->startSync());
+
+    // an update restarts the interval
+    m_tracker->update(SOURCE_ID, std::chrono::seconds(5), true);
+    ASSERT_FALSE(m_tracker->startSync());
+    advance(SYNC_INTERVAL - std::chrono::milliseconds(1));
+    ASSERT_FALSE(m_tracker->startSync());
+    advance(std::chrono::milliseconds(1));
+    ASSERT_TRUE(m_tracker->startSync());
+
+    // no sync is needed without a source
+    m_tracker->reset(MediaPlayerInterface::ERROR);
+    advance(SYNC_INTERVAL);
+    ASSERT_FALSE(m_tracker->startSync());
+}
@@ -17,7 +17,9 @@
 #define AASB_ENGINE_APL_AASB_APL_H
 
 #include <AACE/APL/APL.h>
+#include <AACE/Engine/APL/APLDocumentCache.h>
 #include <AACE/Engine/MessageBroker/MessageBrokerInterface.h>
+#include <AACE/Engine/MessageBroker/PayloadStreamChannel.h>
 
 namespace aasb {
 namespace engine {
@@ -29,11 +31,25 @@ class AASBAPL
 private:
     AASBAPL() = default;
 
-    bool initialize(std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker);
+    bool initialize(
+        std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
+        std::shared_ptr<aace::engine::messageBroker::PayloadStreamChannel> payloadStreamChannel,
+        std::shared_ptr<aace::engine::apl::APLDocumentCache> documentCache);
 
 public:
+    /**
+     * Creates the APL message handler.
+     *
+     * @param messageBroker The message broker to publish and receive messages with.
+     * @param payloadStreamChannel The channel for documents and data source updates which are too large
+     *        to be embedded in a message, or @c nullptr to embed every payload.
+     * @param documentCache The cache of the documents the platform has received, or @c nullptr to deliver
+     *        every document in full.
+     */
     static std::shared_ptr<AASBAPL> create(
-        std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker);
+        std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
+        std::shared_ptr<aace::engine::messageBroker::PayloadStreamChannel> payloadStreamChannel = nullptr,
+        std::shared_ptr<aace::engine::apl::APLDocumentCache> documentCache = nullptr);
 
     // aace::apl
     void renderDocument(const std::string& payload, const std::string& token, const std::string& windowId) override;
@@ -46,6 +62,8 @@ public:
 
 private:
     std::weak_ptr<aace::engine::messageBroker::MessageBrokerInterface> m_messageBroker;
+    std::shared_ptr<aace::engine::messageBroker::PayloadStreamChannel> m_payloadStreamChannel;
+    std::shared_ptr<aace::engine::apl::APLDocumentCache> m_documentCache;
 };
 
 }  // namespace apl
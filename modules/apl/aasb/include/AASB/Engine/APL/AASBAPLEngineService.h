@@ -35,9 +35,22 @@ private:
 
 protected:
     bool postRegister() override;
+    bool configureMessageInterface(
+        const std::string& name,
+        bool enabled,
+        const aace::engine::utils::json::Value& configuration) override;
 
 public:
     virtual ~AASBAPLEngineService() = default;
+
+private:
+    bool configureAPL(const aace::engine::utils::json::Value& configuration);
+
+    /// Size from which documents and data source updates are sent in a stream, or 0 to always embed them.
+    size_t m_payloadStreamThreshold = 0;
+
+    /// Number of documents the platform keeps in its document cache, or 0 to deliver every document in full.
+    size_t m_documentCacheMaxDocuments = 0;
 };
 
 }  // namespace apl
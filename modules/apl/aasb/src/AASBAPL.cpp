@@ -19,6 +19,7 @@
 #include <AASB/Message/APL/APL/ActivityEvent.h>
 #include <AASB/Message/APL/APL/ClearAllExecuteCommandsMessage.h>
 #include <AASB/Message/APL/APL/ClearCardMessage.h>
+#include <AASB/Message/APL/APL/ClearDocumentCacheMessage.h>
 #include <AASB/Message/APL/APL/ClearDocumentMessage.h>
 #include <AASB/Message/APL/APL/DataSourceUpdateMessage.h>
 #include <AASB/Message/APL/APL/ExecuteCommandsMessage.h>
@@ -50,7 +51,9 @@ static const std::string TAG("aasb.apl.AASBAPL");
 using Message = aace::engine::messageBroker::Message;
 
 std::shared_ptr<AASBAPL> AASBAPL::create(
-    std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker) {
+    std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
+    std::shared_ptr<aace::engine::messageBroker::PayloadStreamChannel> payloadStreamChannel,
+    std::shared_ptr<aace::engine::apl::APLDocumentCache> documentCache) {
     try {
         ThrowIfNull(messageBroker, "invalidMessageBrokerInterface");
 
@@ -58,7 +61,7 @@ std::shared_ptr<AASBAPL> AASBAPL::create(
         auto apl = std::shared_ptr<AASBAPL>(new AASBAPL());
 
         // initialize the platform handler
-        ThrowIfNot(apl->initialize(messageBroker), "initializeAASBAPLFailed");
+        ThrowIfNot(apl->initialize(messageBroker, payloadStreamChannel, documentCache), "initializeAASBAPLFailed");
 
         return apl;
     } catch (std::exception& ex) {
@@ -67,11 +70,16 @@ std::shared_ptr<AASBAPL> AASBAPL::create(
     }
 }
 
-bool AASBAPL::initialize(std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker) {
+bool AASBAPL::initialize(
+    std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
+    std::shared_ptr<aace::engine::messageBroker::PayloadStreamChannel> payloadStreamChannel,
+    std::shared_ptr<aace::engine::apl::APLDocumentCache> documentCache) {
     try {
         ThrowIfNull(messageBroker, "invalidMessageBrokerInterface");
 
         m_messageBroker = messageBroker;
+        m_payloadStreamChannel = payloadStreamChannel;
+        m_documentCache = documentCache;
 
         // create a wp reference
         std::weak_ptr<AASBAPL> wp = shared_from_this();
@@ -90,6 +98,22 @@ bool AASBAPL::initialize(std::shared_ptr<aace::engine::messageBroker::MessageBro
                 }
             });
 
+        messageBroker->subscribe(
+            aasb::message::apl::apl::ClearDocumentCacheMessage::topic(),
+            aasb::message::apl::apl::ClearDocumentCacheMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+
+                    if (sp->m_documentCache != nullptr) {
+                        sp->m_documentCache->clear();
+                    }
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG, "ClearDocumentCacheMessage").d("reason", ex.what()));
+                }
+            });
+
         messageBroker->subscribe(
             aasb::message::apl::apl::ClearAllExecuteCommandsMessage::topic(),
             aasb::message::apl::apl::ClearAllExecuteCommandsMessage::action(),
@@ -163,6 +187,9 @@ bool AASBAPL::initialize(std::shared_ptr<aace::engine::messageBroker::MessageBro
                     aasb::message::apl::apl::RenderDocumentResultMessage::Payload payload =
                         nlohmann::json::parse(message.payload());
 
+                    if (!payload.result && sp->m_documentCache != nullptr) {
+                        sp->m_documentCache->renderFailed(payload.token);
+                    }
                     sp->renderDocumentResult(payload.token, payload.result, payload.error);
                 } catch (std::exception& ex) {
                     AACE_ERROR(LX(TAG, "RenderDocumentResultMessage").d("reason", ex.what()));
@@ -304,6 +331,15 @@ void AASBAPL::renderDocument(const std::string& payload, const std::string& toke
         message.payload.payload = payload;
         message.payload.token = token;
         message.payload.windowId = windowId;
+        if (m_documentCache != nullptr) {
+            auto render = m_documentCache->prepareRender(payload, token, windowId);
+            message.payload.payload = std::move(render.payload);
+            message.payload.documentHash = std::move(render.documentHash);
+            message.payload.dataSourcesPatch = std::move(render.dataSourcesPatch);
+        }
+        if (m_payloadStreamChannel != nullptr) {
+            message.payload.payloadStreamId = m_payloadStreamChannel->send(message.payload.payload);
+        }
 
         m_messageBroker_lock->publish(message.toString()).send();
 
@@ -319,6 +355,10 @@ void AASBAPL::clearDocument(const std::string& token) {
         auto m_messageBroker_lock = m_messageBroker.lock();
         ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
 
+        if (m_documentCache != nullptr) {
+            m_documentCache->clearDocument(token);
+        }
+
         aasb::message::apl::apl::ClearDocumentMessage message;
         message.payload.token = token;
 
@@ -375,6 +415,9 @@ void AASBAPL::dataSourceUpdate(const std::string& type, const std::string& paylo
         message.payload.type = type;
         message.payload.payload = payload;
         message.payload.token = token;
+        if (m_payloadStreamChannel != nullptr) {
+            message.payload.payloadStreamId = m_payloadStreamChannel->send(message.payload.payload);
+        }
 
         m_messageBroker_lock->publish(message.toString()).send();
 
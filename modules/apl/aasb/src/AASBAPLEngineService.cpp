@@ -17,6 +17,10 @@
 #include <AASB/Engine/APL/AASBAPL.h>
 #include <AACE/Engine/MessageBroker/MessageBrokerInterface.h>
 #include <AACE/Engine/Core/EngineMacros.h>
+#include <AACE/Engine/APL/APLDocumentCache.h>
+#include <AACE/Engine/MessageBroker/PayloadStreamChannel.h>
+
+#include <nlohmann/json.hpp>
 
 namespace aasb {
 namespace engine {
@@ -35,6 +39,49 @@ AASBAPLEngineService::AASBAPLEngineService(const aace::engine::core::ServiceDesc
         aace::engine::messageBroker::MessageHandlerEngineService(description, minRequiredVersion, {"APL"}) {
 }
 
+bool AASBAPLEngineService::configureMessageInterface(
+    const std::string& name,
+    bool enabled,
+    const aace::engine::utils::json::Value& configuration) {
+    try {
+        // call inherited configure method
+        ThrowIfNot(
+            MessageHandlerEngineService::configureMessageInterface(name, enabled, configuration),
+            "configureMessageInterfaceFailed");
+
+        // handle specific interface configuration options
+        if (enabled && name == "APL") {
+            ThrowIfNot(configureAPL(configuration), "configureAPLFailed");
+        }
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool AASBAPLEngineService::configureAPL(const aace::engine::utils::json::Value& configuration) {
+    try {
+        ThrowIfNot(configuration.is_object(), "invalidAPLConfiguration");
+        auto threshold = configuration.value("payloadStreamThreshold", nlohmann::json());
+        if (threshold != nullptr) {
+            ThrowIfNot(threshold.is_number_unsigned(), "invalidPayloadStreamThreshold");
+            m_payloadStreamThreshold = threshold.get<size_t>();
+        }
+        auto maxDocuments =
+            configuration.value(nlohmann::json::json_pointer("/documentCache/maxDocuments"), nlohmann::json());
+        if (maxDocuments != nullptr) {
+            ThrowIfNot(maxDocuments.is_number_unsigned(), "invalidDocumentCacheMaxDocuments");
+            m_documentCacheMaxDocuments = maxDocuments.get<size_t>();
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
 bool AASBAPLEngineService::postRegister() {
     try {
         auto aasbServiceInterface =
@@ -44,7 +91,18 @@ bool AASBAPLEngineService::postRegister() {
 
         // APL
         if (isInterfaceEnabled("APL")) {
-            auto apl = AASBAPL::create(aasbServiceInterface->getMessageBroker());
+            std::shared_ptr<aace::engine::messageBroker::PayloadStreamChannel> payloadStreamChannel;
+            if (m_payloadStreamThreshold > 0) {
+                payloadStreamChannel = aace::engine::messageBroker::PayloadStreamChannel::create(
+                    aasbServiceInterface->getStreamManager(), m_payloadStreamThreshold);
+                ThrowIfNull(payloadStreamChannel, "invalidPayloadStreamChannel");
+            }
+            std::shared_ptr<aace::engine::apl::APLDocumentCache> documentCache;
+            if (m_documentCacheMaxDocuments > 0) {
+                documentCache = aace::engine::apl::APLDocumentCache::create(m_documentCacheMaxDocuments);
+                ThrowIfNull(documentCache, "invalidDocumentCache");
+            }
+            auto apl = AASBAPL::create(aasbServiceInterface->getMessageBroker(), payloadStreamChannel, documentCache);
             ThrowIfNull(apl, "invalidAPLHandler");
             getContext()->registerPlatformInterface(apl);
         }
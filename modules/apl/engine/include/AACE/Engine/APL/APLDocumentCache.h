@@ -0,0 +1,124 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_APL_APL_DOCUMENT_CACHE_H
+#define AACE_ENGINE_APL_APL_DOCUMENT_CACHE_H
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <nlohmann/json.hpp>
+
+namespace aace {
+namespace engine {
+namespace apl {
+
+/**
+ * Tracks the APL documents the platform has already received, so that a render can reference a document
+ * by hash instead of delivering it again.
+ *
+ * Documents are identified by a hash of their content. The cache mirrors a least recently used cache of
+ * @c maxDocuments documents on the platform: every render of a document, whether it is delivered or
+ * referenced, makes it the most recently used one. When a window shows the same document again, only a
+ * JSON Patch (RFC 6902) from the data sources of the previous render in that window is delivered.
+ * All functions are thread safe.
+ */
+class APLDocumentCache {
+private:
+    APLDocumentCache(size_t maxDocuments);
+
+public:
+    /**
+     * Creates a cache.
+     *
+     * @param maxDocuments The number of documents the platform keeps.
+     * @return The new cache, or @c nullptr if @c maxDocuments is 0.
+     */
+    static std::shared_ptr<APLDocumentCache> create(size_t maxDocuments);
+
+    /// A render, as it is delivered to the platform.
+    struct Render {
+        /// The render payload, without the document if it is cached, and without the data sources if they are patched.
+        std::string payload;
+        /// The hash of the document, or an empty string if the payload has no document.
+        std::string documentHash;
+        /// The patch to apply to the data sources of the previous render in the window, or an empty string.
+        std::string dataSourcesPatch;
+    };
+
+    /**
+     * Prepares the delivery of a render.
+     *
+     * @param payload The render payload, with the @c document and @c datasources of the directive.
+     * @param token The presentation token of the render.
+     * @param windowId The window the document is rendered in.
+     * @return The render to deliver, which is the unmodified payload if it can not be parsed.
+     */
+    Render prepareRender(const std::string& payload, const std::string& token, const std::string& windowId);
+
+    /**
+     * Notifies the cache that a document was cleared, so that its data sources are delivered in full next time.
+     *
+     * @param token The presentation token of the document.
+     */
+    void clearDocument(const std::string& token);
+
+    /**
+     * Notifies the cache that the platform failed to render a document, which is delivered in full next time.
+     *
+     * @param token The presentation token of the document.
+     */
+    void renderFailed(const std::string& token);
+
+    /// Forgets all documents, after the platform has cleared its cache.
+    void clear();
+
+    /// Returns the hash which identifies a document.
+    static std::string createHash(const std::string& document);
+
+private:
+    /// Marks a document as the most recently used one, and returns whether the platform already has it.
+    bool useDocumentLocked(const std::string& hash);
+
+    /// Removes a document from the cache.
+    void removeDocumentLocked(std::string hash);
+
+    /// The render shown in a window.
+    struct WindowState {
+        std::string token;
+        std::string documentHash;
+        nlohmann::json dataSources;
+    };
+
+    const size_t m_maxDocuments;
+
+    std::mutex m_mutex;
+
+    /// Hashes of the documents on the platform, most recently used first.
+    std::list<std::string> m_lruHashes;
+    std::unordered_map<std::string, std::list<std::string>::iterator> m_documents;
+
+    /// The last render in each window.
+    std::unordered_map<std::string, WindowState> m_windows;
+};
+
+}  // namespace apl
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_APL_APL_DOCUMENT_CACHE_H
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/Core/EngineMacros.h>
+#include <AACE/Engine/Utils/Hash/Hash.h>
+
+#include "AACE/Engine/APL/APLDocumentCache.h"
+
+namespace aace {
+namespace engine {
+namespace apl {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.apl.APLDocumentCache");
+
+/// Render payload key of the APL document.
+static const std::string DOCUMENT_KEY = "document";
+
+/// Render payload key of the data sources.
+static const std::string DATA_SOURCES_KEY = "datasources";
+
+APLDocumentCache::APLDocumentCache(size_t maxDocuments) : m_maxDocuments(maxDocuments) {
+}
+
+std::shared_ptr<APLDocumentCache> APLDocumentCache::create(size_t maxDocuments) {
+    try {
+        ThrowIf(maxDocuments == 0, "invalidMaxDocuments");
+        return std::shared_ptr<APLDocumentCache>(new APLDocumentCache(maxDocuments));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+std::string APLDocumentCache::createHash(const std::string& document) {
+    // qualified by the size of the document
+    return aace::engine::utils::hash::toHex(aace::engine::utils::hash::fnv1a(document)) + "-" +
+           std::to_string(document.size());
+}
+
+APLDocumentCache::Render APLDocumentCache::prepareRender(
+    const std::string& payload,
+    const std::string& token,
+    const std::string& windowId) {
+    Render render;
+    render.payload = payload;
+    try {
+        auto root = nlohmann::json::parse(payload);
+        ReturnIf(!root.is_object() || !root.contains(DOCUMENT_KEY), render);
+
+        render.documentHash = createHash(root[DOCUMENT_KEY].dump());
+        nlohmann::json dataSources;
+        if (root.contains(DATA_SOURCES_KEY)) {
+            dataSources = root[DATA_SOURCES_KEY];
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto cached = useDocumentLocked(render.documentHash);
+        auto& window = m_windows[windowId];
+        auto patchable = cached && window.documentHash == render.documentHash && window.dataSources.is_object() &&
+                         dataSources.is_object();
+        if (patchable) {
+            // deliver only what changed, if that is smaller than the data sources
+            auto patch = nlohmann::json::diff(window.dataSources, dataSources).dump();
+            if (patch.size() < dataSources.dump().size()) {
+                render.dataSourcesPatch = std::move(patch);
+                root.erase(DATA_SOURCES_KEY);
+            }
+        }
+        window.token = token;
+        window.documentHash = render.documentHash;
+        window.dataSources = std::move(dataSources);
+
+        // the platform does not have the document yet, so it is delivered unmodified
+        ReturnIfNot(cached, render);
+        root.erase(DOCUMENT_KEY);
+        render.payload = root.dump();
+        AACE_DEBUG(LX(TAG)
+                       .d("documentHash", render.documentHash)
+                       .d("payloadSize", payload.size())
+                       .d("renderSize", render.payload.size() + render.dataSourcesPatch.size()));
+        return render;
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG).d("reason", ex.what()));
+        render.payload = payload;
+        render.documentHash.clear();
+        render.dataSourcesPatch.clear();
+        return render;
+    }
+}
+
+void APLDocumentCache::clearDocument(const std::string& token) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_windows.begin(); it != m_windows.end();) {
+        if (it->second.token == token) {
+            it = m_windows.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void APLDocumentCache::renderFailed(const std::string& token) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_windows.begin(); it != m_windows.end();) {
+        if (it->second.token == token) {
+            removeDocumentLocked(it->second.documentHash);
+            it = m_windows.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void APLDocumentCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_documents.clear();
+    m_lruHashes.clear();
+    m_windows.clear();
+}
+
+bool APLDocumentCache::useDocumentLocked(const std::string& hash) {
+    auto it = m_documents.find(hash);
+    if (it != m_documents.end()) {
+        m_lruHashes.splice(m_lruHashes.begin(), m_lruHashes, it->second);
+        return true;
+    }
+    if (m_lruHashes.size() >= m_maxDocuments) {
+        removeDocumentLocked(m_lruHashes.back());
+    }
+    m_lruHashes.push_front(hash);
+    m_documents[hash] = m_lruHashes.begin();
+    return false;
+}
+
+void APLDocumentCache::removeDocumentLocked(std::string hash) {
+    auto it = m_documents.find(hash);
+    if (it != m_documents.end()) {
+        m_lruHashes.erase(it->second);
+        m_documents.erase(it);
+    }
+    // a window showing the document can no longer be patched. The hash is a copy, since the caller may pass the
+    // list node erased above or the hash of a window cleared below.
+    for (auto& window : m_windows) {
+        if (window.second.documentHash == hash) {
+            window.second.documentHash.clear();
+        }
+    }
+}
+
+}  // namespace apl
+}  // namespace engine
+}  // namespace aace
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+#include <string>
+
+#include <AACE/Engine/APL/APLDocumentCache.h>
+
+using namespace aace::engine::apl;
+
+/// Creates a render payload with a document identified by @c name, and data sources with a list of items.
+static std::string createPayload(const std::string& name, int selected = 0) {
+    nlohmann::json items = nlohmann::json::array();
+    for (int i = 0; i < 20; i++) {
+        items.push_back({{"title", "Item " + std::to_string(i)}, {"subtitle", "A long enough description"}});
+    }
+    return nlohmann::json(
+               {{"document",
+                 {{"type", "APL"}, {"version", "1.9"}, {"mainTemplate", {{"items", {{"type", "Text"}, {"id", name}}}}}}},
+                {"datasources", {{"list", {{"items", items}, {"selected", selected}}}}}})
+        .dump();
+}
+
+static bool hasDocument(const APLDocumentCache::Render& render) {
+    return nlohmann::json::parse(render.payload).contains("document");
+}
+
+static bool hasDataSources(const APLDocumentCache::Render& render) {
+    return nlohmann::json::parse(render.payload).contains("datasources");
+}
+
+TEST(APLDocumentCacheTest, createWithInvalidSize) {
+    ASSERT_EQ(APLDocumentCache::create(0), nullptr);
+}
+
+TEST(APLDocumentCacheTest, referenceCachedDocument) {
+    auto cache = APLDocumentCache::create(2);
+    ASSERT_NE(cache, nullptr);
+
+    auto first = cache->prepareRender(createPayload("a"), "token-1", "window-1");
+    EXPECT_TRUE(hasDocument(first));
+    EXPECT_FALSE(first.documentHash.empty());
+
+    // the same document in another window is referenced by hash, with its data sources in full
+    auto second = cache->prepareRender(createPayload("a"), "token-2", "window-2");
+    EXPECT_FALSE(hasDocument(second));
+    EXPECT_TRUE(hasDataSources(second));
+    EXPECT_TRUE(second.dataSourcesPatch.empty());
+    EXPECT_EQ(second.documentHash, first.documentHash);
+}
+
+TEST(APLDocumentCacheTest, evictLeastRecentlyUsedDocument) {
+    auto cache = APLDocumentCache::create(2);
+    ASSERT_NE(cache, nullptr);
+
+    cache->prepareRender(createPayload("a"), "token-1", "window-1");
+    cache->prepareRender(createPayload("b"), "token-2", "window-2");
+
+    // using "a" again makes "b" the least recently used document, which "c" evicts
+    EXPECT_FALSE(hasDocument(cache->prepareRender(createPayload("a"), "token-3", "window-3")));
+    EXPECT_TRUE(hasDocument(cache->prepareRender(createPayload("c"), "token-4", "window-4")));
+    EXPECT_FALSE(hasDocument(cache->prepareRender(createPayload("a"), "token-5", "window-5")));
+    EXPECT_TRUE(hasDocument(cache->prepareRender(createPayload("b"), "token-6", "window-6")));
+}
+
+TEST(APLDocumentCacheTest, evictedDocumentIsNotPatched) {
+    auto cache = APLDocumentCache::create(2);
+    ASSERT_NE(cache, nullptr);
+
+    cache->prepareRender(createPayload("a"), "token-1", "window-1");
+    cache->prepareRender(createPayload("b"), "token-2", "window-2");
+    cache->prepareRender(createPayload("c"), "token-3", "window-3");
+
+    // "a" is delivered again, but the platform no longer has the data sources shown in window-1 with it
+    EXPECT_TRUE(hasDocument(cache->prepareRender(createPayload("a"), "token-4", "window-4")));
+    auto render = cache->prepareRender(createPayload("a", 1), "token-5", "window-1");
+    EXPECT_FALSE(hasDocument(render));
+    EXPECT_TRUE(hasDataSources(render));
+    EXPECT_TRUE(render.dataSourcesPatch.empty());
+}
+
+TEST(APLDocumentCacheTest, patchDataSources) {
+    auto cache = APLDocumentCache::create(2);
+    ASSERT_NE(cache, nullptr);
+
+    auto previous = nlohmann::json::parse(createPayload("a"))["datasources"];
+    cache->prepareRender(createPayload("a"), "token-1", "window-1");
+    auto render = cache->prepareRender(createPayload("a", 3), "token-2", "window-1");
+    EXPECT_FALSE(hasDocument(render));
+    EXPECT_FALSE(hasDataSources(render));
+    ASSERT_FALSE(render.dataSourcesPatch.empty());
+
+    auto patched = previous.patch(nlohmann::json::parse(render.dataSourcesPatch));
+    EXPECT_EQ(patched, nlohmann::json::parse(createPayload("a", 3))["datasources"]);
+}
+
+TEST(APLDocumentCacheTest, clearDocumentDeliversDataSources) {
+    auto cache = APLDocumentCache::create(2);
+    ASSERT_NE(cache, nullptr);
+
+    cache->prepareRender(createPayload("a"), "token-1", "window-1");
+    cache->clearDocument("token-1");
+    auto render = cache->prepareRender(createPayload("a", 1), "token-2", "window-1");
+    EXPECT_FALSE(hasDocument(render));
+    EXPECT_TRUE(hasDataSources(render));
+    EXPECT_TRUE(render.dataSourcesPatch.empty());
+}
+
+TEST(APLDocumentCacheTest, renderFailedInvalidatesEveryWindow) {
+    auto cache = APLDocumentCache::create(2);
+    ASSERT_NE(cache, nullptr);
+
+    cache->prepareRender(createPayload("a"), "token-1", "window-1");
+    cache->prepareRender(createPayload("a"), "token-2", "window-2");
+    cache->renderFailed("token-1");
+
+    // the document is delivered again
+    EXPECT_TRUE(hasDocument(cache->prepareRender(createPayload("a"), "token-3", "window-1")));
+
+    // the data sources shown in window-2 belonged to the failed document, so they are not patched
+    auto render = cache->prepareRender(createPayload("a", 1), "token-4", "window-2");
+    EXPECT_FALSE(hasDocument(render));
+    EXPECT_TRUE(hasDataSources(render));
+    EXPECT_TRUE(render.dataSourcesPatch.empty());
+}
+
+TEST(APLDocumentCacheTest, invalidPayloadIsDeliveredUnmodified) {
+    auto cache = APLDocumentCache::create(2);
+    ASSERT_NE(cache, nullptr);
+
+    auto render = cache->prepareRender("{\"document\":", "token-1", "window-1");
+    EXPECT_EQ(render.payload, "{\"document\":");
+    EXPECT_TRUE(render.documentHash.empty());
+
+    render = cache->prepareRender("{\"presentationToken\":\"token-2\"}", "token-2", "window-1");
+    EXPECT_EQ(render.payload, "{\"presentationToken\":\"token-2\"}");
+    EXPECT_TRUE(render.documentHash.empty());
+}
@@ -22,6 +22,7 @@
 #include <utility>
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 namespace aasb {
 namespace engine {
@@ -32,7 +33,7 @@ class AASBCarControl
         , public std::enable_shared_from_this<AASBCarControl> {
 private:
     using CarControlPromise = std::promise<bool>;
-    AASBCarControl(uint32_t asyncReplyTimeout);
+    AASBCarControl(uint32_t asyncReplyTimeout, bool batchRequests);
 
     bool initialize(std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker);
     void addReplyMessagePromise(const std::string& messageId, std::shared_ptr<CarControlPromise> promise);
@@ -43,7 +44,8 @@ private:
 public:
     static std::shared_ptr<AASBCarControl> create(
         std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
-        uint32_t asyncReplyTimeout);
+        uint32_t asyncReplyTimeout,
+        bool batchRequests = false);
 
     // aace::carControl
     bool turnPowerControllerOn(const std::string& endpointId) override;
@@ -68,9 +70,13 @@ public:
     bool getModeControllerValue(const std::string& endpointId, const std::string& controllerId, std::string& value)
         override;
 
+    std::vector<bool> setControllerValues(ControllerType type, const std::vector<ControllerRequest>& requests) override;
+    bool handlesControllerBatches() override;
+
 private:
     std::weak_ptr<aace::engine::messageBroker::MessageBrokerInterface> m_messageBroker;
     uint32_t m_replyMessageTimeout;
+    bool m_batchRequests;
     std::mutex m_promise_map_access_mutex;
     std::unordered_map<std::string, std::shared_ptr<CarControlPromise>> m_promiseMap;
 };
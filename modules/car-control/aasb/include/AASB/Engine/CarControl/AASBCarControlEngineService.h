@@ -32,17 +32,21 @@ public:
 
 private:
     AASBCarControlEngineService(const aace::engine::core::ServiceDescription& description);
-    bool configureCarControl(std::istream& configuration);
+    bool configureCarControl(const aace::engine::utils::json::Value& configuration);
 
 protected:
     bool postRegister() override;
-    bool configureMessageInterface(const std::string& name, bool enabled, std::istream& configuration) override;
+    bool configureMessageInterface(
+        const std::string& name,
+        bool enabled,
+        const aace::engine::utils::json::Value& configuration) override;
 
 public:
     virtual ~AASBCarControlEngineService() = default;
 
 private:
     uint32_t m_asyncReplyTimeout = 5000;
+    bool m_batchRequests = false;
 };
 
 }  // namespace carControl
@@ -25,6 +25,12 @@
 #include <AASB/Message/CarControl/CarControl/SetModeControllerValueMessage.h>
 #include <AASB/Message/CarControl/CarControl/SetPowerControllerValueMessage.h>
 #include <AASB/Message/CarControl/CarControl/SetToggleControllerValueMessage.h>
+#include <AASB/Message/CarControl/CarControl/SetControllerValuesMessage.h>
+
+#include <AASB/Message/CarControl/CarControl/ModeControllerValueChangedMessage.h>
+#include <AASB/Message/CarControl/CarControl/PowerControllerStateChangedMessage.h>
+#include <AASB/Message/CarControl/CarControl/RangeControllerValueChangedMessage.h>
+#include <AASB/Message/CarControl/CarControl/ToggleControllerStateChangedMessage.h>
 
 namespace aasb {
 namespace engine {
@@ -36,19 +42,21 @@ static const std::string TAG("aasb.carControl.AASBCarControl");
 // aliases
 using Message = aace::engine::messageBroker::Message;
 
-AASBCarControl::AASBCarControl(uint32_t asyncReplyTimeout) {
-    AACE_VERBOSE(LX(TAG).d("asyncReplyTimeout", asyncReplyTimeout));
+AASBCarControl::AASBCarControl(uint32_t asyncReplyTimeout, bool batchRequests) {
+    AACE_VERBOSE(LX(TAG).d("asyncReplyTimeout", asyncReplyTimeout).d("batchRequests", batchRequests));
     m_replyMessageTimeout = asyncReplyTimeout;
+    m_batchRequests = batchRequests;
 }
 
 std::shared_ptr<AASBCarControl> AASBCarControl::create(
     std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker,
-    uint32_t asyncReplyTimeout) {
+    uint32_t asyncReplyTimeout,
+    bool batchRequests) {
     try {
         ThrowIfNull(messageBroker, "invalidMessageBrokerInterface");
 
         // create the car control platform handler
-        auto carControl = std::shared_ptr<AASBCarControl>(new AASBCarControl(asyncReplyTimeout));
+        auto carControl = std::shared_ptr<AASBCarControl>(new AASBCarControl(asyncReplyTimeout, batchRequests));
 
         // initialize the platform handler
         ThrowIfNot(carControl->initialize(messageBroker), "initializeAASBCarControlFailed");
@@ -109,6 +117,71 @@ bool AASBCarControl::initialize(std::shared_ptr<aace::engine::messageBroker::Mes
                     AACE_ERROR(LX(TAG, "AdjustControllerValueMessageReply").d("reason", ex.what()));
                 }
             });
+
+        messageBroker->subscribe(
+            aasb::message::carControl::carControl::PowerControllerStateChangedMessage::topic(),
+            aasb::message::carControl::carControl::PowerControllerStateChangedMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+
+                    aasb::message::carControl::carControl::PowerControllerStateChangedMessage::Payload payload =
+                        nlohmann::json::parse(message.payload());
+                    sp->powerControllerStateChanged(payload.endpointId, payload.isOn);
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG, "PowerControllerStateChangedMessage").d("reason", ex.what()));
+                }
+            });
+
+        messageBroker->subscribe(
+            aasb::message::carControl::carControl::ToggleControllerStateChangedMessage::topic(),
+            aasb::message::carControl::carControl::ToggleControllerStateChangedMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+
+                    aasb::message::carControl::carControl::ToggleControllerStateChangedMessage::Payload payload =
+                        nlohmann::json::parse(message.payload());
+                    sp->toggleControllerStateChanged(payload.endpointId, payload.instanceId, payload.isOn);
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG, "ToggleControllerStateChangedMessage").d("reason", ex.what()));
+                }
+            });
+
+        messageBroker->subscribe(
+            aasb::message::carControl::carControl::RangeControllerValueChangedMessage::topic(),
+            aasb::message::carControl::carControl::RangeControllerValueChangedMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+
+                    aasb::message::carControl::carControl::RangeControllerValueChangedMessage::Payload payload =
+                        nlohmann::json::parse(message.payload());
+                    sp->rangeControllerValueChanged(payload.endpointId, payload.instanceId, payload.value);
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG, "RangeControllerValueChangedMessage").d("reason", ex.what()));
+                }
+            });
+
+        messageBroker->subscribe(
+            aasb::message::carControl::carControl::ModeControllerValueChangedMessage::topic(),
+            aasb::message::carControl::carControl::ModeControllerValueChangedMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+
+                    aasb::message::carControl::carControl::ModeControllerValueChangedMessage::Payload payload =
+                        nlohmann::json::parse(message.payload());
+                    sp->modeControllerValueChanged(payload.endpointId, payload.instanceId, payload.value);
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG, "ModeControllerValueChangedMessage").d("reason", ex.what()));
+                }
+            });
+
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -168,7 +241,8 @@ bool AASBCarControl::turnPowerControllerOff(const std::string& endpointId) {
 }
 
 bool AASBCarControl::isPowerControllerOn(const std::string& endpointId, bool& isOn) {
-    return true;
+    // the state is only known by the engine once it is reported with a PowerControllerStateChanged message
+    return false;
 }
 
 /**
@@ -222,7 +296,8 @@ bool AASBCarControl::turnToggleControllerOff(const std::string& endpointId, cons
 }
 
 bool AASBCarControl::isToggleControllerOn(const std::string& endpointId, const std::string& controllerId, bool& isOn) {
-    return true;
+    // the state is only known by the engine once it is reported with a ToggleControllerStateChanged message
+    return false;
 }
 
 /**
@@ -286,7 +361,8 @@ bool AASBCarControl::getRangeControllerValue(
     const std::string& endpointId,
     const std::string& controllerId,
     double& value) {
-    return true;
+    // the state is only known by the engine once it is reported with a RangeControllerValueChanged message
+    return false;
 }
 
 /**
@@ -350,7 +426,56 @@ bool AASBCarControl::getModeControllerValue(
     const std::string& endpointId,
     const std::string& controllerId,
     std::string& value) {
-    return true;
+    // the state is only known by the engine once it is reported with a ModeControllerValueChanged message
+    return false;
+}
+
+/**
+ * Batched requests
+ */
+std::vector<bool> AASBCarControl::setControllerValues(
+    ControllerType type,
+    const std::vector<ControllerRequest>& requests) {
+    if (!m_batchRequests) {
+        // the application handles a SetControllerValue or AdjustControllerValue message for each request
+        return {};
+    }
+    try {
+        AACE_VERBOSE(LX(TAG).d("requests", requests.size()));
+
+        auto m_messageBroker_lock = m_messageBroker.lock();
+        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
+
+        aasb::message::carControl::carControl::SetControllerValuesMessage message;
+
+        message.payload.capabilityType = static_cast<aasb::message::carControl::carControl::CapabilityType>(type);
+        for (const auto& next : requests) {
+            message.payload.requests.push_back(
+                {next.endpointId, next.controllerId, next.adjust, next.turnOn, next.value, next.mode, next.delta});
+        }
+
+        auto result = m_messageBroker_lock->publish(message.toString())
+                          .timeout(std::chrono::milliseconds(m_replyMessageTimeout))
+                          .get();
+        ThrowIfNot(result.valid(), "replyMessageTimeout:id=" + message.header.id);
+
+        aasb::message::carControl::carControl::SetControllerValuesMessageReply::Payload payload =
+            nlohmann::json::parse(result.payload());
+        ThrowIfNot(payload.results.size() == requests.size(), "invalidResultCount");
+
+        std::vector<bool> results;
+        for (const auto& next : payload.results) {
+            results.push_back(next.success);
+        }
+        return results;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return std::vector<bool>(requests.size(), false);
+    }
+}
+
+bool AASBCarControl::handlesControllerBatches() {
+    return m_batchRequests;
 }
 
 bool AASBCarControl::waitForAsyncReply(const std::string& messageId) {
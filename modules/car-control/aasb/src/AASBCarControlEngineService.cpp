@@ -38,7 +38,7 @@ AASBCarControlEngineService::AASBCarControlEngineService(const aace::engine::cor
 bool AASBCarControlEngineService::configureMessageInterface(
     const std::string& name,
     bool enabled,
-    std::istream& configuration) {
+    const aace::engine::utils::json::Value& configuration) {
     try {
         // call inherited configure method
         ThrowIfNot(
@@ -57,10 +57,11 @@ bool AASBCarControlEngineService::configureMessageInterface(
     }
 }
 
-bool AASBCarControlEngineService::configureCarControl(std::istream& configuration) {
+bool AASBCarControlEngineService::configureCarControl(const aace::engine::utils::json::Value& configuration) {
     try {
-        auto root = nlohmann::json::parse(configuration);
-        m_asyncReplyTimeout = root["/asyncReplyTimeout"_json_pointer];
+        ThrowIfNot(configuration.is_object(), "invalidCarControlConfiguration");
+        m_asyncReplyTimeout = configuration.value("asyncReplyTimeout", m_asyncReplyTimeout);
+        m_batchRequests = configuration.value("batchRequests", false);
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -77,7 +78,8 @@ bool AASBCarControlEngineService::postRegister() {
 
         // CarControl
         if (isInterfaceEnabled("CarControl")) {
-            auto carControl = AASBCarControl::create(aasbServiceInterface->getMessageBroker(), m_asyncReplyTimeout);
+            auto carControl = AASBCarControl::create(
+                aasbServiceInterface->getMessageBroker(), m_asyncReplyTimeout, m_batchRequests);
             ThrowIfNull(carControl, "invalidCarControlHandler");
             getContext()->registerPlatformInterface(carControl);
         }
@@ -298,6 +298,23 @@ JNIEXPORT void JNICALL Java_com_amazon_aace_carControl_CarControlConfiguration_a
     }
 }
 
+JNIEXPORT void JNICALL Java_com_amazon_aace_carControl_CarControlConfiguration_setProactivelyReported(
+    JNIEnv*,
+    jobject obj,
+    jlong ref,
+    jboolean proactivelyReported) {
+    try {
+        auto configBinder = ENGINE_CONFIGURATION_BINDER(ref);
+        ThrowIfNull(configBinder, "invalidConfigBinder");
+
+        auto carControlConfig = CAR_CONTROL_CONFIGURATION(configBinder->getConfig());
+        carControlConfig->setProactivelyReported(proactivelyReported);
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(
+            TAG, "Java_com_amazon_aace_carControl_CarControlConfiguration_setProactivelyReported", ex.what());
+    }
+}
+
 JNIEXPORT void JNICALL
 Java_com_amazon_aace_carControl_CarControlConfiguration_createZone(JNIEnv*, jobject obj, jlong ref, jstring zoneId) {
     try {
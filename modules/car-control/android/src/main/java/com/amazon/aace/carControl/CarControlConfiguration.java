@@ -471,6 +471,23 @@ public class CarControlConfiguration extends EngineConfiguration {
         return this;
     }
 
+    /**
+     * Set whether changes to the state of the enclosing capability instance are proactively reported to Alexa. This
+     * sets 'properties.proactivelyReported' in the definition of the capability most recently added to the enclosing
+     * endpoint, which is @c false by default.
+     *
+     * @note If @c true, the platform implementation must report the state of the instance to the Engine when it
+     * starts and whenever the state changes, such as with
+     * @c com.amazon.aace.carControl.CarControl.powerControllerStateChanged().
+     *
+     * @param proactivelyReported Whether changes to the state are proactively reported to Alexa.
+     * @return @c CarControlConfiguration to allow chaining.
+     */
+    final public CarControlConfiguration setProactivelyReported(boolean proactivelyReported) {
+        setProactivelyReported(getNativeRef(), proactivelyReported);
+        return this;
+    }
+
     /**
      * Begin a zone definition using the specified zone ID. This creates a single entry in the "zones" array of
      * 'aace.carControl'. Call @c addMembers() to add endpoint IDs as members of this zone.
@@ -568,6 +585,7 @@ public class CarControlConfiguration extends EngineConfiguration {
     private native void addValue(long nativeRef, String value);
     private native void addActionSetMode(long nativeRef, String[] actions, String value);
     private native void addActionAdjustMode(long nativeRef, String[] actions, int delta);
+    private native void setProactivelyReported(long nativeRef, boolean proactivelyReported);
     private native void createZone(long nativeRef, String zoneId);
     private native void addMembers(long nativeRef, String[] endpointIds);
     private native void setDefaultZone(long nativeRef, String zoneId);
@@ -16,6 +16,7 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_ASSET_STORE_H
 #define AACE_ENGINE_CAR_CONTROL_ASSET_STORE_H
 
+#include <cstdint>
 #include <istream>
 #include <string>
 #include <unordered_map>
@@ -51,6 +52,21 @@ public:
      */
     bool addAssets(const std::string& path);
 
+    /**
+     * Ingest the assets files at the given paths, in order, with a snapshot of
+     * the resulting friendly name / locale pairs. If the snapshot was written
+     * for the same paths and file contents, the pairs are read from it without
+     * parsing the assets JSON. Otherwise the files are parsed and the snapshot
+     * is written for the next start.
+     *
+     * @param paths The paths of the assets files to ingest
+     * @param snapshotPath The path of the snapshot file, or an empty string to
+     * ingest the files without a snapshot
+     * @return @c true if the assets were ingested successfully; @c false if
+     * there was an issue such as a missing file or malformed values
+     */
+    bool addAssets(const std::vector<std::string>& paths, const std::string& snapshotPath);
+
     /**
      * Get the literal friendly names and locales associated with the given 
      * asset ID.
@@ -77,6 +93,25 @@ private:
      */
     bool addAssets(std::istream& stream);
 
+    /**
+     * Read the friendly name / locale pairs from a snapshot file written by
+     * @c saveSnapshot() with the same key.
+     *
+     * @param path The path of the snapshot file
+     * @param key The hash of the paths and contents of the assets files
+     * @return @c true if the snapshot exists, matches the key, and is valid
+     */
+    bool loadSnapshot(const std::string& path, uint64_t key);
+
+    /**
+     * Write the friendly name / locale pairs to a snapshot file.
+     *
+     * @param path The path of the snapshot file
+     * @param key The hash of the paths and contents of the assets files
+     * @return @c true if the snapshot was written
+     */
+    bool saveSnapshot(const std::string& path, uint64_t key) const;
+
     /**
      * A map of asset ID to a list of friendly name text / locale pairs used to
      * describe the asset. It contains an entry for all assets ingested by the
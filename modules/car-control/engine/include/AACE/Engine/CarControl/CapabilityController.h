@@ -18,6 +18,8 @@
 
 #include "AVSCommon/SDKInterfaces/Endpoints/EndpointBuilderInterface.h"
 
+#include <nlohmann/json.hpp>
+
 #include "AACE/Engine/CarControl/AssetStore.h"
 #include "AACE/Engine/CarControl/CarControlEngineImpl.h"
 
@@ -57,6 +59,30 @@ public:
      */
     std::string getInterface();
 
+    /**
+     * Set whether the state of this controller is proactively reported and retrievable from the 'properties' node
+     * of the capability definition JSON. Both are @c false if the node does not specify them.
+     *
+     * @param capabilityConfig The capability definition JSON
+     */
+    void setProperties(const nlohmann::json& capabilityConfig);
+    /**
+     * Whether changes to the state of this controller are reported to Alexa
+     */
+    bool isProactivelyReported();
+    /**
+     * Whether Alexa may request the state of this controller
+     */
+    bool isRetrievable();
+
+    /**
+     * Set the car control service interface used to access the platform interface, which @c build() sets before
+     * registering the controller
+     *
+     * @param carControlServiceInterface The car control service interface
+     */
+    void setCarControlServiceInterface(std::shared_ptr<CarControlServiceInterface> carControlServiceInterface);
+
     /**
      * Create the internal representation of the endpoint using the @c EndpointBuilder
      */
@@ -69,6 +95,10 @@ private:
     std::string m_endpointId;
     /// The interface type of this controller
     std::string m_interface;
+    /// Whether changes to the state of this controller are reported to Alexa
+    bool m_proactivelyReported;
+    /// Whether Alexa may request the state of this controller
+    bool m_retrievable;
 
 protected:
     /// The car control service interface reference, used to access the platform interface
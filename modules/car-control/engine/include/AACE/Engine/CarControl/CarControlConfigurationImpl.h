@@ -64,6 +64,7 @@ public:
     CarControlConfiguration& addActionSetMode(const std::vector<std::string>& actions, const std::string& value)
         override;
     CarControlConfiguration& addActionAdjustMode(const std::vector<std::string>& actions, int delta) override;
+    CarControlConfiguration& setProactivelyReported(bool proactivelyReported) override;
 
     CarControlConfiguration& createZone(const std::string& zoneId) override;
     CarControlConfiguration& addMembers(const std::vector<std::string>& endpointIds) override;
@@ -19,17 +19,23 @@
 #include <AVSCommon/Utils/RequiresShutdown.h>
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 
 #include "AACE/CarControl/CarControl.h"
 #include "AACE/Engine/CarControl/CarControlServiceInterface.h"
+#include "AACE/Engine/CarControl/ControllerRequestBatcher.h"
 
 namespace aace {
 namespace engine {
 namespace carControl {
 
+class Endpoint;
+
 class CarControlEngineImpl
         : public CarControlServiceInterface
+        , public aace::carControl::CarControlEngineInterface
         , public alexaClientSDK::avsCommon::utils::RequiresShutdown {
 public:
     static std::shared_ptr<CarControlEngineImpl> create(
@@ -58,11 +64,48 @@ public:
         override;
     /// @}
 
+    /// @name @c CarControlEngineInterface methods
+    /// @{
+    void onPowerControllerStateChanged(const std::string& endpointId, bool isOn) override;
+    void onToggleControllerStateChanged(const std::string& endpointId, const std::string& controllerId, bool isOn)
+        override;
+    void onRangeControllerValueChanged(const std::string& endpointId, const std::string& controllerId, double value)
+        override;
+    void onModeControllerValueChanged(
+        const std::string& endpointId,
+        const std::string& controllerId,
+        const std::string& value) override;
+    /// @}
+
+    /**
+     * Adds an endpoint, whose controllers are updated with the states reported by the platform implementation.
+     *
+     * @param endpoint The endpoint
+     */
+    void addEndpoint(std::shared_ptr<Endpoint> endpoint);
+
 protected:
     void doShutdown() override;
 
 private:
+    /**
+     * Gets the controller of an endpoint which the platform implementation reported a state for.
+     *
+     * @return The controller, or @c nullptr if the endpoint has no controller of type @c T with the ID
+     */
+    template <class T>
+    std::shared_ptr<T> getController(const std::string& endpointId, const std::string& controllerId);
+
     std::shared_ptr<aace::carControl::CarControl> m_platformInterface;
+
+    /// Groups the requests to set or adjust the settings of several endpoints into one call to the platform interface
+    std::shared_ptr<ControllerRequestBatcher> m_requestBatcher;
+
+    /// The endpoints with their configured IDs, which the platform implementation reports states for
+    std::unordered_map<std::string, std::shared_ptr<Endpoint>> m_endpoints;
+
+    /// Serializes access to @c m_endpoints
+    std::mutex m_mutex;
 };
 
 }  // namespace carControl
@@ -61,7 +61,7 @@ public:
 
 protected:
     bool initialize() override;
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configure(std::shared_ptr<const json> configuration) override;
     bool setup() override;
     bool shutdown() override;
     /// @}
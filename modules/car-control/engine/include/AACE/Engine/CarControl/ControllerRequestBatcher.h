@@ -0,0 +1,117 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_CAR_CONTROL_CONTROLLER_REQUEST_BATCHER_H
+#define AACE_ENGINE_CAR_CONTROL_CONTROLLER_REQUEST_BATCHER_H
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "AACE/CarControl/CarControl.h"
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/**
+ * Groups the requests to set or adjust the settings of controllers of the same type into one call to the platform
+ * implementation.
+ *
+ * The capability agent of each endpoint handles its directives on its own thread, so a request targeting several
+ * endpoints, such as turning on all the seat heaters, reaches the engine as concurrent calls. The first call waits for
+ * the batching window, then sends its request with the requests of the calls that arrived in the meantime, and every
+ * call returns the result of its own request. Unless the platform implementation reports that it handles batches, each
+ * call sends its own request without waiting, and so do the calls after the platform implementation declines a batch.
+ */
+class ControllerRequestBatcher {
+public:
+    /// Aliases to improve readability
+    /// @{
+    using ControllerType = aace::carControl::CarControl::ControllerType;
+    using ControllerRequest = aace::carControl::CarControl::ControllerRequest;
+    /// @}
+
+    /**
+     * Creates a batcher.
+     *
+     * @param platformInterface The platform implementation the batches are sent to.
+     * @param window The time the first request of a batch waits for the other requests.
+     * @return The batcher, or @c nullptr if the platform interface is invalid.
+     */
+    static std::shared_ptr<ControllerRequestBatcher> create(
+        std::shared_ptr<aace::carControl::CarControl> platformInterface,
+        std::chrono::milliseconds window);
+
+    /**
+     * Sends a request to the platform implementation in the next batch of requests for controllers of the same type,
+     * and waits for its result.
+     *
+     * @param type The type of the controller.
+     * @param request The request.
+     * @return @c true if the platform implementation handled the request successfully.
+     */
+    bool execute(ControllerType type, const ControllerRequest& request);
+
+private:
+    ControllerRequestBatcher(
+        std::shared_ptr<aace::carControl::CarControl> platformInterface,
+        std::chrono::milliseconds window);
+
+    /// The requests waiting to be sent together, and the results of the batch
+    struct Batch {
+        Batch();
+
+        /// The requests, which are not modified once the batch is sent
+        std::vector<ControllerRequest> requests;
+
+        /// Fulfilled with the results of the requests when the platform implementation returns
+        std::promise<std::vector<bool>> promise;
+
+        /// The results of the requests, read by each call with a request in the batch
+        std::shared_future<std::vector<bool>> results;
+    };
+
+    /// Sends the requests of a batch to the platform implementation.
+    /// @return The results of the requests, or an empty vector if the platform implementation does not handle batches
+    std::vector<bool> sendBatch(ControllerType type, const std::vector<ControllerRequest>& requests);
+
+    /// Sends a request to the platform implementation with the method for a single controller.
+    bool sendRequest(ControllerType type, const ControllerRequest& request);
+
+    std::shared_ptr<aace::carControl::CarControl> m_platformInterface;
+
+    /// The time the first request of a batch waits for the other requests
+    std::chrono::milliseconds m_window;
+
+    /// Whether the platform implementation handles batches, as it reports when created, until it declines one
+    std::atomic<bool> m_batchesSupported;
+
+    /// The batch accepting requests for each type of controller
+    std::map<ControllerType, std::shared_ptr<Batch>> m_batches;
+
+    /// Serializes access to @c m_batches
+    std::mutex m_mutex;
+};
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_CAR_CONTROL_CONTROLLER_REQUEST_BATCHER_H
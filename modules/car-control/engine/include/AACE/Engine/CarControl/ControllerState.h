@@ -0,0 +1,146 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_CAR_CONTROL_CONTROLLER_STATE_H
+#define AACE_ENGINE_CAR_CONTROL_CONTROLLER_STATE_H
+
+#include <AVSCommon/Utils/Timing/TimePoint.h>
+
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/**
+ * The engine-side state of a capability controller instance, and the observers notified when it changes.
+ *
+ * The state is only known once the platform implementation reports it. From then on, it answers the state requests
+ * of the controller without a call to the platform implementation, and it is kept up to date with the values set by
+ * directives.
+ */
+template <typename ValueType, typename ObserverType>
+class ControllerState {
+public:
+    /// Alias to improve readability
+    using TimePoint = alexaClientSDK::avsCommon::utils::timing::TimePoint;
+
+    ControllerState() : m_known(false), m_value(), m_timeOfSample(TimePoint::now()) {
+    }
+
+    /**
+     * Sets the state reported by the platform implementation.
+     *
+     * @param value The value of the state.
+     * @return @c true if the value changed.
+     */
+    bool report(const ValueType& value) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        bool changed = !m_known || !(m_value == value);
+        m_value = value;
+        m_known = true;
+        m_timeOfSample = TimePoint::now();
+        return changed;
+    }
+
+    /**
+     * Sets the state after a directive changed it, if the state is known.
+     *
+     * @param value The value of the state.
+     * @return @c true if the value changed.
+     */
+    bool update(const ValueType& value) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_known) {
+            return false;
+        }
+        bool changed = !(m_value == value);
+        m_value = value;
+        m_timeOfSample = TimePoint::now();
+        return changed;
+    }
+
+    /**
+     * Forgets the state after a directive changed it to a value the engine cannot compute, until the platform
+     * implementation reports it again.
+     */
+    void invalidate() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_known = false;
+    }
+
+    /**
+     * Gets the state.
+     *
+     * @param [out] value The value of the state.
+     * @param [out] timeOfSample The time the value was set.
+     * @return @c true if the state is known.
+     */
+    bool get(ValueType& value, TimePoint& timeOfSample) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_known) {
+            return false;
+        }
+        value = m_value;
+        timeOfSample = m_timeOfSample;
+        return true;
+    }
+
+    bool addObserver(std::shared_ptr<ObserverType> observer) {
+        if (observer == nullptr) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_observers.insert(observer);
+        return true;
+    }
+
+    void removeObserver(const std::shared_ptr<ObserverType>& observer) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_observers.erase(observer);
+    }
+
+    /**
+     * Gets the observers to notify, which are notified without holding the lock of the state.
+     */
+    std::unordered_set<std::shared_ptr<ObserverType>> getObservers() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_observers;
+    }
+
+private:
+    /// Serializes access to the state and the observers
+    std::mutex m_mutex;
+
+    /// Whether the value is known
+    bool m_known;
+
+    /// The value of the state
+    ValueType m_value;
+
+    /// The time the value was set
+    TimePoint m_timeOfSample;
+
+    /// The observers notified when the state changes
+    std::unordered_set<std::shared_ptr<ObserverType>> m_observers;
+};
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_CAR_CONTROL_CONTROLLER_STATE_H
@@ -126,6 +126,14 @@ public:
      */
     bool addController(const std::string& id, std::shared_ptr<CapabilityController> controller);
 
+    /**
+     * Get the controller with the specified ID of this endpoint
+     *
+     * @param id The ID of the controller, as returned by @c CapabilityController::getId()
+     * @return The controller, or @c nullptr if this endpoint has no controller with the ID
+     */
+    std::shared_ptr<CapabilityController> getController(const std::string& id);
+
 private:
     /**
      * Endpoint constructor
@@ -21,6 +21,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include "AACE/Engine/CarControl/ControllerState.h"
 #include "AACE/Engine/CarControl/PrimitiveController.h"
 
 namespace aace {
@@ -75,6 +76,14 @@ public:
     void removeObserver(const std::shared_ptr<ModeControllerObserverInterface>& observer) override;
     /// @}
 
+    /**
+     * Sets the mode reported by the platform implementation, and notifies the observers if it changed.
+     *
+     * @param mode The mode, which must be one of the supported modes of this controller.
+     * @return @c true if the mode is supported.
+     */
+    bool reportMode(const std::string& mode);
+
 private:
     /**
      * ModeController constructor
@@ -90,6 +99,14 @@ private:
 
     /// The list of modes supported by this controller
     std::vector<std::string> m_supportedModes;
+
+    /**
+     * Notifies the observers of the current mode.
+     */
+    void notifyObservers(AlexaStateChangeCauseType cause);
+
+    /// The mode of this controller
+    ControllerState<std::string, ModeControllerObserverInterface> m_state;
 };
 
 }  // namespace carControl
@@ -20,6 +20,7 @@
 #include <Endpoints/EndpointBuilder.h>
 
 #include "AACE/Engine/CarControl/CapabilityController.h"
+#include "AACE/Engine/CarControl/ControllerState.h"
 
 namespace aace {
 namespace engine {
@@ -66,11 +67,26 @@ public:
     void removeObserver(const std::shared_ptr<PowerControllerObserverInterface>& observer) override;
     /// @}
 
+    /**
+     * Sets the power state reported by the platform implementation, and notifies the observers if it changed.
+     *
+     * @param isOn @c true if the endpoint is powered on.
+     */
+    void reportPowerState(bool isOn);
+
 private:
     /**
      * PowerController constructor.
      */
     PowerController(const std::string& endpointId, const std::string& interface);
+
+    /**
+     * Notifies the observers of the current power state.
+     */
+    void notifyObservers(AlexaStateChangeCauseType cause);
+
+    /// The power state of this controller
+    ControllerState<bool, PowerControllerObserverInterface> m_state;
 };
 
 }  // namespace carControl
@@ -21,6 +21,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include "AACE/Engine/CarControl/ControllerState.h"
 #include "AACE/Engine/CarControl/PrimitiveController.h"
 
 namespace aace {
@@ -77,6 +78,14 @@ public:
     void removeObserver(const std::shared_ptr<RangeControllerObserverInterface>& observer) override;
     /// @}
 
+    /**
+     * Sets the range value reported by the platform implementation, and notifies the observers if it changed.
+     *
+     * @param value The range value, which must be in the supported range of this controller.
+     * @return @c true if the value is in the supported range.
+     */
+    bool reportRangeValue(double value);
+
 private:
     /**
      * RangeController constructor.
@@ -99,6 +108,14 @@ private:
     double m_maximum;
     /// The precision of range increments allowed for this controller
     double m_precision;
+
+    /**
+     * Notifies the observers of the current range value.
+     */
+    void notifyObservers(AlexaStateChangeCauseType cause);
+
+    /// The range value of this controller
+    ControllerState<double, RangeControllerObserverInterface> m_state;
 };
 
 }  // namespace carControl
@@ -21,6 +21,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include "AACE/Engine/CarControl/ControllerState.h"
 #include "AACE/Engine/CarControl/PrimitiveController.h"
 
 namespace aace {
@@ -75,6 +76,13 @@ public:
     void removeObserver(const std::shared_ptr<ToggleControllerObserverInterface>& observer) override;
     /// @}
 
+    /**
+     * Sets the toggle state reported by the platform implementation, and notifies the observers if it changed.
+     *
+     * @param isOn @c true if the setting is turned on.
+     */
+    void reportToggleState(bool isOn);
+
 private:
     /**
      * ToggleController constructor
@@ -85,8 +93,16 @@ private:
         const std::string& instance,
         ToggleControllerAttributes attributes);
 
+    /**
+     * Notifies the observers of the current toggle state.
+     */
+    void notifyObservers(AlexaStateChangeCauseType cause);
+
     /// The attributes of this ToggleController
     ToggleControllerAttributes m_attributes;
+
+    /// The toggle state of this controller
+    ControllerState<bool, ToggleControllerObserverInterface> m_state;
 };
 
 }  // namespace carControl
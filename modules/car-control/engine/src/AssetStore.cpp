@@ -15,7 +15,11 @@
 
 #include <AACE/Engine/CarControl/AssetStore.h>
 #include <AACE/Engine/Core/EngineMacros.h>
+#include <AACE/Engine/Utils/Hash/Hash.h>
 
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <sstream>
 
 // JSON for Modern C++
@@ -29,6 +33,102 @@ namespace carControl {
 /// String to identify log entries originating from this file.
 static const std::string TAG("aace.carControl.AssetStore");
 
+/// Identifies a snapshot file. The version changes with the snapshot format, and a snapshot written with a different
+/// byte order does not match it.
+/// @{
+static const char SNAPSHOT_MAGIC[8] = {'A', 'A', 'C', 'E', 'A', 'S', 'E', 'T'};
+static const uint32_t SNAPSHOT_VERSION = 1;
+/// @}
+
+/// Continues the key of the snapshot with a string.
+static uint64_t hash(uint64_t value, const std::string& data) {
+    // the size separates consecutive strings, so that moving characters from one to the other changes the hash
+    uint64_t size = data.size();
+    std::string sizeBytes;
+    for (size_t i = 0; i < sizeof(size); i++) {
+        sizeBytes.push_back(static_cast<char>((size >> (i * 8)) & 0xff));
+    }
+    return aace::engine::utils::hash::fnv1a(data, aace::engine::utils::hash::fnv1a(sizeBytes, value));
+}
+
+static bool readFile(const std::string& path, std::string& contents) {
+    std::ifstream ifs(path, std::ios::binary | std::ios::ate);
+    if (!ifs.good()) {
+        return false;
+    }
+    auto size = ifs.tellg();
+    if (size < 0) {
+        return false;
+    }
+    contents.resize(static_cast<size_t>(size));
+    ifs.seekg(0);
+    return static_cast<bool>(ifs.read(&contents[0], size));
+}
+
+/**
+ * Writes the snapshot in the host byte order. The snapshot starts with its header: the magic, the version, the key,
+ * and the number of strings and of assets. The strings follow, each with its size, then the assets, each with the
+ * index of its ID, the number of its friendly names, and the indices of the text and locale of each name.
+ */
+class SnapshotWriter {
+public:
+    void writeU32(uint32_t value) {
+        m_buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void writeU64(uint64_t value) {
+        m_buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void writeBytes(const char* data, size_t size) {
+        m_buffer.append(data, size);
+    }
+
+    const std::string& getBuffer() const {
+        return m_buffer;
+    }
+
+private:
+    std::string m_buffer;
+};
+
+/// Reads a snapshot written by @c SnapshotWriter, with bounds checks.
+class SnapshotReader {
+public:
+    SnapshotReader(const std::string& buffer) : m_buffer(buffer), m_position(0) {
+    }
+
+    void readU32(uint32_t& value) {
+        readBytes(&value, sizeof(value));
+    }
+
+    void readU64(uint64_t& value) {
+        readBytes(&value, sizeof(value));
+    }
+
+    void readBytes(void* data, size_t size) {
+        ThrowIf(size > m_buffer.size() - m_position, "truncatedSnapshot");
+        std::memcpy(data, m_buffer.data() + m_position, size);
+        m_position += size;
+    }
+
+    void readString(std::string& value) {
+        uint32_t size;
+        readU32(size);
+        ThrowIf(size > m_buffer.size() - m_position, "truncatedSnapshot");
+        value.assign(m_buffer, m_position, size);
+        m_position += size;
+    }
+
+    bool atEnd() const {
+        return m_position == m_buffer.size();
+    }
+
+private:
+    const std::string& m_buffer;
+    size_t m_position;
+};
+
 AssetStore::~AssetStore() {
     clear();
 }
@@ -82,6 +182,149 @@ bool AssetStore::addAssets(std::istream& stream) {
     }
 }
 
+bool AssetStore::addAssets(const std::vector<std::string>& paths, const std::string& snapshotPath) {
+    try {
+        // The snapshot is keyed by the paths and contents of the assets files, so any change to them invalidates it
+        std::vector<std::string> contents(paths.size());
+        uint64_t key = aace::engine::utils::hash::FNV1A_OFFSET_BASIS;
+        for (size_t i = 0; i < paths.size(); i++) {
+            ThrowIfNot(readFile(paths[i], contents[i]), "readAssetsFileFailed");
+            key = hash(hash(key, paths[i]), contents[i]);
+        }
+
+        if (!snapshotPath.empty() && loadSnapshot(snapshotPath, key)) {
+            AACE_DEBUG(LX(TAG).m("assetsLoadedFromSnapshot").d("assets", m_assets.size()));
+            return true;
+        }
+
+        for (auto& next : contents) {
+            std::istringstream stream(next);
+            ThrowIfNot(addAssets(stream), "addAssetsFailed");
+        }
+
+        // A snapshot that cannot be written only costs parsing the assets again at the next start
+        if (!snapshotPath.empty() && !saveSnapshot(snapshotPath, key)) {
+            AACE_WARN(LX(TAG).m("saveSnapshotFailed").sensitive("path", snapshotPath));
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        clear();
+        return false;
+    }
+}
+
+bool AssetStore::loadSnapshot(const std::string& path, uint64_t key) {
+    std::unordered_map<std::string, std::vector<NameLocalePair>> assets;
+    try {
+        std::string buffer;
+        if (!readFile(path, buffer)) {
+            AACE_DEBUG(LX(TAG).m("snapshotNotFound"));
+            return false;
+        }
+
+        SnapshotReader reader(buffer);
+        char magic[sizeof(SNAPSHOT_MAGIC)];
+        uint32_t version;
+        uint64_t snapshotKey;
+        reader.readBytes(magic, sizeof(magic));
+        reader.readU32(version);
+        reader.readU64(snapshotKey);
+        if (std::memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) != 0 || version != SNAPSHOT_VERSION ||
+            snapshotKey != key) {
+            AACE_DEBUG(LX(TAG).m("snapshotOutdated"));
+            return false;
+        }
+
+        uint32_t stringCount, assetCount;
+        reader.readU32(stringCount);
+        reader.readU32(assetCount);
+        std::vector<std::string> strings(stringCount);
+        for (auto& next : strings) {
+            reader.readString(next);
+        }
+
+        assets.reserve(assetCount);
+        for (uint32_t i = 0; i < assetCount; i++) {
+            uint32_t idIndex, nameCount;
+            reader.readU32(idIndex);
+            reader.readU32(nameCount);
+            ThrowIfNot(idIndex < stringCount, "invalidStringIndex");
+            std::vector<NameLocalePair> names;
+            names.reserve(nameCount);
+            for (uint32_t j = 0; j < nameCount; j++) {
+                uint32_t nameIndex, localeIndex;
+                reader.readU32(nameIndex);
+                reader.readU32(localeIndex);
+                ThrowIfNot(nameIndex < stringCount && localeIndex < stringCount, "invalidStringIndex");
+                names.emplace_back(strings[nameIndex], strings[localeIndex]);
+            }
+            assets.emplace(strings[idIndex], std::move(names));
+        }
+        ThrowIfNot(reader.atEnd(), "unexpectedSnapshotData");
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG).d("reason", ex.what()).sensitive("path", path));
+        return false;
+    }
+
+    for (auto& next : assets) {
+        m_assets.emplace(next.first, std::move(next.second));
+    }
+    return true;
+}
+
+bool AssetStore::saveSnapshot(const std::string& path, uint64_t key) const {
+    try {
+        // The strings are stored once, since the locales in particular are repeated for every friendly name
+        std::unordered_map<std::string, uint32_t> stringIndices;
+        std::vector<const std::string*> strings;
+        auto indexOf = [&stringIndices, &strings](const std::string& value) {
+            auto result = stringIndices.emplace(value, static_cast<uint32_t>(strings.size()));
+            if (result.second) {
+                strings.push_back(&result.first->first);
+            }
+            return result.first->second;
+        };
+
+        SnapshotWriter assets;
+        for (auto& next : m_assets) {
+            assets.writeU32(indexOf(next.first));
+            assets.writeU32(static_cast<uint32_t>(next.second.size()));
+            for (auto& name : next.second) {
+                assets.writeU32(indexOf(name.first));
+                assets.writeU32(indexOf(name.second));
+            }
+        }
+
+        SnapshotWriter writer;
+        writer.writeBytes(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+        writer.writeU32(SNAPSHOT_VERSION);
+        writer.writeU64(key);
+        writer.writeU32(static_cast<uint32_t>(strings.size()));
+        writer.writeU32(static_cast<uint32_t>(m_assets.size()));
+        for (auto next : strings) {
+            writer.writeU32(static_cast<uint32_t>(next->size()));
+            writer.writeBytes(next->data(), next->size());
+        }
+        writer.writeBytes(assets.getBuffer().data(), assets.getBuffer().size());
+
+        // Replace the snapshot only once it is complete, so that an interrupted write leaves no partial snapshot
+        std::string temporaryPath = path + ".tmp";
+        {
+            std::ofstream ofs(temporaryPath, std::ios::binary | std::ios::trunc);
+            ThrowIfNot(ofs.good(), "openSnapshotFailed");
+            ofs.write(writer.getBuffer().data(), writer.getBuffer().size());
+            ofs.close();
+            ThrowIfNot(ofs.good(), "writeSnapshotFailed");
+        }
+        ThrowIf(std::rename(temporaryPath.c_str(), path.c_str()) != 0, "renameSnapshotFailed");
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
 const std::vector<AssetStore::NameLocalePair>& AssetStore::getFriendlyNames(const std::string& assetId) const {
     auto iter = m_assets.find(assetId);
     if (iter != m_assets.end()) {
@@ -20,7 +20,7 @@ namespace engine {
 namespace carControl {
 
 CapabilityController::CapabilityController(const std::string& endpointId, const std::string& interface) :
-        m_endpointId(endpointId), m_interface(interface) {
+        m_endpointId(endpointId), m_interface(interface), m_proactivelyReported(false), m_retrievable(false) {
 }
 
 CapabilityController::~CapabilityController() {
@@ -38,6 +38,28 @@ std::string CapabilityController::getInterface() {
     return m_interface;
 }
 
+void CapabilityController::setProperties(const nlohmann::json& capabilityConfig) {
+    auto properties = capabilityConfig.find("properties");
+    if (properties == capabilityConfig.end() || !properties->is_object()) {
+        return;
+    }
+    m_proactivelyReported = properties->value("proactivelyReported", false);
+    m_retrievable = properties->value("retrievable", false);
+}
+
+bool CapabilityController::isProactivelyReported() {
+    return m_proactivelyReported;
+}
+
+bool CapabilityController::isRetrievable() {
+    return m_retrievable;
+}
+
+void CapabilityController::setCarControlServiceInterface(
+    std::shared_ptr<CarControlServiceInterface> carControlServiceInterface) {
+    m_carControlServiceInterface = carControlServiceInterface;
+}
+
 }  // namespace carControl
 }  // namespace engine
 }  // namespace aace
@@ -638,6 +638,21 @@ CarControlConfiguration& CarControlConfigurationImpl::addActionAdjustMode(
     return *this;
 }
 
+CarControlConfiguration& CarControlConfigurationImpl::setProactivelyReported(bool proactivelyReported) {
+    try {
+        ThrowIf(m_failed, "previouslyFailed");
+        ThrowIfNot(isOption(Option::ENDPOINT), "proactivelyReportedNotAllowed");
+
+        auto& capabilities = m_document["aace.carControl"]["endpoints"].back()["capabilities"];
+        ThrowIf(capabilities.empty(), "noCapability");
+        capabilities.back()["properties"]["proactivelyReported"] = proactivelyReported;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        m_failed = true;
+    }
+    return *this;
+}
+
 CarControlConfiguration& CarControlConfigurationImpl::createZone(const std::string& zoneId) {
     try {
         ThrowIf(m_failed, "previouslyFailed");
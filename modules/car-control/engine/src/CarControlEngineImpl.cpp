@@ -15,6 +15,11 @@
 
 #include "AACE/Engine/CarControl/CarControlEngineImpl.h"
 
+#include "AACE/Engine/CarControl/Endpoint.h"
+#include "AACE/Engine/CarControl/ModeController.h"
+#include "AACE/Engine/CarControl/PowerController.h"
+#include "AACE/Engine/CarControl/RangeController.h"
+#include "AACE/Engine/CarControl/ToggleController.h"
 #include "AACE/Engine/Core/EngineMacros.h"
 #include <AACE/Engine/Utils/Metrics/Metrics.h>
 
@@ -24,11 +29,32 @@ namespace carControl {
 
 using namespace aace::engine::utils::metrics;
 
+/// Aliases to improve readability
+/// @{
+using ControllerType = aace::carControl::CarControl::ControllerType;
+using ControllerRequest = aace::carControl::CarControl::ControllerRequest;
+/// @}
+
 static const std::string MODE_CONTROLLER_TAG("aace.engine.carControl.ModeController");
 static const std::string POWER_CONTROLLER_TAG("aace.engine.carControl.PowerController");
 static const std::string RANGE_CONTROLLER_TAG("aace.engine.carControl.RangeController");
 static const std::string TOGGLE_CONTROLLER_TAG("aace.engine.carControl.ToggleController");
 
+/// String to identify log entries of the states reported by the platform implementation
+static const std::string TAG("aace.engine.carControl.CarControlEngineImpl");
+
+/// The namespaces and names of the capability interfaces, which prefix the IDs of their controllers
+/// @{
+static const std::string CAPABILITY_MODE_CONTROLLER = "Alexa.ModeController";
+static const std::string CAPABILITY_POWER_CONTROLLER = "Alexa.PowerController";
+static const std::string CAPABILITY_RANGE_CONTROLLER = "Alexa.RangeController";
+static const std::string CAPABILITY_TOGGLE_CONTROLLER = "Alexa.ToggleController";
+/// @}
+
+/// The time the first request to a type of controller waits for the requests to other endpoints, which Alexa sends
+/// within a few milliseconds of each other when the user targets several endpoints at once
+static const std::chrono::milliseconds REQUEST_BATCH_WINDOW(20);
+
 /// Program Name for Metrics
 static const std::string METRIC_PROGRAM_NAME_SUFFIX = "CarControlEngineImpl";
 
@@ -48,26 +74,44 @@ static const std::string METRIC_CAR_CONTROL_GET_MODECONTROLLER_VALUE = "GetModeC
 
 std::shared_ptr<CarControlEngineImpl> CarControlEngineImpl::create(
     std::shared_ptr<aace::carControl::CarControl> platformInterface) {
-    return std::make_shared<CarControlEngineImpl>(platformInterface);
+    try {
+        ThrowIfNull(platformInterface, "invalidPlatformInterface");
+        auto carControlEngineImpl = std::make_shared<CarControlEngineImpl>(platformInterface);
+
+        // set the platform engine interface reference
+        platformInterface->setEngineInterface(carControlEngineImpl);
+
+        return carControlEngineImpl;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
 }
 
 CarControlEngineImpl::CarControlEngineImpl(std::shared_ptr<aace::carControl::CarControl> platformInterface) :
         alexaClientSDK::avsCommon::utils::RequiresShutdown("CarControlEngineImpl"),
-        m_platformInterface(platformInterface) {
+        m_platformInterface(platformInterface),
+        m_requestBatcher(ControllerRequestBatcher::create(platformInterface, REQUEST_BATCH_WINDOW)) {
 }
 
 bool CarControlEngineImpl::turnPowerControllerOn(const std::string& endpointId) {
     AACE_DEBUG(LX(POWER_CONTROLLER_TAG).sensitive("endpoint", endpointId).sensitive("name", "TurnOn"));
     emitCounterMetrics(
         METRIC_PROGRAM_NAME_SUFFIX, "turnPowerControllerOn", METRIC_CAR_CONTROL_TURN_POWERCONTROLLER_ON, 1);
-    return m_platformInterface->turnPowerControllerOn(endpointId);
+    ControllerRequest request;
+    request.endpointId = endpointId;
+    request.turnOn = true;
+    return m_requestBatcher->execute(ControllerType::POWER, request);
 }
 
 bool CarControlEngineImpl::turnPowerControllerOff(const std::string& endpointId) {
     AACE_DEBUG(LX(POWER_CONTROLLER_TAG).sensitive("endpoint", endpointId).sensitive("name", "TurnOff"));
     emitCounterMetrics(
         METRIC_PROGRAM_NAME_SUFFIX, "turnPowerControllerOff", METRIC_CAR_CONTROL_TURN_POWERCONTROLLER_OFF, 1);
-    return m_platformInterface->turnPowerControllerOff(endpointId);
+    ControllerRequest request;
+    request.endpointId = endpointId;
+    request.turnOn = false;
+    return m_requestBatcher->execute(ControllerType::POWER, request);
 }
 
 bool CarControlEngineImpl::isPowerControllerOn(const std::string& endpointId, bool& isOn) {
@@ -82,7 +126,11 @@ bool CarControlEngineImpl::turnToggleControllerOn(const std::string& endpointId,
                    .sensitive("instance", instance));
     emitCounterMetrics(
         METRIC_PROGRAM_NAME_SUFFIX, "turnToggleControllerOn", METRIC_CAR_CONTROL_TURN_TOGGLECONTROLLER_ON, 1);
-    return m_platformInterface->turnToggleControllerOn(endpointId, instance);
+    ControllerRequest request;
+    request.endpointId = endpointId;
+    request.controllerId = instance;
+    request.turnOn = true;
+    return m_requestBatcher->execute(ControllerType::TOGGLE, request);
 }
 
 bool CarControlEngineImpl::turnToggleControllerOff(const std::string& endpointId, const std::string& instance) {
@@ -92,7 +140,11 @@ bool CarControlEngineImpl::turnToggleControllerOff(const std::string& endpointId
                    .sensitive("instance", instance));
     emitCounterMetrics(
         METRIC_PROGRAM_NAME_SUFFIX, "turnToggleControllerOff", METRIC_CAR_CONTROL_TURN_TOGGLECONTROLLER_OFF, 1);
-    return m_platformInterface->turnToggleControllerOff(endpointId, instance);
+    ControllerRequest request;
+    request.endpointId = endpointId;
+    request.controllerId = instance;
+    request.turnOn = false;
+    return m_requestBatcher->execute(ControllerType::TOGGLE, request);
 }
 
 bool CarControlEngineImpl::isToggleControllerOn(
@@ -115,7 +167,11 @@ bool CarControlEngineImpl::setRangeControllerValue(
                    .sensitive("rangeValue", value));
     emitCounterMetrics(
         METRIC_PROGRAM_NAME_SUFFIX, "setRangeControllerValue", METRIC_CAR_CONTROL_SET_RANGECONTROLLER_VALUE, 1);
-    return m_platformInterface->setRangeControllerValue(endpointId, instance, value);
+    ControllerRequest request;
+    request.endpointId = endpointId;
+    request.controllerId = instance;
+    request.value = value;
+    return m_requestBatcher->execute(ControllerType::RANGE, request);
 }
 
 bool CarControlEngineImpl::adjustRangeControllerValue(
@@ -129,7 +185,12 @@ bool CarControlEngineImpl::adjustRangeControllerValue(
                    .sensitive("rangeValueDelta", delta));
     emitCounterMetrics(
         METRIC_PROGRAM_NAME_SUFFIX, "adjustRangeControllerValue", METRIC_CAR_CONTROL_ADJUST_RANGECONTROLLER_VALUE, 1);
-    return m_platformInterface->adjustRangeControllerValue(endpointId, instance, delta);
+    ControllerRequest request;
+    request.endpointId = endpointId;
+    request.controllerId = instance;
+    request.adjust = true;
+    request.delta = delta;
+    return m_requestBatcher->execute(ControllerType::RANGE, request);
 }
 
 bool CarControlEngineImpl::getRangeControllerValue(
@@ -152,7 +213,11 @@ bool CarControlEngineImpl::setModeControllerValue(
                    .sensitive("mode", value));
     emitCounterMetrics(
         METRIC_PROGRAM_NAME_SUFFIX, "setModeControllerValue", METRIC_CAR_CONTROL_SET_MODECONTROLLER_VALUE, 1);
-    return m_platformInterface->setModeControllerValue(endpointId, instance, value);
+    ControllerRequest request;
+    request.endpointId = endpointId;
+    request.controllerId = instance;
+    request.mode = value;
+    return m_requestBatcher->execute(ControllerType::MODE, request);
 }
 
 bool CarControlEngineImpl::adjustModeControllerValue(
@@ -166,7 +231,12 @@ bool CarControlEngineImpl::adjustModeControllerValue(
                    .sensitive("modeDelta", delta));
     emitCounterMetrics(
         METRIC_PROGRAM_NAME_SUFFIX, "adjustModeControllerValue", METRIC_CAR_CONTROL_ADJUST_MODECONTROLLER_VALUE, 1);
-    return m_platformInterface->adjustModeControllerValue(endpointId, instance, delta);
+    ControllerRequest request;
+    request.endpointId = endpointId;
+    request.controllerId = instance;
+    request.adjust = true;
+    request.delta = delta;
+    return m_requestBatcher->execute(ControllerType::MODE, request);
 }
 
 bool CarControlEngineImpl::getModeControllerValue(
@@ -178,9 +248,81 @@ bool CarControlEngineImpl::getModeControllerValue(
     return m_platformInterface->getModeControllerValue(endpointId, instance, value);
 }
 
+void CarControlEngineImpl::addEndpoint(std::shared_ptr<Endpoint> endpoint) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_endpoints[endpoint->getId()] = endpoint;
+}
+
+template <class T>
+std::shared_ptr<T> CarControlEngineImpl::getController(const std::string& endpointId, const std::string& controllerId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_endpoints.find(endpointId);
+    if (it == m_endpoints.end()) {
+        return nullptr;
+    }
+    return std::dynamic_pointer_cast<T>(it->second->getController(controllerId));
+}
+
+void CarControlEngineImpl::onPowerControllerStateChanged(const std::string& endpointId, bool isOn) {
+    try {
+        auto controller = getController<PowerController>(endpointId, CAPABILITY_POWER_CONTROLLER);
+        ThrowIfNull(controller, "invalidPowerController");
+        controller->reportPowerState(isOn);
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).sensitive("endpointId", endpointId));
+    }
+}
+
+void CarControlEngineImpl::onToggleControllerStateChanged(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    bool isOn) {
+    try {
+        auto controller =
+            getController<ToggleController>(endpointId, CAPABILITY_TOGGLE_CONTROLLER + "#" + controllerId);
+        ThrowIfNull(controller, "invalidToggleController");
+        controller->reportToggleState(isOn);
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).sensitive("endpointId", endpointId).d("controllerId", controllerId));
+    }
+}
+
+void CarControlEngineImpl::onRangeControllerValueChanged(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    double value) {
+    try {
+        auto controller = getController<RangeController>(endpointId, CAPABILITY_RANGE_CONTROLLER + "#" + controllerId);
+        ThrowIfNull(controller, "invalidRangeController");
+        ThrowIfNot(controller->reportRangeValue(value), "reportRangeValueFailed");
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).sensitive("endpointId", endpointId).d("controllerId", controllerId));
+    }
+}
+
+void CarControlEngineImpl::onModeControllerValueChanged(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    const std::string& value) {
+    try {
+        auto controller = getController<ModeController>(endpointId, CAPABILITY_MODE_CONTROLLER + "#" + controllerId);
+        ThrowIfNull(controller, "invalidModeController");
+        ThrowIfNot(controller->reportMode(value), "reportModeFailed");
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).sensitive("endpointId", endpointId).d("controllerId", controllerId));
+    }
+}
+
 void CarControlEngineImpl::doShutdown() {
+    {
+        // the controllers of the endpoints reference this object
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_endpoints.clear();
+    }
     if (m_platformInterface != nullptr) {
+        m_platformInterface->setEngineInterface(nullptr);
         m_platformInterface.reset();
+        m_requestBatcher.reset();
     }
 }
 
@@ -51,6 +51,8 @@ static const std::string CONFIG_KEY_ASSETS = "assets";
 static const std::string CONFIG_KEY_DEFAULT_ASSETS_PATH = "defaultAssetsPath";
 /// The key for the 'customAssetsPath' node of configuration
 static const std::string CONFIG_KEY_CUSTOM_ASSETS_PATH = "customAssetsPath";
+/// The key for the 'snapshotPath' node of configuration
+static const std::string CONFIG_KEY_SNAPSHOT_PATH = "snapshotPath";
 
 // The endpoint ID of the internal endpoint created for zones
 static const std::string INTERNAL_ENDPOINT_ID = "_AutoSDKInternalRoot";
@@ -79,39 +81,54 @@ bool CarControlEngineService::initialize() {
     }
 }
 
-bool CarControlEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool CarControlEngineService::configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) {
     try {
         AACE_DEBUG(LX(TAG).d("isLocalServiceAvailable", isLocalServiceAvailable()));
         ThrowIf(m_configured, "carControlEngineServiceAlreadyConfigured");
 
-        json jconfiguration;
-        jconfiguration = json::parse(*configuration);
+        // Translate <v2.2 zones config format (top level "zones" array) to v2.3+ (ZoneDefinitions capability). Only
+        // the legacy format requires a copy of the configuration, which is otherwise read in place.
+        json translatedConfiguration;
+        if (configuration->contains("zones")) {
+            translatedConfiguration = *configuration;
+            translateConfigForZones(translatedConfiguration);
+        }
+        const json& jconfiguration = translatedConfiguration.is_null() ? *configuration : translatedConfiguration;
 
         // Ingest assets from the file path(s) specified in configuration. Store custom assets in an @c AssetStore to
         // facilitate retrieval of friendly name/locale pairs for asset expansion during @c Endpoint construction.
         // Note: Default assets may be overridden for legacy backward compatibility, but this results in friendly name/
         // locale pair expansion rather than using asset definitions stored in the cloud.
 
+        // The friendly names of the assets are read from the snapshot at the optional "snapshotPath" instead when the
+        // assets files did not change since the snapshot was written.
+
         if (jconfiguration.contains(CONFIG_KEY_ASSETS) && jconfiguration[CONFIG_KEY_ASSETS].is_object()) {
             auto& assets = jconfiguration.at(CONFIG_KEY_ASSETS);
+            std::vector<std::string> assetsPaths;
             if (assets.contains(CONFIG_KEY_DEFAULT_ASSETS_PATH) && assets[CONFIG_KEY_DEFAULT_ASSETS_PATH].is_string()) {
                 std::string path = assets.at(CONFIG_KEY_DEFAULT_ASSETS_PATH);
                 AACE_WARN(LX(TAG)
                               .m("addingDefaultAssetsFromPath")
                               .sensitive("path", path)
                               .m("Assets in file override cloud definitions for matching IDs!"));
-                ThrowIfNot(m_assetStore.addAssets(path), "addDefaultAssetsFromPathFailed");
+                assetsPaths.push_back(path);
             }
 
             if (assets.contains(CONFIG_KEY_CUSTOM_ASSETS_PATH) && assets[CONFIG_KEY_CUSTOM_ASSETS_PATH].is_string()) {
                 std::string path = assets.at(CONFIG_KEY_CUSTOM_ASSETS_PATH);
                 AACE_DEBUG(LX(TAG).m("addingCustomAssetsFromPath").sensitive("path", path));
-                ThrowIfNot(m_assetStore.addAssets(path), "addCustomAssetsFromPathFailed");
+                assetsPaths.push_back(path);
             }
-        }
 
-        // Translate <v2.2 zones config format (top level "zones" array) to v2.3+ (ZoneDefinitions capability)
-        translateConfigForZones(jconfiguration);
+            if (!assetsPaths.empty()) {
+                std::string snapshotPath;
+                if (assets.contains(CONFIG_KEY_SNAPSHOT_PATH) && assets[CONFIG_KEY_SNAPSHOT_PATH].is_string()) {
+                    snapshotPath = assets.at(CONFIG_KEY_SNAPSHOT_PATH);
+                }
+                ThrowIfNot(m_assetStore.addAssets(assetsPaths, snapshotPath), "addAssetsFromPathsFailed");
+            }
+        }
 
         // Construct an object representation of each endpoint in configuration
         if (jconfiguration.contains(CONFIG_KEY_ENDPOINTS) && jconfiguration.at(CONFIG_KEY_ENDPOINTS).is_array()) {
@@ -127,8 +144,11 @@ bool CarControlEngineService::configure(std::shared_ptr<std::istream> configurat
         auto localStorage =
             getContext()->getServiceInterface<aace::engine::storage::LocalStorageInterface>(AACE_STORAGE_SERVICE_KEY);
         ThrowIfNull(localStorage, "invalidLocalStorage");
+        // Skip the write when the stored configuration did not change since the last start
         std::string s = jconfiguration.dump();
-        localStorage->put(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_KEY, s);
+        if (localStorage->get(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_KEY, "") != s) {
+            localStorage->put(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_KEY, s);
+        }
 
         m_configured = true;
         return true;
@@ -175,6 +195,9 @@ bool CarControlEngineService::setup() {
                     manufacturerName,
                     description);
                 endpointIdMappings.insert({endpoint.second->getId(), endpoint.second->getDiscoveryId()});
+
+                // Route the states reported by the platform implementation to the controllers of the endpoint
+                m_carControlEngineImpl->addEndpoint(endpoint.second);
             }
 
             // Add ZoneDefinitions capability to a dummy endpoint
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AACE/Engine/CarControl/ControllerRequestBatcher.h"
+#include "AACE/Engine/Core/EngineMacros.h"
+
+#include <thread>
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("aace.engine.carControl.ControllerRequestBatcher");
+
+ControllerRequestBatcher::Batch::Batch() : results(promise.get_future()) {
+}
+
+std::shared_ptr<ControllerRequestBatcher> ControllerRequestBatcher::create(
+    std::shared_ptr<aace::carControl::CarControl> platformInterface,
+    std::chrono::milliseconds window) {
+    try {
+        ThrowIfNull(platformInterface, "invalidPlatformInterface");
+        return std::shared_ptr<ControllerRequestBatcher>(new ControllerRequestBatcher(platformInterface, window));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+ControllerRequestBatcher::ControllerRequestBatcher(
+    std::shared_ptr<aace::carControl::CarControl> platformInterface,
+    std::chrono::milliseconds window) :
+        m_platformInterface(platformInterface),
+        m_window(window),
+        m_batchesSupported(platformInterface->handlesControllerBatches()) {
+    AACE_INFO(LX(TAG).d("batchesSupported", m_batchesSupported.load()));
+}
+
+bool ControllerRequestBatcher::execute(ControllerType type, const ControllerRequest& request) {
+    if (!m_batchesSupported) {
+        return sendRequest(type, request);
+    }
+
+    std::shared_ptr<Batch> batch;
+    size_t index;
+    bool first = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& pending = m_batches[type];
+        if (pending == nullptr) {
+            pending = std::make_shared<Batch>();
+            first = true;
+        }
+        batch = pending;
+        index = batch->requests.size();
+        batch->requests.push_back(request);
+    }
+
+    if (first) {
+        // the first request sends the batch once the requests to the other endpoints had time to join it
+        std::this_thread::sleep_for(m_window);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_batches.erase(type);
+        }
+        batch->promise.set_value(
+            batch->requests.size() > 1 ? sendBatch(type, batch->requests) : std::vector<bool>());
+    }
+
+    auto& results = batch->results.get();
+    if (results.empty()) {
+        // each request of the batch is sent by its own caller, concurrently with the others
+        return sendRequest(type, request);
+    }
+    return results[index];
+}
+
+std::vector<bool> ControllerRequestBatcher::sendBatch(
+    ControllerType type,
+    const std::vector<ControllerRequest>& requests) {
+    try {
+        AACE_VERBOSE(LX(TAG).d("type", static_cast<int>(type)).d("requests", requests.size()));
+        auto results = m_platformInterface->setControllerValues(type, requests);
+        if (results.empty()) {
+            AACE_INFO(LX(TAG).m("batchesNotSupportedByPlatformInterface"));
+            m_batchesSupported = false;
+            return results;
+        }
+        ThrowIfNot(results.size() == requests.size(), "invalidResultCount");
+        return results;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("requests", requests.size()));
+        return std::vector<bool>(requests.size(), false);
+    }
+}
+
+bool ControllerRequestBatcher::sendRequest(ControllerType type, const ControllerRequest& request) {
+    switch (type) {
+        case ControllerType::POWER:
+            return request.turnOn ? m_platformInterface->turnPowerControllerOn(request.endpointId)
+                                  : m_platformInterface->turnPowerControllerOff(request.endpointId);
+        case ControllerType::TOGGLE:
+            return request.turnOn
+                       ? m_platformInterface->turnToggleControllerOn(request.endpointId, request.controllerId)
+                       : m_platformInterface->turnToggleControllerOff(request.endpointId, request.controllerId);
+        case ControllerType::RANGE:
+            return request.adjust ? m_platformInterface->adjustRangeControllerValue(
+                                        request.endpointId, request.controllerId, request.delta)
+                                  : m_platformInterface->setRangeControllerValue(
+                                        request.endpointId, request.controllerId, request.value);
+        case ControllerType::MODE:
+            return request.adjust ? m_platformInterface->adjustModeControllerValue(
+                                        request.endpointId, request.controllerId, static_cast<int>(request.delta))
+                                  : m_platformInterface->setModeControllerValue(
+                                        request.endpointId, request.controllerId, request.mode);
+    }
+    return false;
+}
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
@@ -117,6 +117,7 @@ std::shared_ptr<Endpoint> Endpoint::create(const json& endpointConfig, const Ass
             }
 
             if (controller) {
+                controller->setProperties(capabilityConfig);
                 ThrowIfNot(endpoint->addController(controller->getId(), controller), "addControllerFailed");
             }
         }
@@ -132,6 +133,11 @@ bool Endpoint::addController(const std::string& id, std::shared_ptr<CapabilityCo
     return result.second;
 }
 
+std::shared_ptr<CapabilityController> Endpoint::getController(const std::string& id) {
+    auto it = m_controllers.find(id);
+    return it != m_controllers.end() ? it->second : nullptr;
+}
+
 Endpoint::Endpoint(const std::string endpointId, const std::vector<std::string>& assetIds) :
         m_endpointId{endpointId}, m_assetIds{assetIds} {
 }
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+
 #include <nlohmann/json.hpp>
 
 #include <AVSCommon/AVS/CapabilitySemantics/CapabilitySemantics.h>
@@ -104,8 +106,9 @@ ModeController::ModeController(
 void ModeController::build(
     std::shared_ptr<CarControlServiceInterface> carControlServiceInterface,
     std::unique_ptr<EndpointBuilderInterface>& builder) {
-    m_carControlServiceInterface = carControlServiceInterface;
-    builder->withModeController(shared_from_this(), getInstance(), m_attributes, false, false, false);
+    setCarControlServiceInterface(carControlServiceInterface);
+    builder->withModeController(
+        shared_from_this(), getInstance(), m_attributes, isProactivelyReported(), isRetrievable(), false);
 }
 
 ModeControllerConfiguration ModeController::getConfiguration() {
@@ -125,6 +128,9 @@ std::pair<alexaClientSDK::avsCommon::avs::AlexaResponseType, std::string> ModeCo
         ThrowIfNot(
             m_carControlServiceInterface->setModeControllerValue(getEndpointId(), getInstance(), mode),
             "setModeControllerValue");
+        if (m_state.update(mode)) {
+            notifyObservers(cause);
+        }
         return std::make_pair(AlexaResponseType::SUCCESS, "");
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -145,6 +151,8 @@ std::pair<alexaClientSDK::avsCommon::avs::AlexaResponseType, std::string> ModeCo
         ThrowIfNot(
             m_carControlServiceInterface->adjustModeControllerValue(getEndpointId(), getInstance(), modeDelta),
             "adjustModeFailed");
+        // the platform implementation applies the delta, so the mode is unknown until it is reported again
+        m_state.invalidate();
         return std::make_pair(AlexaResponseType::SUCCESS, "");
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -157,11 +165,14 @@ std::pair<
     alexaClientSDK::avsCommon::utils::Optional<ModeController::ModeState>>
 ModeController::getMode() {
     std::string mode;
-    if (m_carControlServiceInterface->getModeControllerValue(getEndpointId(), getInstance(), mode)) {
+    auto timeOfSample = alexaClientSDK::avsCommon::utils::timing::TimePoint::now();
+    // the platform implementation is only queried until it reports the state
+    if (m_state.get(mode, timeOfSample) ||
+        m_carControlServiceInterface->getModeControllerValue(getEndpointId(), getInstance(), mode)) {
         return std::make_pair(
             AlexaResponseType::SUCCESS,
-            alexaClientSDK::avsCommon::utils::Optional<ModeController::ModeState>(ModeController::ModeState{
-                mode, alexaClientSDK::avsCommon::utils::timing::TimePoint::now(), std::chrono::milliseconds(0)}));
+            alexaClientSDK::avsCommon::utils::Optional<ModeController::ModeState>(
+                ModeController::ModeState{mode, timeOfSample, std::chrono::milliseconds(0)}));
     } else {
         return std::make_pair(
             AlexaResponseType::INTERNAL_ERROR, alexaClientSDK::avsCommon::utils::Optional<ModeController::ModeState>());
@@ -169,12 +180,41 @@ ModeController::getMode() {
 }
 
 bool ModeController::addObserver(std::shared_ptr<ModeController::ModeControllerObserverInterface> observer) {
-    AACE_WARN(LX(TAG).m("Unexpected addObserver()"));
-    return false;
+    return m_state.addObserver(observer);
 }
 
 void ModeController::removeObserver(const std::shared_ptr<ModeController::ModeControllerObserverInterface>& observer) {
-    AACE_WARN(LX(TAG).m("Unexpected removeObserver()"));
+    m_state.removeObserver(observer);
+}
+
+bool ModeController::reportMode(const std::string& mode) {
+    try {
+        AACE_DEBUG(LX(TAG)
+                       .sensitive("endpointId", getEndpointId())
+                       .sensitive("instance", getInstance())
+                       .sensitive("mode", mode));
+        ThrowIf(
+            std::find(m_supportedModes.begin(), m_supportedModes.end(), mode) == m_supportedModes.end(),
+            "unsupportedMode");
+        if (m_state.report(mode)) {
+            notifyObservers(AlexaStateChangeCauseType::PHYSICAL_INTERACTION);
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+void ModeController::notifyObservers(AlexaStateChangeCauseType cause) {
+    std::string mode;
+    alexaClientSDK::avsCommon::utils::timing::TimePoint timeOfSample;
+    if (m_state.get(mode, timeOfSample)) {
+        ModeState modeState{mode, timeOfSample, std::chrono::milliseconds(0)};
+        for (auto& observer : m_state.getObservers()) {
+            observer->onModeChanged(modeState, cause);
+        }
+    }
 }
 
 }  // namespace carControl
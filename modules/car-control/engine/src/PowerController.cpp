@@ -46,8 +46,8 @@ PowerController::PowerController(const std::string& endpointId, const std::strin
 void PowerController::build(
     std::shared_ptr<CarControlServiceInterface> carControlServiceInterface,
     std::unique_ptr<EndpointBuilderInterface>& builder) {
-    m_carControlServiceInterface = carControlServiceInterface;
-    builder->withPowerController(shared_from_this(), false, false);
+    setCarControlServiceInterface(carControlServiceInterface);
+    builder->withPowerController(shared_from_this(), isProactivelyReported(), isRetrievable());
 }
 
 std::pair<AlexaResponseType, std::string> PowerController::setPowerState(
@@ -65,6 +65,9 @@ std::pair<AlexaResponseType, std::string> PowerController::setPowerState(
             ThrowIfNot(
                 m_carControlServiceInterface->turnPowerControllerOff(getEndpointId()), "turnPowerControllerOffFailed");
         }
+        if (m_state.update(state)) {
+            notifyObservers(cause);
+        }
         return std::make_pair(AlexaResponseType::SUCCESS, "");
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -77,11 +80,14 @@ std::pair<
     alexaClientSDK::avsCommon::utils::Optional<PowerController::PowerState>>
 PowerController::getPowerState() {
     bool state;
-    if (m_carControlServiceInterface->isPowerControllerOn(getEndpointId(), state)) {
+    auto timeOfSample = alexaClientSDK::avsCommon::utils::timing::TimePoint::now();
+    // the platform implementation is only queried until it reports the state
+    if (m_state.get(state, timeOfSample) ||
+        m_carControlServiceInterface->isPowerControllerOn(getEndpointId(), state)) {
         return std::make_pair(
             AlexaResponseType::SUCCESS,
-            alexaClientSDK::avsCommon::utils::Optional<PowerState>(PowerState{
-                state, alexaClientSDK::avsCommon::utils::timing::TimePoint::now(), std::chrono::milliseconds(0)}));
+            alexaClientSDK::avsCommon::utils::Optional<PowerState>(
+                PowerState{state, timeOfSample, std::chrono::milliseconds(0)}));
     } else {
         return std::make_pair(
             AlexaResponseType::INTERNAL_ERROR, alexaClientSDK::avsCommon::utils::Optional<PowerState>());
@@ -89,12 +95,29 @@ PowerController::getPowerState() {
 }
 
 bool PowerController::addObserver(std::shared_ptr<PowerControllerObserverInterface> observer) {
-    AACE_WARN(LX(TAG).m("Unexpected addObserver()"));
-    return false;
+    return m_state.addObserver(observer);
 }
 
 void PowerController::removeObserver(const std::shared_ptr<PowerControllerObserverInterface>& observer) {
-    AACE_WARN(LX(TAG).m("Unexpected removeObserver()"));
+    m_state.removeObserver(observer);
+}
+
+void PowerController::reportPowerState(bool isOn) {
+    AACE_DEBUG(LX(TAG).sensitive("endpointId", getEndpointId()).sensitive("state", isOn));
+    if (m_state.report(isOn)) {
+        notifyObservers(AlexaStateChangeCauseType::PHYSICAL_INTERACTION);
+    }
+}
+
+void PowerController::notifyObservers(AlexaStateChangeCauseType cause) {
+    bool state;
+    alexaClientSDK::avsCommon::utils::timing::TimePoint timeOfSample;
+    if (m_state.get(state, timeOfSample)) {
+        PowerState powerState{state, timeOfSample, std::chrono::milliseconds(0)};
+        for (auto& observer : m_state.getObservers()) {
+            observer->onPowerStateChanged(powerState, cause);
+        }
+    }
 }
 
 }  // namespace carControl
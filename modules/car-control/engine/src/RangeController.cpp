@@ -116,8 +116,9 @@ RangeController::RangeController(
 void RangeController::build(
     std::shared_ptr<CarControlServiceInterface> carControlServiceInterface,
     std::unique_ptr<EndpointBuilderInterface>& builder) {
-    m_carControlServiceInterface = carControlServiceInterface;
-    builder->withRangeController(shared_from_this(), getInstance(), m_attributes, false, false, false);
+    setCarControlServiceInterface(carControlServiceInterface);
+    builder->withRangeController(
+        shared_from_this(), getInstance(), m_attributes, isProactivelyReported(), isRetrievable(), false);
 }
 
 RangeControllerConfiguration RangeController::getConfiguration() {
@@ -136,6 +137,9 @@ std::pair<alexaClientSDK::avsCommon::avs::AlexaResponseType, std::string> RangeC
         ThrowIfNot(
             m_carControlServiceInterface->setRangeControllerValue(getEndpointId(), getInstance(), rangeValue),
             "setRangeControllerValueFailed");
+        if (m_state.update(rangeValue)) {
+            notifyObservers(cause);
+        }
         return std::make_pair(AlexaResponseType::SUCCESS, "");
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -155,6 +159,8 @@ std::pair<alexaClientSDK::avsCommon::avs::AlexaResponseType, std::string> RangeC
         ThrowIfNot(
             m_carControlServiceInterface->adjustRangeControllerValue(getEndpointId(), getInstance(), rangeDelta),
             "adjustRangeControllerValueFailed");
+        // the platform implementation applies the delta, so the value is unknown until it is reported again
+        m_state.invalidate();
         return std::make_pair(AlexaResponseType::SUCCESS, "");
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -165,12 +171,14 @@ std::pair<alexaClientSDK::avsCommon::avs::AlexaResponseType, std::string> RangeC
 std::pair<alexaClientSDK::avsCommon::avs::AlexaResponseType, alexaClientSDK::avsCommon::utils::Optional<RangeState>>
 RangeController::getRangeState() {
     double value;
-    if (m_carControlServiceInterface->getRangeControllerValue(getEndpointId(), getInstance(), value)) {
+    auto timeOfSample = alexaClientSDK::avsCommon::utils::timing::TimePoint::now();
+    // the platform implementation is only queried until it reports the state
+    if (m_state.get(value, timeOfSample) ||
+        m_carControlServiceInterface->getRangeControllerValue(getEndpointId(), getInstance(), value)) {
         return std::make_pair(
             AlexaResponseType::SUCCESS,
             alexaClientSDK::avsCommon::utils::Optional<RangeControllerInterface::RangeState>(
-                alexaClientSDK::avsCommon::sdkInterfaces::rangeController::RangeControllerInterface::RangeState{
-                    value, alexaClientSDK::avsCommon::utils::timing::TimePoint::now(), std::chrono::milliseconds(0)}));
+                RangeState{value, timeOfSample, std::chrono::milliseconds(0)}));
     } else {
         return std::make_pair(
             AlexaResponseType::INTERNAL_ERROR,
@@ -179,12 +187,39 @@ RangeController::getRangeState() {
 }
 
 bool RangeController::addObserver(std::shared_ptr<RangeControllerObserverInterface> observer) {
-    AACE_WARN(LX(TAG).m("Unexpected addObserver()"));
-    return false;
+    return m_state.addObserver(observer);
 }
 
 void RangeController::removeObserver(const std::shared_ptr<RangeControllerObserverInterface>& observer) {
-    AACE_WARN(LX(TAG).m("Unexpected removeObserver()"));
+    m_state.removeObserver(observer);
+}
+
+bool RangeController::reportRangeValue(double value) {
+    try {
+        AACE_DEBUG(LX(TAG)
+                       .sensitive("endpointId", getEndpointId())
+                       .sensitive("instance", getInstance())
+                       .sensitive("rangeValue", value));
+        ThrowIf(value < m_minimum || value > m_maximum, "rangeValueOutOfRange");
+        if (m_state.report(value)) {
+            notifyObservers(AlexaStateChangeCauseType::PHYSICAL_INTERACTION);
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+void RangeController::notifyObservers(AlexaStateChangeCauseType cause) {
+    double value;
+    alexaClientSDK::avsCommon::utils::timing::TimePoint timeOfSample;
+    if (m_state.get(value, timeOfSample)) {
+        RangeState rangeState{value, timeOfSample, std::chrono::milliseconds(0)};
+        for (auto& observer : m_state.getObservers()) {
+            observer->onRangeChanged(rangeState, cause);
+        }
+    }
 }
 
 }  // namespace carControl
@@ -76,8 +76,9 @@ ToggleController::ToggleController(
 void ToggleController::build(
     std::shared_ptr<CarControlServiceInterface> carControlServiceInterface,
     std::unique_ptr<EndpointBuilderInterface>& builder) {
-    m_carControlServiceInterface = carControlServiceInterface;
-    builder->withToggleController(shared_from_this(), getInstance(), m_attributes, false, false, false);
+    setCarControlServiceInterface(carControlServiceInterface);
+    builder->withToggleController(
+        shared_from_this(), getInstance(), m_attributes, isProactivelyReported(), isRetrievable(), false);
 }
 
 std::pair<alexaClientSDK::avsCommon::avs::AlexaResponseType, std::string> ToggleController::setToggleState(
@@ -98,6 +99,9 @@ std::pair<alexaClientSDK::avsCommon::avs::AlexaResponseType, std::string> Toggle
                 m_carControlServiceInterface->turnToggleControllerOff(getEndpointId(), getInstance()),
                 "turnToggleControllerOffFailed");
         }
+        if (m_state.update(state)) {
+            notifyObservers(cause);
+        }
         return std::make_pair(AlexaResponseType::SUCCESS, "");
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -110,11 +114,14 @@ std::pair<
     alexaClientSDK::avsCommon::utils::Optional<ToggleController::ToggleState>>
 ToggleController::getToggleState() {
     bool state;
-    if (m_carControlServiceInterface->isToggleControllerOn(getEndpointId(), getInstance(), state)) {
+    auto timeOfSample = alexaClientSDK::avsCommon::utils::timing::TimePoint::now();
+    // the platform implementation is only queried until it reports the state
+    if (m_state.get(state, timeOfSample) ||
+        m_carControlServiceInterface->isToggleControllerOn(getEndpointId(), getInstance(), state)) {
         return std::make_pair(
             AlexaResponseType::SUCCESS,
-            alexaClientSDK::avsCommon::utils::Optional<ToggleState>(ToggleState{
-                state, alexaClientSDK::avsCommon::utils::timing::TimePoint::now(), std::chrono::milliseconds(0)}));
+            alexaClientSDK::avsCommon::utils::Optional<ToggleState>(
+                ToggleState{state, timeOfSample, std::chrono::milliseconds(0)}));
     } else {
         return std::make_pair(
             AlexaResponseType::INTERNAL_ERROR, alexaClientSDK::avsCommon::utils::Optional<ToggleState>());
@@ -124,14 +131,34 @@ ToggleController::getToggleState() {
 bool ToggleController::addObserver(
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::toggleController::ToggleControllerObserverInterface>
         observer) {
-    AACE_WARN(LX(TAG).m("Unexpected addObserver()"));
-    return false;
+    return m_state.addObserver(observer);
 }
 
 void ToggleController::removeObserver(
     const std::shared_ptr<
         alexaClientSDK::avsCommon::sdkInterfaces::toggleController::ToggleControllerObserverInterface>& observer) {
-    AACE_WARN(LX(TAG).m("Unexpected addObserver()"));
+    m_state.removeObserver(observer);
+}
+
+void ToggleController::reportToggleState(bool isOn) {
+    AACE_DEBUG(LX(TAG)
+                   .sensitive("endpointId", getEndpointId())
+                   .sensitive("instance", getInstance())
+                   .sensitive("state", isOn));
+    if (m_state.report(isOn)) {
+        notifyObservers(AlexaStateChangeCauseType::PHYSICAL_INTERACTION);
+    }
+}
+
+void ToggleController::notifyObservers(AlexaStateChangeCauseType cause) {
+    bool state;
+    alexaClientSDK::avsCommon::utils::timing::TimePoint timeOfSample;
+    if (m_state.get(state, timeOfSample)) {
+        ToggleState toggleState{state, timeOfSample, std::chrono::milliseconds(0)};
+        for (auto& observer : m_state.getObservers()) {
+            observer->onToggleStateChanged(toggleState, cause);
+        }
+    }
 }
 
 }  // namespace carControl
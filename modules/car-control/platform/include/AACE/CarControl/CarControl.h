@@ -17,8 +17,11 @@
 #define AACE_CAR_CONTROL_CAR_CONTROL_H
 
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #include "AACE/Core/PlatformInterface.h"
+#include "CarControlEngineInterfaces.h"
 
 /** @file */
 
@@ -58,6 +61,43 @@ public:
      */
     virtual ~CarControl();
 
+    /**
+     * Describes the type of a controller.
+     */
+    enum class ControllerType {
+        /// Power Controller
+        POWER,
+        /// Toggle Controller
+        TOGGLE,
+        /// Range Controller
+        RANGE,
+        /// Mode Controller
+        MODE
+    };
+
+    /**
+     * A request to set or adjust the setting of a controller, sent to the platform implementation in a batch of
+     * requests for controllers of the same type.
+     *
+     * @sa setControllerValues
+     */
+    struct ControllerRequest {
+        /// The unique identifier of the endpoint.
+        std::string endpointId;
+        /// The unique identifier of the controller. Empty for a Power Controller.
+        std::string controllerId;
+        /// @c true to adjust the setting of a Range or Mode Controller by @c delta.
+        bool adjust = false;
+        /// The new power state of a Power or Toggle Controller.
+        bool turnOn = false;
+        /// The new range setting of a Range Controller.
+        double value = 0;
+        /// The new mode of a Mode Controller.
+        std::string mode;
+        /// The delta by which to adjust the setting of a Range or Mode Controller.
+        double delta = 0;
+    };
+
     /**
      * Notifies the platform implementation to power on the controller identified by @c endpointId.
      *
@@ -216,6 +256,89 @@ public:
         const std::string& endpointId,
         const std::string& controllerId,
         std::string& value);
+
+    /**
+     * Notifies the platform implementation to set or adjust the settings of several controllers of the same type at
+     * once, such as when the user asks Alexa to turn on all the seat heaters. The Engine groups the requests it
+     * receives for controllers of the same type within a few milliseconds of each other into one call. It sends a
+     * request that is alone in its batch with the method for a single controller.
+     *
+     * Override this method and @c handlesControllerBatches() to handle the requests with one request to the vehicle.
+     * If the platform implementation does not handle batches, the Engine sends each request with the methods for a
+     * single controller, such as @c turnPowerControllerOn(), without waiting for other requests.
+     *
+     * @note The platform implementation must return within 5 seconds. Failure to do so will result in
+     * a timeout.
+     *
+     * @param [in] type The type of the controllers.
+     * @param [in] requests The requests to set or adjust the settings of the controllers.
+     * @return Whether each request was successful, in the order of @c requests, or an empty vector if the platform
+     * implementation does not handle batches of requests.
+     */
+    virtual std::vector<bool> setControllerValues(ControllerType type, const std::vector<ControllerRequest>& requests);
+
+    /**
+     * Returns whether the platform implementation handles batches of requests with @c setControllerValues(). The
+     * Engine queries it once when it starts, and waits a few milliseconds for the other requests of a batch only if
+     * it returns @c true.
+     *
+     * @return @c true if the platform implementation handles batches of requests. The default implementation
+     * returns @c false.
+     */
+    virtual bool handlesControllerBatches();
+
+    /**
+     * Notifies the Engine that the power state of the controller identified by @c endpointId changed. The Engine
+     * answers state requests for the controller with the reported state, and sends a change report to Alexa if the
+     * controller is configured as @c proactivelyReported.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint.
+     * @param [in] isOn @c true if the controller is powered on.
+     */
+    void powerControllerStateChanged(const std::string& endpointId, bool isOn);
+    /**
+     * Notifies the Engine that the power state of the controller identified by @c endpointId and @c controllerId
+     * changed.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint.
+     * @param [in] controllerId The unique identifier of the controller.
+     * @param [in] isOn @c true if the controller is turned on.
+     * @sa powerControllerStateChanged
+     */
+    void toggleControllerStateChanged(const std::string& endpointId, const std::string& controllerId, bool isOn);
+    /**
+     * Notifies the Engine that the range setting of the controller identified by @c endpointId and @c controllerId
+     * changed.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint.
+     * @param [in] controllerId The unique identifier of the controller.
+     * @param [in] value The current range setting.
+     * @sa powerControllerStateChanged
+     */
+    void rangeControllerValueChanged(const std::string& endpointId, const std::string& controllerId, double value);
+    /**
+     * Notifies the Engine that the mode of the controller identified by @c endpointId and @c controllerId changed.
+     *
+     * @param [in] endpointId The unique identifier of the endpoint.
+     * @param [in] controllerId The unique identifier of the controller.
+     * @param [in] value The current mode.
+     * @sa powerControllerStateChanged
+     */
+    void modeControllerValueChanged(
+        const std::string& endpointId,
+        const std::string& controllerId,
+        const std::string& value);
+
+    /**
+     * @internal
+     * Sets the Engine interface delegate
+     *
+     * Should *never* be called by the platform implementation
+     */
+    void setEngineInterface(std::shared_ptr<CarControlEngineInterface> carControlEngineInterface);
+
+private:
+    std::shared_ptr<CarControlEngineInterface> m_carControlEngineInterface;
 };
 
 }  // namespace carControl
@@ -266,8 +266,8 @@ public:
      * 
      * @sa https://developer.amazon.com/en-US/docs/alexa/alexa-voice-service/alexa-powercontroller.html.
      *
-     * @param [in] retrievable Whether the state of this instance may be retrieved by the Alexa service. Only @c false 
-     *        is supported.
+     * @param [in] retrievable Whether the state of this instance may be retrieved by the Alexa service. If @c true, the
+     *        platform implementation must report the state to the Engine.
      * @return @c CarControlConfiguration to allow chaining.
      */
     virtual CarControlConfiguration& addPowerController(bool retrievable) = 0;
@@ -280,8 +280,8 @@ public:
      *
      * @param [in] instanceId The identifier of this @b ToggleController instance. Must be unique with respect to the 
      *        enclosing endpoint.
-     * @param [in] retrievable Whether the state of this instance may be retrieved by the Alexa service. Only @c false 
-     *        is supported.
+     * @param [in] retrievable Whether the state of this instance may be retrieved by the Alexa service. If @c true, the
+     *        platform implementation must report the state to the Engine.
      * @return @c CarControlConfiguration to allow chaining.
      */
     virtual CarControlConfiguration& addToggleController(const std::string& instanceId, bool retrievable) = 0;
@@ -322,8 +322,8 @@ public:
      *
      * @param [in] instanceId The identifier of this @b RangeController instance. Must be unique with respect to the 
      *        enclosing endpoint.
-     * @param [in] retrievable Whether the state of this instance may be retrieved by the Alexa service. Only @c false
-     *        is supported.
+     * @param [in] retrievable Whether the state of this instance may be retrieved by the Alexa service. If @c true, the
+     *        platform implementation must report the state to the Engine.
      * @param [in] minimum The minimum value of the range supported by this instance.
      * @param [in] minimum The maximum value of the range supported by this instance.
      * @param [in] precision The amount by which the set value changes when iterating through the range.
@@ -387,8 +387,8 @@ public:
      *
      * @param [in] instanceId The identifier of this @b ModeController instance. Must be unique with respect to the 
      *        enclosing endpoint.
-     * @param [in] retrievable Whether the state of this instance may be retrieved by the Alexa service. Only @c false
-     *        is supported.
+     * @param [in] retrievable Whether the state of this instance may be retrieved by the Alexa service. If @c true, the
+     *        platform implementation must report the state to the Engine.
      * @param [in] Whether the modes are ordered, enabling iteration through them using the @b AdjustMode directive.
      * @return @c CarControlConfiguration to allow chaining.
      */
@@ -443,6 +443,20 @@ public:
      */
     virtual CarControlConfiguration& addActionAdjustMode(const std::vector<std::string>& actions, int delta) = 0;
 
+    /**
+     * Set whether changes to the state of the enclosing capability instance are proactively reported to Alexa. This
+     * sets 'properties.proactivelyReported' in the definition of the capability most recently added to the enclosing
+     * endpoint, which is @c false by default.
+     *
+     * @note If @c true, the platform implementation must report the state of the instance to the Engine when it
+     * starts and whenever the state changes, such as with
+     * @c aace::carControl::CarControl::powerControllerStateChanged().
+     *
+     * @param [in] proactivelyReported Whether changes to the state are proactively reported to Alexa.
+     * @return @c CarControlConfiguration to allow chaining.
+     */
+    virtual CarControlConfiguration& setProactivelyReported(bool proactivelyReported) = 0;
+
     /**
      * Begin a zone definition using the specified zone ID. This creates a single entry in the "zones" array of 
      * 'aace.carControl'. Call @c addMembers() to add endpoint IDs as members of this zone.
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_CAR_CONTROL_CAR_CONTROL_ENGINE_INTERFACES_H
+#define AACE_CAR_CONTROL_CAR_CONTROL_ENGINE_INTERFACES_H
+
+#include <string>
+
+/** @file */
+
+namespace aace {
+namespace carControl {
+
+/**
+ * CarControlEngineInterface
+ */
+class CarControlEngineInterface {
+public:
+    virtual ~CarControlEngineInterface() = default;
+
+    virtual void onPowerControllerStateChanged(const std::string& endpointId, bool isOn) = 0;
+    virtual void onToggleControllerStateChanged(
+        const std::string& endpointId,
+        const std::string& controllerId,
+        bool isOn) = 0;
+    virtual void onRangeControllerValueChanged(
+        const std::string& endpointId,
+        const std::string& controllerId,
+        double value) = 0;
+    virtual void onModeControllerValueChanged(
+        const std::string& endpointId,
+        const std::string& controllerId,
+        const std::string& value) = 0;
+};
+
+}  // namespace carControl
+}  // namespace aace
+
+#endif  // AACE_CAR_CONTROL_CAR_CONTROL_ENGINE_INTERFACES_H
@@ -89,5 +89,56 @@ bool CarControl::getModeControllerValue(
     return false;
 }
 
+/**
+ * Batched requests
+ */
+std::vector<bool> CarControl::setControllerValues(ControllerType type, const std::vector<ControllerRequest>& requests) {
+    return {};
+}
+
+bool CarControl::handlesControllerBatches() {
+    return false;
+}
+
+/**
+ * State reporting
+ */
+void CarControl::powerControllerStateChanged(const std::string& endpointId, bool isOn) {
+    if (m_carControlEngineInterface != nullptr) {
+        m_carControlEngineInterface->onPowerControllerStateChanged(endpointId, isOn);
+    }
+}
+
+void CarControl::toggleControllerStateChanged(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    bool isOn) {
+    if (m_carControlEngineInterface != nullptr) {
+        m_carControlEngineInterface->onToggleControllerStateChanged(endpointId, controllerId, isOn);
+    }
+}
+
+void CarControl::rangeControllerValueChanged(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    double value) {
+    if (m_carControlEngineInterface != nullptr) {
+        m_carControlEngineInterface->onRangeControllerValueChanged(endpointId, controllerId, value);
+    }
+}
+
+void CarControl::modeControllerValueChanged(
+    const std::string& endpointId,
+    const std::string& controllerId,
+    const std::string& value) {
+    if (m_carControlEngineInterface != nullptr) {
+        m_carControlEngineInterface->onModeControllerValueChanged(endpointId, controllerId, value);
+    }
+}
+
+void CarControl::setEngineInterface(std::shared_ptr<CarControlEngineInterface> carControlEngineInterface) {
+    m_carControlEngineInterface = carControlEngineInterface;
+}
+
 }  // namespace carControl
 }  // namespace aace
@@ -0,0 +1,173 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+#include <AACE/Engine/CarControl/AssetStore.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace carControl {
+
+using AssetStore = aace::engine::carControl::AssetStore;
+
+static const std::string DEFAULT_ASSETS_PATH = "/tmp/aace-car-control-assets-1P.json";
+static const std::string CUSTOM_ASSETS_PATH = "/tmp/aace-car-control-assets-3P.json";
+static const std::string SNAPSHOT_PATH = "/tmp/aace-car-control-assets.snapshot";
+
+/// The locales of an OEM configuration supporting every Alexa locale
+static const std::vector<std::string> LOCALES = {"en-US",
+                                                 "en-CA",
+                                                 "en-GB",
+                                                 "en-IN",
+                                                 "en-AU",
+                                                 "de-DE",
+                                                 "fr-FR",
+                                                 "fr-CA",
+                                                 "it-IT",
+                                                 "es-ES",
+                                                 "es-MX",
+                                                 "es-US",
+                                                 "ja-JP",
+                                                 "hi-IN",
+                                                 "pt-BR",
+                                                 "ar-SA"};
+
+/// Writes an assets file with a friendly name for each of several hundred endpoints, with several values and synonyms
+/// translated to every locale, as in a large OEM configuration.
+static void writeAssets(const std::string& path, const std::string& prefix, int assetCount) {
+    nlohmann::json assets = nlohmann::json::array();
+    for (int i = 0; i < assetCount; i++) {
+        nlohmann::json values = nlohmann::json::array();
+        for (size_t locale = 0; locale < LOCALES.size(); locale += 2) {
+            nlohmann::json synonyms = nlohmann::json::array();
+            for (int synonym = 0; synonym < 5; synonym++) {
+                synonyms.push_back(prefix + " endpoint " + std::to_string(i) + " synonym " + std::to_string(synonym));
+            }
+            values.push_back(
+                {{"locales", {LOCALES[locale], LOCALES[locale + 1]}},
+                 {"defaultValue", prefix + " endpoint " + std::to_string(i) + " " + LOCALES[locale]},
+                 {"synonyms", synonyms}});
+        }
+        assets.push_back({{"assetId", prefix + ".Endpoint." + std::to_string(i)}, {"values", values}});
+    }
+    std::ofstream(path) << nlohmann::json({{"version", 1}, {"assets", assets}}).dump(2);
+}
+
+/// Test harness for the assets snapshot
+class AssetStoreSnapshotBenchmarkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        writeAssets(DEFAULT_ASSETS_PATH, "Alexa.Automotive", 600);
+        writeAssets(CUSTOM_ASSETS_PATH, "My", 200);
+        std::remove(SNAPSHOT_PATH.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(DEFAULT_ASSETS_PATH.c_str());
+        std::remove(CUSTOM_ASSETS_PATH.c_str());
+        std::remove(SNAPSHOT_PATH.c_str());
+    }
+
+    static void expectSameAssets(const AssetStore& expected, const AssetStore& actual) {
+        for (auto& assetId : {"Alexa.Automotive.Endpoint.0", "Alexa.Automotive.Endpoint.599", "My.Endpoint.199"}) {
+            EXPECT_FALSE(expected.getFriendlyNames(assetId).empty());
+            EXPECT_EQ(expected.getFriendlyNames(assetId), actual.getFriendlyNames(assetId)) << assetId;
+        }
+    }
+
+    const std::vector<std::string> m_paths = {DEFAULT_ASSETS_PATH, CUSTOM_ASSETS_PATH};
+};
+
+TEST_F(AssetStoreSnapshotBenchmarkTest, snapshotMatchesParsedAssets) {
+    AssetStore parsed;
+    ASSERT_TRUE(parsed.addAssets(m_paths, ""));
+
+    AssetStore written;
+    ASSERT_TRUE(written.addAssets(m_paths, SNAPSHOT_PATH));
+    ASSERT_TRUE(std::ifstream(SNAPSHOT_PATH).good());
+
+    AssetStore loaded;
+    ASSERT_TRUE(loaded.addAssets(m_paths, SNAPSHOT_PATH));
+    expectSameAssets(parsed, written);
+    expectSameAssets(parsed, loaded);
+}
+
+TEST_F(AssetStoreSnapshotBenchmarkTest, changedAssetsInvalidateSnapshot) {
+    AssetStore written;
+    ASSERT_TRUE(written.addAssets(m_paths, SNAPSHOT_PATH));
+
+    writeAssets(CUSTOM_ASSETS_PATH, "My", 201);
+    AssetStore loaded;
+    ASSERT_TRUE(loaded.addAssets(m_paths, SNAPSHOT_PATH));
+    EXPECT_FALSE(loaded.getFriendlyNames("My.Endpoint.200").empty());
+}
+
+TEST_F(AssetStoreSnapshotBenchmarkTest, invalidSnapshotIsIgnored) {
+    AssetStore written;
+    ASSERT_TRUE(written.addAssets(m_paths, SNAPSHOT_PATH));
+
+    // truncate the snapshot
+    std::string snapshot;
+    {
+        std::ifstream ifs(SNAPSHOT_PATH, std::ios::binary);
+        snapshot.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    }
+    std::ofstream(SNAPSHOT_PATH, std::ios::binary) << snapshot.substr(0, snapshot.size() / 2);
+
+    AssetStore loaded;
+    ASSERT_TRUE(loaded.addAssets(m_paths, SNAPSHOT_PATH));
+    expectSameAssets(written, loaded);
+}
+
+TEST_F(AssetStoreSnapshotBenchmarkTest, missingAssetsFileFails) {
+    AssetStore store;
+    EXPECT_FALSE(store.addAssets({"/tmp/aace-car-control-missing-assets.json"}, SNAPSHOT_PATH));
+}
+
+TEST_F(AssetStoreSnapshotBenchmarkTest, DISABLED_benchmarkColdStart) {
+    const int iterations = 10;
+
+    auto measure = [&](const std::string& snapshotPath) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            AssetStore store;
+            EXPECT_TRUE(store.addAssets(m_paths, snapshotPath));
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start) /
+               iterations;
+    };
+
+    auto parsedDuration = measure("");
+    AssetStore written;
+    ASSERT_TRUE(written.addAssets(m_paths, SNAPSHOT_PATH));
+    auto snapshotDuration = measure(SNAPSHOT_PATH);
+
+    RecordProperty("assets.parsedUs", static_cast<int>(parsedDuration.count()));
+    RecordProperty("assets.snapshotUs", static_cast<int>(snapshotDuration.count()));
+}
+
+}  // namespace carControl
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
@@ -0,0 +1,283 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+#include <AACE/CarControl/CarControlConfiguration.h>
+#include <AACE/Engine/CarControl/AssetStore.h>
+#include <AACE/Engine/CarControl/CarControlEngineImpl.h>
+#include <AACE/Engine/CarControl/Endpoint.h>
+#include <AACE/Engine/CarControl/ModeController.h>
+#include <AACE/Engine/CarControl/PowerController.h>
+#include <AACE/Engine/CarControl/RangeController.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace carControl {
+
+using namespace aace::engine::carControl;
+using AlexaStateChangeCauseType = alexaClientSDK::avsCommon::sdkInterfaces::AlexaStateChangeCauseType;
+using AlexaResponseType = alexaClientSDK::avsCommon::avs::AlexaResponseType;
+
+static const std::string ENDPOINT_ID = "default.fan";
+static const std::string RANGE_INSTANCE = "speed";
+static const std::string MODE_INSTANCE = "direction";
+
+/// Answers the state requests with fixed values, and counts them.
+class TestCarControl : public aace::carControl::CarControl {
+public:
+    bool turnPowerControllerOn(const std::string& endpointId) override {
+        return true;
+    }
+
+    bool isPowerControllerOn(const std::string& endpointId, bool& isOn) override {
+        m_getterCalls++;
+        isOn = false;
+        return true;
+    }
+
+    bool setRangeControllerValue(const std::string& endpointId, const std::string& controllerId, double value)
+        override {
+        return true;
+    }
+
+    bool adjustRangeControllerValue(const std::string& endpointId, const std::string& controllerId, double delta)
+        override {
+        return true;
+    }
+
+    bool getRangeControllerValue(const std::string& endpointId, const std::string& controllerId, double& value)
+        override {
+        m_getterCalls++;
+        value = 1;
+        return true;
+    }
+
+    bool getModeControllerValue(const std::string& endpointId, const std::string& controllerId, std::string& value)
+        override {
+        m_getterCalls++;
+        value = "FRONT";
+        return true;
+    }
+
+    std::atomic<int> m_getterCalls{0};
+};
+
+/// Records the causes of the state changes notified to the observers of the controllers.
+class TestObserver
+        : public alexaClientSDK::avsCommon::sdkInterfaces::powerController::PowerControllerObserverInterface
+        , public alexaClientSDK::avsCommon::sdkInterfaces::rangeController::RangeControllerObserverInterface
+        , public alexaClientSDK::avsCommon::sdkInterfaces::modeController::ModeControllerObserverInterface {
+public:
+    void onPowerStateChanged(const PowerController::PowerState& powerState, AlexaStateChangeCauseType cause)
+        override {
+        record(cause);
+    }
+
+    void onRangeChanged(const RangeController::RangeState& rangeState, AlexaStateChangeCauseType cause) override {
+        record(cause);
+    }
+
+    void onModeChanged(const ModeController::ModeState& modeState, AlexaStateChangeCauseType cause) override {
+        record(cause);
+    }
+
+    std::vector<AlexaStateChangeCauseType> getCauses() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_causes;
+    }
+
+private:
+    void record(AlexaStateChangeCauseType cause) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_causes.push_back(cause);
+    }
+
+    std::mutex m_mutex;
+    std::vector<AlexaStateChangeCauseType> m_causes;
+};
+
+/// Test harness for the states of the controllers reported by the platform implementation
+class CarControlStateTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        // the endpoint is configured with the builder, so the test also covers the configuration it produces
+        auto config = aace::carControl::config::CarControlConfiguration::create();
+        config->createEndpoint(ENDPOINT_ID)
+            .addAssetId("Alexa.Automotive.DeviceName.Fan")
+            .addPowerController(true)
+            .setProactivelyReported(true)
+            .addRangeController(RANGE_INSTANCE, true, 1, 10, 1)
+            .addAssetId("Alexa.Automotive.Setting.FanSpeed")
+            .addModeController(MODE_INSTANCE, true, false)
+            .addAssetId("Alexa.Automotive.Setting.Direction")
+            .addValue("FRONT")
+            .addAssetId("Alexa.Automotive.Value.Front")
+            .addValue("FLOOR")
+            .addAssetId("Alexa.Automotive.Value.Floor");
+        auto document = nlohmann::json::parse(*config->getStream());
+        m_endpointConfig = document.at("aace.carControl").at("endpoints").at(0);
+
+        auto endpoint = Endpoint::create(m_endpointConfig, m_assetStore);
+        ASSERT_NE(endpoint, nullptr);
+
+        m_carControl = std::make_shared<TestCarControl>();
+        m_carControlEngineImpl = CarControlEngineImpl::create(m_carControl);
+        ASSERT_NE(m_carControlEngineImpl, nullptr);
+        m_carControlEngineImpl->addEndpoint(endpoint);
+
+        m_powerController =
+            std::dynamic_pointer_cast<PowerController>(endpoint->getController("Alexa.PowerController"));
+        m_rangeController = std::dynamic_pointer_cast<RangeController>(
+            endpoint->getController("Alexa.RangeController#" + RANGE_INSTANCE));
+        m_modeController = std::dynamic_pointer_cast<ModeController>(
+            endpoint->getController("Alexa.ModeController#" + MODE_INSTANCE));
+        ASSERT_NE(m_powerController, nullptr);
+        ASSERT_NE(m_rangeController, nullptr);
+        ASSERT_NE(m_modeController, nullptr);
+
+        // the controllers are not registered with Alexa, which would require an endpoint builder
+        m_powerController->setCarControlServiceInterface(m_carControlEngineImpl);
+        m_rangeController->setCarControlServiceInterface(m_carControlEngineImpl);
+        m_modeController->setCarControlServiceInterface(m_carControlEngineImpl);
+
+        m_observer = std::make_shared<TestObserver>();
+        ASSERT_TRUE(m_powerController->addObserver(m_observer));
+        ASSERT_TRUE(m_rangeController->addObserver(m_observer));
+        ASSERT_TRUE(m_modeController->addObserver(m_observer));
+    }
+
+    void TearDown() override {
+        if (m_carControlEngineImpl != nullptr) {
+            m_carControlEngineImpl->shutdown();
+        }
+    }
+
+protected:
+    AssetStore m_assetStore;
+    nlohmann::json m_endpointConfig;
+    std::shared_ptr<TestCarControl> m_carControl;
+    std::shared_ptr<CarControlEngineImpl> m_carControlEngineImpl;
+    std::shared_ptr<PowerController> m_powerController;
+    std::shared_ptr<RangeController> m_rangeController;
+    std::shared_ptr<ModeController> m_modeController;
+    std::shared_ptr<TestObserver> m_observer;
+};
+
+TEST_F(CarControlStateTest, configurationSetsProactivelyReported) {
+    auto& capabilities = m_endpointConfig.at("capabilities");
+    ASSERT_EQ(capabilities.size(), 3u);
+    EXPECT_TRUE(capabilities[0]["properties"]["proactivelyReported"].get<bool>());
+    EXPECT_FALSE(capabilities[1]["properties"]["proactivelyReported"].get<bool>());
+    EXPECT_TRUE(m_powerController->isProactivelyReported());
+    EXPECT_FALSE(m_rangeController->isProactivelyReported());
+}
+
+TEST_F(CarControlStateTest, proactivelyReportedRequiresCapability) {
+    auto config = aace::carControl::config::CarControlConfiguration::create();
+    config->createEndpoint(ENDPOINT_ID).setProactivelyReported(true);
+    EXPECT_EQ(nlohmann::json::parse(*config->getStream()), nlohmann::json::object());
+}
+
+TEST_F(CarControlStateTest, reportedStateIsNotRequested) {
+    // the platform implementation is requested until it reports the state
+    auto rangeState = m_rangeController->getRangeState();
+    ASSERT_EQ(rangeState.first, AlexaResponseType::SUCCESS);
+    EXPECT_EQ(rangeState.second.value().value, 1);
+    EXPECT_EQ(m_carControl->m_getterCalls, 1);
+
+    m_carControl->rangeControllerValueChanged(ENDPOINT_ID, RANGE_INSTANCE, 4);
+    m_carControl->powerControllerStateChanged(ENDPOINT_ID, true);
+    m_carControl->modeControllerValueChanged(ENDPOINT_ID, MODE_INSTANCE, "FLOOR");
+
+    rangeState = m_rangeController->getRangeState();
+    ASSERT_EQ(rangeState.first, AlexaResponseType::SUCCESS);
+    EXPECT_EQ(rangeState.second.value().value, 4);
+    auto powerState = m_powerController->getPowerState();
+    ASSERT_EQ(powerState.first, AlexaResponseType::SUCCESS);
+    EXPECT_TRUE(powerState.second.value().powerState);
+    auto modeState = m_modeController->getMode();
+    ASSERT_EQ(modeState.first, AlexaResponseType::SUCCESS);
+    EXPECT_EQ(modeState.second.value().mode, "FLOOR");
+    EXPECT_EQ(m_carControl->m_getterCalls, 1);
+}
+
+TEST_F(CarControlStateTest, setUpdatesReportedState) {
+    m_carControl->rangeControllerValueChanged(ENDPOINT_ID, RANGE_INSTANCE, 4);
+    auto result = m_rangeController->setRangeValue(7, AlexaStateChangeCauseType::VOICE_INTERACTION);
+    ASSERT_EQ(result.first, AlexaResponseType::SUCCESS);
+
+    auto rangeState = m_rangeController->getRangeState();
+    ASSERT_EQ(rangeState.first, AlexaResponseType::SUCCESS);
+    EXPECT_EQ(rangeState.second.value().value, 7);
+    EXPECT_EQ(m_carControl->m_getterCalls, 0);
+}
+
+TEST_F(CarControlStateTest, adjustInvalidatesReportedState) {
+    m_carControl->rangeControllerValueChanged(ENDPOINT_ID, RANGE_INSTANCE, 4);
+    auto result = m_rangeController->adjustRangeValue(2, AlexaStateChangeCauseType::VOICE_INTERACTION);
+    ASSERT_EQ(result.first, AlexaResponseType::SUCCESS);
+
+    // the value is requested from the platform implementation until it reports the adjusted value
+    auto rangeState = m_rangeController->getRangeState();
+    ASSERT_EQ(rangeState.first, AlexaResponseType::SUCCESS);
+    EXPECT_EQ(rangeState.second.value().value, 1);
+    EXPECT_EQ(m_carControl->m_getterCalls, 1);
+
+    m_carControl->rangeControllerValueChanged(ENDPOINT_ID, RANGE_INSTANCE, 6);
+    EXPECT_EQ(m_rangeController->getRangeState().second.value().value, 6);
+    EXPECT_EQ(m_carControl->m_getterCalls, 1);
+}
+
+TEST_F(CarControlStateTest, unsupportedValuesAreRejected) {
+    EXPECT_FALSE(m_rangeController->reportRangeValue(11));
+    EXPECT_FALSE(m_modeController->reportMode("CEILING"));
+
+    // the engine ignores the unsupported values, so the states are still requested from the platform implementation
+    m_carControl->rangeControllerValueChanged(ENDPOINT_ID, RANGE_INSTANCE, 0);
+    m_carControl->modeControllerValueChanged(ENDPOINT_ID, MODE_INSTANCE, "CEILING");
+    EXPECT_EQ(m_rangeController->getRangeState().second.value().value, 1);
+    EXPECT_EQ(m_modeController->getMode().second.value().mode, "FRONT");
+    EXPECT_EQ(m_carControl->m_getterCalls, 2);
+    EXPECT_TRUE(m_observer->getCauses().empty());
+}
+
+TEST_F(CarControlStateTest, observersReceiveCause) {
+    m_carControl->powerControllerStateChanged(ENDPOINT_ID, false);
+    // an unchanged state is not notified
+    m_carControl->powerControllerStateChanged(ENDPOINT_ID, false);
+    auto result = m_powerController->setPowerState(true, AlexaStateChangeCauseType::VOICE_INTERACTION);
+    ASSERT_EQ(result.first, AlexaResponseType::SUCCESS);
+    m_carControl->modeControllerValueChanged(ENDPOINT_ID, MODE_INSTANCE, "FLOOR");
+
+    auto causes = m_observer->getCauses();
+    ASSERT_EQ(causes.size(), 3u);
+    EXPECT_EQ(causes[0], AlexaStateChangeCauseType::PHYSICAL_INTERACTION);
+    EXPECT_EQ(causes[1], AlexaStateChangeCauseType::VOICE_INTERACTION);
+    EXPECT_EQ(causes[2], AlexaStateChangeCauseType::PHYSICAL_INTERACTION);
+}
+
+}  // namespace carControl
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
@@ -0,0 +1,168 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <AACE/Engine/CarControl/ControllerRequestBatcher.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace carControl {
+
+using ControllerRequestBatcher = aace::engine::carControl::ControllerRequestBatcher;
+using ControllerType = ControllerRequestBatcher::ControllerType;
+using ControllerRequest = ControllerRequestBatcher::ControllerRequest;
+
+/// The endpoint the platform implementation fails to set
+static const std::string FAILING_ENDPOINT = "failing";
+
+/// A window long enough for the concurrent requests of a test to join the same batch
+static const std::chrono::milliseconds WINDOW(500);
+
+/// Records the requests sent to the platform implementation.
+class TestCarControl : public aace::carControl::CarControl {
+public:
+    TestCarControl(bool handlesBatches, bool declinesBatches = false) :
+            m_handlesBatches(handlesBatches), m_declinesBatches(declinesBatches) {
+    }
+
+    bool turnPowerControllerOn(const std::string& endpointId) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_singleRequests.push_back(endpointId);
+        return endpointId != FAILING_ENDPOINT;
+    }
+
+    std::vector<bool> setControllerValues(ControllerType type, const std::vector<ControllerRequest>& requests)
+        override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_batchSizes.push_back(requests.size());
+        if (m_declinesBatches) {
+            return {};
+        }
+        std::vector<bool> results;
+        for (const auto& request : requests) {
+            results.push_back(request.endpointId != FAILING_ENDPOINT);
+        }
+        return results;
+    }
+
+    bool handlesControllerBatches() override {
+        return m_handlesBatches;
+    }
+
+    std::vector<std::string> getSingleRequests() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_singleRequests;
+    }
+
+    std::vector<size_t> getBatchSizes() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_batchSizes;
+    }
+
+private:
+    bool m_handlesBatches;
+    bool m_declinesBatches;
+    std::mutex m_mutex;
+    std::vector<std::string> m_singleRequests;
+    std::vector<size_t> m_batchSizes;
+};
+
+static ControllerRequest createPowerRequest(const std::string& endpointId) {
+    ControllerRequest request;
+    request.endpointId = endpointId;
+    request.turnOn = true;
+    return request;
+}
+
+/// Executes a request for each endpoint concurrently, and returns the results in the order of @c endpointIds.
+static std::vector<bool> executeConcurrently(
+    std::shared_ptr<ControllerRequestBatcher> batcher,
+    const std::vector<std::string>& endpointIds) {
+    std::vector<std::future<bool>> futures;
+    for (const auto& endpointId : endpointIds) {
+        futures.push_back(std::async(std::launch::async, [batcher, endpointId] {
+            return batcher->execute(ControllerType::POWER, createPowerRequest(endpointId));
+        }));
+    }
+    std::vector<bool> results;
+    for (auto& future : futures) {
+        results.push_back(future.get());
+    }
+    return results;
+}
+
+TEST(ControllerRequestBatcherTest, createWithInvalidPlatformInterface) {
+    EXPECT_EQ(ControllerRequestBatcher::create(nullptr, WINDOW), nullptr);
+}
+
+TEST(ControllerRequestBatcherTest, platformWithoutBatchesIsNotDelayed) {
+    auto carControl = std::make_shared<TestCarControl>(false);
+    // a request waiting for the window would not return before the test times out
+    auto batcher = ControllerRequestBatcher::create(carControl, std::chrono::hours(1));
+    ASSERT_NE(batcher, nullptr);
+
+    EXPECT_EQ(executeConcurrently(batcher, {"left", "right", FAILING_ENDPOINT}), std::vector<bool>({true, true, false}));
+    EXPECT_EQ(carControl->getSingleRequests().size(), 3u);
+    EXPECT_TRUE(carControl->getBatchSizes().empty());
+}
+
+TEST(ControllerRequestBatcherTest, concurrentRequestsAreBatched) {
+    auto carControl = std::make_shared<TestCarControl>(true);
+    auto batcher = ControllerRequestBatcher::create(carControl, WINDOW);
+    ASSERT_NE(batcher, nullptr);
+
+    // each caller receives the result of its own request
+    EXPECT_EQ(executeConcurrently(batcher, {"left", FAILING_ENDPOINT, "right"}), std::vector<bool>({true, false, true}));
+    EXPECT_EQ(carControl->getBatchSizes(), std::vector<size_t>({3}));
+    EXPECT_TRUE(carControl->getSingleRequests().empty());
+}
+
+TEST(ControllerRequestBatcherTest, requestAloneIsSentWithSingleMethod) {
+    auto carControl = std::make_shared<TestCarControl>(true);
+    auto batcher = ControllerRequestBatcher::create(carControl, std::chrono::milliseconds(1));
+    ASSERT_NE(batcher, nullptr);
+
+    EXPECT_TRUE(batcher->execute(ControllerType::POWER, createPowerRequest("left")));
+    EXPECT_EQ(carControl->getSingleRequests(), std::vector<std::string>({"left"}));
+    EXPECT_TRUE(carControl->getBatchSizes().empty());
+}
+
+TEST(ControllerRequestBatcherTest, declinedBatchFallsBackToSingleRequests) {
+    auto carControl = std::make_shared<TestCarControl>(true, true);
+    auto batcher = ControllerRequestBatcher::create(carControl, WINDOW);
+    ASSERT_NE(batcher, nullptr);
+
+    EXPECT_EQ(executeConcurrently(batcher, {"left", FAILING_ENDPOINT}), std::vector<bool>({true, false}));
+    EXPECT_EQ(carControl->getBatchSizes(), std::vector<size_t>({2}));
+    EXPECT_EQ(carControl->getSingleRequests().size(), 2u);
+
+    // the following requests are sent without a batch
+    EXPECT_EQ(executeConcurrently(batcher, {"left", "right"}), std::vector<bool>({true, true}));
+    EXPECT_EQ(carControl->getBatchSizes().size(), 1u);
+    EXPECT_EQ(carControl->getSingleRequests().size(), 4u);
+}
+
+}  // namespace carControl
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include <AACE/Engine/CarControl/ControllerState.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace carControl {
+
+/// The observers are only stored by the state, which never calls them.
+class TestObserver {};
+
+using State = aace::engine::carControl::ControllerState<std::string, TestObserver>;
+
+TEST(ControllerStateTest, unknownUntilReported) {
+    State state;
+    std::string value;
+    State::TimePoint timeOfSample;
+    EXPECT_FALSE(state.get(value, timeOfSample));
+
+    // a directive does not make the state known
+    EXPECT_FALSE(state.update("HIGH"));
+    EXPECT_FALSE(state.get(value, timeOfSample));
+
+    EXPECT_TRUE(state.report("LOW"));
+    ASSERT_TRUE(state.get(value, timeOfSample));
+    EXPECT_EQ(value, "LOW");
+}
+
+TEST(ControllerStateTest, reportAndUpdateReturnWhetherChanged) {
+    State state;
+    EXPECT_TRUE(state.report("LOW"));
+    EXPECT_FALSE(state.report("LOW"));
+    EXPECT_TRUE(state.update("HIGH"));
+    EXPECT_FALSE(state.update("HIGH"));
+
+    std::string value;
+    State::TimePoint timeOfSample;
+    ASSERT_TRUE(state.get(value, timeOfSample));
+    EXPECT_EQ(value, "HIGH");
+}
+
+TEST(ControllerStateTest, invalidateForgetsUntilReported) {
+    State state;
+    ASSERT_TRUE(state.report("LOW"));
+    state.invalidate();
+
+    std::string value;
+    State::TimePoint timeOfSample;
+    EXPECT_FALSE(state.get(value, timeOfSample));
+    EXPECT_FALSE(state.update("HIGH"));
+
+    // the same value reported again is a change, since the previous one was forgotten
+    EXPECT_TRUE(state.report("LOW"));
+    ASSERT_TRUE(state.get(value, timeOfSample));
+    EXPECT_EQ(value, "LOW");
+}
+
+TEST(ControllerStateTest, addAndRemoveObservers) {
+    State state;
+    auto observer = std::make_shared<TestObserver>();
+    EXPECT_FALSE(state.addObserver(nullptr));
+    EXPECT_TRUE(state.addObserver(observer));
+    EXPECT_TRUE(state.addObserver(observer));
+    EXPECT_EQ(state.getObservers().size(), 1u);
+
+    state.removeObserver(observer);
+    EXPECT_TRUE(state.getObservers().empty());
+}
+
+}  // namespace carControl
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
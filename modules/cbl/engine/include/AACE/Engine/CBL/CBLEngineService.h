@@ -48,7 +48,7 @@ public:
     virtual ~CBLEngineService() = default;
 
 protected:
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) override;
     bool setup() override;
     bool engineStarted() override;
     bool stop() override;
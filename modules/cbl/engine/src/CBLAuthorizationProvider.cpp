@@ -33,6 +33,7 @@
 #include <AVSCommon/Utils/RetryTimer.h>
 
 #include <AACE/Alexa/AlexaProperties.h>
+#include <AACE/Engine/Alexa/HttpClientPool.h>
 #include "AACE/Engine/CBL/CBLAuthorizationProvider.h"
 #include "AACE/Engine/Core/EngineMacros.h"
 #include <AACE/Engine/Utils/Metrics/Metrics.h>
@@ -614,12 +615,7 @@ alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse CBLAuthorizationPro
     const std::vector<std::pair<std::string, std::string>>& data,
     std::chrono::seconds timeout) {
     try {
-        // Creating the HttpPost on every doPost is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpPost = HttpPost::create();
-        ThrowIfNull(httpPost, "nullHttpPost");
-
-        return httpPost->doPost(url, headerLines, data, timeout);
+        return aace::engine::alexa::HttpClientPool::getInstance()->doPost(url, headerLines, data, timeout);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         return alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse();
@@ -630,12 +626,8 @@ alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse CBLAuthorizationPro
     const std::string& url,
     const std::vector<std::string>& headers) {
     try {
-        // Creating the HttpGet on every doGet is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpGet = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpGet::create();
-        ThrowIfNull(httpGet, "nullHttpGet");
-
-        return httpGet->doGet(url, headers, m_configuration->getRequestTimeout());
+        return aace::engine::alexa::HttpClientPool::getInstance()->doGet(
+            url, headers, m_configuration->getRequestTimeout());
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         return alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse();
@@ -52,19 +52,17 @@ CBLEngineService::CBLEngineService(const aace::engine::core::ServiceDescription&
         m_enableUserProfile(false) {
 }
 
-bool CBLEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool CBLEngineService::configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) {
     try {
-        auto document = aace::engine::utils::json::parse(configuration);
-        ThrowIfNull(document, "parseConfigurationStreamFailed");
+        const auto& cblConfigRoot = *configuration;
+        ThrowIfNot(cblConfigRoot.is_object(), "invalidConfiguration");
 
-        auto cblConfigRoot = document->GetObject();
-
-        if (cblConfigRoot.HasMember("requestTimeout") && cblConfigRoot["requestTimeout"].IsUint()) {
-            m_codePairRequestTimeout = std::chrono::seconds(cblConfigRoot["requestTimeout"].GetUint());
+        if (cblConfigRoot.contains("requestTimeout") && cblConfigRoot.at("requestTimeout").is_number_unsigned()) {
+            m_codePairRequestTimeout = std::chrono::seconds(cblConfigRoot.at("requestTimeout").get<uint32_t>());
         }
 
-        if (cblConfigRoot.HasMember("enableUserProfile") && cblConfigRoot["enableUserProfile"].IsBool()) {
-            m_enableUserProfile = cblConfigRoot["enableUserProfile"].GetBool();
+        if (cblConfigRoot.contains("enableUserProfile") && cblConfigRoot.at("enableUserProfile").is_boolean()) {
+            m_enableUserProfile = cblConfigRoot.at("enableUserProfile").get<bool>();
         }
 
         return true;
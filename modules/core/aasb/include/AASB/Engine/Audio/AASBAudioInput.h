@@ -24,6 +24,7 @@
 
 #include <memory>
 #include <fstream>
+#include <vector>
 
 namespace aasb {
 namespace engine {
@@ -85,6 +86,7 @@ private:
 
     private:
         std::shared_ptr<AASBAudioInput> m_audioInput;
+        std::vector<int16_t> m_samples;
     };
 };
 
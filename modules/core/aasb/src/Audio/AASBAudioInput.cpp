@@ -15,6 +15,7 @@
 
 #include <AASB/Engine/Audio/AASBAudioInput.h>
 #include <AACE/Engine/Core/EngineMacros.h>
+#include <AACE/Engine/Utils/Audio/PCM.h>
 #include <AACE/Engine/Utils/UUID/UUID.h>
 
 #include <AASB/Message/Audio/AudioInput/StartAudioInputMessage.h>
@@ -146,7 +147,13 @@ ssize_t AASBAudioInput::AudioInputStreamHandler::read(char* data, const size_t s
 }
 
 ssize_t AASBAudioInput::AudioInputStreamHandler::write(const char* data, const size_t size) {
-    return m_audioInput->write((int16_t*)data, size / 2) * 2;
+    // stream writes are not guaranteed to be sample aligned, so copy unaligned data into a sample buffer
+    if (reinterpret_cast<uintptr_t>(data) % alignof(int16_t) == 0) {
+        return m_audioInput->write(reinterpret_cast<const int16_t*>(data), size / 2) * 2;
+    }
+    m_samples.resize(size / 2);
+    auto count = aace::engine::utils::audio::pcm::bytesToInt16(data, size, m_samples.data());
+    return m_audioInput->write(m_samples.data(), count) * 2;
 }
 
 bool AASBAudioInput::AudioInputStreamHandler::isClosed() {
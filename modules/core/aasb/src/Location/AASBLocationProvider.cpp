@@ -18,6 +18,7 @@
 
 #include <AASB/Message/Location/LocationProvider/GetCountryMessage.h>
 #include <AASB/Message/Location/LocationProvider/GetLocationMessage.h>
+#include <AASB/Message/Location/LocationProvider/LocationChangedMessage.h>
 #include <AASB/Message/Location/LocationProvider/LocationServiceAccessChangedMessage.h>
 
 namespace aasb {
@@ -30,6 +31,12 @@ static const std::string TAG("aasb.location.AASBLocationProvider");
 // aliases
 using Message = aace::engine::messageBroker::Message;
 
+static aace::location::Location toLocation(const aasb::message::location::locationProvider::Location& location) {
+    auto altitude = location.altitude < 0 ? aace::location::Location::UNDEFINED : location.altitude;
+    auto accuracy = location.accuracy < 0 ? aace::location::Location::UNDEFINED : location.accuracy;
+    return aace::location::Location(location.latitude, location.longitude, altitude, accuracy);
+}
+
 std::shared_ptr<AASBLocationProvider> AASBLocationProvider::create(
     std::shared_ptr<aace::engine::messageBroker::MessageBrokerInterface> messageBroker) {
     try {
@@ -76,6 +83,27 @@ bool AASBLocationProvider::initialize(
                     AACE_ERROR(LX(TAG, "LocationServiceAccessChangedMessage").d("reason", ex.what()));
                 }
             });
+
+        //
+        // LocationProvider:LocationChanged
+        //
+        messageBroker->subscribe(
+            aasb::message::location::locationProvider::LocationChangedMessage::topic(),
+            aasb::message::location::locationProvider::LocationChangedMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+
+                    aasb::message::location::locationProvider::LocationChangedMessage::Payload payload =
+                        nlohmann::json::parse(message.payload());
+
+                    sp->locationChanged(toLocation(payload.location));
+
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG, "LocationChangedMessage").d("reason", ex.what()));
+                }
+            });
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -103,12 +131,8 @@ aace::location::Location AASBLocationProvider::getLocation() {
         aasb::message::location::locationProvider::GetLocationMessageReply::Payload payload =
             nlohmann::json::parse(result.payload());
 
-        auto altitude = payload.location.altitude < 0 ? aace::location::Location::UNDEFINED : payload.location.altitude;
-        auto accuracy = payload.location.accuracy < 0 ? aace::location::Location::UNDEFINED : payload.location.accuracy;
-
         // parse the location from payload
-        m_location =
-            aace::location::Location(payload.location.latitude, payload.location.longitude, altitude, accuracy);
+        m_location = toLocation(payload.location);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
     }
@@ -90,6 +90,16 @@ abstract public class LocationProvider extends PlatformInterface {
         locationServiceAccessChanged(getNativeRef(), access);
     }
 
+    /**
+     * Notifies the Engine of the current geolocation of the device. Use this method to push location
+     * updates as they arrive, so the Engine can answer location queries without calling getLocation().
+     *
+     * @param location The current location
+     */
+    public void locationChanged(Location location) {
+        locationChanged(getNativeRef(), location);
+    }
+
     final protected long createNativeRef() {
         return createBinder();
     }
@@ -102,4 +112,5 @@ abstract public class LocationProvider extends PlatformInterface {
     private native long createBinder();
     private native void disposeBinder(long nativeRef);
     private native void locationServiceAccessChanged(long nativeRef, LocationServiceAccess access);
+    private native void locationChanged(long nativeRef, Location location);
 }
@@ -97,4 +97,21 @@ endif()
 
 if(AAC_EMIT_THREAD_MONIKER_LOGS)
     add_definitions(-DAAC_EMIT_THREAD_MONIKER_LOGS)
+endif()
+
+# Enable/disable recording the message traffic with the "trafficRecordingPath" configuration (On|Off).
+#
+#   -DAAC_ENABLE_TRAFFIC_RECORDING=On
+#
+# Defaults to Off. The recording holds the messages verbatim, including tokens and personal data, so it is only
+# allowed in debug builds.
+
+if(AAC_ENABLE_TRAFFIC_RECORDING)
+    string(TOUPPER "${CMAKE_BUILD_TYPE}" AAC_BUILD_TYPE_UPPER)
+    if(AAC_BUILD_TYPE_UPPER STREQUAL "DEBUG")
+        message("WARNING: Recording of the message traffic enabled!")
+        add_definitions(-DAAC_TRAFFIC_RECORDING_ENABLED)
+    else()
+        message(FATAL_ERROR "FATAL_ERROR: AAC_ENABLE_TRAFFIC_RECORDING=ON in non-DEBUG build.")
+    endif()
 endif()
\ No newline at end of file
@@ -31,6 +31,7 @@ class AutoSdkModulePkg(ConanFile):
         "default_logger_sink": ["Default", "Console", "Syslog"],
         "with_colored_logs": [True, False],
         "with_thread_moniker_logs": [True, False],
+        "with_traffic_recording": [True, False],
     }
     module_default_options = {
         "default_logger_enabled": True,
@@ -38,6 +39,7 @@ class AutoSdkModulePkg(ConanFile):
         "default_logger_sink": "Default",
         "with_colored_logs": True,
         "with_thread_moniker_logs": True,
+        "with_traffic_recording": False,
         "sqlite3:build_executable": False,
     }
 
@@ -60,5 +62,7 @@ class AutoSdkModulePkg(ConanFile):
             cmake_defs["AAC_EMIT_COLOR_LOGS"] = "On"
         if self.options.with_thread_moniker_logs:
             cmake_defs["AAC_EMIT_THREAD_MONIKER_LOGS"] = "On"
+        if self.options.with_traffic_recording:
+            cmake_defs["AAC_ENABLE_TRAFFIC_RECORDING"] = "On"
 
         return cmake_defs
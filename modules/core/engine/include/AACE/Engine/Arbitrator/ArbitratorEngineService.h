@@ -64,7 +64,7 @@ public:
     /// @}
 
 protected:
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) override;
     bool shutdown() override;
     bool registerPlatformInterface(std::shared_ptr<aace::core::PlatformInterface> platformInterface) override;
 
@@ -26,6 +26,8 @@
 #include <AACE/Engine/PropertyManager/PropertyManagerServiceInterface.h>
 #include <AACE/Engine/MessageBroker/MessageBrokerServiceInterface.h>
 #include "EngineServiceManager.h"
+#include "EngineServiceScheduler.h"
+#include "LifecycleTracer.h"
 #include "ServiceDescription.h"
 
 namespace aace {
@@ -74,6 +76,8 @@ protected:
 private:
     bool initialize();
     bool checkServices();
+    void runServiceStage(const std::string& stage, EngineServiceScheduler::StageFunction function);
+    void writeLifecycleTrace();
 
     std::shared_ptr<EngineService> getServiceFromPropertyKey(const std::string& key);
     bool registerProperties();
@@ -81,8 +85,13 @@ private:
 private:
     std::unordered_map<std::string, std::shared_ptr<EngineService>> m_registeredServiceMap;
     std::vector<std::shared_ptr<EngineService>> m_orderedServiceList;
+    std::shared_ptr<EngineServiceScheduler> m_serviceScheduler;
     std::weak_ptr<aace::engine::messageBroker::MessageBrokerServiceInterface> m_messageBrokerService;
 
+    // the time spent in each lifecycle phase, written to the configured path once the engine is started
+    LifecycleTracer m_tracer;
+    std::string m_lifecycleTracePath;
+
     // engine flags
     bool m_running = false;
     bool m_initialized = false;
@@ -28,6 +28,7 @@
 #include <iostream>
 
 #include "AACE/Engine/Core/ServiceDescription.h"
+#include "AACE/Engine/Utils/JSON/JSON.h"
 #include "AACE/Core/PlatformInterface.h"
 
 namespace aace {
@@ -83,6 +84,13 @@ protected:
     virtual bool initialize();
     virtual bool configure();
     virtual bool configure(std::shared_ptr<std::istream> configuration);
+
+    /**
+     * Configures the service with its section of the engine configuration, parsed once by the engine and shared
+     * with the other services. The default implementation serializes the section and calls
+     * @c configure(std::shared_ptr<std::istream>), so services should override this method instead.
+     */
+    virtual bool configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration);
     virtual bool preRegister();
     virtual bool postRegister();
     virtual bool setup();
@@ -135,7 +143,7 @@ protected:
 
 private:
     bool handleInitializeEngineEvent(std::shared_ptr<aace::engine::core::EngineContext> context);
-    bool handleConfigureEngineEvent(std::shared_ptr<std::istream> configuration);
+    bool handleConfigureEngineEvent(std::shared_ptr<const aace::engine::utils::json::Value> configuration);
     bool handlePreRegisterEngineEvent();
     bool handlePostRegisterEngineEvent();
     bool handleSetupEngineEvent();
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_CORE_ENGINE_SERVICE_SCHEDULER_H
+#define AACE_ENGINE_CORE_ENGINE_SERVICE_SCHEDULER_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "EngineService.h"
+
+namespace aace {
+namespace engine {
+namespace core {
+
+/**
+ * Runs a lifecycle stage of the engine services on a bounded number of threads. A service runs once all the
+ * services it depends on completed the stage, so independent services run at the same time. Among the services
+ * which are ready, the one first in the ordered service list runs first, so a single thread runs the services in
+ * list order.
+ *
+ * When a service fails, the services after it in the list are not started anymore, while the services before
+ * it still run. The reported failure is therefore the same as if the services ran one after another.
+ */
+class EngineServiceScheduler {
+private:
+    EngineServiceScheduler(std::vector<std::vector<size_t>> dependencies, size_t maxThreads);
+
+public:
+    /// Runs the stage of the service at an index, returning @c true on success.
+    using StageFunction = std::function<bool(size_t index)>;
+
+    /**
+     * Creates a scheduler for the services at the indexes of a list.
+     *
+     * @param dependencies The indexes of the services each service depends on, which come before it in the list.
+     * @param maxThreads The number of services running at the same time, at least 1.
+     */
+    static std::shared_ptr<EngineServiceScheduler> create(
+        std::vector<std::vector<size_t>> dependencies,
+        size_t maxThreads);
+
+    /**
+     * Creates a scheduler for the services of an ordered service list, using their declared dependencies.
+     */
+    static std::shared_ptr<EngineServiceScheduler> create(
+        const std::vector<std::shared_ptr<EngineService>>& orderedServiceList,
+        size_t maxThreads);
+
+    /**
+     * Runs a stage for all the services, returning when none of them is running.
+     *
+     * @param stage The stage of a service.
+     * @param [out] failedIndex The index of the first service in the list which failed.
+     * @return @c true if the stage succeeded for all the services.
+     */
+    bool run(StageFunction stage, size_t& failedIndex);
+
+private:
+    /// The indexes of the services depending on each service.
+    std::vector<std::vector<size_t>> m_dependents;
+
+    /// The number of services each service depends on.
+    std::vector<size_t> m_dependencyCounts;
+
+    size_t m_maxThreads;
+};
+
+}  // namespace core
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_CORE_ENGINE_SERVICE_SCHEDULER_H
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_CORE_LIFECYCLE_TRACER_H
+#define AACE_ENGINE_CORE_LIFECYCLE_TRACER_H
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace aace {
+namespace engine {
+namespace core {
+
+/**
+ * Records the time spent in each lifecycle phase of the engine and of each engine service, and exports it in the
+ * Chrome trace event format, which chrome://tracing and Perfetto display as a timeline with a row per thread.
+ *
+ * The engine records a few spans for each service in each phase, so the tracer is always enabled. It keeps at most
+ * a maximum number of spans, and drops the following ones.
+ */
+class LifecycleTracer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// A span of time spent in a phase
+    struct Event {
+        /// The name of the span, which is the phase of the engine or the type of the service
+        std::string name;
+
+        /// The category of the span, which is "engine" or the phase of the service
+        std::string category;
+
+        /// The time the span started, since the tracer was created
+        Clock::duration start;
+
+        Clock::duration duration;
+
+        /// The index of the thread the span ran on, 0 for the thread which created the tracer
+        size_t thread;
+    };
+
+    /// Records the time from its creation to its destruction as a span.
+    class Span {
+    public:
+        Span(LifecycleTracer& tracer, std::string name, std::string category);
+        ~Span();
+
+        Span(const Span&) = delete;
+        Span& operator=(const Span&) = delete;
+
+    private:
+        LifecycleTracer& m_tracer;
+        std::string m_name;
+        std::string m_category;
+        Clock::time_point m_startTime;
+    };
+
+    /// The default maximum number of spans
+    static const size_t DEFAULT_MAX_EVENTS;
+
+    LifecycleTracer(size_t maxEvents = DEFAULT_MAX_EVENTS);
+
+    /**
+     * Records a span.
+     *
+     * @param name The name of the span.
+     * @param category The category of the span.
+     * @param startTime The time the span started.
+     * @param endTime The time the span ended.
+     */
+    void addEvent(
+        const std::string& name,
+        const std::string& category,
+        Clock::time_point startTime,
+        Clock::time_point endTime);
+
+    /// Returns the spans recorded so far, in the order they ended.
+    std::vector<Event> getEvents() const;
+
+    /// Returns the spans recorded so far as a Chrome trace JSON object.
+    std::string toJson() const;
+
+    /**
+     * Writes the spans recorded so far to a Chrome trace file.
+     *
+     * @param path The path of the file, which is replaced if it exists.
+     * @return @c true if the file was written.
+     */
+    bool write(const std::string& path) const;
+
+private:
+    const Clock::time_point m_startTime;
+    const size_t m_maxEvents;
+
+    mutable std::mutex m_mutex;
+    std::vector<Event> m_events;
+    std::unordered_map<std::thread::id, size_t> m_threads;
+    size_t m_droppedEvents;
+};
+
+}  // namespace core
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_CORE_LIFECYCLE_TRACER_H
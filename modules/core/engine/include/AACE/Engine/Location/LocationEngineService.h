@@ -34,6 +34,7 @@ public:
     virtual ~LocationEngineService() = default;
 
 protected:
+    bool configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) override;
     bool registerPlatformInterface(std::shared_ptr<aace::core::PlatformInterface> platformInterface) override;
     bool shutdown() override;
 
@@ -49,6 +50,8 @@ private:
 
 private:
     std::shared_ptr<aace::engine::location::LocationProviderEngineImpl> m_locationProviderEngineImpl;
+    std::chrono::milliseconds m_maxLocationAge;
+    std::chrono::milliseconds m_fetchTimeout;
 };
 
 }  // namespace location
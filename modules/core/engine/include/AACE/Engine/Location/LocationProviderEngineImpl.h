@@ -16,11 +16,14 @@
 #ifndef AACE_ENGINE_LOCATION_LOCATION_PROVIDER_ENGINE_IMPL_H
 #define AACE_ENGINE_LOCATION_LOCATION_PROVIDER_ENGINE_IMPL_H
 
+#include <chrono>
+#include <future>
 #include <unordered_set>
 #include <mutex>
 #include <memory>
 
 #include "AACE/Engine/Location/LocationServiceInterface.h"
+#include "AACE/Engine/Utils/Threading/Executor.h"
 #include "AACE/Location/LocationProviderEngineInterface.h"
 
 #include "LocationServiceObserverInterface.h"
@@ -29,15 +32,41 @@ namespace aace {
 namespace engine {
 namespace location {
 
+/**
+ * Serves location queries from a cache of the last location reported by the platform.
+ *
+ * The platform may push updates with @c LocationProvider::locationChanged(). A location younger than
+ * the maximum age is returned without calling the platform; otherwise @c LocationProvider::getLocation()
+ * is called on a worker thread and waited on for at most the fetch timeout, after which the stale
+ * location is returned and the cache is refreshed when the platform eventually answers.
+ */
 class LocationProviderEngineImpl
         : public aace::location::LocationProviderEngineInterface
         , public LocationServiceInterface {
 private:
-    LocationProviderEngineImpl(std::shared_ptr<aace::location::LocationProvider> platfromInterface);
+    LocationProviderEngineImpl(
+        std::shared_ptr<aace::location::LocationProvider> platformInterface,
+        std::chrono::milliseconds maxLocationAge,
+        std::chrono::milliseconds fetchTimeout);
 
 public:
+    /// Default age after which a cached location is fetched again from the platform.
+    static const std::chrono::milliseconds DEFAULT_MAX_LOCATION_AGE;
+
+    /// Default time to wait for the platform when the cached location is stale.
+    static const std::chrono::milliseconds DEFAULT_FETCH_TIMEOUT;
+
+    /**
+     * Creates a location provider engine implementation.
+     *
+     * @param platformInterface The platform location provider.
+     * @param maxLocationAge The age after which a cached location is stale. Zero disables the cache.
+     * @param fetchTimeout The time to wait for the platform to return a location.
+     */
     static std::shared_ptr<LocationProviderEngineImpl> create(
-        std::shared_ptr<aace::location::LocationProvider> platformInterface);
+        std::shared_ptr<aace::location::LocationProvider> platformInterface,
+        std::chrono::milliseconds maxLocationAge = DEFAULT_MAX_LOCATION_AGE,
+        std::chrono::milliseconds fetchTimeout = DEFAULT_FETCH_TIMEOUT);
     virtual ~LocationProviderEngineImpl() = default;
 
     // aace::engine::location::LocationServiceInterface
@@ -47,13 +76,32 @@ public:
 
     // LocationProviderEngineInterface
     virtual void onLocationServiceAccessChanged(LocationServiceAccess access) override;
+    virtual void onLocationChanged(const aace::location::Location& location) override;
 
     void shutdown();
 
 private:
+    /// Stores @c location as the current location. Only call this function on a thread holding @c m_cacheMutex.
+    void updateCacheLocked(const aace::location::Location& location);
+
     std::unordered_set<std::shared_ptr<LocationServiceObserverInterface>> m_observers;
-    std::shared_ptr<aace::location::LocationProvider> m_locationProviderPlatformInterface;
     std::mutex m_mutex;
+
+    const std::chrono::milliseconds m_maxLocationAge;
+    const std::chrono::milliseconds m_fetchTimeout;
+
+    /// Guards the platform interface and the cache.
+    std::mutex m_cacheMutex;
+    std::shared_ptr<aace::location::LocationProvider> m_locationProviderPlatformInterface;
+    aace::location::Location m_cachedLocation;
+    std::chrono::steady_clock::time_point m_cachedLocationTime;
+    bool m_hasCachedLocation;
+
+    /// The platform request in progress, shared by the callers waiting for it.
+    std::shared_future<aace::location::Location> m_pendingFetch;
+
+    /// Calls the platform. The executor must be declared last to be destructed first.
+    aace::engine::utils::threading::Executor m_executor;
 };
 
 }  // namespace location
@@ -51,7 +51,7 @@ protected:
     bool initialize() override;
     bool shutdown() override;
     bool configure() override;
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) override;
     bool setup() override;
     // bool start() override;
     // bool stop() override;
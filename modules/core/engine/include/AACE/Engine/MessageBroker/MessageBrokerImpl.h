@@ -24,6 +24,7 @@
 
 #include <AACE/Engine/Utils/Threading/Executor.h>
 
+#include "MessageTrafficRecorder.h"
 #include "PublishMessage.h"
 
 namespace aace {
@@ -79,6 +80,14 @@ public:
 
     void setMessageTimeout(const std::chrono::milliseconds& value);
 
+    /**
+     * Records every message published from now on, in both directions, including the replies to synchronous
+     * messages which are not delivered to subscribers.
+     *
+     * @param recorder The recorder, or @c nullptr to stop recording.
+     */
+    void setTrafficRecorder(std::shared_ptr<MessageTrafficRecorder> recorder);
+
     // MessageBrokerInterface
     void subscribe(
         const std::string& topic,
@@ -110,6 +119,9 @@ private:
 
     // message time out
     std::chrono::milliseconds m_timeout = std::chrono::milliseconds(500);
+
+    // records the published messages when traffic recording is enabled, accessed atomically
+    std::shared_ptr<MessageTrafficRecorder> m_trafficRecorder;
 };
 
 }  // namespace messageBroker
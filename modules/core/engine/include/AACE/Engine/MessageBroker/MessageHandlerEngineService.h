@@ -40,11 +40,14 @@ protected:
     bool isInterfaceEnabled(const std::string& name);
 
     // aace::core::EngineService
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) override;
     bool configure() override;
 
-    // configure the message interface
-    virtual bool configureMessageInterface(const std::string& name, bool enabled, std::istream& configuration);
+    // configure the message interface with its section of the service configuration
+    virtual bool configureMessageInterface(
+        const std::string& name,
+        bool enabled,
+        const aace::engine::utils::json::Value& configuration);
 
 public:
     virtual ~MessageHandlerEngineService() = default;
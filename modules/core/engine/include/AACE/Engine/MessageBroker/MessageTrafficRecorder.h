@@ -0,0 +1,109 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_MESSAGE_BROKER_MESSAGE_TRAFFIC_RECORDER_H
+#define AACE_ENGINE_MESSAGE_BROKER_MESSAGE_TRAFFIC_RECORDER_H
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <AACE/Engine/Utils/Threading/Executor.h>
+
+#include "Message.h"
+
+namespace aace {
+namespace engine {
+namespace messageBroker {
+
+/**
+ * Records the messages published to the message broker in both directions, with the time they were published,
+ * so the traffic of a session can be replayed with @c MessageTrafficReplayer.
+ *
+ * The recording has one JSON object per line:
+ * @code{.json}
+ * {"time":1520,"direction":"INCOMING","message":"<the message, as published>"}
+ * @endcode
+ * where @c time is the number of microseconds since the recorder was created. The lines are written on a
+ * separate thread, so recording does not delay the delivery of the messages.
+ *
+ * The messages are recorded verbatim, including the tokens and personal data they hold, so the Engine only enables
+ * recording from its configuration in debug builds with @c AAC_TRAFFIC_RECORDING_ENABLED defined. The recording
+ * stops when the file reaches its maximum size, which also bounds the messages waiting to be written.
+ */
+class MessageTrafficRecorder {
+public:
+    /// The default maximum size of a recording in bytes
+    static constexpr size_t DEFAULT_MAX_SIZE = 64 * 1024 * 1024;
+
+private:
+    MessageTrafficRecorder(const std::string& path, size_t maxSize);
+
+public:
+    /**
+     * Creates a recorder writing to a new file.
+     *
+     * @param path The path of the recording, which is replaced if it exists.
+     * @param maxSize The maximum size of the recording in bytes.
+     * @return The recorder, or @c nullptr if the file cannot be created.
+     */
+    static std::shared_ptr<MessageTrafficRecorder> create(
+        const std::string& path,
+        size_t maxSize = DEFAULT_MAX_SIZE);
+
+    ~MessageTrafficRecorder();
+
+    /**
+     * Records a message.
+     *
+     * @param direction The direction the message was published in.
+     * @param message The message.
+     */
+    void record(Message::Direction direction, const std::string& message);
+
+    /// Waits until the messages recorded so far are written to the file.
+    void flush();
+
+private:
+    /// Stops recording, and logs that the recording reached its maximum size.
+    void stop();
+
+    std::ofstream m_file;
+    const std::chrono::steady_clock::time_point m_startTime;
+
+    /// The maximum size of the recording in bytes
+    const size_t m_maxSize;
+
+    /// The size of the messages accepted for recording, which bounds the messages waiting to be written
+    std::atomic<size_t> m_acceptedSize;
+
+    /// The size of the recording written so far, or @c m_maxSize once a message is left out, accessed by
+    /// @c m_executor only
+    size_t m_writtenSize;
+
+    /// Whether the recording reached its maximum size
+    std::atomic<bool> m_stopped;
+
+    /// Writes the recorded messages in the order they were published
+    aace::engine::utils::threading::Executor m_executor;
+};
+
+}  // namespace messageBroker
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_MESSAGE_BROKER_MESSAGE_TRAFFIC_RECORDER_H
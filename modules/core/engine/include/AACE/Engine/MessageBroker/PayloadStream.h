@@ -0,0 +1,59 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_MESSAGE_BROKER_PAYLOAD_STREAM_H
+#define AACE_ENGINE_MESSAGE_BROKER_PAYLOAD_STREAM_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <AACE/Core/MessageStream.h>
+
+namespace aace {
+namespace engine {
+namespace messageBroker {
+
+/**
+ * Read only message stream which provides a payload that is too large to be embedded in a message.
+ * The payload is moved into the stream when it is created, and is not copied until it is read.
+ */
+class PayloadStream : public aace::core::MessageStream {
+private:
+    PayloadStream(std::string payload);
+
+public:
+    static std::shared_ptr<PayloadStream> create(std::string payload);
+
+    /// Returns the size of the payload.
+    size_t getSize() const;
+
+    // aace::core::MessageStream
+    ssize_t read(char* data, const size_t size) override;
+    ssize_t write(const char* data, const size_t size) override;
+    bool isClosed() override;
+    aace::core::MessageStream::Mode getMode() override;
+
+private:
+    const std::string m_payload;
+    std::mutex m_mutex;
+    size_t m_offset;
+};
+
+}  // namespace messageBroker
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_MESSAGE_BROKER_PAYLOAD_STREAM_H
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_MESSAGE_BROKER_PAYLOAD_STREAM_CHANNEL_H
+#define AACE_ENGINE_MESSAGE_BROKER_PAYLOAD_STREAM_CHANNEL_H
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "StreamManagerInterface.h"
+
+namespace aace {
+namespace engine {
+namespace messageBroker {
+
+/**
+ * Sends large outgoing payloads, such as APL documents, through the stream manager instead of embedding
+ * them in a message. The message only references the id of the stream, so its size does not depend on the
+ * payload, and the payload is neither escaped nor parsed again by the message broker. The platform opens
+ * the stream with @c MessageBroker::openStream() in @c READ mode and reads it to the end.
+ *
+ * Streams which the platform does not open are removed, oldest first, once they hold more than the
+ * maximum number of pending bytes.
+ */
+class PayloadStreamChannel {
+private:
+    PayloadStreamChannel(
+        std::shared_ptr<StreamManagerInterface> streamManager,
+        size_t threshold,
+        size_t maxPendingBytes);
+
+public:
+    /// The default maximum size of the payloads in streams which have not been opened.
+    static const size_t DEFAULT_MAX_PENDING_BYTES;
+
+    /**
+     * Creates a channel.
+     *
+     * @param streamManager The stream manager the streams are registered with.
+     * @param threshold The size from which payloads are sent through a stream.
+     * @param maxPendingBytes The maximum size of the payloads in streams which have not been opened.
+     * @return The channel, or @c nullptr if @c threshold is 0.
+     */
+    static std::shared_ptr<PayloadStreamChannel> create(
+        std::shared_ptr<StreamManagerInterface> streamManager,
+        size_t threshold,
+        size_t maxPendingBytes = DEFAULT_MAX_PENDING_BYTES);
+
+    /**
+     * Moves a payload into a new stream if it is at least as large as the threshold.
+     *
+     * @param [in,out] payload The payload, which is cleared if it was moved into a stream.
+     * @return The id of the stream, or an empty string if the payload should be embedded in the message.
+     */
+    std::string send(std::string& payload);
+
+private:
+    std::weak_ptr<StreamManagerInterface> m_streamManager;
+    const size_t m_threshold;
+    const size_t m_maxPendingBytes;
+
+    std::mutex m_mutex;
+
+    /// Ids and sizes of the streams which may not have been opened yet, oldest first.
+    std::deque<std::pair<std::string, size_t>> m_pendingStreams;
+    size_t m_pendingBytes;
+};
+
+}  // namespace messageBroker
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_MESSAGE_BROKER_PAYLOAD_STREAM_CHANNEL_H
@@ -45,6 +45,7 @@ public:
     std::shared_ptr<aace::core::MessageStream> requestStreamHandler(
         const std::string& streamId,
         aace::core::MessageStream::Mode mode) override;
+    bool unregisterStreamHandler(const std::string& streamId) override;
 
 private:
     std::unordered_map<std::string, std::shared_ptr<aace::core::MessageStream>> m_streamMap;
@@ -34,6 +34,9 @@ public:
     virtual std::shared_ptr<aace::core::MessageStream> requestStreamHandler(
         const std::string& streamId,
         aace::core::MessageStream::Mode mode) = 0;
+
+    // removes a stream which has not been requested, returning false if there is no such stream
+    virtual bool unregisterStreamHandler(const std::string& streamId) = 0;
 };
 
 }  // namespace messageBroker
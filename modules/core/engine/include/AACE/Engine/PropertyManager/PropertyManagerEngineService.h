@@ -22,6 +22,7 @@
 #include "PropertyDescription.h"
 #include "PropertyManagerEngineImpl.h"
 #include "PropertyManagerServiceInterface.h"
+#include "PropertyStore.h"
 
 namespace aace {
 namespace engine {
@@ -72,8 +73,17 @@ private:
     bool registerPlatformInterfaceType(std::shared_ptr<aace::propertyManager::PropertyManager> propertyManager);
 
     // Notifies all the listeners about the property change by calling
-    // propertyChanged() on every PropertyListenerInterface.
-    void notifyPropertyChangeListeners(const std::string& key, const std::string& propertyValue);
+    // propertyChanged() on every PropertyListenerInterface. The notification
+    // is delivered asynchronously with the latest value of the property, so
+    // several changes made before it is delivered are notified once.
+    void notifyPropertyChangeListeners(const std::string& name);
+
+    // Delivers the pending notification of a property change to the listeners.
+    void deliverPropertyChange(const std::string& name);
+
+    // Returns the value of a property read from its owner after it was set to
+    // @c value, or @c value if the property has no getter.
+    std::string getOwnerValue(const std::string& name, const std::string& value);
 
     // Notifies the platform and listeners about a successful set property
     // operation. Expects m_propertyManagerEngineImpl to be not null.
@@ -94,14 +104,19 @@ private:
 
     // Map to store property name and the set of listeners for that property.
     // The property owner is responsible for adding itself as a listener to the
-    // property upon which it depends.
-    std::unordered_map<std::string, std::unordered_set<std::shared_ptr<PropertyListenerInterface>>>
-        m_propertyListenerMap;
+    // property upon which it depends. The sets are replaced rather than modified,
+    // so a notification only holds the lock to get the current set.
+    using ListenerSet = std::unordered_set<std::shared_ptr<PropertyListenerInterface>>;
+    std::unordered_map<std::string, std::shared_ptr<const ListenerSet>> m_propertyListenerMap;
 
     std::mutex m_listenerMutex;
+
+    // The current value of each registered property, and its pending notification
+    PropertyStore m_propertyStore;
     std::shared_ptr<PropertyManagerEngineImpl> m_propertyManagerEngineImpl;
 
     aace::engine::utils::threading::Executor m_executor;
+    aace::engine::utils::threading::Executor m_notificationExecutor;
 };
 
 }  // namespace propertyManager
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_PROPERTY_MANAGER_PROPERTY_STORE_H
+#define AACE_ENGINE_PROPERTY_MANAGER_PROPERTY_STORE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace aace {
+namespace engine {
+namespace propertyManager {
+
+/**
+ * Keeps the current value of each registered property, so the value can be read without calling the getter of the
+ * property owner, and tracks the change notifications pending for each property, so a burst of changes to a
+ * property is notified once with its latest value.
+ *
+ * Each value is immutable and replaced atomically, so reading and setting values are lock-free. Properties are
+ * added while the Engine initializes and removed when it shuts down, so @c add() and @c clear() must not be called
+ * concurrently with the other functions.
+ */
+class PropertyStore {
+public:
+    /// A value of a property
+    struct Value {
+        /// The property value
+        std::string value;
+
+        /// The version of the value, incremented by each change to the property starting from 1
+        uint64_t version;
+    };
+
+    /**
+     * Adds a property without a value.
+     *
+     * @param [in] name The name of the property.
+     * @return @c true if the property was added, else @c false if it was already added.
+     */
+    bool add(const std::string& name);
+
+    /**
+     * Returns the current value of a property.
+     *
+     * @param [in] name The name of the property.
+     * @return The current value, or @c nullptr if the property was not added or has no value.
+     */
+    std::shared_ptr<const Value> get(const std::string& name) const;
+
+    /**
+     * Sets the value of a property, and increments its version.
+     *
+     * @param [in] name The name of the property.
+     * @param [in] value The new value.
+     * @return The new value, or @c nullptr if the property was not added.
+     */
+    std::shared_ptr<const Value> set(const std::string& name, const std::string& value);
+
+    /**
+     * Sets the value of a property if it has no value yet, so a value read from the property owner does not replace
+     * a value set concurrently.
+     *
+     * @param [in] name The name of the property.
+     * @param [in] value The value read from the property owner.
+     * @return The current value, or @c nullptr if the property was not added.
+     */
+    std::shared_ptr<const Value> setIfEmpty(const std::string& name, const std::string& value);
+
+    /**
+     * Marks a change notification as pending for a property.
+     *
+     * @param [in] name The name of the property.
+     * @return @c true if the caller must schedule the notification, else @c false if one is already pending and will
+     *         notify the latest value.
+     */
+    bool requestNotification(const std::string& name);
+
+    /**
+     * Clears the pending change notification of a property, and returns the value to notify. Must be called from a
+     * single thread, which notifies the values in order.
+     *
+     * @param [in] name The name of the property.
+     * @return The value to notify, or @c nullptr if the current value was already notified.
+     */
+    std::shared_ptr<const Value> takeNotification(const std::string& name);
+
+    /// Removes all the properties.
+    void clear();
+
+private:
+    struct Entry {
+        std::shared_ptr<const Value> value;
+        std::atomic<bool> notificationPending{false};
+        std::atomic<uint64_t> notifiedVersion{0};
+    };
+
+    Entry* getEntry(const std::string& name) const;
+
+    std::unordered_map<std::string, std::unique_ptr<Entry>> m_entries;
+};
+
+}  // namespace propertyManager
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_PROPERTY_MANAGER_PROPERTY_STORE_H
@@ -34,7 +34,7 @@ public:
     virtual ~StorageEngineService() = default;
 
 protected:
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) override;
 
 private:
     std::shared_ptr<LocalStorageInterface> m_localStorage;
@@ -0,0 +1,140 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_UTILS_AUDIO_ENERGY_GATE_H
+#define AACE_ENGINE_UTILS_AUDIO_ENERGY_GATE_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace audio {
+
+/**
+ * Frame energy gate for mono 16-bit PCM, used in front of a wakeword engine to skip frames that are too
+ * quiet to contain speech.
+ *
+ * The gate opens when a frame reaches the open threshold, and closes only after the level has stayed
+ * below the lower close threshold for the hangover time. While the gate is closed, the most recent
+ * audio is kept as pre-roll and delivered ahead of the frame that opens the gate, so the consumer sees
+ * the onset of the sound that opened it. An @c EnergyGate instance is not thread safe.
+ */
+class EnergyGate {
+public:
+    /**
+     * Gate parameters. Thresholds are frame RMS levels in dBFS, where a full scale sine wave is -3 dBFS.
+     */
+    struct Configuration {
+        /// Level at or above which a closed gate opens.
+        float openThreshold = -50.0f;
+        /// Level below which an open gate starts its hangover. Must not be above @c openThreshold.
+        float closeThreshold = -55.0f;
+        /// Time the level must stay below @c closeThreshold before the gate closes.
+        std::chrono::milliseconds hangover = std::chrono::milliseconds(1000);
+        /// Amount of audio preceding the opening frame that is delivered when the gate opens.
+        std::chrono::milliseconds preRoll = std::chrono::milliseconds(500);
+        /// Length of the analysis frame.
+        std::chrono::milliseconds frameDuration = std::chrono::milliseconds(10);
+    };
+
+    /// Receives the audio that passes the gate.
+    using Writer = std::function<void(const int16_t* samples, size_t count)>;
+
+private:
+    EnergyGate(unsigned int sampleRate, const Configuration& configuration);
+
+public:
+    /**
+     * Creates an energy gate.
+     *
+     * @param sampleRate The sample rate of the audio in Hz.
+     * @param configuration The gate parameters.
+     * @return The new gate, or @c nullptr if the parameters are invalid.
+     */
+    static std::unique_ptr<EnergyGate> create(unsigned int sampleRate, const Configuration& configuration);
+
+    /**
+     * Processes a block of audio, and passes the audio that is not gated to @c writer, in order. Frames
+     * are analyzed across calls, so consecutive blocks may have any size.
+     *
+     * @param samples The input samples.
+     * @param count The number of input samples.
+     * @param writer Called with each contiguous run of audio that passes the gate.
+     */
+    void process(const int16_t* samples, size_t count, const Writer& writer);
+
+    /**
+     * Closes the gate and discards the pre-roll and any partial frame.
+     */
+    void reset();
+
+    /// Returns @c true if the gate is open.
+    bool isOpen() const;
+
+    /// Returns the number of samples passed to the writer since creation.
+    uint64_t getPassedSampleCount() const;
+
+    /// Returns the number of samples dropped by the gate since creation.
+    uint64_t getGatedSampleCount() const;
+
+private:
+    /// Analyzes the buffered frame and passes or holds it.
+    void processFrame(const Writer& writer);
+
+    /// Appends the buffered frame to the pre-roll ring, replacing the oldest samples.
+    void holdFrame();
+
+    /// Passes the pre-roll ring to @c writer and empties it.
+    void flushPreRoll(const Writer& writer);
+
+    /// Squared linear amplitude corresponding to @c Configuration::openThreshold.
+    const double m_openPower;
+
+    /// Squared linear amplitude corresponding to @c Configuration::closeThreshold.
+    const double m_closePower;
+
+    /// Hangover in samples.
+    const size_t m_hangoverSamples;
+
+    /// Analysis frame being accumulated.
+    std::vector<int16_t> m_frame;
+    size_t m_frameCount;
+
+    /// Circular pre-roll buffer, with the oldest sample at @c m_preRollStart.
+    std::vector<int16_t> m_preRoll;
+    size_t m_preRollStart;
+    size_t m_preRollCount;
+
+    bool m_open;
+
+    /// Samples remaining before an open gate closes.
+    size_t m_hangoverRemaining;
+
+    uint64_t m_passedSamples;
+    uint64_t m_gatedSamples;
+};
+
+}  // namespace audio
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_UTILS_AUDIO_ENERGY_GATE_H
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_UTILS_AUDIO_PCM_H
+#define AACE_ENGINE_UTILS_AUDIO_PCM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace audio {
+
+/**
+ * PCM processing kernels used by the engine audio path.
+ *
+ * Every kernel has a portable scalar implementation, and SSE2, AVX2 (x86) or NEON (ARM) implementations
+ * which are selected at runtime based on the features supported by the CPU. Samples are interleaved
+ * signed 16-bit linear PCM unless stated otherwise, and all kernels accept unaligned buffers.
+ */
+namespace pcm {
+
+/**
+ * Describes the instruction set used by the PCM kernels.
+ */
+enum class SimdLevel {
+    /// Portable C++ implementation.
+    SCALAR,
+    /// x86 SSE2 implementation.
+    SSE2,
+    /// x86 AVX2 implementation.
+    AVX2,
+    /// ARM NEON implementation.
+    NEON
+};
+
+/**
+ * Returns the best instruction set supported by the current CPU.
+ */
+SimdLevel getSupportedSimdLevel();
+
+/**
+ * Returns the instruction set currently used by the PCM kernels.
+ */
+SimdLevel getSimdLevel();
+
+/**
+ * Overrides the instruction set used by the PCM kernels. This is intended for testing and benchmarking.
+ *
+ * @param level The requested instruction set.
+ * @return @c true if @c level is supported by the current CPU and was selected, otherwise @c false.
+ */
+bool setSimdLevel(SimdLevel level);
+
+/**
+ * Returns the printable name of a @c SimdLevel.
+ */
+std::string toString(SimdLevel level);
+
+/**
+ * Converts a raw byte stream to native 16-bit samples. The source buffer may have any alignment, and a
+ * trailing odd byte is ignored.
+ *
+ * @param data The raw PCM bytes.
+ * @param size The number of bytes in @c data.
+ * @param samples The destination buffer, which must hold at least @c size / 2 samples.
+ * @return The number of samples written to @c samples.
+ */
+size_t bytesToInt16(const char* data, size_t size, int16_t* samples);
+
+/**
+ * Converts 16-bit samples to floating point samples in the range [-1.0, 1.0).
+ */
+void int16ToFloat(const int16_t* src, float* dst, size_t count);
+
+/**
+ * Converts floating point samples in the range [-1.0, 1.0] to 16-bit samples, rounding to nearest and
+ * saturating values outside of the range.
+ */
+void floatToInt16(const float* src, int16_t* dst, size_t count);
+
+/**
+ * Applies a constant gain to the samples in place, saturating on overflow.
+ *
+ * @param samples The samples to process.
+ * @param count The number of samples.
+ * @param gain The linear gain factor.
+ */
+void applyGain(int16_t* samples, size_t count, float gain);
+
+/**
+ * Applies a linear gain ramp to interleaved frames in place, saturating on overflow. All of the channels
+ * in a frame receive the same gain. This is used for ducking and fading without audible zipper noise.
+ *
+ * @param samples The interleaved samples to process.
+ * @param frames The number of frames in @c samples.
+ * @param channels The number of channels per frame.
+ * @param startGain The gain applied to the first frame.
+ * @param endGain The gain that would be applied to the frame following the last frame.
+ */
+void applyGainRamp(int16_t* samples, size_t frames, size_t channels, float startGain, float endGain);
+
+/**
+ * Mixes interleaved multi-channel frames down to mono by averaging the channels.
+ *
+ * @param src The interleaved source samples.
+ * @param dst The destination buffer, which must hold at least @c frames samples. It may alias @c src.
+ * @param frames The number of frames in @c src.
+ * @param channels The number of channels per frame.
+ */
+void downmixToMono(const int16_t* src, int16_t* dst, size_t frames, size_t channels);
+
+/**
+ * Computes the dot product of two floating point vectors.
+ */
+float dotProduct(const float* a, const float* b, size_t count);
+
+}  // namespace pcm
+}  // namespace audio
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_UTILS_AUDIO_PCM_H
@@ -0,0 +1,112 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_UTILS_AUDIO_RESAMPLER_H
+#define AACE_ENGINE_UTILS_AUDIO_RESAMPLER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace audio {
+
+/**
+ * Streaming rational sample rate converter for mono 16-bit PCM, implemented as a polyphase
+ * windowed-sinc FIR filter. The filter dot products use the runtime dispatched PCM kernels.
+ *
+ * Typical use is converting 48 kHz or 44.1 kHz capture or playback audio to the 16 kHz format
+ * expected by the wakeword engine and the cloud. A @c Resampler instance is not thread safe.
+ */
+class Resampler {
+private:
+    Resampler(unsigned int inputRate, unsigned int outputRate, unsigned int interpolation, unsigned int decimation);
+
+public:
+    /**
+     * Creates a resampler.
+     *
+     * @param inputRate The sample rate of the input audio in Hz.
+     * @param outputRate The sample rate of the output audio in Hz.
+     * @return The new resampler, or @c nullptr if the rates are invalid or their ratio is too complex.
+     */
+    static std::unique_ptr<Resampler> create(unsigned int inputRate, unsigned int outputRate);
+
+    /**
+     * Resamples a block of audio. Filter state is kept between calls, so consecutive blocks of
+     * a stream may have any size.
+     *
+     * @param input The input samples.
+     * @param inputCount The number of input samples.
+     * @param output The output buffer.
+     * @param outputCapacity The number of samples @c output can hold, which must be at least
+     *        @c getMaxOutputCount(inputCount).
+     * @param [out] outputCount The number of samples written to @c output.
+     * @return @c true if the block was resampled, or @c false if @c outputCapacity is too small, in which
+     *         case the input is not consumed and nothing is written to @c output.
+     */
+    bool process(const int16_t* input, size_t inputCount, int16_t* output, size_t outputCapacity, size_t& outputCount);
+
+    /**
+     * Returns the maximum number of output samples produced by @c process() for @c inputCount input samples.
+     */
+    size_t getMaxOutputCount(size_t inputCount) const;
+
+    /**
+     * Clears the filter history so the next call to @c process() starts a new stream.
+     */
+    void reset();
+
+    unsigned int getInputRate() const;
+    unsigned int getOutputRate() const;
+
+private:
+    const unsigned int m_inputRate;
+    const unsigned int m_outputRate;
+
+    /// Upsampling factor L of the rational conversion L/M.
+    const unsigned int m_interpolation;
+
+    /// Downsampling factor M of the rational conversion L/M.
+    const unsigned int m_decimation;
+
+    /// Number of filter taps per polyphase branch.
+    size_t m_tapsPerPhase;
+
+    /// Filter coefficients, stored per phase and reversed so each branch is a contiguous dot product.
+    std::vector<float> m_coefficients;
+
+    /// Input history followed by the current block, as floating point samples.
+    std::vector<float> m_buffer;
+
+    /// Index in @c m_buffer of the newest input sample used by the next output sample.
+    size_t m_inputIndex;
+
+    /// Polyphase branch used by the next output sample.
+    unsigned int m_phase;
+
+    /// Scratch buffer for the filtered output.
+    std::vector<float> m_output;
+};
+
+}  // namespace audio
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_UTILS_AUDIO_RESAMPLER_H
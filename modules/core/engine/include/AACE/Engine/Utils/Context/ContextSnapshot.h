@@ -0,0 +1,118 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_UTILS_CONTEXT_CONTEXT_SNAPSHOT_H
+#define AACE_ENGINE_UTILS_CONTEXT_CONTEXT_SNAPSHOT_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace context {
+
+/**
+ * Holds the latest context state pushed by the platform, so that a context provider can answer
+ * @c provideState() without a synchronous call to the platform.
+ *
+ * Each fragment is stored under a key chosen by the provider, such as a namespace or a player id, in
+ * the form the provider reports it: the platform state is validated and converted once when it is
+ * pushed, not every time context is requested. A provider should fall back to querying the platform
+ * for keys that have never been pushed. All functions are thread safe.
+ *
+ * @tparam Fragment The pre-validated, pre-serialized state reported in context.
+ */
+template <typename Fragment>
+class ContextSnapshot {
+public:
+    ContextSnapshot() : m_version(0) {
+    }
+
+    /**
+     * Stores the fragment for a key, replacing the previous one.
+     *
+     * @param key The key of the fragment.
+     * @param fragment The new fragment.
+     * @return The version of the stored fragment, which increases with every update of the snapshot.
+     */
+    uint64_t update(const std::string& key, Fragment fragment) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& entry = m_entries[key];
+        entry.first = ++m_version;
+        entry.second = std::move(fragment);
+        return entry.first;
+    }
+
+    /**
+     * Returns the fragment for a key.
+     *
+     * @param key The key of the fragment.
+     * @param [out] fragment The fragment, which is not modified if the key has never been pushed.
+     * @param [out] version The version of the fragment, if requested.
+     * @return @c true if a fragment is available for @c key.
+     */
+    bool get(const std::string& key, Fragment& fragment, uint64_t* version = nullptr) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(key);
+        if (it == m_entries.end()) {
+            return false;
+        }
+        fragment = it->second.second;
+        if (version != nullptr) {
+            *version = it->second.first;
+        }
+        return true;
+    }
+
+    /**
+     * Returns whether a fragment is available for a key.
+     */
+    bool contains(const std::string& key) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_entries.find(key) != m_entries.end();
+    }
+
+    /**
+     * Removes the fragment for a key, so that the provider queries the platform again.
+     */
+    void remove(const std::string& key) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.erase(key);
+    }
+
+    /**
+     * Removes all fragments.
+     */
+    void clear() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.clear();
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, std::pair<uint64_t, Fragment>> m_entries;
+    uint64_t m_version;
+};
+
+}  // namespace context
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_UTILS_CONTEXT_CONTEXT_SNAPSHOT_H
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_UTILS_EVENT_EVENT_BUILDER_H_
+#define AACE_ENGINE_UTILS_EVENT_EVENT_BUILDER_H_
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace event {
+
+/*
+ * Functions composing events and context from JSON fragments, which are written to the event as they are.
+ * The fragments must be valid JSON: they are not parsed again when they are composed.
+ */
+
+/**
+ * Appends a string to a buffer as a JSON string, escaping it.
+ *
+ * @param buffer The buffer.
+ * @param value The string to append.
+ */
+void appendString(std::string& buffer, const std::string& value);
+
+/**
+ * Appends the state of an interface to a buffer, in the form reported in the context of an event:
+ * @code{.json}
+ * {"header":{"namespace":"<nameSpace>","name":"<name>"},"payload":<payload>}
+ * @endcode
+ *
+ * @param buffer The buffer.
+ * @param nameSpace The namespace of the interface.
+ * @param name The name of the state.
+ * @param payload The serialized state.
+ */
+void appendContextState(
+    std::string& buffer,
+    const std::string& nameSpace,
+    const std::string& name,
+    const std::string& payload);
+
+/**
+ * Builds an event from its serialized payload and context:
+ * @code{.json}
+ * {"context":<context>,"event":{"header":{"namespace":...,"name":...,"messageId":...},"payload":<payload>}}
+ * @endcode
+ *
+ * @param nameSpace The namespace of the event.
+ * @param name The name of the event.
+ * @param dialogRequestId The dialog request id of the event, which is not added to the header if empty.
+ * @param payload The serialized payload of the event.
+ * @param context The serialized context of the event, which is not added to the event if empty.
+ * @return The message id and the event.
+ */
+std::pair<std::string, std::string> buildEvent(
+    const std::string& nameSpace,
+    const std::string& name,
+    const std::string& dialogRequestId,
+    const std::string& payload,
+    const std::string& context = "");
+
+/**
+ * Returns the serialized members of a JSON object, as they are in the object, without building a document.
+ * The object is validated while it is read, and values nested deeper than 256 levels are rejected.
+ *
+ * @param object The serialized JSON object.
+ * @param [in,out] members The names of the members to return, for which the serialized values are set. The
+ *        values of the members which are not in the object are not modified. Names are compared as they are
+ *        serialized, so a member with escape sequences in its name is not returned.
+ * @return @c true if @c object is a valid JSON object.
+ */
+bool getMembers(const std::string& object, std::unordered_map<std::string, std::string>& members);
+
+}  // namespace event
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_UTILS_EVENT_EVENT_BUILDER_H_
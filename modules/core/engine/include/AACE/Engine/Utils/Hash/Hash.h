@@ -0,0 +1,48 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_UTILS_HASH_HASH_H_
+#define AACE_ENGINE_UTILS_HASH_HASH_H_
+
+#include <cstdint>
+#include <string>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace hash {
+
+/// The offset basis of the 64-bit FNV-1a hash, which is the hash of no data
+static constexpr uint64_t FNV1A_OFFSET_BASIS = 14695981039346656037ULL;
+
+/**
+ * Computes the 64-bit FNV-1a hash of @c data. It is not a cryptographic hash, and it only detects changes to data
+ * which is not chosen to collide, such as the contents of documents or configuration files.
+ *
+ * @param data The data to hash.
+ * @param hash The hash to continue, to hash several strings in sequence.
+ * @return The hash of the data.
+ */
+uint64_t fnv1a(const std::string& data, uint64_t hash = FNV1A_OFFSET_BASIS);
+
+/// Returns the 16 lowercase hexadecimal digits of a 64-bit hash.
+std::string toHex(uint64_t hash);
+
+}  // namespace hash
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_UTILS_HASH_HASH_H_
@@ -79,7 +79,7 @@ protected:
     /// @{
     bool initialize() override;
     bool setup() override;
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) override;
     /// @}
 
     /**
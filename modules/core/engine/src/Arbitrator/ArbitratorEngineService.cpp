@@ -33,13 +33,10 @@ ArbitratorEngineService::ArbitratorEngineService(const aace::engine::core::Servi
         aace::engine::core::EngineService(description) {
 }
 
-bool ArbitratorEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool ArbitratorEngineService::configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) {
     AACE_INFO(LX(TAG));
     try {
-        json jconfiguration;
-        jconfiguration = json::parse(*configuration);
-
-        m_arbitratorConfig = jconfiguration.dump();
+        m_arbitratorConfig = configuration->dump();
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
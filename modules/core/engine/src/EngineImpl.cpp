@@ -42,6 +42,9 @@ namespace json = aace::engine::utils::json;
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.core.EngineImpl");
 
+/// The number of services configured, pre-registered or started at the same time.
+static const size_t MAX_SERVICE_THREADS = 4;
+
 std::shared_ptr<EngineImpl> EngineImpl::create() {
     try {
         auto engine = std::shared_ptr<EngineImpl>(new EngineImpl());
@@ -65,6 +68,7 @@ EngineImpl::~EngineImpl() {
 
 bool EngineImpl::initialize() {
     try {
+        LifecycleTracer::Span span(m_tracer, "Engine.initialize", "engine");
         AACE_INFO(LX(TAG).d("engineVersion", aace::engine::core::version::getEngineVersion()));
 #ifndef NO_SIGPIPE
         AACE_VERBOSE(LX(TAG).d("signal", "SIGPIPE").d("value", "SIG_IGN"));
@@ -74,8 +78,12 @@ bool EngineImpl::initialize() {
         ThrowIf(m_initialized, "engineAlreadyInitialized");
         ThrowIfNot(checkServices(), "checkServicesFailed");
 
+        m_serviceScheduler = EngineServiceScheduler::create(m_orderedServiceList, MAX_SERVICE_THREADS);
+        ThrowIfNull(m_serviceScheduler, "createServiceSchedulerFailed");
+
         // iterate through registered engine services and call initialize() for each module
         for (auto next : m_orderedServiceList) {
+            LifecycleTracer::Span serviceSpan(m_tracer, next->getDescription().getType(), "initialize");
             ThrowIfNot(next->handleInitializeEngineEvent(shared_from_this()), "handleInitializeEngineEventFailed");
         }
 
@@ -125,10 +133,12 @@ bool EngineImpl::shutdown() {
         }
 
         AACE_DEBUG(LX(TAG).m("EngineShutdown"));
+        auto shutdownTime = LifecycleTracer::Clock::now();
 
         // iterate through registered engine services and call shutdown() for each module
         for (auto next : m_orderedServiceList) {
             AACE_DEBUG(LX(TAG).m(next->getDescription().getType()));
+            LifecycleTracer::Span serviceSpan(m_tracer, next->getDescription().getType(), "shutdown");
 
             // if shutting down the service failed throw an error but continue with
             // shutting down remaining services
@@ -139,7 +149,11 @@ bool EngineImpl::shutdown() {
             }
         }
 
+        m_tracer.addEvent("Engine.shutdown", "engine", shutdownTime, LifecycleTracer::Clock::now());
+        writeLifecycleTrace();
+
         // reset the engine state
+        m_serviceScheduler.reset();
         m_orderedServiceList.clear();
         m_registeredServiceMap.clear();
         m_initialized = false;
@@ -170,6 +184,7 @@ bool EngineImpl::configure(
 bool EngineImpl::configure(std::vector<std::shared_ptr<aace::core::config::EngineConfiguration>> configurationList) {
     try {
         AACE_DEBUG(LX(TAG).m("EngineConfigure"));
+        LifecycleTracer::Span span(m_tracer, "Engine.configure", "engine");
 
         ThrowIfNot(m_initialized, "engineNotInitialized");
         ThrowIf(m_running, "engineRunning");
@@ -192,26 +207,49 @@ bool EngineImpl::configure(std::vector<std::shared_ptr<aace::core::config::Engin
             ThrowIfNot(aace::engine::utils::json::merge(mergedConfiguration, nextConfig), "mergeConfigurationFailed");
         }
 
-        // iterate through registered engine services and call configure() for each module
+        // the path the lifecycle trace is written to, if any
+        auto engineConfiguration = mergedConfiguration.find("aace.engine");
+        if (engineConfiguration != mergedConfiguration.end() && engineConfiguration->is_object()) {
+            auto lifecycleTracePath = engineConfiguration->find("lifecycleTracePath");
+            if (lifecycleTracePath != engineConfiguration->end()) {
+                ThrowIfNot(lifecycleTracePath->is_string(), "invalidLifecycleTracePath");
+                m_lifecycleTracePath = lifecycleTracePath->get<std::string>();
+            }
+        }
+
+        // call configure() for each module, once the modules it depends on are configured
         if (mergedConfiguration.is_null() == false) {
+            // each service gets its section of the merged configuration without copying or serializing it, and the
+            // sections keep the merged configuration alive for the services holding on to them
+            auto configuration = std::make_shared<const json::Value>(std::move(mergedConfiguration));
+            std::vector<std::shared_ptr<const json::Value>> serviceConfigList;
             for (auto nextService : m_orderedServiceList) {
-                auto serviceConfig =
-                    json::get(mergedConfiguration, nextService->getDescription().getType(), json::Type::object);
-                ThrowIfNot(
-                    nextService->handleConfigureEngineEvent(
-                        serviceConfig != nullptr ? json::toStream(serviceConfig) : nullptr),
-                    "Service failed to configure: " + nextService->getDescription().getType());
+                auto it = configuration->find(nextService->getDescription().getType());
+                if (it != configuration->end() && it->is_object()) {
+                    serviceConfigList.push_back(std::shared_ptr<const json::Value>(configuration, &*it));
+                } else {
+                    if (it != configuration->end()) {
+                        AACE_ERROR(LX(TAG)
+                                       .m("invalidServiceConfiguration")
+                                       .d("service", nextService->getDescription().getType()));
+                    }
+                    serviceConfigList.push_back(nullptr);
+                }
             }
+
+            runServiceStage("configure", [this, &serviceConfigList](size_t index) {
+                return m_orderedServiceList[index]->handleConfigureEngineEvent(serviceConfigList[index]);
+            });
         } else {
             AACE_ERROR(LX(TAG).m("nullMergedConfiguration"));
         }
 
         m_configured = true;
 
-        // iterate through registered engine modules and call handlePreRegisterEngineEvent() for each module
-        for (auto next : m_orderedServiceList) {
-            ThrowIfNot(next->handlePreRegisterEngineEvent(), "handlePreRegisterEngineEvent");
-        }
+        // call handlePreRegisterEngineEvent() for each module, once the modules it depends on are pre-registered
+        runServiceStage("preRegister", [this](size_t index) {
+            return m_orderedServiceList[index]->handlePreRegisterEngineEvent();
+        });
 
         return true;
     } catch (std::exception& ex) {
@@ -331,6 +369,7 @@ bool EngineImpl::start() {
     try {
         AACE_DEBUG(LX(TAG).m("EngineStart"));
         CORE_METRIC(LX(TAG), aace::engine::core::CoreMetrics::Location::ENGINE_START_BEGIN);
+        auto startTime = LifecycleTracer::Clock::now();
 
         ThrowIf(m_running, "engineAlreadyRunning");
         ThrowIfNot(m_initialized, "engineNotInitialized");
@@ -340,11 +379,13 @@ bool EngineImpl::start() {
         if (m_setup == false) {
             // iterate through registered engine modules and call handlePostRegisterEngineEvent() for each module
             for (auto next : m_orderedServiceList) {
+                LifecycleTracer::Span serviceSpan(m_tracer, next->getDescription().getType(), "postRegister");
                 ThrowIfNot(next->handlePostRegisterEngineEvent(), "handlePostRegisterEngineEvent");
             }
 
             // iterate through registered engine modules and call handleSetupEngineEvent() for each module
             for (auto next : m_orderedServiceList) {
+                LifecycleTracer::Span serviceSpan(m_tracer, next->getDescription().getType(), "setup");
                 ThrowIfNot(next->handleSetupEngineEvent(), "handleSetupEngineEventFailed");
             }
 
@@ -352,13 +393,14 @@ bool EngineImpl::start() {
             m_setup = true;
         }
 
-        // iterate through registered engine modules and call handleStartEngineEvent() for each module
-        for (auto next : m_orderedServiceList) {
-            ThrowIfNot(next->handleStartEngineEvent(), "handleStartEngineEventFailed");
-        }
+        // call handleStartEngineEvent() for each module, once the modules it depends on are started
+        runServiceStage("start", [this](size_t index) {
+            return m_orderedServiceList[index]->handleStartEngineEvent();
+        });
 
         // iterate through registered engine services and call handleEngineStartedEngineEvent() for each service
         for (auto next : m_orderedServiceList) {
+            LifecycleTracer::Span serviceSpan(m_tracer, next->getDescription().getType(), "engineStarted");
             ThrowIfNot(next->handleEngineStartedEngineEvent(), "handleEngineStartedEngineEventFailed");
         }
 
@@ -366,6 +408,8 @@ bool EngineImpl::start() {
         m_running = true;
 
         CORE_METRIC(LX(TAG), aace::engine::core::CoreMetrics::Location::ENGINE_START_END);
+        m_tracer.addEvent("Engine.start", "engine", startTime, LifecycleTracer::Clock::now());
+        writeLifecycleTrace();
         return true;
     } catch (std::exception& ex) {
         CORE_METRIC(LX(TAG), aace::engine::core::CoreMetrics::Location::ENGINE_START_EXCEPTION);
@@ -378,6 +422,7 @@ bool EngineImpl::stop() {
     try {
         AACE_DEBUG(LX(TAG).m("EngineStop"));
         CORE_METRIC(LX(TAG), aace::engine::core::CoreMetrics::Location::ENGINE_STOP_BEGIN);
+        LifecycleTracer::Span span(m_tracer, "Engine.stop", "engine");
 
         if (m_running == false) {
             AACE_WARN(LX(TAG).m("Attempting to stop engine that is not running - doing nothing."));
@@ -386,11 +431,13 @@ bool EngineImpl::stop() {
 
         // iterate through registered engine modules and call stop() for each module
         for (auto next : m_orderedServiceList) {
+            LifecycleTracer::Span serviceSpan(m_tracer, next->getDescription().getType(), "stop");
             ThrowIfNot(next->handleStopEngineEvent(), "handleStopEngineEventFailed");
         }
 
         // iterate through registered engine services and call engineStopped() for each service
         for (auto next : m_orderedServiceList) {
+            LifecycleTracer::Span serviceSpan(m_tracer, next->getDescription().getType(), "engineStopped");
             ThrowIfNot(next->handleEngineStoppedEngineEvent(), "handleEngineStoppedEngineEventFailed");
         }
 
@@ -406,6 +453,25 @@ bool EngineImpl::stop() {
     }
 }
 
+void EngineImpl::runServiceStage(const std::string& stage, EngineServiceScheduler::StageFunction function) {
+    LifecycleTracer::Span span(m_tracer, stage, "engine");
+    auto tracedFunction = [this, &stage, &function](size_t index) {
+        LifecycleTracer::Span serviceSpan(m_tracer, m_orderedServiceList[index]->getDescription().getType(), stage);
+        return function(index);
+    };
+
+    size_t failedIndex = 0;
+    if (!m_serviceScheduler->run(tracedFunction, failedIndex)) {
+        Throw("Service failed to " + stage + ": " + m_orderedServiceList[failedIndex]->getDescription().getType());
+    }
+}
+
+void EngineImpl::writeLifecycleTrace() {
+    if (!m_lifecycleTracePath.empty() && m_tracer.write(m_lifecycleTracePath)) {
+        AACE_INFO(LX(TAG).m("Lifecycle trace written").d("path", m_lifecycleTracePath));
+    }
+}
+
 std::shared_ptr<EngineServiceContext> EngineImpl::getService(const std::string& type) {
     auto it = m_registeredServiceMap.find(type);
     return it != m_registeredServiceMap.end() ? std::make_shared<EngineServiceContext>(it->second) : nullptr;
@@ -62,7 +62,7 @@ bool EngineService::handleInitializeEngineEvent(std::shared_ptr<aace::engine::co
     }
 }
 
-bool EngineService::handleConfigureEngineEvent(std::shared_ptr<std::istream> configuration) {
+bool EngineService::handleConfigureEngineEvent(std::shared_ptr<const aace::engine::utils::json::Value> configuration) {
     try {
         ThrowIfNot(m_initialized, "serviceNotInitialized");
         ThrowIfNot(configuration != nullptr ? configure(configuration) : configure(), "configureServiceFailed");
@@ -220,6 +220,10 @@ bool EngineService::configure(std::shared_ptr<std::istream> configuration) {
     return true;
 }
 
+bool EngineService::configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) {
+    return configure(aace::engine::utils::json::toStream(*configuration));
+}
+
 bool EngineService::preRegister() {
     return true;
 }
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_map>
+
+#include "AACE/Engine/Core/EngineServiceScheduler.h"
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace core {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.core.EngineServiceScheduler");
+
+EngineServiceScheduler::EngineServiceScheduler(std::vector<std::vector<size_t>> dependencies, size_t maxThreads) :
+        m_dependents(dependencies.size()), m_dependencyCounts(dependencies.size()), m_maxThreads(maxThreads) {
+    for (size_t index = 0; index < dependencies.size(); index++) {
+        m_dependencyCounts[index] = dependencies[index].size();
+        for (auto dependency : dependencies[index]) {
+            m_dependents[dependency].push_back(index);
+        }
+    }
+}
+
+std::shared_ptr<EngineServiceScheduler> EngineServiceScheduler::create(
+    std::vector<std::vector<size_t>> dependencies,
+    size_t maxThreads) {
+    try {
+        ThrowIf(maxThreads < 1, "invalidMaxThreads");
+        for (size_t index = 0; index < dependencies.size(); index++) {
+            auto& next = dependencies[index];
+
+            // the services come after the services they depend on, which makes the dependencies acyclic
+            std::sort(next.begin(), next.end());
+            next.erase(std::unique(next.begin(), next.end()), next.end());
+            ThrowIf(!next.empty() && next.back() >= index, "invalidDependencyOrder");
+        }
+
+        return std::shared_ptr<EngineServiceScheduler>(
+            new EngineServiceScheduler(std::move(dependencies), maxThreads));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+std::shared_ptr<EngineServiceScheduler> EngineServiceScheduler::create(
+    const std::vector<std::shared_ptr<EngineService>>& orderedServiceList,
+    size_t maxThreads) {
+    std::unordered_map<std::string, size_t> indexes;
+    for (size_t index = 0; index < orderedServiceList.size(); index++) {
+        indexes[orderedServiceList[index]->getDescription().getType()] = index;
+    }
+
+    std::vector<std::vector<size_t>> dependencies(orderedServiceList.size());
+    for (size_t index = 0; index < orderedServiceList.size(); index++) {
+        for (auto& next : orderedServiceList[index]->getDescription().getDependencies()) {
+            auto it = indexes.find(next.getType());
+            if (it != indexes.end()) {
+                dependencies[index].push_back(it->second);
+            }
+        }
+    }
+
+    return create(std::move(dependencies), maxThreads);
+}
+
+bool EngineServiceScheduler::run(StageFunction stage, size_t& failedIndex) {
+    auto count = m_dependencyCounts.size();
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    auto remainingDependencies = m_dependencyCounts;
+    std::set<size_t> ready;
+    size_t running = 0;
+    size_t firstFailed = count;
+
+    for (size_t index = 0; index < count; index++) {
+        if (remainingDependencies[index] == 0) {
+            ready.insert(index);
+        }
+    }
+
+    // services after a failed service are not started, so that the first failure is always the same
+    auto runnable = [&]() { return !ready.empty() && *ready.begin() < firstFailed; };
+
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            changed.wait(lock, [&]() { return runnable() || running == 0; });
+            if (!runnable()) {
+                return;
+            }
+
+            auto index = *ready.begin();
+            ready.erase(ready.begin());
+            running++;
+            lock.unlock();
+
+            bool success = false;
+            try {
+                success = stage(index);
+            } catch (std::exception& ex) {
+                AACE_ERROR(LX(TAG).d("index", index).d("reason", ex.what()));
+            }
+
+            lock.lock();
+            running--;
+            if (success) {
+                for (auto dependent : m_dependents[index]) {
+                    if (--remainingDependencies[dependent] == 0) {
+                        ready.insert(dependent);
+                    }
+                }
+            } else {
+                firstFailed = std::min(firstFailed, index);
+            }
+            changed.notify_all();
+        }
+    };
+
+    // the calling thread is one of the threads running the services
+    std::vector<std::thread> threads;
+    for (size_t next = 1; next < std::min(m_maxThreads, count); next++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& next : threads) {
+        next.join();
+    }
+
+    failedIndex = firstFailed;
+    return firstFailed == count;
+}
+
+}  // namespace core
+}  // namespace engine
+}  // namespace aace
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+
+#include <nlohmann/json.hpp>
+
+#include "AACE/Engine/Core/LifecycleTracer.h"
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace core {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.core.LifecycleTracer");
+
+const size_t LifecycleTracer::DEFAULT_MAX_EVENTS = 10000;
+
+/// Returns a duration in microseconds, the time unit of Chrome trace events.
+static double toMicroseconds(LifecycleTracer::Clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+LifecycleTracer::Span::Span(LifecycleTracer& tracer, std::string name, std::string category) :
+        m_tracer(tracer), m_name(std::move(name)), m_category(std::move(category)), m_startTime(Clock::now()) {
+}
+
+LifecycleTracer::Span::~Span() {
+    m_tracer.addEvent(m_name, m_category, m_startTime, Clock::now());
+}
+
+LifecycleTracer::LifecycleTracer(size_t maxEvents) :
+        m_startTime(Clock::now()), m_maxEvents(maxEvents), m_droppedEvents(0) {
+    // the thread which creates the tracer creates the engine, and runs its lifecycle phases
+    m_threads.emplace(std::this_thread::get_id(), 0);
+}
+
+void LifecycleTracer::addEvent(
+    const std::string& name,
+    const std::string& category,
+    Clock::time_point startTime,
+    Clock::time_point endTime) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_events.size() >= m_maxEvents) {
+        m_droppedEvents++;
+        return;
+    }
+    auto thread = m_threads.emplace(std::this_thread::get_id(), m_threads.size()).first->second;
+    m_events.push_back({name, category, startTime - m_startTime, endTime - startTime, thread});
+}
+
+std::vector<LifecycleTracer::Event> LifecycleTracer::getEvents() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_events;
+}
+
+std::string LifecycleTracer::toJson() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    nlohmann::json traceEvents = nlohmann::json::array();
+
+    // the other threads run services concurrently with the engine thread
+    for (size_t thread = 0; thread < m_threads.size(); thread++) {
+        traceEvents.push_back(
+            {{"name", "thread_name"},
+             {"ph", "M"},
+             {"pid", 1},
+             {"tid", thread},
+             {"args", {{"name", thread == 0 ? "engine" : "service-" + std::to_string(thread)}}}});
+    }
+    for (auto& next : m_events) {
+        traceEvents.push_back(
+            {{"name", next.name},
+             {"cat", next.category},
+             {"ph", "X"},
+             {"ts", toMicroseconds(next.start)},
+             {"dur", toMicroseconds(next.duration)},
+             {"pid", 1},
+             {"tid", next.thread}});
+    }
+
+    return nlohmann::json(
+               {{"traceEvents", traceEvents},
+                {"displayTimeUnit", "ms"},
+                {"otherData", {{"droppedEvents", m_droppedEvents}}}})
+        .dump();
+}
+
+bool LifecycleTracer::write(const std::string& path) const {
+    try {
+        // the trace is written to a temporary file first, so a trace being written is never read
+        auto temporaryPath = path + ".tmp";
+        {
+            std::ofstream file(temporaryPath, std::ios::out | std::ios::trunc);
+            ThrowIfNot(file.is_open(), "openFileFailed");
+            file << toJson();
+            ThrowIfNot(file.good(), "writeFailed");
+        }
+        ThrowIf(std::rename(temporaryPath.c_str(), path.c_str()) != 0, "renameFailed");
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("path", path));
+        return false;
+    }
+}
+
+}  // namespace core
+}  // namespace engine
+}  // namespace aace
@@ -17,11 +17,14 @@
 
 #include "AACE/Engine/Location/LocationEngineService.h"
 #include "AACE/Engine/Core/EngineMacros.h"
+#include "AACE/Engine/Utils/JSON/JSON.h"
 
 namespace aace {
 namespace engine {
 namespace location {
 
+namespace json = aace::engine::utils::json;
+
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.location.LocationEngineService");
 
@@ -29,7 +32,27 @@ static const std::string TAG("aace.location.LocationEngineService");
 REGISTER_SERVICE(LocationEngineService)
 
 LocationEngineService::LocationEngineService(const aace::engine::core::ServiceDescription& description) :
-        aace::engine::core::EngineService(description) {
+        aace::engine::core::EngineService(description),
+        m_maxLocationAge(LocationProviderEngineImpl::DEFAULT_MAX_LOCATION_AGE),
+        m_fetchTimeout(LocationProviderEngineImpl::DEFAULT_FETCH_TIMEOUT) {
+}
+
+bool LocationEngineService::configure(std::shared_ptr<const json::Value> configuration) {
+    try {
+        auto& root = *configuration;
+
+        // the location cache policy, in milliseconds
+        m_maxLocationAge = std::chrono::milliseconds(json::get(
+            root, "/locationProvider/maxLocationAge", static_cast<uint64_t>(m_maxLocationAge.count())));
+        m_fetchTimeout = std::chrono::milliseconds(
+            json::get(root, "/locationProvider/fetchTimeout", static_cast<uint64_t>(m_fetchTimeout.count())));
+        ThrowIf(m_fetchTimeout.count() == 0, "invalidFetchTimeout");
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "configure").d("reason", ex.what()));
+        return false;
+    }
 }
 
 bool LocationEngineService::registerPlatformInterface(
@@ -48,7 +71,8 @@ bool LocationEngineService::registerPlatformInterfaceType(
     try {
         ThrowIfNotNull(m_locationProviderEngineImpl, "platformInterfaceAlreadyRegistered");
 
-        m_locationProviderEngineImpl = LocationProviderEngineImpl::create(locationProviderPlatformInterface);
+        m_locationProviderEngineImpl = LocationProviderEngineImpl::create(
+            locationProviderPlatformInterface, m_maxLocationAge, m_fetchTimeout);
         ThrowIfNull(m_locationProviderEngineImpl, "createLocationProviderEngineImplFailed");
 
         ThrowIfNot(
@@ -23,12 +23,19 @@ namespace location {
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.core.LocationProviderEngineImpl");
 
+const std::chrono::milliseconds LocationProviderEngineImpl::DEFAULT_MAX_LOCATION_AGE = std::chrono::seconds(5);
+const std::chrono::milliseconds LocationProviderEngineImpl::DEFAULT_FETCH_TIMEOUT = std::chrono::seconds(1);
+
 std::shared_ptr<LocationProviderEngineImpl> LocationProviderEngineImpl::create(
-    std::shared_ptr<aace::location::LocationProvider> platformInterface) {
+    std::shared_ptr<aace::location::LocationProvider> platformInterface,
+    std::chrono::milliseconds maxLocationAge,
+    std::chrono::milliseconds fetchTimeout) {
     try {
         ThrowIfNull(platformInterface, "locationProviderPlatformInterfaceIsNull");
-        auto locationProviderEngineImpl =
-            std::shared_ptr<LocationProviderEngineImpl>(new LocationProviderEngineImpl(platformInterface));
+        ThrowIf(maxLocationAge.count() < 0, "invalidMaxLocationAge");
+        ThrowIf(fetchTimeout.count() <= 0, "invalidFetchTimeout");
+        auto locationProviderEngineImpl = std::shared_ptr<LocationProviderEngineImpl>(
+            new LocationProviderEngineImpl(platformInterface, maxLocationAge, fetchTimeout));
         return locationProviderEngineImpl;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -37,8 +44,13 @@ std::shared_ptr<LocationProviderEngineImpl> LocationProviderEngineImpl::create(
 }
 
 LocationProviderEngineImpl::LocationProviderEngineImpl(
-    std::shared_ptr<aace::location::LocationProvider> platformInterface) :
-        m_locationProviderPlatformInterface(platformInterface) {
+    std::shared_ptr<aace::location::LocationProvider> platformInterface,
+    std::chrono::milliseconds maxLocationAge,
+    std::chrono::milliseconds fetchTimeout) :
+        m_maxLocationAge(maxLocationAge),
+        m_fetchTimeout(fetchTimeout),
+        m_locationProviderPlatformInterface(platformInterface),
+        m_hasCachedLocation(false) {
 }
 
 void LocationProviderEngineImpl::addObserver(std::shared_ptr<LocationServiceObserverInterface> observer) {
@@ -60,6 +72,13 @@ void LocationProviderEngineImpl::removeObserver(std::shared_ptr<LocationServiceO
 }
 
 void LocationProviderEngineImpl::onLocationServiceAccessChanged(LocationServiceAccess access) {
+    if (access == LocationServiceAccess::DISABLED) {
+        // a location reported before access was revoked must not be shared
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        m_cachedLocation = aace::location::Location();
+        m_hasCachedLocation = false;
+    }
+
     std::lock_guard<std::mutex> lock(m_mutex);
 
     for (const auto& next : m_observers) {
@@ -67,19 +86,82 @@ void LocationProviderEngineImpl::onLocationServiceAccessChanged(LocationServiceA
     }
 }
 
-aace::location::Location LocationProviderEngineImpl::getLocation() {
+void LocationProviderEngineImpl::onLocationChanged(const aace::location::Location& location) {
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
     if (m_locationProviderPlatformInterface != nullptr) {
-        return m_locationProviderPlatformInterface->getLocation();
-    } else {
-        AACE_WARN(LX(TAG).m("locationQueriedAfterShutdown"));
-        return aace::location::Location();
+        updateCacheLocked(location);
+    }
+}
+
+aace::location::Location LocationProviderEngineImpl::getLocation() {
+    std::shared_future<aace::location::Location> fetch;
+    {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        if (m_locationProviderPlatformInterface == nullptr) {
+            AACE_WARN(LX(TAG).m("locationQueriedAfterShutdown"));
+            return aace::location::Location();
+        }
+        if (m_hasCachedLocation && std::chrono::steady_clock::now() - m_cachedLocationTime < m_maxLocationAge) {
+            return m_cachedLocation;
+        }
+        if (!m_pendingFetch.valid()) {
+            auto platformInterface = m_locationProviderPlatformInterface;
+            auto future = m_executor.submit([this, platformInterface]() {
+                aace::location::Location location;
+                bool fetched = false;
+                try {
+                    location = platformInterface->getLocation();
+                    fetched = true;
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG).m("platformGetLocationFailed").d("reason", ex.what()));
+                }
+                std::lock_guard<std::mutex> lock(m_cacheMutex);
+                // the pending fetch is cleared even if the platform failed, so the next query fetches again
+                m_pendingFetch = std::shared_future<aace::location::Location>();
+                if (!fetched) {
+                    return m_cachedLocation;
+                }
+                if (m_locationProviderPlatformInterface != nullptr) {
+                    updateCacheLocked(location);
+                }
+                return location;
+            });
+            if (!future.valid()) {
+                AACE_ERROR(LX(TAG).d("reason", "submitFetchFailed"));
+                return m_cachedLocation;
+            }
+            m_pendingFetch = future.share();
+        }
+        fetch = m_pendingFetch;
     }
+
+    if (fetch.wait_for(m_fetchTimeout) == std::future_status::ready) {
+        return fetch.get();
+    }
+
+    // the platform is refreshing the cache in the background, so the next query may be answered from it
+    AACE_WARN(LX(TAG).m("fetchLocationTimeout").d("timeout", m_fetchTimeout.count()));
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    return m_cachedLocation;
+}
+
+void LocationProviderEngineImpl::updateCacheLocked(const aace::location::Location& location) {
+    m_cachedLocation = location;
+    m_cachedLocationTime = std::chrono::steady_clock::now();
+    m_hasCachedLocation = true;
 }
 
 void LocationProviderEngineImpl::shutdown() {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_observers.clear();
-    m_locationProviderPlatformInterface.reset();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_observers.clear();
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        m_locationProviderPlatformInterface.reset();
+        m_pendingFetch = std::shared_future<aace::location::Location>();
+    }
+    m_executor.shutdown();
 }
 
 }  // namespace location
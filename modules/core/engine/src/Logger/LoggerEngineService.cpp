@@ -64,10 +64,9 @@ bool LoggerEngineService::initialize() {
     }
 }
 
-bool LoggerEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool LoggerEngineService::configure(std::shared_ptr<const json::Value> configuration) {
     try {
-        auto root = json::toJson(configuration);
-        ThrowIfNull(root, "parseConfigurationFailed");
+        auto& root = *configuration;
 
         auto sinkConfigList = json::get(root, "/sinks", json::Type::array);
         if (sinkConfigList != nullptr) {
@@ -63,6 +63,8 @@ bool MessageBrokerEngineService::initialize() {
 bool MessageBrokerEngineService::shutdown() {
     try {
         m_messageBroker->shutdown();
+        // writes the messages which are still being recorded
+        m_messageBroker->setTrafficRecorder(nullptr);
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -81,10 +83,10 @@ bool MessageBrokerEngineService::configure() {
     }
 }
 
-bool MessageBrokerEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool MessageBrokerEngineService::configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) {
     try {
-        auto root = nlohmann::json::parse(*configuration);
-        auto autoEnableInterfaces = root["/autoEnableInterfaces"_json_pointer];
+        auto& root = *configuration;
+        auto autoEnableInterfaces = root.value("autoEnableInterfaces", nlohmann::json());
 
         // default configuration
         ThrowIfNot(configure(), "configureFailed");
@@ -93,7 +95,7 @@ bool MessageBrokerEngineService::configure(std::shared_ptr<std::istream> configu
         m_autoEnableInterfaces =
             autoEnableInterfaces == nullptr || (autoEnableInterfaces.is_boolean() && autoEnableInterfaces.get<bool>());
 
-        auto defaultMessageTimeout = root["/defaultMessageTimeout"_json_pointer];
+        auto defaultMessageTimeout = root.value("defaultMessageTimeout", nlohmann::json());
 
         if (defaultMessageTimeout != nullptr) {
             ThrowIfNot(
@@ -107,12 +109,32 @@ bool MessageBrokerEngineService::configure(std::shared_ptr<std::istream> configu
         // set the configured message broker message timeout
         m_messageBroker->setMessageTimeout(std::chrono::milliseconds(m_defaultMessageTimeout));
 
-        auto version = root["/version"_json_pointer];
+        auto version = root.value("version", nlohmann::json());
         if (version != nullptr) {
             ThrowIfNot(version.is_string(), "invalidConfiguration");
             m_configuredVersion = VERSION(version.get<std::string>());
         }
 
+        // record the message traffic to a file, to replay it with the message traffic replayer
+        auto trafficRecordingPath = root.value("trafficRecordingPath", nlohmann::json());
+        if (trafficRecordingPath != nullptr) {
+#ifdef AAC_TRAFFIC_RECORDING_ENABLED
+            ThrowIfNot(trafficRecordingPath.is_string(), "invalidConfiguration");
+            auto trafficRecordingMaxSize = root.value("trafficRecordingMaxSize", nlohmann::json());
+            size_t maxSize = MessageTrafficRecorder::DEFAULT_MAX_SIZE;
+            if (trafficRecordingMaxSize != nullptr) {
+                ThrowIfNot(trafficRecordingMaxSize.is_number_unsigned(), "invalidConfiguration");
+                maxSize = trafficRecordingMaxSize.get<size_t>();
+            }
+            auto recorder = MessageTrafficRecorder::create(trafficRecordingPath.get<std::string>(), maxSize);
+            ThrowIfNull(recorder, "createTrafficRecorderFailed");
+            m_messageBroker->setTrafficRecorder(recorder);
+#else
+            // the recording holds the messages verbatim, including tokens and personal data
+            AACE_WARN(LX(TAG).m("Traffic recording is not enabled in this build").d("config", "trafficRecordingPath"));
+#endif
+        }
+
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
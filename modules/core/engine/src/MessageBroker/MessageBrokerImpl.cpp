@@ -45,6 +45,10 @@ void MessageBrokerImpl::setMessageTimeout(const std::chrono::milliseconds& value
     m_timeout = value;
 }
 
+void MessageBrokerImpl::setTrafficRecorder(std::shared_ptr<MessageTrafficRecorder> recorder) {
+    std::atomic_store(&m_trafficRecorder, recorder);
+}
+
 std::string MessageBrokerImpl::getMessageType(
     Message::Direction direction,
     const std::string& topic,
@@ -94,6 +98,12 @@ PublishMessage MessageBrokerImpl::publish(const std::string& message, Message::D
             // get an instance of the Message defined by the PublishMessage object
             auto msg = pm.message();
 
+            // record the message as it was published
+            auto recorder = std::atomic_load(&sp->m_trafficRecorder);
+            if (recorder != nullptr && msg.valid()) {
+                recorder->record(pm.direction(), pm.msg());
+            }
+
             // handle publish message type
             if (msg.messageType() == Message::MessageType::PUBLISH) {
                 if (sync) {
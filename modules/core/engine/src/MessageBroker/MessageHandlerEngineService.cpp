@@ -14,7 +14,6 @@
  */
 
 #include <nlohmann/json.hpp>
-#include <sstream>
 
 #include <AACE/Engine/MessageBroker/MessageHandlerEngineService.h>
 #include <AACE/Engine/MessageBroker/MessageBrokerServiceInterface.h>
@@ -112,33 +111,28 @@ bool MessageHandlerEngineService::configure() {
     }
 }
 
-bool MessageHandlerEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool MessageHandlerEngineService::configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) {
     try {
         // default configuration
         ThrowIfNot(configure(), "configureFailed");
 
         // process the service configuration
-        auto root = nlohmann::json::parse(*configuration);
+        auto& root = *configuration;
 
         for (auto& next : m_interfaceMap) {
-            auto interfaceRoot = root[nlohmann::json::json_pointer("/" + next.first)];
+            auto it = root.find(next.first);
 
-            if (interfaceRoot != nullptr) {
-                auto enabledNode = interfaceRoot["/enabled"_json_pointer];
+            if (it != root.end() && *it != nullptr) {
+                auto& interfaceRoot = *it;
+                auto enabledNode = interfaceRoot.is_object() ? interfaceRoot.find("enabled") : interfaceRoot.end();
 
                 // set the configured enabled state, or use default if not explicitly configured
-                if (enabledNode != nullptr && enabledNode.is_boolean()) {
-                    next.second = enabledNode.get<bool>() ? Enablement::ENABLED : Enablement::DISABLED;
+                if (enabledNode != interfaceRoot.end() && enabledNode->is_boolean()) {
+                    next.second = enabledNode->get<bool>() ? Enablement::ENABLED : Enablement::DISABLED;
                 }
 
-                // configure the interface
-                std::stringstream interfaceConfigStream;
-
-                // generate the config stream for the interface
-                interfaceConfigStream << interfaceRoot.dump();
-
                 // call service configure interface method
-                configureMessageInterface(next.first, isInterfaceEnabled(next.first), interfaceConfigStream);
+                configureMessageInterface(next.first, isInterfaceEnabled(next.first), interfaceRoot);
             }
         }
 
@@ -152,7 +146,7 @@ bool MessageHandlerEngineService::configure(std::shared_ptr<std::istream> config
 bool MessageHandlerEngineService::configureMessageInterface(
     const std::string& name,
     bool enabled,
-    std::istream& configuration) {
+    const aace::engine::utils::json::Value& configuration) {
     AACE_DEBUG(LX(TAG).d("name", name).d("enabled", enabled));
     return true;
 }
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <nlohmann/json.hpp>
+#include <sstream>
+
+#include <AACE/Engine/MessageBroker/MessageTrafficRecorder.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+namespace aace {
+namespace engine {
+namespace messageBroker {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.messageBroker.MessageTrafficRecorder");
+
+constexpr size_t MessageTrafficRecorder::DEFAULT_MAX_SIZE;
+
+MessageTrafficRecorder::MessageTrafficRecorder(const std::string& path, size_t maxSize) :
+        m_file(path, std::ios::out | std::ios::trunc),
+        m_startTime(std::chrono::steady_clock::now()),
+        m_maxSize(maxSize),
+        m_acceptedSize(0),
+        m_writtenSize(0),
+        m_stopped(false) {
+}
+
+std::shared_ptr<MessageTrafficRecorder> MessageTrafficRecorder::create(const std::string& path, size_t maxSize) {
+    try {
+        ThrowIf(path.empty(), "invalidPath");
+        ThrowIf(maxSize == 0, "invalidMaxSize");
+        auto recorder = std::shared_ptr<MessageTrafficRecorder>(new MessageTrafficRecorder(path, maxSize));
+        ThrowIfNot(recorder->m_file.is_open(), "openFileFailed");
+        AACE_INFO(LX(TAG).m("Recording message traffic").d("path", path).d("maxSize", maxSize));
+        return recorder;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("path", path));
+        return nullptr;
+    }
+}
+
+MessageTrafficRecorder::~MessageTrafficRecorder() {
+    m_executor.waitForSubmittedTasks();
+    m_executor.shutdown();
+}
+
+void MessageTrafficRecorder::record(Message::Direction direction, const std::string& message) {
+    if (m_stopped) {
+        return;
+    }
+    // the messages accepted are at most the size of the recording, whether they are written yet or not
+    if (m_acceptedSize.fetch_add(message.size()) + message.size() > m_maxSize) {
+        stop();
+        return;
+    }
+    auto time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_startTime);
+    m_executor.submit([this, time, direction, message]() {
+        if (m_writtenSize >= m_maxSize) {
+            return;
+        }
+        try {
+            std::stringstream directionStr;
+            directionStr << direction;
+            // the message is recorded as a string value, so it is replayed exactly as it was published
+            nlohmann::json entry = {
+                {"time", time.count()}, {"direction", directionStr.str()}, {"message", message}};
+            auto line = entry.dump() + '\n';
+            // the escaped message with its time and direction is larger than the size accepted for it, and the
+            // following messages are not written once one of them is left out
+            if (m_writtenSize + line.size() > m_maxSize) {
+                m_writtenSize = m_maxSize;
+                stop();
+                return;
+            }
+            m_file << line;
+            ThrowIfNot(m_file.good(), "writeFailed");
+            m_writtenSize += line.size();
+        } catch (std::exception& ex) {
+            AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        }
+    });
+}
+
+void MessageTrafficRecorder::stop() {
+    if (!m_stopped.exchange(true)) {
+        AACE_WARN(LX(TAG).m("Recording reached its maximum size").d("maxSize", m_maxSize));
+    }
+}
+
+void MessageTrafficRecorder::flush() {
+    m_executor.submit([this]() { m_file.flush(); }).wait();
+}
+
+}  // namespace messageBroker
+}  // namespace engine
+}  // namespace aace
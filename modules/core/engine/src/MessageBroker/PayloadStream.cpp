@@ -0,0 +1,68 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <AACE/Engine/MessageBroker/PayloadStream.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+namespace aace {
+namespace engine {
+namespace messageBroker {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.messageBroker.PayloadStream");
+
+PayloadStream::PayloadStream(std::string payload) : m_payload(std::move(payload)), m_offset(0) {
+}
+
+std::shared_ptr<PayloadStream> PayloadStream::create(std::string payload) {
+    return std::shared_ptr<PayloadStream>(new PayloadStream(std::move(payload)));
+}
+
+size_t PayloadStream::getSize() const {
+    return m_payload.size();
+}
+
+//
+// aace::core::MessageStream
+//
+
+ssize_t PayloadStream::read(char* data, const size_t size) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto count = std::min(size, m_payload.size() - m_offset);
+    std::memcpy(data, m_payload.data() + m_offset, count);
+    m_offset += count;
+    return static_cast<ssize_t>(count);
+}
+
+ssize_t PayloadStream::write(const char* data, const size_t size) {
+    AACE_ERROR(LX(TAG).d("reason", "invalidOperation"));
+    return -1;
+}
+
+bool PayloadStream::isClosed() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_offset >= m_payload.size();
+}
+
+aace::core::MessageStream::Mode PayloadStream::getMode() {
+    return aace::core::MessageStream::Mode::READ;
+}
+
+}  // namespace messageBroker
+}  // namespace engine
+}  // namespace aace
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/MessageBroker/PayloadStream.h>
+#include <AACE/Engine/MessageBroker/PayloadStreamChannel.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+#include <AACE/Engine/Utils/UUID/UUID.h>
+
+namespace aace {
+namespace engine {
+namespace messageBroker {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.messageBroker.PayloadStreamChannel");
+
+const size_t PayloadStreamChannel::DEFAULT_MAX_PENDING_BYTES = 8 * 1024 * 1024;
+
+PayloadStreamChannel::PayloadStreamChannel(
+    std::shared_ptr<StreamManagerInterface> streamManager,
+    size_t threshold,
+    size_t maxPendingBytes) :
+        m_streamManager(streamManager),
+        m_threshold(threshold),
+        m_maxPendingBytes(maxPendingBytes),
+        m_pendingBytes(0) {
+}
+
+std::shared_ptr<PayloadStreamChannel> PayloadStreamChannel::create(
+    std::shared_ptr<StreamManagerInterface> streamManager,
+    size_t threshold,
+    size_t maxPendingBytes) {
+    try {
+        ThrowIfNull(streamManager, "invalidStreamManager");
+        ThrowIf(threshold == 0, "invalidThreshold");
+        return std::shared_ptr<PayloadStreamChannel>(
+            new PayloadStreamChannel(streamManager, threshold, maxPendingBytes));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+std::string PayloadStreamChannel::send(std::string& payload) {
+    try {
+        ReturnIf(payload.size() < m_threshold, "");
+
+        auto m_streamManager_lock = m_streamManager.lock();
+        ThrowIfNull(m_streamManager_lock, "invalidStreamManagerReference");
+
+        auto size = payload.size();
+        auto stream = PayloadStream::create(std::move(payload));
+        payload.clear();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // remove the oldest streams, which have either been opened or are not going to be
+        while (!m_pendingStreams.empty() && m_pendingBytes + size > m_maxPendingBytes) {
+            auto& oldest = m_pendingStreams.front();
+            if (m_streamManager_lock->unregisterStreamHandler(oldest.first)) {
+                AACE_WARN(LX(TAG).m("Removed payload stream which was not opened").d("streamId", oldest.first));
+            }
+            m_pendingBytes -= oldest.second;
+            m_pendingStreams.pop_front();
+        }
+
+        auto streamId = aace::engine::utils::uuid::generateUUID();
+        if (!m_streamManager_lock->registerStreamHandler(streamId, stream)) {
+            // embed the payload in the message instead
+            payload.resize(size);
+            stream->read(&payload[0], size);
+            Throw("registerStreamHandlerFailed");
+        }
+        m_pendingStreams.emplace_back(streamId, size);
+        m_pendingBytes += size;
+
+        AACE_DEBUG(LX(TAG).d("streamId", streamId).d("size", size));
+        return streamId;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return "";
+    }
+}
+
+}  // namespace messageBroker
+}  // namespace engine
+}  // namespace aace
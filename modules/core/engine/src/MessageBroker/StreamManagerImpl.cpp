@@ -79,6 +79,11 @@ std::shared_ptr<aace::core::MessageStream> StreamManagerImpl::requestStreamHandl
     }
 }
 
+bool StreamManagerImpl::unregisterStreamHandler(const std::string& streamId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_streamMap.erase(streamId) > 0;
+}
+
 }  // namespace messageBroker
 }  // namespace engine
 }  // namespace aace
@@ -81,6 +81,7 @@ bool PropertyManagerEngineService::registerProperty(const PropertyDescription& p
         ThrowIf(name.empty(), "invalidPropertyName");
         ThrowIf(m_propertyDescriptionMap.find(name) != m_propertyDescriptionMap.end(), "propertyAlreadyRegistered");
         m_propertyDescriptionMap[name] = propertyDescription;
+        m_propertyStore.add(name);
 
         return true;
     } catch (std::exception& ex) {
@@ -97,9 +98,11 @@ bool PropertyManagerEngineService::addListener(
         std::lock_guard<std::mutex> lock(m_listenerMutex);
         auto it = m_propertyListenerMap.find(name);
         if (it != m_propertyListenerMap.end()) {
-            it->second.insert(listener);
+            auto listeners = std::make_shared<ListenerSet>(*it->second);
+            listeners->insert(listener);
+            it->second = listeners;
         } else {
-            m_propertyListenerMap[name] = {listener};
+            m_propertyListenerMap[name] = std::make_shared<const ListenerSet>(ListenerSet{listener});
         }
         return true;
     } catch (std::exception& ex) {
@@ -116,7 +119,9 @@ void PropertyManagerEngineService::removeListener(
         std::lock_guard<std::mutex> lock(m_listenerMutex);
         auto it = m_propertyListenerMap.find(name);
         ThrowIf(it == m_propertyListenerMap.end(), "propertyNotFound");
-        it->second.erase(listener);
+        auto listeners = std::make_shared<ListenerSet>(*it->second);
+        listeners->erase(listener);
+        it->second = listeners;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()).d("name", name));
     }
@@ -182,8 +187,10 @@ void PropertyManagerEngineService::handleSetSuccess(
             m_propertyManagerEngineImpl->handlePropertyChanged(name, value);
         }
         // notify the listeners of the property change irrespective of the initiator of the
-        // setProperty()
-        notifyPropertyChangeListeners(name, value);
+        // setProperty(). The listeners are notified after the platform, with the value of the
+        // property owner, which may differ from the requested one, e.g. "TRUE" is set as "true".
+        m_propertyStore.set(name, getOwnerValue(name, value));
+        notifyPropertyChangeListeners(name);
     } else {  // The property value did not change
         // If setProperty() was initiated by the platform, call the
         // propertyStateChanged(name, value, SUCCEEDED)
@@ -229,29 +236,62 @@ std::string PropertyManagerEngineService::getProperty(const std::string& name) {
         ThrowIf(name.empty(), "invalidPropertyName");
         auto it = m_propertyDescriptionMap.find(name);
         ThrowIf(it == m_propertyDescriptionMap.end(), "propertyNotFound");
-        return it->second.getter()();
+        ThrowIfNull(it->second.getter(), "writeOnlyProperty");
+
+        // the value set or notified last is current, since the property owner notifies any other change
+        auto current = m_propertyStore.get(name);
+        if (current != nullptr) {
+            return current->value;
+        }
+        auto value = it->second.getter()();
+
+        // the owner may not have its value until the Engine is started, so a value read before is not kept
+        if (isRunning()) {
+            return m_propertyStore.setIfEmpty(name, value)->value;
+        }
+        return value;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()).d("name", name));
         return "";
     }
 }
 
-void PropertyManagerEngineService::notifyPropertyChangeListeners(
-    const std::string& name,
-    const std::string& propertyValue) {
+std::string PropertyManagerEngineService::getOwnerValue(const std::string& name, const std::string& value) {
     try {
-        std::unique_lock<std::mutex> lock(m_listenerMutex);
-        ThrowIf(name.empty(), "invalidPropertyName");
-        auto it = m_propertyListenerMap.find(name);
-        if (it != m_propertyListenerMap.end()) {
-            auto currentListeners = it->second;
-            lock.unlock();
-            for (auto& listener : currentListeners) {
-                listener->propertyChanged(name, propertyValue);
-            }
+        auto it = m_propertyDescriptionMap.find(name);
+        ThrowIf(it == m_propertyDescriptionMap.end(), "propertyNotFound");
+        auto getter = it->second.getter();
+        return getter != nullptr ? getter() : value;
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG).d("reason", ex.what()).d("name", name));
+        return value;
+    }
+}
+
+void PropertyManagerEngineService::notifyPropertyChangeListeners(const std::string& name) {
+    // a pending notification delivers the latest value, so a burst of changes is notified once
+    if (m_propertyStore.requestNotification(name)) {
+        m_notificationExecutor.submit([this, name] { deliverPropertyChange(name); });
+    }
+}
+
+void PropertyManagerEngineService::deliverPropertyChange(const std::string& name) {
+    try {
+        auto propertyValue = m_propertyStore.takeNotification(name);
+        ReturnIf(propertyValue == nullptr);
+
+        std::shared_ptr<const ListenerSet> currentListeners;
+        {
+            std::lock_guard<std::mutex> lock(m_listenerMutex);
+            auto it = m_propertyListenerMap.find(name);
+            ReturnIf(it == m_propertyListenerMap.end());
+            currentListeners = it->second;
+        }
+        for (auto& listener : *currentListeners) {
+            listener->propertyChanged(name, propertyValue->value);
         }
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("name", name).sensitive("value", propertyValue));
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("name", name));
     }
 }
 
@@ -264,7 +304,8 @@ void PropertyManagerEngineService::updatePropertyValue(const std::string& name,
         auto it = m_propertyDescriptionMap.find(name);
         if (it != m_propertyDescriptionMap.end()) {
             auto propertyValue = it->second.getter()();
-            notifyPropertyChangeListeners(name, propertyValue);
+            m_propertyStore.set(name, propertyValue);
+            notifyPropertyChangeListeners(name);
             if (m_propertyManagerEngineImpl != nullptr) {
                 m_propertyManagerEngineImpl->handlePropertyChanged(name, propertyValue);
             }
@@ -280,8 +321,10 @@ bool PropertyManagerEngineService::shutdown() {
         m_propertyManagerEngineImpl.reset();
     }
     m_executor.shutdown();
+    m_notificationExecutor.shutdown();
     m_propertyListenerMap.clear();
     m_propertyDescriptionMap.clear();
+    m_propertyStore.clear();
     return true;
 }
 
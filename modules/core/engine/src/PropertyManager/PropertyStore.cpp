@@ -0,0 +1,87 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AACE/Engine/PropertyManager/PropertyStore.h"
+
+namespace aace {
+namespace engine {
+namespace propertyManager {
+
+bool PropertyStore::add(const std::string& name) {
+    return m_entries.emplace(name, std::unique_ptr<Entry>(new Entry())).second;
+}
+
+PropertyStore::Entry* PropertyStore::getEntry(const std::string& name) const {
+    auto it = m_entries.find(name);
+    return it != m_entries.end() ? it->second.get() : nullptr;
+}
+
+std::shared_ptr<const PropertyStore::Value> PropertyStore::get(const std::string& name) const {
+    auto entry = getEntry(name);
+    return entry != nullptr ? std::atomic_load(&entry->value) : nullptr;
+}
+
+std::shared_ptr<const PropertyStore::Value> PropertyStore::set(const std::string& name, const std::string& value) {
+    auto entry = getEntry(name);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+    auto current = std::atomic_load(&entry->value);
+    std::shared_ptr<const Value> next;
+    do {
+        next = std::make_shared<const Value>(Value{value, current != nullptr ? current->version + 1 : 1});
+    } while (!std::atomic_compare_exchange_weak(&entry->value, &current, next));
+    return next;
+}
+
+std::shared_ptr<const PropertyStore::Value> PropertyStore::setIfEmpty(
+    const std::string& name,
+    const std::string& value) {
+    auto entry = getEntry(name);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+    std::shared_ptr<const Value> current;
+    auto next = std::make_shared<const Value>(Value{value, 1});
+    return std::atomic_compare_exchange_strong(&entry->value, &current, next) ? next : current;
+}
+
+bool PropertyStore::requestNotification(const std::string& name) {
+    auto entry = getEntry(name);
+    return entry != nullptr && !entry->notificationPending.exchange(true);
+}
+
+std::shared_ptr<const PropertyStore::Value> PropertyStore::takeNotification(const std::string& name) {
+    auto entry = getEntry(name);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+    // clear the pending flag before reading the value, so a change after the read requests another notification
+    entry->notificationPending = false;
+    auto value = std::atomic_load(&entry->value);
+    if (value == nullptr || value->version <= entry->notifiedVersion) {
+        return nullptr;
+    }
+    entry->notifiedVersion = value->version;
+    return value;
+}
+
+void PropertyStore::clear() {
+    m_entries.clear();
+}
+
+}  // namespace propertyManager
+}  // namespace engine
+}  // namespace aace
@@ -37,10 +37,9 @@ StorageEngineService::StorageEngineService(const aace::engine::core::ServiceDesc
         aace::engine::core::EngineService(description) {
 }
 
-bool StorageEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool StorageEngineService::configure(std::shared_ptr<const json::Value> configuration) {
     try {
-        auto root = json::toJson(configuration);
-        ThrowIfNull(root, "parseConfigurationFailed");
+        auto& root = *configuration;
 
         auto localStoragePath = json::get(root, "/localStoragePath", json::Type::string);
         if (localStoragePath != nullptr) {
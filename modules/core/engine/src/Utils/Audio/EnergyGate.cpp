@@ -0,0 +1,192 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/Utils/Audio/EnergyGate.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace audio {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.engine.utils.audio.EnergyGate");
+
+/// Full scale amplitude of a 16-bit sample.
+static const double FULL_SCALE = 32768.0;
+
+/// Lowest accepted threshold, below which the gate would never close on real audio.
+static const float MIN_THRESHOLD = -96.0f;
+
+/// Longest accepted pre-roll or hangover, which bounds the memory used by the gate.
+static const std::chrono::milliseconds MAX_DURATION = std::chrono::seconds(5);
+
+static double dbfsToPower(float dbfs) {
+    double amplitude = FULL_SCALE * std::pow(10.0, dbfs / 20.0);
+    return amplitude * amplitude;
+}
+
+static size_t toSamples(unsigned int sampleRate, std::chrono::milliseconds duration) {
+    return static_cast<size_t>(static_cast<uint64_t>(sampleRate) * duration.count() / 1000);
+}
+
+EnergyGate::EnergyGate(unsigned int sampleRate, const Configuration& configuration) :
+        m_openPower(dbfsToPower(configuration.openThreshold)),
+        m_closePower(dbfsToPower(configuration.closeThreshold)),
+        m_hangoverSamples(toSamples(sampleRate, configuration.hangover)),
+        m_frame(std::max<size_t>(toSamples(sampleRate, configuration.frameDuration), 1)),
+        m_frameCount(0),
+        m_preRoll(toSamples(sampleRate, configuration.preRoll)),
+        m_preRollStart(0),
+        m_preRollCount(0),
+        m_open(false),
+        m_hangoverRemaining(0),
+        m_passedSamples(0),
+        m_gatedSamples(0) {
+}
+
+std::unique_ptr<EnergyGate> EnergyGate::create(unsigned int sampleRate, const Configuration& configuration) {
+    try {
+        ThrowIf(sampleRate == 0, "invalidSampleRate");
+        ThrowIf(
+            configuration.openThreshold > 0.0f || configuration.openThreshold < MIN_THRESHOLD, "invalidOpenThreshold");
+        ThrowIf(
+            configuration.closeThreshold > configuration.openThreshold || configuration.closeThreshold < MIN_THRESHOLD,
+            "invalidCloseThreshold");
+        ThrowIf(configuration.hangover.count() < 0 || configuration.hangover > MAX_DURATION, "invalidHangover");
+        ThrowIf(configuration.preRoll.count() < 0 || configuration.preRoll > MAX_DURATION, "invalidPreRoll");
+        ThrowIf(
+            configuration.frameDuration.count() <= 0 || configuration.frameDuration > configuration.hangover,
+            "invalidFrameDuration");
+
+        return std::unique_ptr<EnergyGate>(new EnergyGate(sampleRate, configuration));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG)
+                       .d("reason", ex.what())
+                       .d("sampleRate", sampleRate)
+                       .d("openThreshold", configuration.openThreshold)
+                       .d("closeThreshold", configuration.closeThreshold));
+        return nullptr;
+    }
+}
+
+void EnergyGate::process(const int16_t* samples, size_t count, const Writer& writer) {
+    while (count > 0) {
+        size_t copy = std::min(count, m_frame.size() - m_frameCount);
+        std::copy(samples, samples + copy, m_frame.begin() + m_frameCount);
+        m_frameCount += copy;
+        samples += copy;
+        count -= copy;
+
+        if (m_frameCount == m_frame.size()) {
+            processFrame(writer);
+            m_frameCount = 0;
+        }
+    }
+}
+
+void EnergyGate::processFrame(const Writer& writer) {
+    int64_t sum = 0;
+    for (size_t i = 0; i < m_frameCount; i++) {
+        sum += static_cast<int32_t>(m_frame[i]) * m_frame[i];
+    }
+    double power = static_cast<double>(sum) / m_frameCount;
+
+    if (!m_open) {
+        if (power < m_openPower) {
+            holdFrame();
+            return;
+        }
+        m_open = true;
+        flushPreRoll(writer);
+    }
+
+    if (power >= m_closePower) {
+        m_hangoverRemaining = m_hangoverSamples;
+    } else if (m_hangoverRemaining > 0) {
+        m_hangoverRemaining -= std::min(m_hangoverRemaining, m_frameCount);
+    } else {
+        // the frame that ends the hangover is the first one held for the next opening
+        m_open = false;
+        m_hangoverRemaining = 0;
+        holdFrame();
+        return;
+    }
+
+    writer(m_frame.data(), m_frameCount);
+    m_passedSamples += m_frameCount;
+}
+
+void EnergyGate::holdFrame() {
+    size_t capacity = m_preRoll.size();
+    if (capacity == 0) {
+        m_gatedSamples += m_frameCount;
+        return;
+    }
+    for (size_t i = 0; i < m_frameCount; i++) {
+        if (m_preRollCount == capacity) {
+            // overwrite the oldest sample, which is now gated for good
+            m_preRoll[m_preRollStart] = m_frame[i];
+            m_preRollStart = (m_preRollStart + 1) % capacity;
+            m_gatedSamples++;
+        } else {
+            m_preRoll[(m_preRollStart + m_preRollCount) % capacity] = m_frame[i];
+            m_preRollCount++;
+        }
+    }
+}
+
+void EnergyGate::flushPreRoll(const Writer& writer) {
+    if (m_preRollCount == 0) {
+        return;
+    }
+    size_t first = std::min(m_preRollCount, m_preRoll.size() - m_preRollStart);
+    writer(m_preRoll.data() + m_preRollStart, first);
+    if (first < m_preRollCount) {
+        writer(m_preRoll.data(), m_preRollCount - first);
+    }
+    m_passedSamples += m_preRollCount;
+    m_preRollStart = 0;
+    m_preRollCount = 0;
+}
+
+void EnergyGate::reset() {
+    m_gatedSamples += m_preRollCount + m_frameCount;
+    m_frameCount = 0;
+    m_preRollStart = 0;
+    m_preRollCount = 0;
+    m_open = false;
+    m_hangoverRemaining = 0;
+}
+
+bool EnergyGate::isOpen() const {
+    return m_open;
+}
+
+uint64_t EnergyGate::getPassedSampleCount() const {
+    return m_passedSamples;
+}
+
+uint64_t EnergyGate::getGatedSampleCount() const {
+    return m_gatedSamples;
+}
+
+}  // namespace audio
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
@@ -0,0 +1,594 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/Utils/Audio/PCM.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define AACE_PCM_X86
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define AACE_PCM_NEON
+#include <arm_neon.h>
+#endif
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace audio {
+namespace pcm {
+
+/// Scale factor between 16-bit and floating point samples.
+static const float INT16_SCALE = 32768.0f;
+
+/// Smallest 16-bit sample value as a float.
+static const float INT16_MIN_FLOAT = -32768.0f;
+
+/// Largest 16-bit sample value as a float.
+static const float INT16_MAX_FLOAT = 32767.0f;
+
+/**
+ * Dispatch table holding one implementation of every kernel.
+ */
+struct Kernels {
+    SimdLevel level;
+    void (*int16ToFloat)(const int16_t* src, float* dst, size_t count);
+    void (*floatToInt16)(const float* src, int16_t* dst, size_t count);
+    void (*applyGain)(int16_t* samples, size_t count, float gain);
+    void (*applyGainRamp)(int16_t* samples, size_t frames, size_t channels, float startGain, float endGain);
+    void (*downmixToMono)(const int16_t* src, int16_t* dst, size_t frames, size_t channels);
+    float (*dotProduct)(const float* a, const float* b, size_t count);
+};
+
+//
+// scalar
+//
+
+static inline int16_t saturate(float value) {
+    return static_cast<int16_t>(std::lrint(std::min(std::max(value, INT16_MIN_FLOAT), INT16_MAX_FLOAT)));
+}
+
+static void int16ToFloatScalar(const int16_t* src, float* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = static_cast<float>(src[i]) / INT16_SCALE;
+    }
+}
+
+static void floatToInt16Scalar(const float* src, int16_t* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = saturate(src[i] * INT16_SCALE);
+    }
+}
+
+static void applyGainScalar(int16_t* samples, size_t count, float gain) {
+    for (size_t i = 0; i < count; i++) {
+        samples[i] = saturate(static_cast<float>(samples[i]) * gain);
+    }
+}
+
+static void applyGainRampFrom(
+    int16_t* samples,
+    size_t begin,
+    size_t frames,
+    size_t channels,
+    float startGain,
+    float step) {
+    for (size_t frame = begin; frame < frames; frame++) {
+        float gain = startGain + step * static_cast<float>(frame);
+        int16_t* sample = samples + frame * channels;
+        for (size_t ch = 0; ch < channels; ch++) {
+            sample[ch] = saturate(static_cast<float>(sample[ch]) * gain);
+        }
+    }
+}
+
+static inline float rampStep(size_t frames, float startGain, float endGain) {
+    return frames > 0 ? (endGain - startGain) / static_cast<float>(frames) : 0.0f;
+}
+
+static void applyGainRampScalar(int16_t* samples, size_t frames, size_t channels, float startGain, float endGain) {
+    applyGainRampFrom(samples, 0, frames, channels, startGain, rampStep(frames, startGain, endGain));
+}
+
+static void downmixToMonoFrom(const int16_t* src, int16_t* dst, size_t begin, size_t frames, size_t channels) {
+    if (channels == 2) {
+        // matches the rounding of the halving add used by the vector implementations
+        for (size_t frame = begin; frame < frames; frame++) {
+            dst[frame] = static_cast<int16_t>((src[frame * 2] + src[frame * 2 + 1]) >> 1);
+        }
+    } else {
+        for (size_t frame = begin; frame < frames; frame++) {
+            int32_t sum = 0;
+            for (size_t ch = 0; ch < channels; ch++) {
+                sum += src[frame * channels + ch];
+            }
+            dst[frame] = static_cast<int16_t>(sum / static_cast<int32_t>(channels));
+        }
+    }
+}
+
+static void downmixToMonoScalar(const int16_t* src, int16_t* dst, size_t frames, size_t channels) {
+    downmixToMonoFrom(src, dst, 0, frames, channels);
+}
+
+static float dotProductScalar(const float* a, const float* b, size_t count) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < count; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+static const Kernels SCALAR_KERNELS = {SimdLevel::SCALAR,
+                                       int16ToFloatScalar,
+                                       floatToInt16Scalar,
+                                       applyGainScalar,
+                                       applyGainRampScalar,
+                                       downmixToMonoScalar,
+                                       dotProductScalar};
+
+#ifdef AACE_PCM_X86
+
+//
+// SSE2
+//
+
+#define AACE_PCM_TARGET_SSE2 __attribute__((target("sse2")))
+#define AACE_PCM_TARGET_AVX2 __attribute__((target("avx2")))
+
+AACE_PCM_TARGET_SSE2 static inline __m128 clampSSE2(__m128 value) {
+    return _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(INT16_MIN_FLOAT)), _mm_set1_ps(INT16_MAX_FLOAT));
+}
+
+AACE_PCM_TARGET_SSE2 static void int16ToFloatSSE2(const int16_t* src, float* dst, size_t count) {
+    const __m128 scale = _mm_set1_ps(1.0f / INT16_SCALE);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16);
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+        _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    }
+    int16ToFloatScalar(src + i, dst + i, count - i);
+}
+
+AACE_PCM_TARGET_SSE2 static void floatToInt16SSE2(const float* src, int16_t* dst, size_t count) {
+    const __m128 scale = _mm_set1_ps(INT16_SCALE);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i lo = _mm_cvtps_epi32(clampSSE2(_mm_mul_ps(_mm_loadu_ps(src + i), scale)));
+        __m128i hi = _mm_cvtps_epi32(clampSSE2(_mm_mul_ps(_mm_loadu_ps(src + i + 4), scale)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(lo, hi));
+    }
+    floatToInt16Scalar(src + i, dst + i, count - i);
+}
+
+AACE_PCM_TARGET_SSE2 static inline __m128i scaleSSE2(__m128i in, __m128 gainLo, __m128 gainHi) {
+    __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16));
+    __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16));
+    return _mm_packs_epi32(
+        _mm_cvtps_epi32(clampSSE2(_mm_mul_ps(lo, gainLo))), _mm_cvtps_epi32(clampSSE2(_mm_mul_ps(hi, gainHi))));
+}
+
+AACE_PCM_TARGET_SSE2 static void applyGainSSE2(int16_t* samples, size_t count, float gain) {
+    const __m128 g = _mm_set1_ps(gain);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i* ptr = reinterpret_cast<__m128i*>(samples + i);
+        _mm_storeu_si128(ptr, scaleSSE2(_mm_loadu_si128(ptr), g, g));
+    }
+    applyGainScalar(samples + i, count - i, gain);
+}
+
+AACE_PCM_TARGET_SSE2 static void applyGainRampSSE2(
+    int16_t* samples,
+    size_t frames,
+    size_t channels,
+    float startGain,
+    float endGain) {
+    float step = rampStep(frames, startGain, endGain);
+    size_t i = 0;
+    if (channels == 1) {
+        const __m128 start = _mm_set1_ps(startGain);
+        const __m128 stepVec = _mm_set1_ps(step);
+        const __m128i offsetLo = _mm_setr_epi32(0, 1, 2, 3);
+        const __m128i offsetHi = _mm_setr_epi32(4, 5, 6, 7);
+        for (; i + 8 <= frames; i += 8) {
+            __m128i index = _mm_set1_epi32(static_cast<int>(i));
+            __m128 gainLo = _mm_add_ps(start, _mm_mul_ps(stepVec, _mm_cvtepi32_ps(_mm_add_epi32(index, offsetLo))));
+            __m128 gainHi = _mm_add_ps(start, _mm_mul_ps(stepVec, _mm_cvtepi32_ps(_mm_add_epi32(index, offsetHi))));
+            __m128i* ptr = reinterpret_cast<__m128i*>(samples + i);
+            _mm_storeu_si128(ptr, scaleSSE2(_mm_loadu_si128(ptr), gainLo, gainHi));
+        }
+    }
+    applyGainRampFrom(samples, i, frames, channels, startGain, step);
+}
+
+AACE_PCM_TARGET_SSE2 static void downmixToMonoSSE2(const int16_t* src, int16_t* dst, size_t frames, size_t channels) {
+    size_t i = 0;
+    if (channels == 2) {
+        const __m128i ones = _mm_set1_epi16(1);
+        for (; i + 8 <= frames; i += 8) {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 2));
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 2 + 8));
+            // pairwise sum of left and right into 32-bit lanes, then halve and narrow
+            __m128i lo = _mm_srai_epi32(_mm_madd_epi16(a, ones), 1);
+            __m128i hi = _mm_srai_epi32(_mm_madd_epi16(b, ones), 1);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(lo, hi));
+        }
+    }
+    downmixToMonoFrom(src, dst, i, frames, channels);
+}
+
+AACE_PCM_TARGET_SSE2 static float dotProductSSE2(const float* a, const float* b, size_t count) {
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+    }
+    __m128 sum = _mm_add_ps(sum0, sum1);
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum) + dotProductScalar(a + i, b + i, count - i);
+}
+
+static const Kernels SSE2_KERNELS = {SimdLevel::SSE2,
+                                     int16ToFloatSSE2,
+                                     floatToInt16SSE2,
+                                     applyGainSSE2,
+                                     applyGainRampSSE2,
+                                     downmixToMonoSSE2,
+                                     dotProductSSE2};
+
+//
+// AVX2
+//
+
+AACE_PCM_TARGET_AVX2 static inline __m256 clampAVX2(__m256 value) {
+    return _mm256_min_ps(_mm256_max_ps(value, _mm256_set1_ps(INT16_MIN_FLOAT)), _mm256_set1_ps(INT16_MAX_FLOAT));
+}
+
+AACE_PCM_TARGET_AVX2 static inline __m128i packAVX2(__m256i value) {
+    return _mm_packs_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1));
+}
+
+AACE_PCM_TARGET_AVX2 static void int16ToFloatAVX2(const int16_t* src, float* dst, size_t count) {
+    const __m256 scale = _mm256_set1_ps(1.0f / INT16_SCALE);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i in = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(in), scale));
+    }
+    int16ToFloatScalar(src + i, dst + i, count - i);
+}
+
+AACE_PCM_TARGET_AVX2 static void floatToInt16AVX2(const float* src, int16_t* dst, size_t count) {
+    const __m256 scale = _mm256_set1_ps(INT16_SCALE);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i out = _mm256_cvtps_epi32(clampAVX2(_mm256_mul_ps(_mm256_loadu_ps(src + i), scale)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packAVX2(out));
+    }
+    floatToInt16Scalar(src + i, dst + i, count - i);
+}
+
+AACE_PCM_TARGET_AVX2 static inline __m128i scaleAVX2(__m128i in, __m256 gain) {
+    __m256 value = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(in));
+    return packAVX2(_mm256_cvtps_epi32(clampAVX2(_mm256_mul_ps(value, gain))));
+}
+
+AACE_PCM_TARGET_AVX2 static void applyGainAVX2(int16_t* samples, size_t count, float gain) {
+    const __m256 g = _mm256_set1_ps(gain);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i* ptr = reinterpret_cast<__m128i*>(samples + i);
+        _mm_storeu_si128(ptr, scaleAVX2(_mm_loadu_si128(ptr), g));
+    }
+    applyGainScalar(samples + i, count - i, gain);
+}
+
+AACE_PCM_TARGET_AVX2 static void applyGainRampAVX2(
+    int16_t* samples,
+    size_t frames,
+    size_t channels,
+    float startGain,
+    float endGain) {
+    float step = rampStep(frames, startGain, endGain);
+    size_t i = 0;
+    if (channels == 1) {
+        const __m256 start = _mm256_set1_ps(startGain);
+        const __m256 stepVec = _mm256_set1_ps(step);
+        const __m256i offset = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        for (; i + 8 <= frames; i += 8) {
+            __m256i index = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(i)), offset);
+            __m256 gain = _mm256_add_ps(start, _mm256_mul_ps(stepVec, _mm256_cvtepi32_ps(index)));
+            __m128i* ptr = reinterpret_cast<__m128i*>(samples + i);
+            _mm_storeu_si128(ptr, scaleAVX2(_mm_loadu_si128(ptr), gain));
+        }
+    }
+    applyGainRampFrom(samples, i, frames, channels, startGain, step);
+}
+
+AACE_PCM_TARGET_AVX2 static float dotProductAVX2(const float* a, const float* b, size_t count) {
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+        sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8)));
+    }
+    __m256 sum256 = _mm256_add_ps(sum0, sum1);
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(sum256), _mm256_extractf128_ps(sum256, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum) + dotProductScalar(a + i, b + i, count - i);
+}
+
+// the stereo downmix is bound by memory bandwidth, so the SSE2 implementation is reused
+static const Kernels AVX2_KERNELS = {SimdLevel::AVX2,
+                                     int16ToFloatAVX2,
+                                     floatToInt16AVX2,
+                                     applyGainAVX2,
+                                     applyGainRampAVX2,
+                                     downmixToMonoSSE2,
+                                     dotProductAVX2};
+
+#endif  // AACE_PCM_X86
+
+#ifdef AACE_PCM_NEON
+
+//
+// NEON
+//
+
+static inline int32x4_t roundToInt32NEON(float32x4_t value) {
+    value = vminq_f32(vmaxq_f32(value, vdupq_n_f32(INT16_MIN_FLOAT)), vdupq_n_f32(INT16_MAX_FLOAT));
+#if defined(__aarch64__)
+    return vcvtnq_s32_f32(value);
+#else
+    // ARMv7 NEON only truncates, so round before converting: adding and subtracting 1.5 * 2^23 leaves the value
+    // rounded to the nearest integer with ties to even, like lrint and the other implementations, which is exact
+    // for the clamped range
+    float32x4_t magic = vdupq_n_f32(12582912.0f);
+    return vcvtq_s32_f32(vsubq_f32(vaddq_f32(value, magic), magic));
+#endif
+}
+
+static void int16ToFloatNEON(const int16_t* src, float* dst, size_t count) {
+    const float scale = 1.0f / INT16_SCALE;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        int16x8_t in = vld1q_s16(src + i);
+        vst1q_f32(dst + i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(in))), scale));
+        vst1q_f32(dst + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(in))), scale));
+    }
+    int16ToFloatScalar(src + i, dst + i, count - i);
+}
+
+static void floatToInt16NEON(const float* src, int16_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        int32x4_t lo = roundToInt32NEON(vmulq_n_f32(vld1q_f32(src + i), INT16_SCALE));
+        int32x4_t hi = roundToInt32NEON(vmulq_n_f32(vld1q_f32(src + i + 4), INT16_SCALE));
+        vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)));
+    }
+    floatToInt16Scalar(src + i, dst + i, count - i);
+}
+
+static inline int16x8_t scaleNEON(int16x8_t in, float32x4_t gainLo, float32x4_t gainHi) {
+    float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(in)));
+    float32x4_t hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(in)));
+    return vcombine_s16(
+        vqmovn_s32(roundToInt32NEON(vmulq_f32(lo, gainLo))), vqmovn_s32(roundToInt32NEON(vmulq_f32(hi, gainHi))));
+}
+
+static void applyGainNEON(int16_t* samples, size_t count, float gain) {
+    const float32x4_t g = vdupq_n_f32(gain);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        vst1q_s16(samples + i, scaleNEON(vld1q_s16(samples + i), g, g));
+    }
+    applyGainScalar(samples + i, count - i, gain);
+}
+
+static void applyGainRampNEON(int16_t* samples, size_t frames, size_t channels, float startGain, float endGain) {
+    float step = rampStep(frames, startGain, endGain);
+    size_t i = 0;
+    if (channels == 1) {
+        static const float offsets[] = {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f};
+        const float32x4_t start = vdupq_n_f32(startGain);
+        const float32x4_t offsetLo = vld1q_f32(offsets);
+        const float32x4_t offsetHi = vld1q_f32(offsets + 4);
+        for (; i + 8 <= frames; i += 8) {
+            float32x4_t index = vdupq_n_f32(static_cast<float>(i));
+            float32x4_t gainLo = vaddq_f32(start, vmulq_n_f32(vaddq_f32(index, offsetLo), step));
+            float32x4_t gainHi = vaddq_f32(start, vmulq_n_f32(vaddq_f32(index, offsetHi), step));
+            vst1q_s16(samples + i, scaleNEON(vld1q_s16(samples + i), gainLo, gainHi));
+        }
+    }
+    applyGainRampFrom(samples, i, frames, channels, startGain, step);
+}
+
+static void downmixToMonoNEON(const int16_t* src, int16_t* dst, size_t frames, size_t channels) {
+    size_t i = 0;
+    if (channels == 2) {
+        for (; i + 8 <= frames; i += 8) {
+            int16x8x2_t in = vld2q_s16(src + i * 2);
+            vst1q_s16(dst + i, vhaddq_s16(in.val[0], in.val[1]));
+        }
+    }
+    downmixToMonoFrom(src, dst, i, frames, channels);
+}
+
+static float dotProductNEON(const float* a, const float* b, size_t count) {
+    float32x4_t sum0 = vdupq_n_f32(0.0f);
+    float32x4_t sum1 = vdupq_n_f32(0.0f);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        sum0 = vmlaq_f32(sum0, vld1q_f32(a + i), vld1q_f32(b + i));
+        sum1 = vmlaq_f32(sum1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+    }
+    float32x4_t sum = vaddq_f32(sum0, sum1);
+    float32x2_t pair = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+    return vget_lane_f32(vpadd_f32(pair, pair), 0) + dotProductScalar(a + i, b + i, count - i);
+}
+
+static const Kernels NEON_KERNELS = {SimdLevel::NEON,
+                                     int16ToFloatNEON,
+                                     floatToInt16NEON,
+                                     applyGainNEON,
+                                     applyGainRampNEON,
+                                     downmixToMonoNEON,
+                                     dotProductNEON};
+
+#endif  // AACE_PCM_NEON
+
+//
+// dispatch
+//
+
+static const Kernels* getKernels(SimdLevel level) {
+    switch (level) {
+#ifdef AACE_PCM_X86
+        case SimdLevel::SSE2:
+            return &SSE2_KERNELS;
+        case SimdLevel::AVX2:
+            return &AVX2_KERNELS;
+#endif
+#ifdef AACE_PCM_NEON
+        case SimdLevel::NEON:
+            return &NEON_KERNELS;
+#endif
+        default:
+            return &SCALAR_KERNELS;
+    }
+}
+
+static bool isSupported(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::SCALAR:
+            return true;
+#ifdef AACE_PCM_X86
+        case SimdLevel::SSE2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("sse2");
+        case SimdLevel::AVX2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+#endif
+#ifdef AACE_PCM_NEON
+        case SimdLevel::NEON:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+SimdLevel getSupportedSimdLevel() {
+    static const SimdLevel s_supportedLevel = []() -> SimdLevel {
+        for (auto level : {SimdLevel::AVX2, SimdLevel::SSE2, SimdLevel::NEON}) {
+            if (isSupported(level)) {
+                return level;
+            }
+        }
+        return SimdLevel::SCALAR;
+    }();
+    return s_supportedLevel;
+}
+
+static std::atomic<const Kernels*>& activeKernels() {
+    static std::atomic<const Kernels*> s_kernels(getKernels(getSupportedSimdLevel()));
+    return s_kernels;
+}
+
+static inline const Kernels* kernels() {
+    return activeKernels().load(std::memory_order_relaxed);
+}
+
+SimdLevel getSimdLevel() {
+    return kernels()->level;
+}
+
+bool setSimdLevel(SimdLevel level) {
+    if (!isSupported(level)) {
+        return false;
+    }
+    activeKernels().store(getKernels(level), std::memory_order_relaxed);
+    return true;
+}
+
+std::string toString(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::SCALAR:
+            return "SCALAR";
+        case SimdLevel::SSE2:
+            return "SSE2";
+        case SimdLevel::AVX2:
+            return "AVX2";
+        case SimdLevel::NEON:
+            return "NEON";
+    }
+    return "UNKNOWN";
+}
+
+size_t bytesToInt16(const char* data, size_t size, int16_t* samples) {
+    size_t count = size / sizeof(int16_t);
+    std::memcpy(samples, data, count * sizeof(int16_t));
+    return count;
+}
+
+void int16ToFloat(const int16_t* src, float* dst, size_t count) {
+    kernels()->int16ToFloat(src, dst, count);
+}
+
+void floatToInt16(const float* src, int16_t* dst, size_t count) {
+    kernels()->floatToInt16(src, dst, count);
+}
+
+void applyGain(int16_t* samples, size_t count, float gain) {
+    kernels()->applyGain(samples, count, gain);
+}
+
+void applyGainRamp(int16_t* samples, size_t frames, size_t channels, float startGain, float endGain) {
+    if (channels > 0) {
+        kernels()->applyGainRamp(samples, frames, channels, startGain, endGain);
+    }
+}
+
+void downmixToMono(const int16_t* src, int16_t* dst, size_t frames, size_t channels) {
+    if (channels == 1) {
+        std::memmove(dst, src, frames * sizeof(int16_t));
+    } else if (channels > 1) {
+        kernels()->downmixToMono(src, dst, frames, channels);
+    }
+}
+
+float dotProduct(const float* a, const float* b, size_t count) {
+    return kernels()->dotProduct(a, b, count);
+}
+
+}  // namespace pcm
+}  // namespace audio
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
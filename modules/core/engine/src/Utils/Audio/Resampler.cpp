@@ -0,0 +1,171 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/Utils/Audio/Resampler.h>
+#include <AACE/Engine/Utils/Audio/PCM.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace audio {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.engine.utils.audio.Resampler");
+
+/// Largest supported interpolation or decimation factor, which bounds the size of the filter table.
+static const unsigned int MAX_RATIO_TERM = 1024;
+
+/// Number of taps per polyphase branch for each unit of the decimation ratio.
+static const size_t TAPS_PER_RATIO = 16;
+
+/// Fraction of the output Nyquist frequency used as the filter cutoff.
+static const double CUTOFF_RATIO = 0.9;
+
+static const double PI = 3.14159265358979323846;
+
+static unsigned int gcd(unsigned int a, unsigned int b) {
+    while (b != 0) {
+        unsigned int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+Resampler::Resampler(
+    unsigned int inputRate,
+    unsigned int outputRate,
+    unsigned int interpolation,
+    unsigned int decimation) :
+        m_inputRate(inputRate),
+        m_outputRate(outputRate),
+        m_interpolation(interpolation),
+        m_decimation(decimation),
+        m_tapsPerPhase(0),
+        m_inputIndex(0),
+        m_phase(0) {
+    unsigned int ratio = (decimation + interpolation - 1) / interpolation;
+    m_tapsPerPhase = TAPS_PER_RATIO * std::max(ratio, 1u);
+
+    // design the prototype low pass filter at the upsampled rate with a Blackman window
+    size_t length = m_tapsPerPhase * interpolation;
+    double cutoff = CUTOFF_RATIO * 0.5 / std::max(interpolation, decimation);
+    double center = (length - 1) / 2.0;
+    std::vector<double> prototype(length);
+    for (size_t n = 0; n < length; n++) {
+        double x = n - center;
+        double sinc = x == 0.0 ? 2.0 * cutoff : std::sin(2.0 * PI * cutoff * x) / (PI * x);
+        double theta = 2.0 * PI * n / (length - 1);
+        double window = 0.42 - 0.5 * std::cos(theta) + 0.08 * std::cos(2.0 * theta);
+        prototype[n] = interpolation * sinc * window;
+    }
+
+    // split into polyphase branches, reversed so each branch lines up with the input history
+    m_coefficients.resize(length);
+    for (unsigned int phase = 0; phase < interpolation; phase++) {
+        float* branch = &m_coefficients[phase * m_tapsPerPhase];
+        for (size_t k = 0; k < m_tapsPerPhase; k++) {
+            branch[m_tapsPerPhase - 1 - k] = static_cast<float>(prototype[phase + k * interpolation]);
+        }
+    }
+
+    reset();
+}
+
+std::unique_ptr<Resampler> Resampler::create(unsigned int inputRate, unsigned int outputRate) {
+    try {
+        ThrowIf(inputRate == 0 || outputRate == 0, "invalidSampleRate");
+
+        unsigned int divisor = gcd(inputRate, outputRate);
+        unsigned int interpolation = outputRate / divisor;
+        unsigned int decimation = inputRate / divisor;
+        ThrowIf(interpolation > MAX_RATIO_TERM || decimation > MAX_RATIO_TERM, "unsupportedRateRatio");
+
+        return std::unique_ptr<Resampler>(new Resampler(inputRate, outputRate, interpolation, decimation));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("inputRate", inputRate).d("outputRate", outputRate));
+        return nullptr;
+    }
+}
+
+bool Resampler::process(
+    const int16_t* input,
+    size_t inputCount,
+    int16_t* output,
+    size_t outputCapacity,
+    size_t& outputCount) {
+    try {
+        outputCount = 0;
+        ThrowIf(outputCapacity < getMaxOutputCount(inputCount), "outputCapacityTooSmall");
+
+        size_t history = m_tapsPerPhase - 1;
+        size_t offset = m_buffer.size();
+        m_buffer.resize(offset + inputCount);
+        pcm::int16ToFloat(input, m_buffer.data() + offset, inputCount);
+
+        m_output.clear();
+        m_output.reserve(getMaxOutputCount(inputCount));
+        while (m_inputIndex < m_buffer.size()) {
+            m_output.push_back(pcm::dotProduct(
+                &m_coefficients[m_phase * m_tapsPerPhase], &m_buffer[m_inputIndex - history], m_tapsPerPhase));
+            m_phase += m_decimation;
+            m_inputIndex += m_phase / m_interpolation;
+            m_phase %= m_interpolation;
+        }
+
+        // keep only the history needed by the next block
+        size_t consumed = m_buffer.size() - history;
+        m_buffer.erase(m_buffer.begin(), m_buffer.begin() + consumed);
+        m_inputIndex -= consumed;
+
+        outputCount = m_output.size();
+        pcm::floatToInt16(m_output.data(), output, outputCount);
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG)
+                       .d("reason", ex.what())
+                       .d("capacity", outputCapacity)
+                       .d("required", getMaxOutputCount(inputCount)));
+        return false;
+    }
+}
+
+size_t Resampler::getMaxOutputCount(size_t inputCount) const {
+    return (inputCount * m_interpolation + m_decimation - 1) / m_decimation + 1;
+}
+
+void Resampler::reset() {
+    m_buffer.assign(m_tapsPerPhase - 1, 0.0f);
+    m_inputIndex = m_tapsPerPhase - 1;
+    m_phase = 0;
+}
+
+unsigned int Resampler::getInputRate() const {
+    return m_inputRate;
+}
+
+unsigned int Resampler::getOutputRate() const {
+    return m_outputRate;
+}
+
+}  // namespace audio
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
@@ -0,0 +1,339 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/Utils/Event/EventBuilder.h>
+#include <AACE/Engine/Utils/UUID/UUID.h>
+
+#include <cctype>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace event {
+
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+/// The characters following a backslash in a JSON string, except @c u.
+static const std::string ESCAPE_CHARACTERS("\"\\/bfnrt");
+
+void appendString(std::string& buffer, const std::string& value) {
+    buffer.push_back('"');
+    for (char c : value) {
+        switch (c) {
+            case '"':
+                buffer.append("\\\"");
+                break;
+            case '\\':
+                buffer.append("\\\\");
+                break;
+            case '\b':
+                buffer.append("\\b");
+                break;
+            case '\f':
+                buffer.append("\\f");
+                break;
+            case '\n':
+                buffer.append("\\n");
+                break;
+            case '\r':
+                buffer.append("\\r");
+                break;
+            case '\t':
+                buffer.append("\\t");
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    buffer.append("\\u00");
+                    buffer.push_back(HEX_DIGITS[(c >> 4) & 0xf]);
+                    buffer.push_back(HEX_DIGITS[c & 0xf]);
+                } else {
+                    buffer.push_back(c);
+                }
+                break;
+        }
+    }
+    buffer.push_back('"');
+}
+
+void appendContextState(
+    std::string& buffer,
+    const std::string& nameSpace,
+    const std::string& name,
+    const std::string& payload) {
+    buffer.append("{\"header\":{\"namespace\":");
+    appendString(buffer, nameSpace);
+    buffer.append(",\"name\":");
+    appendString(buffer, name);
+    buffer.append("},\"payload\":");
+    buffer.append(payload);
+    buffer.push_back('}');
+}
+
+std::pair<std::string, std::string> buildEvent(
+    const std::string& nameSpace,
+    const std::string& name,
+    const std::string& dialogRequestId,
+    const std::string& payload,
+    const std::string& context) {
+    auto messageId = uuid::generateUUID();
+
+    std::string event;
+    event.reserve(
+        128 + nameSpace.size() + name.size() + messageId.size() + dialogRequestId.size() + payload.size() +
+        context.size());
+    event.push_back('{');
+    if (!context.empty()) {
+        event.append("\"context\":");
+        event.append(context);
+        event.push_back(',');
+    }
+    event.append("\"event\":{\"header\":{\"namespace\":");
+    appendString(event, nameSpace);
+    event.append(",\"name\":");
+    appendString(event, name);
+    event.append(",\"messageId\":");
+    appendString(event, messageId);
+    if (!dialogRequestId.empty()) {
+        event.append(",\"dialogRequestId\":");
+        appendString(event, dialogRequestId);
+    }
+    event.append("},\"payload\":");
+    event.append(payload);
+    event.append("}}");
+
+    return {messageId, event};
+}
+
+/// Reads the serialized JSON values of a string, without building a document.
+class Scanner {
+public:
+    Scanner(const std::string& json) : m_json(json), m_position(0) {
+    }
+
+    size_t getPosition() const {
+        return m_position;
+    }
+
+    bool atEnd() {
+        skipWhitespace();
+        return m_position == m_json.size();
+    }
+
+    /// Reads a character, after the whitespace before it.
+    bool consume(char c) {
+        skipWhitespace();
+        if (m_position < m_json.size() && m_json[m_position] == c) {
+            m_position++;
+            return true;
+        }
+        return false;
+    }
+
+    /// Reads a string, after the whitespace before it, and returns it with its quotes and escape sequences.
+    bool readString(size_t& start) {
+        skipWhitespace();
+        start = m_position;
+        if (m_position >= m_json.size() || m_json[m_position] != '"') {
+            return false;
+        }
+        for (m_position++; m_position < m_json.size(); m_position++) {
+            auto c = static_cast<unsigned char>(m_json[m_position]);
+            if (c == '"') {
+                m_position++;
+                return true;
+            } else if (c == '\\') {
+                if (++m_position >= m_json.size()) {
+                    return false;
+                }
+                if (m_json[m_position] == 'u') {
+                    unsigned int codeUnit;
+                    if (!readCodeUnit(codeUnit) || (codeUnit >= 0xdc00 && codeUnit <= 0xdfff)) {
+                        return false;
+                    }
+                    if (codeUnit >= 0xd800 && codeUnit <= 0xdbff) {
+                        // a high surrogate must be followed by the escaped low surrogate of the pair
+                        if (m_json.compare(m_position + 1, 2, "\\u") != 0) {
+                            return false;
+                        }
+                        m_position += 2;
+                        if (!readCodeUnit(codeUnit) || codeUnit < 0xdc00 || codeUnit > 0xdfff) {
+                            return false;
+                        }
+                    }
+                } else if (ESCAPE_CHARACTERS.find(m_json[m_position]) == std::string::npos) {
+                    return false;
+                }
+            } else if (c < 0x20) {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    /// Reads a value, after the whitespace before it, and returns the position where it starts.
+    bool readValue(size_t& start, int depth = 0) {
+        skipWhitespace();
+        start = m_position;
+        if (m_position >= m_json.size() || depth > MAX_DEPTH) {
+            return false;
+        }
+        switch (m_json[m_position]) {
+            case '"':
+                return readString(start);
+            case '{': {
+                m_position++;
+                if (consume('}')) {
+                    return true;
+                }
+                size_t next;
+                do {
+                    if (!readString(next) || !consume(':') || !readValue(next, depth + 1)) {
+                        return false;
+                    }
+                } while (consume(','));
+                return consume('}');
+            }
+            case '[': {
+                m_position++;
+                if (consume(']')) {
+                    return true;
+                }
+                size_t next;
+                do {
+                    if (!readValue(next, depth + 1)) {
+                        return false;
+                    }
+                } while (consume(','));
+                return consume(']');
+            }
+            case 't':
+                return readLiteral("true");
+            case 'f':
+                return readLiteral("false");
+            case 'n':
+                return readLiteral("null");
+            default:
+                return readNumber();
+        }
+    }
+
+private:
+    void skipWhitespace() {
+        while (m_position < m_json.size() && (m_json[m_position] == ' ' || m_json[m_position] == '\t' ||
+                                              m_json[m_position] == '\n' || m_json[m_position] == '\r')) {
+            m_position++;
+        }
+    }
+
+    bool readLiteral(const char* literal) {
+        auto length = std::char_traits<char>::length(literal);
+        if (m_json.compare(m_position, length, literal) != 0) {
+            return false;
+        }
+        m_position += length;
+        return true;
+    }
+
+    /// Reads the four hexadecimal digits following the @c u of an escape sequence, and leaves the position on the last.
+    bool readCodeUnit(unsigned int& codeUnit) {
+        codeUnit = 0;
+        for (int i = 0; i < 4; i++) {
+            if (++m_position >= m_json.size()) {
+                return false;
+            }
+            auto c = static_cast<unsigned char>(m_json[m_position]);
+            if (!std::isxdigit(c)) {
+                return false;
+            }
+            codeUnit = codeUnit * 16 + (std::isdigit(c) ? c - '0' : std::tolower(c) - 'a' + 10);
+        }
+        return true;
+    }
+
+    bool readDigits() {
+        auto start = m_position;
+        while (m_position < m_json.size() && std::isdigit(static_cast<unsigned char>(m_json[m_position]))) {
+            m_position++;
+        }
+        return m_position > start;
+    }
+
+    bool readNumber() {
+        if (m_json[m_position] == '-') {
+            m_position++;
+        }
+        if (m_position < m_json.size() && m_json[m_position] == '0') {
+            m_position++;
+        } else if (!readDigits()) {
+            return false;
+        }
+        if (m_position < m_json.size() && m_json[m_position] == '.') {
+            m_position++;
+            if (!readDigits()) {
+                return false;
+            }
+        }
+        if (m_position < m_json.size() && (m_json[m_position] == 'e' || m_json[m_position] == 'E')) {
+            m_position++;
+            if (m_position < m_json.size() && (m_json[m_position] == '+' || m_json[m_position] == '-')) {
+                m_position++;
+            }
+            if (!readDigits()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// The maximum nesting of the values read, which bounds the recursion.
+    static const int MAX_DEPTH = 256;
+
+    const std::string& m_json;
+    size_t m_position;
+};
+
+bool getMembers(const std::string& object, std::unordered_map<std::string, std::string>& members) {
+    Scanner scanner(object);
+    if (!scanner.consume('{')) {
+        return false;
+    }
+    if (!scanner.consume('}')) {
+        do {
+            size_t nameStart, valueStart;
+            if (!scanner.readString(nameStart)) {
+                return false;
+            }
+            auto nameEnd = scanner.getPosition();
+            if (!scanner.consume(':') || !scanner.readValue(valueStart)) {
+                return false;
+            }
+
+            // the names with escape sequences are not compared with the requested names
+            auto it = members.find(object.substr(nameStart + 1, nameEnd - nameStart - 2));
+            if (it != members.end()) {
+                it->second.assign(object, valueStart, scanner.getPosition() - valueStart);
+            }
+        } while (scanner.consume(','));
+        if (!scanner.consume('}')) {
+            return false;
+        }
+    }
+    return scanner.atEnd();
+}
+
+}  // namespace event
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
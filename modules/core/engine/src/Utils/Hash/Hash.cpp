@@ -0,0 +1,44 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstdio>
+
+#include <AACE/Engine/Utils/Hash/Hash.h>
+
+namespace aace {
+namespace engine {
+namespace utils {
+namespace hash {
+
+static const uint64_t FNV1A_PRIME = 1099511628211ULL;
+
+uint64_t fnv1a(const std::string& data, uint64_t hash) {
+    for (unsigned char c : data) {
+        hash = (hash ^ c) * FNV1A_PRIME;
+    }
+    return hash;
+}
+
+std::string toHex(uint64_t hash) {
+    char buffer[17];
+    std::snprintf(
+        buffer, sizeof(buffer), "%08x%08x", static_cast<unsigned>(hash >> 32), static_cast<unsigned>(hash));
+    return buffer;
+}
+
+}  // namespace hash
+}  // namespace utils
+}  // namespace engine
+}  // namespace aace
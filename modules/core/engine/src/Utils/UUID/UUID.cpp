@@ -14,122 +14,90 @@
  */
 
 #include <AACE/Engine/Utils/UUID/UUID.h>
-#include <AACE/Engine/Core/EngineMacros.h>
 
-#include <random>
-#include <chrono>
-#include <sstream>
-#include <iomanip>
-#include <mutex>
-#include <climits>
 #include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
 #include <functional>
+#include <random>
+#include <thread>
 
 namespace aace {
 namespace engine {
 namespace utils {
 namespace uuid {
 
-/// The UUID version (Version 4), shifted into the correct position in the byte.
-static const uint8_t UUID_VERSION_VALUE = 4 << 4;
+/// The UUID version (Version 4), in the position of the version digit in the high 64 bits.
+static const uint64_t UUID_VERSION_VALUE = 0x4000ULL;
 
-/// The UUID variant (Variant 1), shifted into the correct position in the byte.
-static const size_t UUID_VARIANT_VALUE = 2 << 6;
+/// The bits of the version digit in the high 64 bits.
+static const uint64_t UUID_VERSION_MASK = 0xf000ULL;
 
-/// Separator used between UUID fields.
-static const std::string SEPARATOR("-");
+/// The UUID variant (Variant 1), in the two most significant bits of the low 64 bits.
+static const uint64_t UUID_VARIANT_VALUE = 0x8000000000000000ULL;
 
-/// Number of bits in the replacement value.
-static const size_t MAX_NUM_REPLACEMENT_BITS = CHAR_BIT;
+/// The bits of the variant in the low 64 bits.
+static const uint64_t UUID_VARIANT_MASK = 0xc000000000000000ULL;
 
-/// Number of bits in a hex digit.
-static const size_t BITS_IN_HEX_DIGIT = 4;
+/// The number of characters of a UUID.
+static const size_t UUID_LENGTH = 36;
 
-// String to identify log entries originating from this file.
-static const std::string TAG("aace.engine.utils.uuid.UUID");
+/// The lower case hex digits, indexed by their value.
+static const char HEX_DIGITS[] = "0123456789abcdef";
 
 /**
- * Randomly generate a string of hex digits. Before the conversion of hex to string,
- * the function allows replacement of the bits of the first two generated hex digits.
- * Replacement happens starting at the most significant, to the least significant bit.
- *
- * @param ibe A random number generator.
- * @param numDigits The number of hex digits [0-9],[a-f] to generate.
- * @param replacementBits The replacement value for up to the first two digits generated.
- * @param numReplacementBits The number of bits of @c replacementBits to use.
- *
- * @return A hex string of length @c numDigits.
+ * Returns the random engine of the calling thread. Each thread seeds its own engine the first time it generates a
+ * UUID, so threads generating UUIDs never wait for each other.
  */
-static const std::string generateHexWithReplacement(
-    std::independent_bits_engine<std::default_random_engine, CHAR_BIT, uint8_t>& ibe,
-    unsigned int numDigits,
-    uint8_t replacementBits,
-    unsigned short numReplacementBits) {
-    try {
-        ThrowIf(numReplacementBits > MAX_NUM_REPLACEMENT_BITS, "replacingMoreBitsThanProvided");
-        ThrowIf(numReplacementBits > (numDigits * BITS_IN_HEX_DIGIT), "replacingMoreBitsThanGenerated");
-
-        // Makes assumption that 1 digit = 4 bits.
-        std::vector<uint8_t> bytes(ceil(numDigits / 2.0));
-        std::generate(bytes.begin(), bytes.end(), std::ref(ibe));
-
-        // Replace the specified number of bits from the first byte.
-        bytes.at(0) &= (0xff >> numReplacementBits);
-        replacementBits &= (0xff << (MAX_NUM_REPLACEMENT_BITS - numReplacementBits));
-        bytes.at(0) |= replacementBits;
-
-        std::ostringstream oss;
-        for (const auto& byte : bytes) {
-            oss << std::hex << std::setfill('0') << std::setw(2) << static_cast<int>(byte);
-        }
-
-        std::string bytesText = oss.str();
-        // Remove the last digit for odd numDigits case.
-        bytesText.resize(numDigits);
-
-        return bytesText;
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "generateHexWithReplacement").d("reason", ex.what()));
-        return std::string();
-    }
+static std::mt19937_64& getRandomEngine() {
+    static thread_local std::mt19937_64 engine([]() {
+        std::random_device rd;
+        auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+        auto threadId = std::hash<std::thread::id>()(std::this_thread::get_id());
+        std::seed_seq seed{rd(),
+                           rd(),
+                           rd(),
+                           rd(),
+                           static_cast<uint32_t>(now),
+                           static_cast<uint32_t>(static_cast<uint64_t>(now) >> 32),
+                           static_cast<uint32_t>(threadId),
+                           static_cast<uint32_t>(static_cast<uint64_t>(threadId) >> 32)};
+        return std::mt19937_64(seed);
+    }());
+    return engine;
 }
 
 /**
- * Randomly generate a string of hex digits.
+ * Writes the hex digits of the @c count least significant nibbles of @c value, most significant first.
  *
- * @param ibe A random number generator.
- * @param numDigits The number of hex digits [0-9],[a-f] to generate.
- *
- * @return A hex string of length @c numDigits.
+ * @return The position following the last digit written.
  */
-static const std::string generateHex(
-    std::independent_bits_engine<std::default_random_engine, CHAR_BIT, uint8_t>& ibe,
-    unsigned int numDigits) {
-    return generateHexWithReplacement(ibe, numDigits, 0, 0);
+static char* writeHex(char* out, uint64_t value, int count) {
+    for (int shift = (count - 1) * 4; shift >= 0; shift -= 4) {
+        *out++ = HEX_DIGITS[(value >> shift) & 0xf];
+    }
+    return out;
 }
 
 const std::string generateUUID() {
-    static bool seeded = false;
-    static std::independent_bits_engine<std::default_random_engine, CHAR_BIT, uint8_t> ibe;
-    static std::mutex mutex;
-    std::unique_lock<std::mutex> lock(mutex);
-    if (!seeded) {
-        std::random_device rd;
-        ibe.seed(
-            rd() +
-            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
-                .count());
-        seeded = true;
-    }
-
-    std::ostringstream uuidText;
-    uuidText << generateHex(ibe, 8) << SEPARATOR << generateHex(ibe, 4) << SEPARATOR
-             << generateHexWithReplacement(ibe, 4, UUID_VERSION_VALUE, 4) << SEPARATOR
-             << generateHexWithReplacement(ibe, 4, UUID_VARIANT_VALUE, 2) << SEPARATOR << generateHex(ibe, 12);
-
-    lock.unlock();
-
-    return uuidText.str();
+    auto& engine = getRandomEngine();
+    uint64_t high = (engine() & ~UUID_VERSION_MASK) | UUID_VERSION_VALUE;
+    uint64_t low = (engine() & ~UUID_VARIANT_MASK) | UUID_VARIANT_VALUE;
+
+    // xxxxxxxx-xxxx-Mxxx-Nxxx-xxxxxxxxxxxx
+    char text[UUID_LENGTH];
+    char* out = writeHex(text, high >> 32, 8);
+    *out++ = '-';
+    out = writeHex(out, high >> 16, 4);
+    *out++ = '-';
+    out = writeHex(out, high, 4);
+    *out++ = '-';
+    out = writeHex(out, low >> 48, 4);
+    *out++ = '-';
+    writeHex(out, low, 12);
+
+    return std::string(text, UUID_LENGTH);
 }
 
 bool compare(const std::string& uuid1, const std::string& uuid2) {
@@ -159,10 +159,9 @@ void VehicleEngineService::getVehicleConfigProperty(
     }
 }
 
-bool VehicleEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool VehicleEngineService::configure(std::shared_ptr<const json::Value> configuration) {
     try {
-        auto root = aace::engine::utils::json::toJson(configuration);
-        ThrowIfNull(root, "parseConfigurationFailed");
+        auto& root = *configuration;
 
         auto info = json::get(root, "/info", json::Type::object);
         if (info != nullptr) {
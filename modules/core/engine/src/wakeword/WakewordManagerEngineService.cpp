@@ -123,12 +123,10 @@ void WakewordManagerEngineService::updateOnWakewordDetected(
     }
 }
 
-bool WakewordManagerEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool WakewordManagerEngineService::configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) {
     AACE_INFO(LX(TAG));
     try {
-        json jconfiguration;
-        jconfiguration = nlohmann::json::parse(*configuration);
-        auto& wakewordManager = jconfiguration.at(WAKEWORDMANAGER);
+        auto& wakewordManager = configuration->at(WAKEWORDMANAGER);
         ThrowIfNot(
             wakewordManager.contains(THIRD_PARTY_WAKEWORDS), "no3PWakewordsConfiguration");
         auto thirdPartyWakewords = wakewordManager[THIRD_PARTY_WAKEWORDS];
@@ -70,6 +70,14 @@ public:
      */
     void locationServiceAccessChanged(LocationServiceAccess access);
 
+    /**
+     * Notifies the Engine of the current geolocation of the device. Use this function to push location
+     * updates as they arrive, so the Engine can answer location queries without calling @c getLocation().
+     *
+     * @param [in] location The current location
+     */
+    void locationChanged(const aace::location::Location& location);
+
     /**
      * @internal
      * Sets the Engine interface delegate.
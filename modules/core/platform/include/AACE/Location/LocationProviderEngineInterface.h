@@ -20,6 +20,8 @@
 
 #include <iostream>
 
+#include "Location.h"
+
 namespace aace {
 namespace location {
 
@@ -46,6 +48,8 @@ public:
     };
 
     virtual void onLocationServiceAccessChanged(LocationServiceAccess access) = 0;
+
+    virtual void onLocationChanged(const Location& location) = 0;
 };
 
 inline std::ostream& operator<<(
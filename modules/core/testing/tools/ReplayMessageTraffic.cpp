@@ -0,0 +1,102 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <AACE/Core/Engine.h>
+#include <AACE/Core/EngineConfiguration.h>
+#include <AACE/Test/Unit/MessageBroker/MessageTrafficReplayer.h>
+
+using MessageTrafficReplayer = aace::test::unit::core::MessageTrafficReplayer;
+
+static void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options] <recording> <config>..." << std::endl
+              << std::endl
+              << "Replays the platform side of a message traffic recording against an Engine configured with the"
+              << std::endl
+              << "configuration files, and prints the statistics of the replay." << std::endl
+              << std::endl
+              << "Options:" << std::endl
+              << "  --rate <factor>       How many times faster than recorded the messages are published (1)"
+              << std::endl
+              << "  --sessions <count>    The number of sessions replaying the recording concurrently (1)" << std::endl
+              << "  --idle-timeout <ms>   The time without messages from the Engine after which the replay ends (500)"
+              << std::endl;
+}
+
+int main(int argc, char** argv) {
+    MessageTrafficReplayer::Options options;
+    std::vector<std::string> paths;
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (arg == "--rate" && hasValue) {
+                options.rate = std::stod(argv[++i]);
+            } else if (arg == "--sessions" && hasValue) {
+                options.sessions = std::stoi(argv[++i]);
+            } else if (arg == "--idle-timeout" && hasValue) {
+                options.idleTimeout = std::chrono::milliseconds(std::stol(argv[++i]));
+            } else if (arg.compare(0, 2, "--") == 0) {
+                printUsage(argv[0]);
+                return 1;
+            } else {
+                paths.push_back(arg);
+            }
+        }
+    } catch (std::exception& ex) {
+        std::cerr << "Invalid option value: " << ex.what() << std::endl;
+        return 1;
+    }
+    if (paths.size() < 2 || options.rate <= 0 || options.sessions <= 0) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    auto replayer = MessageTrafficReplayer::create(paths[0]);
+    if (replayer == nullptr) {
+        std::cerr << "Cannot read the recording " << paths[0] << std::endl;
+        return 1;
+    }
+
+    std::vector<std::shared_ptr<aace::core::config::EngineConfiguration>> configurationList;
+    for (size_t i = 1; i < paths.size(); i++) {
+        auto configuration = aace::core::config::ConfigurationFile::create(paths[i]);
+        if (configuration == nullptr) {
+            std::cerr << "Cannot read the configuration " << paths[i] << std::endl;
+            return 1;
+        }
+        configurationList.push_back(configuration);
+    }
+
+    auto engine = aace::core::Engine::create();
+    if (engine == nullptr || !engine->configure(configurationList) || !engine->start()) {
+        std::cerr << "Cannot start the Engine" << std::endl;
+        return 1;
+    }
+
+    auto result = replayer->replay(engine->getMessageBroker(), options);
+    std::cout << "published: " << result.published << std::endl
+              << "replied: " << result.replied << std::endl
+              << "received: " << result.received << std::endl
+              << "recorded per session: " << result.recorded << std::endl
+              << "duration: " << result.duration.count() << " ms" << std::endl;
+
+    engine->shutdown();
+    return 0;
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_TEST_UNIT_MESSAGE_BROKER_MESSAGE_TRAFFIC_REPLAYER_H
+#define AACE_TEST_UNIT_MESSAGE_BROKER_MESSAGE_TRAFFIC_REPLAYER_H
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <AACE/Core/MessageBroker.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace core {
+
+/**
+ * Replays the platform side of a recording made by @c MessageTrafficRecorder against an Engine, so the Engine can be
+ * profiled with the traffic of a real session without the platform implementation that produced it.
+ *
+ * The replayer connects to the Engine through the @c aace::core::MessageBroker of the platform, and stands in for
+ * the platform handlers:
+ * @li The messages the platform published are published again, with new ids, at their recorded times.
+ * @li The messages the Engine publishes are answered with the reply the platform sent to the recorded message
+ *     with the same topic and action, if it sent one.
+ *
+ * The traffic can be scaled up by replaying it faster than it was recorded, and by replaying several sessions
+ * concurrently. The sessions share one handler of the messages of the Engine, so a request of the Engine is answered
+ * with the same recorded reply whichever session caused it.
+ *
+ * The replayer is built with the unit test framework, and the @c ReplayMessageTraffic tool replays a recording
+ * against an Engine configured from files.
+ */
+class MessageTrafficReplayer {
+private:
+    MessageTrafficReplayer() = default;
+
+public:
+    /// The options of a replay
+    struct Options {
+        /// How many times faster than recorded the messages are published
+        double rate = 1;
+
+        /// The number of sessions replaying the recording concurrently
+        int sessions = 1;
+
+        /// Once the recording is over, the time without messages from the Engine after which the replay ends
+        std::chrono::milliseconds idleTimeout{500};
+    };
+
+    /// The statistics of a replay
+    struct Result {
+        /// The number of messages published to the Engine, not counting the replies
+        size_t published = 0;
+
+        /// The number of replies published to the Engine
+        size_t replied = 0;
+
+        /// The number of messages received from the Engine
+        size_t received = 0;
+
+        /// The number of messages the Engine published in the recording, for each replayed session
+        size_t recorded = 0;
+
+        /// The time from the first message to the end of the replay
+        std::chrono::milliseconds duration{0};
+    };
+
+    /**
+     * Loads a recording.
+     *
+     * @param path The path of the recording.
+     * @return The replayer, or @c nullptr if the recording cannot be read.
+     */
+    static std::shared_ptr<MessageTrafficReplayer> create(const std::string& path);
+
+    /**
+     * Replays the recording, and returns once the scaled duration of the recording has elapsed and the Engine
+     * stopped publishing messages. The replayer stops answering the messages of the Engine when it returns, but its
+     * subscription cannot be removed, so a replay should use an Engine of its own.
+     *
+     * @param messageBroker The message broker of the Engine.
+     * @param options The options of the replay.
+     * @return The statistics of the replay.
+     */
+    Result replay(std::shared_ptr<aace::core::MessageBroker> messageBroker, const Options& options);
+
+private:
+    /// A message the platform published, and the time it was published at
+    struct Entry {
+        std::chrono::microseconds time;
+        nlohmann::json message;
+    };
+
+    /// Publishes the messages of a session at their scaled times.
+    size_t replaySession(
+        std::shared_ptr<aace::core::MessageBroker> messageBroker,
+        const std::string& sessionId,
+        std::chrono::steady_clock::time_point startTime,
+        double rate);
+
+    /// The messages the platform published, other than replies, in the order they were published
+    std::vector<Entry> m_entries;
+
+    /// The reply the platform sent to a message from the Engine, for each topic and action, which outlives the
+    /// replayer in the subscriptions of the Engine
+    std::shared_ptr<std::unordered_map<std::string, nlohmann::json>> m_replies;
+
+    /// The number of messages the Engine published
+    size_t m_recorded = 0;
+
+    /// The time of the last recorded message
+    std::chrono::microseconds m_duration{0};
+};
+
+}  // namespace core
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
+
+#endif  // AACE_TEST_UNIT_MESSAGE_BROKER_MESSAGE_TRAFFIC_REPLAYER_H
@@ -0,0 +1,224 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <fstream>
+#include <thread>
+
+#include <AACE/Engine/Core/EngineMacros.h>
+#include <AACE/Engine/Utils/String/StringUtils.h>
+#include <AACE/Engine/Utils/UUID/UUID.h>
+#include <AACE/Test/Unit/MessageBroker/MessageTrafficReplayer.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+namespace core {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.test.unit.core.MessageTrafficReplayer");
+
+/// Returns the key of the replies to the messages with a topic and action.
+static std::string getReplyKey(const nlohmann::json& header) {
+    auto& messageDescription = header.at("messageDescription");
+    return messageDescription.at("topic").get<std::string>() + ":" +
+           messageDescription.at("action").get<std::string>();
+}
+
+static bool isReply(const nlohmann::json& header) {
+    return aace::engine::utils::string::equal(header.at("messageType").get<std::string>(), "reply", false);
+}
+
+std::shared_ptr<MessageTrafficReplayer> MessageTrafficReplayer::create(const std::string& path) {
+    try {
+        std::ifstream file(path);
+        ThrowIfNot(file.is_open(), "openFileFailed");
+
+        auto replayer = std::shared_ptr<MessageTrafficReplayer>(new MessageTrafficReplayer());
+        replayer->m_replies = std::make_shared<std::unordered_map<std::string, nlohmann::json>>();
+
+        // the topic and action of the messages from the Engine, to find the messages the platform replied to
+        std::unordered_map<std::string, std::string> outgoingReplyKeys;
+        std::string line;
+        size_t lineNumber = 0;
+        while (std::getline(file, line)) {
+            lineNumber++;
+            if (line.empty()) {
+                continue;
+            }
+            try {
+                auto entry = nlohmann::json::parse(line);
+                std::chrono::microseconds time(entry.at("time").get<int64_t>());
+                auto direction = entry.at("direction").get<std::string>();
+                auto message = nlohmann::json::parse(entry.at("message").get<std::string>());
+                auto& header = message.at("header");
+                replayer->m_duration = std::max(replayer->m_duration, time);
+
+                if (direction == "OUTGOING") {
+                    replayer->m_recorded++;
+                    if (!isReply(header)) {
+                        outgoingReplyKeys[header.at("id").get<std::string>()] = getReplyKey(header);
+                    }
+                } else if (isReply(header)) {
+                    // the first reply to a message with the same topic and action answers them all
+                    auto replyTo = header.at("messageDescription").at("replyToId").get<std::string>();
+                    auto it = outgoingReplyKeys.find(replyTo);
+                    if (it != outgoingReplyKeys.end()) {
+                        replayer->m_replies->emplace(it->second, std::move(message));
+                    }
+                } else {
+                    replayer->m_entries.push_back({time, std::move(message)});
+                }
+            } catch (std::exception& ex) {
+                // the last line is incomplete if the Engine stopped while recording
+                AACE_WARN(LX(TAG).m("Skipping invalid entry").d("reason", ex.what()).d("line", lineNumber));
+            }
+        }
+        ThrowIf(replayer->m_entries.empty() && replayer->m_replies->empty(), "emptyRecording");
+
+        AACE_INFO(LX(TAG)
+                      .d("path", path)
+                      .d("published", replayer->m_entries.size())
+                      .d("replies", replayer->m_replies->size())
+                      .d("recorded", replayer->m_recorded));
+        return replayer;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("path", path));
+        return nullptr;
+    }
+}
+
+MessageTrafficReplayer::Result MessageTrafficReplayer::replay(
+    std::shared_ptr<aace::core::MessageBroker> messageBroker,
+    const Options& options) {
+    Result result;
+    try {
+        ThrowIfNull(messageBroker, "invalidMessageBroker");
+        ThrowIfNot(options.rate > 0 && options.sessions > 0, "invalidOptions");
+
+        // the state of the platform handlers, which ignore the messages of the Engine once the replay is over
+        struct State {
+            std::weak_ptr<aace::core::MessageBroker> messageBroker;
+            std::shared_ptr<std::unordered_map<std::string, nlohmann::json>> replies;
+            std::atomic<size_t> replied{0};
+            std::atomic<size_t> received{0};
+            std::atomic<std::chrono::steady_clock::rep> lastReceivedTime{0};
+        };
+        auto state = std::make_shared<State>();
+        state->messageBroker = messageBroker;
+        state->replies = m_replies;
+
+        std::weak_ptr<State> wp = state;
+        messageBroker->subscribe([wp](const std::string& message) {
+            auto sp = wp.lock();
+            if (sp == nullptr) {
+                return;
+            }
+            sp->received++;
+            sp->lastReceivedTime = std::chrono::steady_clock::now().time_since_epoch().count();
+            try {
+                auto json = nlohmann::json::parse(message);
+                auto& header = json.at("header");
+                if (isReply(header)) {
+                    return;
+                }
+                auto it = sp->replies->find(getReplyKey(header));
+                if (it == sp->replies->end()) {
+                    return;
+                }
+                auto reply = it->second;
+                reply["header"]["id"] = aace::engine::utils::uuid::generateUUID();
+                reply["header"]["messageDescription"]["replyToId"] = header.at("id");
+                if (auto messageBroker = sp->messageBroker.lock()) {
+                    messageBroker->publish(reply.dump());
+                    sp->replied++;
+                }
+            } catch (std::exception& ex) {
+                AACE_ERROR(LX(TAG).d("reason", ex.what()));
+            }
+        });
+
+        auto startTime = std::chrono::steady_clock::now();
+        std::vector<std::thread> sessions;
+        std::vector<size_t> published(options.sessions);
+        for (int i = 0; i < options.sessions; i++) {
+            sessions.emplace_back([this, i, messageBroker, startTime, &options, &published]() {
+                published[i] = replaySession(messageBroker, std::to_string(i), startTime, options.rate);
+            });
+        }
+        for (auto& session : sessions) {
+            session.join();
+        }
+
+        // answer the messages the Engine publishes after the last message of the platform, until it is idle
+        auto idleTime = startTime +
+                        std::chrono::duration_cast<std::chrono::steady_clock::duration>(m_duration / options.rate) +
+                        options.idleTimeout;
+        while (std::chrono::steady_clock::now() < idleTime) {
+            std::this_thread::sleep_until(idleTime);
+            auto lastReceivedTime = std::chrono::steady_clock::time_point(
+                std::chrono::steady_clock::duration(state->lastReceivedTime.load()));
+            idleTime = std::max(idleTime, lastReceivedTime + options.idleTimeout);
+        }
+
+        for (auto count : published) {
+            result.published += count;
+        }
+        result.replied = state->replied;
+        result.received = state->received;
+        result.recorded = m_recorded;
+        result.duration = std::chrono::duration_cast<std::chrono::milliseconds>(idleTime - startTime);
+
+        AACE_INFO(LX(TAG)
+                      .d("rate", options.rate)
+                      .d("sessions", options.sessions)
+                      .d("published", result.published)
+                      .d("replied", result.replied)
+                      .d("received", result.received)
+                      .d("duration", result.duration.count()));
+        return result;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return result;
+    }
+}
+
+size_t MessageTrafficReplayer::replaySession(
+    std::shared_ptr<aace::core::MessageBroker> messageBroker,
+    const std::string& sessionId,
+    std::chrono::steady_clock::time_point startTime,
+    double rate) {
+    size_t published = 0;
+    for (auto& entry : m_entries) {
+        std::this_thread::sleep_until(
+            startTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(entry.time / rate));
+        try {
+            // the recorded id is replaced since ids must be unique. The requests of the Engine are answered by the
+            // handler all the sessions share, not by the session that caused them.
+            auto message = entry.message;
+            message["header"]["id"] = aace::engine::utils::uuid::generateUUID();
+            messageBroker->publish(message.dump());
+            published++;
+        } catch (std::exception& ex) {
+            AACE_ERROR(LX(TAG).d("reason", ex.what()).d("session", sessionId));
+        }
+    }
+    return published;
+}
+
+}  // namespace core
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
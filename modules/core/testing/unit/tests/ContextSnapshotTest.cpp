@@ -0,0 +1,92 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+// engine includes
+#include <AACE/Engine/Utils/Context/ContextSnapshot.h>
+
+using namespace aace::engine::utils::context;
+
+TEST(ContextSnapshotTest, unknownKeyIsNotAvailable) {
+    ContextSnapshot<std::string> snapshot;
+    std::string fragment = "unchanged";
+    ASSERT_FALSE(snapshot.get("key", fragment));
+    ASSERT_FALSE(snapshot.contains("key"));
+    ASSERT_EQ(fragment, "unchanged");
+}
+
+TEST(ContextSnapshotTest, updateReplacesFragmentWithNewVersion) {
+    ContextSnapshot<std::string> snapshot;
+    auto first = snapshot.update("key", "first");
+    auto other = snapshot.update("other", "other");
+    auto second = snapshot.update("key", "second");
+    ASSERT_LT(first, other);
+    ASSERT_LT(other, second);
+
+    std::string fragment;
+    uint64_t version = 0;
+    ASSERT_TRUE(snapshot.get("key", fragment, &version));
+    ASSERT_EQ(fragment, "second");
+    ASSERT_EQ(version, second);
+    ASSERT_TRUE(snapshot.get("other", fragment));
+    ASSERT_EQ(fragment, "other");
+}
+
+TEST(ContextSnapshotTest, removeAndClear) {
+    ContextSnapshot<int> snapshot;
+    snapshot.update("a", 1);
+    snapshot.update("b", 2);
+    snapshot.remove("a");
+    ASSERT_FALSE(snapshot.contains("a"));
+    ASSERT_TRUE(snapshot.contains("b"));
+    snapshot.clear();
+    ASSERT_FALSE(snapshot.contains("b"));
+}
+
+TEST(ContextSnapshotTest, concurrentUpdatesAndReads) {
+    ContextSnapshot<std::vector<int>> snapshot;
+    std::vector<std::thread> threads;
+    for (int writer = 0; writer < 4; writer++) {
+        threads.emplace_back([&snapshot, writer] {
+            for (int i = 0; i < 1000; i++) {
+                snapshot.update("key", std::vector<int>(16, writer));
+            }
+        });
+    }
+    bool consistent = true;
+    threads.emplace_back([&snapshot, &consistent] {
+        for (int i = 0; i < 1000; i++) {
+            std::vector<int> fragment;
+            if (snapshot.get("key", fragment)) {
+                // a reader never sees a fragment from two updates
+                consistent = consistent && fragment.size() == 16 && fragment.front() == fragment.back();
+            }
+        }
+    });
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_TRUE(consistent);
+
+    uint64_t version = 0;
+    std::vector<int> fragment;
+    ASSERT_TRUE(snapshot.get("key", fragment, &version));
+    ASSERT_EQ(version, 4000u);
+}
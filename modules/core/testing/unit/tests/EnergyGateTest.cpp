@@ -0,0 +1,346 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+// engine includes
+#include <AACE/Engine/Utils/Audio/EnergyGate.h>
+
+using namespace aace::engine::utils::audio;
+
+/// Sample rate of the loopback audio provided to the wakeword engine.
+static const unsigned int SAMPLE_RATE = 16000;
+
+/// Amount of audio before a wakeword that must reach the wakeword engine.
+static const size_t REQUIRED_LEADING_CONTEXT = SAMPLE_RATE * 300 / 1000;
+
+/// Duration of the benchmark corpus, in seconds.
+static const size_t BENCHMARK_SECONDS = 60;
+
+/// Number of iterations used by the benchmark.
+static const int BENCHMARK_ITERATIONS = 10;
+
+/// A synthetic loopback recording and the spans in it which contain a wakeword.
+struct CorpusEntry {
+    std::string name;
+    std::vector<int16_t> samples;
+    std::vector<std::pair<size_t, size_t>> wakewords;
+};
+
+/// Test harness for @c EnergyGate.
+class EnergyGateTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_generator.seed(7);
+    }
+
+    static size_t ms(size_t milliseconds) {
+        return SAMPLE_RATE * milliseconds / 1000;
+    }
+
+    static double amplitude(double dbfs) {
+        // peak amplitude of a sine wave with the given RMS level
+        return 32768.0 * std::sqrt(2.0) * std::pow(10.0, dbfs / 20.0);
+    }
+
+    /// Appends white noise at the given RMS level.
+    void noise(std::vector<int16_t>& samples, size_t count, double dbfs) {
+        std::normal_distribution<double> distribution(0.0, amplitude(dbfs) / std::sqrt(2.0));
+        for (size_t i = 0; i < count; i++) {
+            samples.push_back(clip(distribution(m_generator)));
+        }
+    }
+
+    /// Appends a tone mixed with a little noise, at the given RMS level.
+    void tone(std::vector<int16_t>& samples, size_t count, double frequency, double dbfs) {
+        std::normal_distribution<double> distribution(0.0, amplitude(dbfs - 30) / std::sqrt(2.0));
+        for (size_t i = 0; i < count; i++) {
+            double value = amplitude(dbfs) * std::sin(2.0 * M_PI * frequency * i / SAMPLE_RATE);
+            samples.push_back(clip(value + distribution(m_generator)));
+        }
+    }
+
+    /**
+     * Appends a speech-like utterance with a soft onset: a fade in from the noise floor, followed by
+     * voiced syllables separated by short pauses. Returns the span of the utterance.
+     */
+    std::pair<size_t, size_t> utterance(std::vector<int16_t>& samples, double dbfs, double floor) {
+        size_t start = samples.size();
+        std::normal_distribution<double> distribution(0.0, 1.0);
+        size_t fade = ms(150);
+        for (size_t i = 0; i < fade; i++) {
+            double level = floor + (dbfs - floor) * i / fade;
+            double value = amplitude(level) * std::sin(2.0 * M_PI * 220.0 * i / SAMPLE_RATE);
+            samples.push_back(clip(value + amplitude(floor) * distribution(m_generator)));
+        }
+        for (int syllable = 0; syllable < 3; syllable++) {
+            tone(samples, ms(180), 180.0 + 40 * syllable, dbfs);
+            noise(samples, ms(60), floor);
+        }
+        return {start, samples.size()};
+    }
+
+    static int16_t clip(double value) {
+        return static_cast<int16_t>(std::max(-32768.0, std::min(32767.0, value)));
+    }
+
+    /// Runs @c samples through a gate in uneven blocks, and returns the audio that passed.
+    static std::vector<int16_t> gate(
+        const std::vector<int16_t>& samples,
+        const EnergyGate::Configuration& configuration = EnergyGate::Configuration(),
+        EnergyGate* existing = nullptr) {
+        auto created = existing == nullptr ? EnergyGate::create(SAMPLE_RATE, configuration) : nullptr;
+        EnergyGate* energyGate = existing == nullptr ? created.get() : existing;
+        std::vector<int16_t> passed;
+        EXPECT_NE(energyGate, nullptr);
+        if (energyGate == nullptr) {
+            return passed;
+        }
+        size_t blockSizes[] = {160, 320, 7, 513};
+        size_t offset = 0;
+        for (size_t block = 0; offset < samples.size(); block++) {
+            size_t count = std::min(blockSizes[block % 4], samples.size() - offset);
+            energyGate->process(samples.data() + offset, count, [&passed](const int16_t* data, size_t size) {
+                passed.insert(passed.end(), data, data + size);
+            });
+            offset += count;
+        }
+        return passed;
+    }
+
+    /// Returns @c true if @c passed contains the span of @c samples, unchanged and contiguous.
+    static bool containsSpan(
+        const std::vector<int16_t>& passed,
+        const std::vector<int16_t>& samples,
+        size_t begin,
+        size_t end) {
+        return std::search(passed.begin(), passed.end(), samples.begin() + begin, samples.begin() + end) !=
+               passed.end();
+    }
+
+    /**
+     * Builds recordings of typical playback: silence between tracks, quiet and loud music, and speech
+     * containing a wakeword at several levels and over several noise floors.
+     */
+    std::vector<CorpusEntry> corpus() {
+        std::vector<CorpusEntry> entries;
+
+        CorpusEntry entry;
+        entry.name = "digitalSilence";
+        entry.samples.assign(ms(3000), 0);
+        entries.push_back(entry);
+
+        entry = CorpusEntry();
+        entry.name = "ditheredSilence";
+        noise(entry.samples, ms(3000), -90);
+        entries.push_back(entry);
+
+        entry = CorpusEntry();
+        entry.name = "wakewordAfterSilence";
+        noise(entry.samples, ms(2000), -85);
+        entry.wakewords.push_back(utterance(entry.samples, -20, -85));
+        noise(entry.samples, ms(2000), -85);
+        entries.push_back(entry);
+
+        entry = CorpusEntry();
+        entry.name = "quietWakewordOverFloor";
+        noise(entry.samples, ms(2000), -65);
+        entry.wakewords.push_back(utterance(entry.samples, -42, -65));
+        noise(entry.samples, ms(2000), -65);
+        entries.push_back(entry);
+
+        entry = CorpusEntry();
+        entry.name = "wakewordsInPodcast";
+        for (int sentence = 0; sentence < 4; sentence++) {
+            noise(entry.samples, ms(700 + 400 * sentence), -75);
+            entry.wakewords.push_back(utterance(entry.samples, -25 - 5 * sentence, -75));
+        }
+        noise(entry.samples, ms(1500), -75);
+        entries.push_back(entry);
+
+        entry = CorpusEntry();
+        entry.name = "wakewordDuringMusic";
+        tone(entry.samples, ms(2000), 440, -30);
+        entry.wakewords.push_back(utterance(entry.samples, -20, -30));
+        tone(entry.samples, ms(2000), 440, -30);
+        entries.push_back(entry);
+
+        entry = CorpusEntry();
+        entry.name = "wakewordAfterTrackFade";
+        tone(entry.samples, ms(1000), 330, -25);
+        for (int step = 0; step < 20; step++) {
+            tone(entry.samples, ms(50), 330, -25 - 3 * step);
+        }
+        noise(entry.samples, ms(1500), -80);
+        entry.wakewords.push_back(utterance(entry.samples, -22, -80));
+        entries.push_back(entry);
+
+        return entries;
+    }
+
+protected:
+    std::mt19937 m_generator;
+};
+
+TEST_F(EnergyGateTest, createWithInvalidParameters) {
+    EnergyGate::Configuration configuration;
+    ASSERT_EQ(EnergyGate::create(0, configuration), nullptr);
+
+    configuration.closeThreshold = configuration.openThreshold + 1;
+    ASSERT_EQ(EnergyGate::create(SAMPLE_RATE, configuration), nullptr);
+
+    configuration = EnergyGate::Configuration();
+    configuration.openThreshold = 3;
+    ASSERT_EQ(EnergyGate::create(SAMPLE_RATE, configuration), nullptr);
+
+    configuration = EnergyGate::Configuration();
+    configuration.preRoll = std::chrono::minutes(1);
+    ASSERT_EQ(EnergyGate::create(SAMPLE_RATE, configuration), nullptr);
+
+    configuration = EnergyGate::Configuration();
+    configuration.frameDuration = std::chrono::milliseconds(0);
+    ASSERT_EQ(EnergyGate::create(SAMPLE_RATE, configuration), nullptr);
+}
+
+TEST_F(EnergyGateTest, silenceIsGated) {
+    std::vector<int16_t> samples;
+    noise(samples, ms(5000), -90);
+    auto energyGate = EnergyGate::create(SAMPLE_RATE, EnergyGate::Configuration());
+    ASSERT_TRUE(gate(samples, EnergyGate::Configuration(), energyGate.get()).empty());
+    ASSERT_FALSE(energyGate->isOpen());
+    // everything but the pre-roll still held by the gate is dropped
+    ASSERT_EQ(energyGate->getGatedSampleCount(), samples.size() - ms(500));
+    ASSERT_EQ(energyGate->getPassedSampleCount(), 0u);
+}
+
+TEST_F(EnergyGateTest, loudAudioPassesUnchanged) {
+    std::vector<int16_t> samples;
+    tone(samples, ms(3000), 440, -20);
+    auto passed = gate(samples);
+    ASSERT_EQ(passed.size(), samples.size());
+    ASSERT_EQ(passed, samples);
+}
+
+TEST_F(EnergyGateTest, preRollPrecedesOpeningFrame) {
+    std::vector<int16_t> samples;
+    noise(samples, ms(2000), -80);
+    size_t onset = samples.size();
+    tone(samples, ms(500), 300, -20);
+
+    auto passed = gate(samples);
+    ASSERT_FALSE(passed.empty());
+    // the gate opens on the first loud frame, and delivers the 500 ms before it
+    ASSERT_EQ(passed.size(), ms(1000));
+    ASSERT_TRUE(std::equal(passed.begin(), passed.end(), samples.begin() + onset - ms(500)));
+}
+
+TEST_F(EnergyGateTest, hysteresisKeepsStateBetweenThresholds) {
+    // a level between the close and open thresholds never opens a closed gate
+    std::vector<int16_t> between;
+    tone(between, ms(3000), 500, -52);
+    ASSERT_TRUE(gate(between).empty());
+
+    // but keeps an open gate open beyond the hangover
+    std::vector<int16_t> samples;
+    tone(samples, ms(200), 500, -20);
+    samples.insert(samples.end(), between.begin(), between.end());
+    ASSERT_EQ(gate(samples), samples);
+}
+
+TEST_F(EnergyGateTest, hangoverDelaysClosing) {
+    EnergyGate::Configuration configuration;
+    configuration.hangover = std::chrono::milliseconds(300);
+    std::vector<int16_t> samples;
+    tone(samples, ms(200), 500, -20);
+    samples.resize(samples.size() + ms(2000), 0);
+
+    auto energyGate = EnergyGate::create(SAMPLE_RATE, configuration);
+    auto passed = gate(samples, configuration, energyGate.get());
+    ASSERT_EQ(passed.size(), ms(200) + ms(300));
+    ASSERT_FALSE(energyGate->isOpen());
+
+    // a gap shorter than the hangover does not close the gate
+    samples.clear();
+    tone(samples, ms(200), 500, -20);
+    samples.resize(samples.size() + ms(250), 0);
+    tone(samples, ms(200), 500, -20);
+    ASSERT_EQ(gate(samples, configuration), samples);
+}
+
+TEST_F(EnergyGateTest, resetClosesGate) {
+    std::vector<int16_t> samples;
+    tone(samples, ms(200), 500, -20);
+    auto energyGate = EnergyGate::create(SAMPLE_RATE, EnergyGate::Configuration());
+    gate(samples, EnergyGate::Configuration(), energyGate.get());
+    ASSERT_TRUE(energyGate->isOpen());
+    energyGate->reset();
+    ASSERT_FALSE(energyGate->isOpen());
+
+    std::vector<int16_t> silence(ms(1000), 0);
+    ASSERT_TRUE(gate(silence, EnergyGate::Configuration(), energyGate.get()).empty());
+}
+
+TEST_F(EnergyGateTest, corpusWakewordsAreNeverGated) {
+    for (auto& entry : corpus()) {
+        SCOPED_TRACE(entry.name);
+        auto passed = gate(entry.samples);
+        for (auto& wakeword : entry.wakewords) {
+            size_t begin = wakeword.first - std::min(wakeword.first, REQUIRED_LEADING_CONTEXT);
+            ASSERT_TRUE(containsSpan(passed, entry.samples, begin, wakeword.second))
+                << "Wakeword at sample " << wakeword.first << " was not delivered with its leading context";
+        }
+        if (entry.wakewords.empty()) {
+            ASSERT_TRUE(passed.empty());
+        }
+    }
+}
+
+TEST_F(EnergyGateTest, DISABLED_benchmarkGate) {
+    // a minute of playback cycling through the corpus
+    std::vector<int16_t> samples;
+    auto entries = corpus();
+    for (size_t i = 0; samples.size() < BENCHMARK_SECONDS * SAMPLE_RATE; i++) {
+        auto& entry = entries[i % entries.size()];
+        samples.insert(samples.end(), entry.samples.begin(), entry.samples.end());
+    }
+
+    uint64_t passed = 0;
+    uint64_t gated = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+        auto energyGate = EnergyGate::create(SAMPLE_RATE, EnergyGate::Configuration());
+        ASSERT_NE(energyGate, nullptr);
+        // feed 10 ms blocks, as the platform does
+        for (size_t offset = 0; offset < samples.size(); offset += ms(10)) {
+            size_t count = std::min(ms(10), samples.size() - offset);
+            energyGate->process(samples.data() + offset, count, [](const int16_t*, size_t) {});
+        }
+        passed = energyGate->getPassedSampleCount();
+        gated = energyGate->getGatedSampleCount();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    double seconds = static_cast<double>(samples.size()) / SAMPLE_RATE;
+    double nanoseconds = std::chrono::duration<double, std::nano>(elapsed).count() / BENCHMARK_ITERATIONS;
+
+    RecordProperty("energyGate.nsPerSecond", static_cast<int>(nanoseconds / seconds));
+    RecordProperty("energyGate.skippedPercent", static_cast<int>(100 * gated / (passed + gated)));
+}
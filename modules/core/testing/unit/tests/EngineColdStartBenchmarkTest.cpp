@@ -0,0 +1,124 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <AACE/Core/EngineConfiguration.h>
+#include <AACE/Engine/Core/EngineImpl.h>
+#include <AACE/Engine/Core/LifecycleTracer.h>
+
+using namespace aace::engine::core;
+using Clock = std::chrono::steady_clock;
+
+/*
+ * The cold start benchmark creates, configures, starts and shuts down an engine with the core services, with a new
+ * storage database each time, and records the start time and the services which took the longest to start as test
+ * properties for --gtest_output=json:<path>. The EngineColdStart tool of the C++ Sample App measures the cold start
+ * with every module linked.
+ */
+
+/// The number of cold starts measured
+static const int COLD_START_ITERATIONS = 5;
+
+/// The number of services reported as the slowest to start
+static const size_t SLOWEST_SERVICE_COUNT = 5;
+
+static const std::string STORAGE_PATH = "/tmp/aace-cold-start.db";
+static const std::string TRACE_PATH = "/tmp/aace-cold-start-trace.json";
+
+static std::shared_ptr<aace::core::config::EngineConfiguration> createConfiguration() {
+    auto configuration =
+        nlohmann::json({{"aace.storage", {{"localStoragePath", STORAGE_PATH}, {"storageType", "sqlite"}}},
+                        {"aace.engine", {{"lifecycleTracePath", TRACE_PATH}}}});
+    return aace::core::config::StreamConfiguration::create(
+        std::make_shared<std::stringstream>(configuration.dump()));
+}
+
+static nlohmann::json readTrace() {
+    std::ifstream file(TRACE_PATH);
+    return nlohmann::json::parse(file);
+}
+
+/// Returns the complete events of a trace, which are the spans recorded by the engine.
+static std::vector<nlohmann::json> getSpans(const nlohmann::json& trace) {
+    std::vector<nlohmann::json> spans;
+    for (auto& next : trace.at("traceEvents")) {
+        if (next.at("ph") == "X") {
+            spans.push_back(next);
+        }
+    }
+    return spans;
+}
+
+TEST(EngineColdStartBenchmarkTest, DISABLED_coldStart) {
+    std::vector<Clock::duration> startTimes;
+    std::map<std::string, int64_t> serviceTimes;
+
+    for (int i = 0; i < COLD_START_ITERATIONS; i++) {
+        std::remove(STORAGE_PATH.c_str());
+        std::remove(TRACE_PATH.c_str());
+
+        auto startTime = Clock::now();
+        auto engine = EngineImpl::create();
+        ASSERT_NE(engine, nullptr) << "Create engine failed!";
+        ASSERT_TRUE(engine->configure(createConfiguration())) << "Configure engine failed!";
+        ASSERT_TRUE(engine->start()) << "Start engine failed!";
+        startTimes.push_back(Clock::now() - startTime);
+
+        // the trace is written once the engine is started, with the time of each service in every phase up to the
+        // start, in microseconds
+        for (auto& next : getSpans(readTrace())) {
+            if (next.at("cat") != "engine") {
+                serviceTimes[next.at("name").get<std::string>()] += next.at("dur").get<int64_t>();
+            }
+        }
+
+        ASSERT_TRUE(engine->stop()) << "Stop engine failed!";
+        ASSERT_TRUE(engine->shutdown()) << "Shutdown engine failed!";
+    }
+
+    std::sort(startTimes.begin(), startTimes.end());
+    auto toMilliseconds = [](Clock::duration duration) {
+        return static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count());
+    };
+    auto median = toMilliseconds(startTimes[startTimes.size() / 2]);
+    auto max = toMilliseconds(startTimes.back());
+    RecordProperty("coldStart.iterations", static_cast<int>(startTimes.size()));
+    RecordProperty("coldStart.medianMs", median);
+    RecordProperty("coldStart.maxMs", max);
+
+    using ServiceTime = std::pair<std::string, int64_t>;
+    std::vector<ServiceTime> slowest(serviceTimes.begin(), serviceTimes.end());
+    std::sort(slowest.begin(), slowest.end(), [](const ServiceTime& a, const ServiceTime& b) {
+        return a.second > b.second;
+    });
+    slowest.resize(std::min(slowest.size(), SLOWEST_SERVICE_COUNT));
+    for (auto& next : slowest) {
+        auto average = static_cast<int>(next.second / COLD_START_ITERATIONS);
+        RecordProperty("coldStart." + next.first + ".us", average);
+    }
+
+    std::remove(STORAGE_PATH.c_str());
+}
@@ -0,0 +1,243 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <sstream>
+
+// engine includes
+#include <AACE/Core/EngineConfiguration.h>
+#include <AACE/Engine/Core/EngineImpl.h>
+#include <AACE/Engine/Core/EngineService.h>
+#include <AACE/Engine/Core/EngineServiceManager.h>
+#include <AACE/Engine/MessageBroker/MessageBrokerEngineService.h>
+#include <AACE/Engine/MessageBroker/MessageHandlerEngineService.h>
+#include <AACE/Engine/Utils/JSON/JSON.h>
+
+namespace json = aace::engine::utils::json;
+
+/// A service configured with a stream, which parses its section of the configuration again.
+class StreamConfiguredService : public aace::engine::core::EngineService {
+public:
+    StreamConfiguredService() : EngineService(aace::engine::core::ServiceDescription("test.stream", {1, 0})) {
+    }
+
+    bool deliver(std::shared_ptr<const json::Value> configuration) {
+        // the default implementation serializes the configuration for the stream overload
+        return EngineService::configure(configuration);
+    }
+
+    json::Value m_configuration;
+
+protected:
+    bool configure(std::shared_ptr<std::istream> configuration) override {
+        m_configuration = json::toJson(configuration);
+        return m_configuration.is_object();
+    }
+};
+
+/// A service reading its section of the configuration in place.
+class ParsedConfiguredService : public aace::engine::core::EngineService {
+public:
+    ParsedConfiguredService() : EngineService(aace::engine::core::ServiceDescription("test.parsed", {1, 0})) {
+    }
+
+    bool deliver(std::shared_ptr<const json::Value> configuration) {
+        return configure(configuration);
+    }
+
+    std::shared_ptr<const json::Value> m_configuration;
+
+protected:
+    bool configure(std::shared_ptr<const json::Value> configuration) override {
+        m_configuration = configuration;
+        return m_configuration->is_object();
+    }
+};
+
+/// A message handler service registered with the engine, which keeps the interface sections it is configured with.
+class TestMessageHandlerEngineService : public aace::engine::messageBroker::MessageHandlerEngineService {
+public:
+    DESCRIBE(
+        "test.messageHandler",
+        VERSION("1.0"),
+        DEPENDS(aace::engine::messageBroker::MessageBrokerEngineService))
+
+public:
+    /// The interface sections the service was configured with, since the engine creates the service
+    static std::map<std::string, json::Value> s_interfaces;
+
+private:
+    TestMessageHandlerEngineService(const aace::engine::core::ServiceDescription& description) :
+            MessageHandlerEngineService(description, VERSION("4.0"), {"First", "Second"}) {
+    }
+
+protected:
+    bool configureMessageInterface(
+        const std::string& name,
+        bool enabled,
+        const json::Value& configuration) override {
+        s_interfaces[name] = configuration;
+        return true;
+    }
+};
+
+std::map<std::string, json::Value> TestMessageHandlerEngineService::s_interfaces;
+
+REGISTER_SERVICE(TestMessageHandlerEngineService);
+
+static std::shared_ptr<aace::core::config::EngineConfiguration> createEngineConfiguration(const json::Value& root) {
+    return aace::core::config::StreamConfiguration::create(json::toStream(root, false));
+}
+
+/// Test harness for the configuration delivered to @c EngineService classes
+class EngineServiceConfigurationTest : public ::testing::Test {
+protected:
+    /// Returns the configuration with the given path in the SDK, or @c null if @c AUTO_SDK_HOME is not set.
+    static json::Value loadSampleConfiguration(const std::string& path) {
+        auto home = std::getenv("AUTO_SDK_HOME");
+        if (home == nullptr) {
+            return nullptr;
+        }
+        auto stream = std::make_shared<std::ifstream>(std::string(home) + "/" + path);
+        return stream->good() ? json::toJson(stream) : nullptr;
+    }
+
+    /// Returns a car control configuration with @c count endpoints, similar to the sample car control configuration.
+    static json::Value createCarControlConfiguration(int count) {
+        json::Value endpoints = json::Value::array();
+        for (int i = 0; i < count; i++) {
+            json::Value friendlyNames = json::Value::array();
+            friendlyNames.push_back({{"@type", "asset"}, {"value", {{"assetId", "Alexa.Automotive.Location.All"}}}});
+            json::Value capability = {
+                {"type", "AlexaInterface"},
+                {"interface", "Alexa.RangeController"},
+                {"version", "3"},
+                {"instance", "speed"},
+                {"capabilityResources", {{"friendlyNames", friendlyNames}}},
+                {"properties", {{"supported", {{{"name", "rangeValue"}}}}, {"proactivelyReported", false}}},
+                {"configuration", {{"supportedRange", {{"minimumValue", 1}, {"maximumValue", 10}, {"precision", 1}}}}}};
+            endpoints.push_back(
+                {{"endpointId", "endpoint." + std::to_string(i)},
+                 {"endpointResources", {{"friendlyNames", friendlyNames}}},
+                 {"capabilities", json::Value::array({capability, capability, capability})}});
+        }
+        return {{"aace.carControl", {{"endpoints", endpoints}}}};
+    }
+};
+
+TEST_F(EngineServiceConfigurationTest, streamConfiguredServiceReceivesSection) {
+    auto configuration = std::make_shared<const json::Value>(
+        json::toJson(std::string(R"({"test.stream":{"enabled":true,"values":[1,2,3]},"other":{}})")));
+    StreamConfiguredService service;
+    ASSERT_TRUE(service.deliver(std::shared_ptr<const json::Value>(configuration, &configuration->at("test.stream"))));
+    EXPECT_EQ(service.m_configuration, configuration->at("test.stream"));
+}
+
+TEST_F(EngineServiceConfigurationTest, parsedConfiguredServiceSharesSection) {
+    auto configuration = std::make_shared<const json::Value>(
+        json::toJson(std::string(R"({"test.parsed":{"enabled":true,"values":[1,2,3]},"other":{}})")));
+    std::shared_ptr<const json::Value> section(configuration, &configuration->at("test.parsed"));
+    ParsedConfiguredService service;
+    ASSERT_TRUE(service.deliver(section));
+
+    // the service reads the engine's copy of the configuration, which it keeps alive
+    EXPECT_EQ(service.m_configuration.get(), &configuration->at("test.parsed"));
+    configuration.reset();
+    section.reset();
+    EXPECT_EQ(service.m_configuration->at("values").size(), 3u);
+}
+
+TEST_F(EngineServiceConfigurationTest, messageHandlerReceivesInterfaceSections) {
+    TestMessageHandlerEngineService::s_interfaces.clear();
+    json::Value configuration = {
+        {"aace.storage", {{"localStoragePath", "/tmp/aace-configuration-test.db"}, {"storageType", "sqlite"}}},
+        {"test.messageHandler", {{"First", {{"enabled", true}, {"values", {1, 2, 3}}}}, {"Other", {}}}}};
+    auto engine = aace::engine::core::EngineImpl::create();
+    ASSERT_NE(engine, nullptr) << "Create engine failed!";
+    ASSERT_TRUE(engine->configure(createEngineConfiguration(configuration))) << "Configure engine failed!";
+
+    // only the configured interfaces are configured, with their section of the service configuration
+    auto& interfaces = TestMessageHandlerEngineService::s_interfaces;
+    ASSERT_EQ(interfaces.size(), 1u);
+    EXPECT_EQ(interfaces["First"], configuration["test.messageHandler"]["First"]);
+
+    EXPECT_TRUE(engine->shutdown());
+    std::remove("/tmp/aace-configuration-test.db");
+}
+
+TEST_F(EngineServiceConfigurationTest, DISABLED_benchmarkEngineConfigure) {
+    // the sample configuration and the sample car control configuration, when the SDK sources are available
+    auto configuration = loadSampleConfiguration("samples/cpp/assets/config/config.json");
+    auto carControlConfiguration = loadSampleConfiguration("modules/car-control/assets/CarControlConfig.json");
+    if (carControlConfiguration == nullptr) {
+        carControlConfiguration = createCarControlConfiguration(150);
+    }
+    if (configuration == nullptr) {
+        configuration = json::Value::object();
+    }
+    ASSERT_TRUE(json::merge(configuration, carControlConfiguration));
+    configuration["aace.storage"] = {
+        {"localStoragePath", "/tmp/aace-configuration-test.db"}, {"storageType", "sqlite"}};
+    auto root = std::make_shared<const json::Value>(std::move(configuration));
+
+    // the engine configure phase, which parses the configuration and configures each service linked into the test
+    const int iterations = 20;
+    std::chrono::microseconds configureDuration(0);
+    for (int i = 0; i < iterations; i++) {
+        std::remove("/tmp/aace-configuration-test.db");
+        auto engine = aace::engine::core::EngineImpl::create();
+        ASSERT_NE(engine, nullptr) << "Create engine failed!";
+        auto start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(engine->configure(createEngineConfiguration(*root))) << "Configure engine failed!";
+        configureDuration +=
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        ASSERT_TRUE(engine->shutdown()) << "Shutdown engine failed!";
+    }
+    std::remove("/tmp/aace-configuration-test.db");
+
+    // the cost a service reading its section from a stream adds for each section
+    auto measure = [&](std::function<bool(std::shared_ptr<const json::Value>)> deliver) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            for (auto& next : root->items()) {
+                if (next.value().is_object()) {
+                    EXPECT_TRUE(deliver(std::shared_ptr<const json::Value>(root, &next.value())));
+                }
+            }
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start) /
+               iterations;
+    };
+    StreamConfiguredService streamService;
+    ParsedConfiguredService parsedService;
+    auto streamDuration = measure([&](std::shared_ptr<const json::Value> section) {
+        return streamService.deliver(section);
+    });
+    auto parsedDuration = measure([&](std::shared_ptr<const json::Value> section) {
+        return parsedService.deliver(section);
+    });
+
+    RecordProperty("engineConfigureUs", static_cast<int>(configureDuration.count() / iterations));
+    RecordProperty("streamDeliveryUs", static_cast<int>(streamDuration.count()));
+    RecordProperty("parsedDeliveryUs", static_cast<int>(parsedDuration.count()));
+}
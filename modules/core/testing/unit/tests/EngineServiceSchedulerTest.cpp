@@ -0,0 +1,137 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// engine includes
+#include <AACE/Engine/Core/EngineServiceScheduler.h>
+
+using EngineServiceScheduler = aace::engine::core::EngineServiceScheduler;
+
+/// Test harness for @c EngineServiceScheduler class
+class EngineServiceSchedulerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_running = 0;
+        m_maxRunning = 0;
+        m_order.clear();
+    }
+
+protected:
+    /// A stage taking some time, which records the order in which the services completed it.
+    bool runService(size_t index, std::chrono::milliseconds duration = std::chrono::milliseconds(20)) {
+        auto running = ++m_running;
+        auto maxRunning = m_maxRunning.load();
+        while (running > maxRunning && !m_maxRunning.compare_exchange_weak(maxRunning, running)) {
+        }
+        std::this_thread::sleep_for(duration);
+        m_running--;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_order.push_back(index);
+        return true;
+    }
+
+    size_t position(size_t index) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return std::find(m_order.begin(), m_order.end(), index) - m_order.begin();
+    }
+
+    std::atomic<int> m_running;
+    std::atomic<int> m_maxRunning;
+    std::mutex m_mutex;
+    std::vector<size_t> m_order;
+};
+
+TEST_F(EngineServiceSchedulerTest, create) {
+    ASSERT_NE(EngineServiceScheduler::create(std::vector<std::vector<size_t>>{{}, {0}, {0, 1}}, 4), nullptr);
+    ASSERT_EQ(EngineServiceScheduler::create(std::vector<std::vector<size_t>>{{}, {0}}, 0), nullptr)
+        << "Create scheduler without threads did not fail!";
+    ASSERT_EQ(EngineServiceScheduler::create(std::vector<std::vector<size_t>>{{1}, {}}, 4), nullptr)
+        << "Create scheduler with a dependency on a later service did not fail!";
+    ASSERT_EQ(EngineServiceScheduler::create(std::vector<std::vector<size_t>>{{0}}, 4), nullptr)
+        << "Create scheduler with a service depending on itself did not fail!";
+}
+
+TEST_F(EngineServiceSchedulerTest, singleThreadRunsInListOrder) {
+    auto scheduler = EngineServiceScheduler::create(std::vector<std::vector<size_t>>{{}, {}, {0}, {}, {2}}, 1);
+    ASSERT_NE(scheduler, nullptr);
+
+    size_t failedIndex = 0;
+    ASSERT_TRUE(scheduler->run(
+        [this](size_t index) { return runService(index, std::chrono::milliseconds(1)); }, failedIndex));
+    EXPECT_EQ(m_order, std::vector<size_t>({0, 1, 2, 3, 4}));
+    EXPECT_EQ(m_maxRunning, 1);
+}
+
+TEST_F(EngineServiceSchedulerTest, dependenciesCompleteBeforeDependents) {
+    // a core service, two modules depending on it, and a service depending on both modules
+    auto scheduler = EngineServiceScheduler::create(std::vector<std::vector<size_t>>{{}, {0}, {0}, {1, 2}, {}}, 4);
+    ASSERT_NE(scheduler, nullptr);
+
+    size_t failedIndex = 0;
+    ASSERT_TRUE(scheduler->run([this](size_t index) { return runService(index); }, failedIndex));
+    ASSERT_EQ(m_order.size(), 5u);
+    EXPECT_LT(position(0), position(1));
+    EXPECT_LT(position(0), position(2));
+    EXPECT_LT(position(1), position(3));
+    EXPECT_LT(position(2), position(3));
+    EXPECT_GT(m_maxRunning, 1) << "Independent services did not run at the same time!";
+}
+
+TEST_F(EngineServiceSchedulerTest, independentServicesRunConcurrentlyOnBoundedThreads) {
+    std::vector<std::vector<size_t>> dependencies(12);
+    auto scheduler = EngineServiceScheduler::create(dependencies, 3);
+    ASSERT_NE(scheduler, nullptr);
+
+    size_t failedIndex = 0;
+    ASSERT_TRUE(scheduler->run([this](size_t index) { return runService(index); }, failedIndex));
+
+    EXPECT_EQ(m_order.size(), 12u);
+    EXPECT_EQ(m_maxRunning, 3) << "Services did not run on every thread at the same time!";
+}
+
+TEST_F(EngineServiceSchedulerTest, firstFailureInListOrderIsReported) {
+    // services 1 and 3 fail, and 3 fails much sooner than 1
+    auto scheduler = EngineServiceScheduler::create(std::vector<std::vector<size_t>>{{}, {}, {}, {}, {3}}, 4);
+    ASSERT_NE(scheduler, nullptr);
+
+    for (int attempt = 0; attempt < 5; attempt++) {
+        m_order.clear();
+        size_t failedIndex = 0;
+        ASSERT_FALSE(scheduler->run(
+            [this](size_t index) {
+                if (index == 1) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                    return false;
+                }
+                return index != 3 && runService(index, std::chrono::milliseconds(1));
+            },
+            failedIndex));
+        EXPECT_EQ(failedIndex, 1u);
+
+        // the services depending on a failed service do not run, while the services before it do
+        EXPECT_EQ(position(4), m_order.size());
+        EXPECT_LT(position(0), m_order.size());
+    }
+}
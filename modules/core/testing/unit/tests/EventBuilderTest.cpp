@@ -0,0 +1,195 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// engine includes
+#include <AACE/Engine/Utils/Event/EventBuilder.h>
+#include <AACE/Engine/Utils/JSON/JSON.h>
+
+using namespace aace::engine::utils::event;
+namespace json = aace::engine::utils::json;
+
+/// Test harness for the event builder functions
+class EventBuilderTest : public ::testing::Test {};
+
+TEST_F(EventBuilderTest, appendStringEscapesCharacters) {
+    std::string buffer;
+    appendString(buffer, "quote \" backslash \\ newline \n tab \t control \x01 unicode \xc3\xa9");
+    EXPECT_EQ(json::toJson(buffer), "quote \" backslash \\ newline \n tab \t control \x01 unicode \xc3\xa9");
+}
+
+TEST_F(EventBuilderTest, buildEventWithContext) {
+    std::string context("[");
+    appendContextState(context, "Test.Namespace", "TestState", R"({"state":"ACTIVE","values":[1,2,3]})");
+    context.push_back(']');
+
+    auto event = buildEvent("Test.Namespace", "TestEvent", "", R"({"callId":"1234"})", context);
+    auto root = json::toJson(event.second);
+    ASSERT_TRUE(root.is_object());
+
+    EXPECT_EQ(root["context"][0]["header"], json::Value({{"namespace", "Test.Namespace"}, {"name", "TestState"}}));
+    EXPECT_EQ(root["context"][0]["payload"], json::toJson(std::string(R"({"state":"ACTIVE","values":[1,2,3]})")));
+    EXPECT_EQ(root["event"]["header"]["namespace"], "Test.Namespace");
+    EXPECT_EQ(root["event"]["header"]["name"], "TestEvent");
+    EXPECT_EQ(root["event"]["header"]["messageId"], event.first);
+    EXPECT_FALSE(root["event"]["header"].contains("dialogRequestId"));
+    EXPECT_EQ(root["event"]["payload"]["callId"], "1234");
+}
+
+TEST_F(EventBuilderTest, buildEventWithoutContext) {
+    auto event = buildEvent("Test.Namespace", "TestEvent", "dialog-1", "{}");
+    auto root = json::toJson(event.second);
+    ASSERT_TRUE(root.is_object());
+
+    EXPECT_FALSE(root.contains("context"));
+    EXPECT_EQ(root["event"]["header"]["dialogRequestId"], "dialog-1");
+    EXPECT_NE(event.first, buildEvent("Test.Namespace", "TestEvent", "", "{}").first);
+}
+
+TEST_F(EventBuilderTest, getMembersReturnsSerializedValues) {
+    std::unordered_map<std::string, std::string> members{
+        {"object", ""}, {"string", ""}, {"number", ""}, {"literal", ""}, {"missing", "unchanged"}};
+    ASSERT_TRUE(getMembers(
+        R"( { "object" : [1, {"name":"}\"]"}], "string":"a\\\"b", "number": -1.5e+3,)"
+        R"( "nested":{"string":"nested"}, "literal":null } )",
+        members));
+
+    EXPECT_EQ(members["object"], R"([1, {"name":"}\"]"}])");
+    EXPECT_EQ(members["string"], R"("a\\\"b")");
+    EXPECT_EQ(members["number"], "-1.5e+3");
+    EXPECT_EQ(members["literal"], "null");
+    EXPECT_EQ(members["missing"], "unchanged");
+}
+
+TEST_F(EventBuilderTest, getMembersRejectsInvalidObjects) {
+    std::unordered_map<std::string, std::string> members{{"name", ""}};
+    EXPECT_TRUE(getMembers("{}", members));
+    for (auto invalid : {"",
+                         "[1]",
+                         R"("string")",
+                         "{",
+                         R"({"name":})",
+                         R"({"name":1,})",
+                         R"({"name":01})",
+                         R"({"name":tru})",
+                         R"({"name":"\q"})",
+                         R"({"name":"\u12"})",
+                         "{\"name\":\"\x01\"}",
+                         R"({"name":1} trailing)"}) {
+        EXPECT_FALSE(getMembers(invalid, members)) << "Invalid object accepted: " << invalid;
+    }
+}
+
+TEST_F(EventBuilderTest, getMembersValidatesNumbers) {
+    for (auto valid : {"0", "-0", "12", "-12.25", "0.5e-7", "1E5", "1e+10"}) {
+        std::unordered_map<std::string, std::string> members{{"name", ""}};
+        EXPECT_TRUE(getMembers(std::string(R"({"name":)") + valid + "}", members))
+            << "Valid number rejected: " << valid;
+        EXPECT_EQ(members["name"], valid);
+    }
+    for (auto invalid : {"-", "+1", ".5", "1.", "1.e5", "1e", "1e+", "-01", "--1", "0x1", "Infinity", "NaN", "1 2"}) {
+        std::unordered_map<std::string, std::string> members{{"name", ""}};
+        EXPECT_FALSE(getMembers(std::string(R"({"name":)") + invalid + "}", members))
+            << "Invalid number accepted: " << invalid;
+    }
+}
+
+TEST_F(EventBuilderTest, getMembersValidatesEscapes) {
+    for (auto valid : {R"("\"\\\/\b\f\n\r\t")", R"("\u00e9")", R"("\uD83D\uDE00")", R"("\u0000")"}) {
+        std::unordered_map<std::string, std::string> members{{"name", ""}};
+        EXPECT_TRUE(getMembers(std::string(R"({"name":)") + valid + "}", members))
+            << "Valid string rejected: " << valid;
+        EXPECT_EQ(members["name"], valid);
+    }
+    for (auto invalid : {R"("\)",
+                         R"("\u00")",
+                         R"("\u00g0")",
+                         R"("\x41")",
+                         R"("\ud83d")",
+                         R"("\ud83d\u0041")",
+                         R"("\ud83d\n")",
+                         R"("\ude00")",
+                         R"("unterminated)"}) {
+        std::unordered_map<std::string, std::string> members{{"name", ""}};
+        EXPECT_FALSE(getMembers(std::string(R"({"name":)") + invalid + "}", members))
+            << "Invalid string accepted: " << invalid;
+    }
+}
+
+TEST_F(EventBuilderTest, getMembersBoundsNesting) {
+    std::unordered_map<std::string, std::string> members{{"name", ""}};
+    auto nested = [](size_t depth) {
+        return R"({"name":)" + std::string(depth, '[') + std::string(depth, ']') + "}";
+    };
+    EXPECT_TRUE(getMembers(nested(200), members));
+    EXPECT_EQ(members["name"].size(), 400u);
+
+    // deeply nested values are rejected without exhausting the stack
+    EXPECT_FALSE(getMembers(nested(300), members));
+    EXPECT_FALSE(getMembers(nested(100000), members));
+    EXPECT_FALSE(getMembers(R"({"name":)" + std::string(100000, '[') + "}", members));
+}
+
+TEST_F(EventBuilderTest, getMembersAgreesWithParser) {
+    static const std::vector<std::string> seeds = {
+        R"({"callId":"1234","state":"ACTIVE","values":[1,2.5,-3e2,true,false,null]})",
+        R"({ "name" : { "nested" : [ {"a":"\u00e9\n"} , [] , {} ] } , "other":"x\"y" })",
+        R"({"name":"\uD83D\uDE00","number":-0.5E+7,"empty":""})"};
+    static const std::string alphabet = R"({}[]":,.-+eE0123456789\/u abcdnrtlsfDE)";
+
+    // mutations of valid objects are accepted exactly when the parser accepts them, with the same member values
+    std::mt19937 random(42);
+    for (int i = 0; i < 20000; i++) {
+        auto input = seeds[random() % seeds.size()];
+        for (int mutations = 1 + random() % 3; mutations > 0; mutations--) {
+            auto position = random() % (input.size() + 1);
+            auto c = alphabet[random() % alphabet.size()];
+            switch (random() % 3) {
+                case 0:
+                    input.insert(position, 1, c);
+                    break;
+                case 1:
+                    if (position < input.size()) {
+                        input.erase(position, 1);
+                    }
+                    break;
+                default:
+                    if (position < input.size()) {
+                        input[position] = c;
+                    }
+                    break;
+            }
+        }
+
+        std::unordered_map<std::string, std::string> members{{"name", ""}, {"callId", ""}, {"values", ""}};
+        bool accepted = getMembers(input, members);
+        bool expected = json::Value::accept(input) && json::Value::parse(input).is_object();
+        ASSERT_EQ(accepted, expected) << "Input: " << input;
+        if (accepted) {
+            auto root = json::Value::parse(input);
+            for (const auto& member : members) {
+                if (!member.second.empty()) {
+                    EXPECT_EQ(json::Value::parse(member.second), root[member.first]) << "Input: " << input;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+// engine includes
+#include <AACE/Engine/Utils/Hash/Hash.h>
+
+using namespace aace::engine::utils::hash;
+
+TEST(HashTest, fnv1aMatchesReferenceValues) {
+    EXPECT_EQ(fnv1a(""), 0xcbf29ce484222325ULL);
+    EXPECT_EQ(fnv1a("a"), 0xaf63dc4c8601ec8cULL);
+    EXPECT_EQ(fnv1a("foobar"), 0x85944171f73967e8ULL);
+    EXPECT_EQ(fnv1a(std::string("\xff\x00", 2)), fnv1a(std::string("\x00", 1), fnv1a("\xff")));
+}
+
+TEST(HashTest, fnv1aContinuesHash) {
+    EXPECT_EQ(fnv1a("bar", fnv1a("foo")), fnv1a("foobar"));
+    EXPECT_NE(fnv1a("oobar", fnv1a("f")), fnv1a("foobar", fnv1a("f")));
+}
+
+TEST(HashTest, toHexPadsToSixteenDigits) {
+    EXPECT_EQ(toHex(0xaf63dc4c8601ec8cULL), "af63dc4c8601ec8c");
+    EXPECT_EQ(toHex(0x1ULL), "0000000000000001");
+    EXPECT_EQ(toHex(fnv1a("")), "cbf29ce484222325");
+}
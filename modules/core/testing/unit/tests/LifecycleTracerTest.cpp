@@ -0,0 +1,108 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <AACE/Core/EngineConfiguration.h>
+#include <AACE/Engine/Core/EngineImpl.h>
+#include <AACE/Engine/Core/LifecycleTracer.h>
+
+using namespace aace::engine::core;
+
+static const std::string TRACE_PATH = "/tmp/aace-lifecycle-tracer-test.json";
+
+/// Returns the complete events of a trace, which are the spans recorded by the engine.
+static std::vector<nlohmann::json> getSpans(const nlohmann::json& trace) {
+    std::vector<nlohmann::json> spans;
+    for (auto& next : trace.at("traceEvents")) {
+        if (next.at("ph") == "X") {
+            spans.push_back(next);
+        }
+    }
+    return spans;
+}
+
+TEST(LifecycleTracerTest, recordSpans) {
+    LifecycleTracer tracer;
+    {
+        LifecycleTracer::Span span(tracer, "Engine.start", "engine");
+        std::thread([&tracer] { LifecycleTracer::Span serviceSpan(tracer, "aace.test", "start"); }).join();
+    }
+
+    auto events = tracer.getEvents();
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0].name, "aace.test");
+    EXPECT_EQ(events[0].category, "start");
+    EXPECT_EQ(events[0].thread, 1u);
+    EXPECT_EQ(events[1].name, "Engine.start");
+    EXPECT_EQ(events[1].thread, 0u);
+    EXPECT_LE(events[1].start, events[0].start);
+    EXPECT_GE(events[1].start + events[1].duration, events[0].start + events[0].duration);
+
+    auto trace = nlohmann::json::parse(tracer.toJson());
+    EXPECT_EQ(trace.at("traceEvents").size(), 4u);
+    EXPECT_EQ(getSpans(trace).size(), 2u);
+    EXPECT_EQ(trace.at("otherData").at("droppedEvents"), 0);
+}
+
+TEST(LifecycleTracerTest, dropSpansOverLimit) {
+    LifecycleTracer tracer(2);
+    for (int i = 0; i < 5; i++) {
+        LifecycleTracer::Span span(tracer, "aace.test", "start");
+    }
+    EXPECT_EQ(tracer.getEvents().size(), 2u);
+    EXPECT_EQ(nlohmann::json::parse(tracer.toJson()).at("otherData").at("droppedEvents"), 3);
+}
+
+static bool hasSpan(const std::vector<nlohmann::json>& spans, const std::string& name) {
+    return std::any_of(spans.begin(), spans.end(), [&name](const nlohmann::json& span) {
+        return span.at("name") == name;
+    });
+}
+
+TEST(LifecycleTracerTest, engineWritesTraceAtStartAndShutdown) {
+    std::remove(TRACE_PATH.c_str());
+    auto configuration = nlohmann::json({{"aace.engine", {{"lifecycleTracePath", TRACE_PATH}}}});
+    auto engine = EngineImpl::create();
+    ASSERT_NE(engine, nullptr) << "Create engine failed!";
+    ASSERT_TRUE(engine->configure(aace::core::config::StreamConfiguration::create(
+        std::make_shared<std::stringstream>(configuration.dump()))))
+        << "Configure engine failed!";
+    ASSERT_TRUE(engine->start()) << "Start engine failed!";
+
+    // the trace is written once the engine is started, with a span for each service
+    std::ifstream startTrace(TRACE_PATH);
+    auto spans = getSpans(nlohmann::json::parse(startTrace));
+    EXPECT_TRUE(hasSpan(spans, "Engine.start"));
+    EXPECT_TRUE(hasSpan(spans, "aace.messageBroker"));
+    EXPECT_FALSE(hasSpan(spans, "Engine.shutdown"));
+
+    ASSERT_TRUE(engine->stop()) << "Stop engine failed!";
+    ASSERT_TRUE(engine->shutdown()) << "Shutdown engine failed!";
+
+    // the trace written at shutdown includes the stop and shutdown phases
+    std::ifstream shutdownTrace(TRACE_PATH);
+    EXPECT_TRUE(hasSpan(getSpans(nlohmann::json::parse(shutdownTrace)), "Engine.shutdown"));
+    std::remove(TRACE_PATH.c_str());
+}
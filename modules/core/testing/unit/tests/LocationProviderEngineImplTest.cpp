@@ -16,6 +16,11 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+
 #include <AACE/Engine/Location/LocationProviderEngineImpl.h>
 
 using namespace aace::location;
@@ -164,4 +169,125 @@ TEST_F(LocationProviderEngineImplTest, test_onLocationServiceAccessChangedCalled
     m_locationProviderEngineImpl->addObserver(m_mockLocationServiceObserverInterface);
     m_locationProviderEngineImpl->shutdown();
     m_locationProviderEngineImpl->onLocationServiceAccessChanged(LocationServiceAccess::ENABLED);
-}
\ No newline at end of file
+}
+
+/**
+ * @test getLocationReturnsCachedLocation
+ */
+TEST_F(LocationProviderEngineImplTest, test_getLocationReturnsCachedLocation) {
+    ASSERT_NE(nullptr, m_locationProviderEngineImpl);
+
+    EXPECT_CALL(*m_mockLocationProviderPlatformInterface, getLocation())
+        .Times(Exactly(1))
+        .WillOnce(Return(Location(47.6, -122.3)));
+    ASSERT_EQ(47.6, m_locationProviderEngineImpl->getLocation().getLatitude());
+    ASSERT_EQ(47.6, m_locationProviderEngineImpl->getLocation().getLatitude());
+}
+
+/**
+ * @test getLocationAfterLocationChanged
+ */
+TEST_F(LocationProviderEngineImplTest, test_getLocationAfterLocationChanged) {
+    ASSERT_NE(nullptr, m_locationProviderEngineImpl);
+
+    EXPECT_CALL(*m_mockLocationProviderPlatformInterface, getLocation()).Times(Exactly(0));
+    m_mockLocationProviderPlatformInterface->setEngineInterface(m_locationProviderEngineImpl);
+    m_mockLocationProviderPlatformInterface->locationChanged(Location(47.6, -122.3));
+    ASSERT_EQ(-122.3, m_locationProviderEngineImpl->getLocation().getLongitude());
+
+    m_mockLocationProviderPlatformInterface->locationChanged(Location(37.8, -122.4));
+    ASSERT_EQ(-122.4, m_locationProviderEngineImpl->getLocation().getLongitude());
+}
+
+/**
+ * @test getLocationWhenCachedLocationIsStale
+ */
+TEST_F(LocationProviderEngineImplTest, test_getLocationWhenCachedLocationIsStale) {
+    // a zero maximum age makes every cached location stale, so each query fetches the location
+    auto locationProviderEngineImpl =
+        LocationProviderEngineImpl::create(m_mockLocationProviderPlatformInterface, std::chrono::milliseconds(0));
+    ASSERT_NE(nullptr, locationProviderEngineImpl);
+
+    EXPECT_CALL(*m_mockLocationProviderPlatformInterface, getLocation())
+        .Times(Exactly(2))
+        .WillOnce(Return(Location(47.6, -122.3)))
+        .WillOnce(Return(Location(37.8, -122.4)));
+    locationProviderEngineImpl->onLocationChanged(Location(1.0, 2.0));
+    ASSERT_EQ(47.6, locationProviderEngineImpl->getLocation().getLatitude());
+    ASSERT_EQ(37.8, locationProviderEngineImpl->getLocation().getLatitude());
+    locationProviderEngineImpl->shutdown();
+}
+
+/**
+ * @test getLocationWhenFetchTimesOut
+ */
+TEST_F(LocationProviderEngineImplTest, test_getLocationWhenFetchTimesOut) {
+    auto locationProviderEngineImpl = LocationProviderEngineImpl::create(
+        m_mockLocationProviderPlatformInterface, std::chrono::milliseconds(0), std::chrono::milliseconds(20));
+    ASSERT_NE(nullptr, locationProviderEngineImpl);
+
+    // the platform does not return the location until the test releases it
+    std::mutex mutex;
+    std::condition_variable released;
+    bool isReleased = false;
+    EXPECT_CALL(*m_mockLocationProviderPlatformInterface, getLocation()).Times(Exactly(1)).WillOnce(Invoke([&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        released.wait_for(lock, std::chrono::seconds(5), [&isReleased]() { return isReleased; });
+        return Location(37.8, -122.4);
+    }));
+    locationProviderEngineImpl->onLocationChanged(Location(47.6, -122.3));
+
+    // the stale location is returned while the platform is slow, and a single request is made
+    ASSERT_EQ(47.6, locationProviderEngineImpl->getLocation().getLatitude());
+    ASSERT_EQ(47.6, locationProviderEngineImpl->getLocation().getLatitude());
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isReleased = true;
+    }
+    released.notify_all();
+    locationProviderEngineImpl->shutdown();
+}
+
+/**
+ * @test getLocationWhenPlatformThrows
+ */
+TEST_F(LocationProviderEngineImplTest, test_getLocationWhenPlatformThrows) {
+    // a zero maximum age makes every cached location stale, so each query fetches the location
+    auto locationProviderEngineImpl =
+        LocationProviderEngineImpl::create(m_mockLocationProviderPlatformInterface, std::chrono::milliseconds(0));
+    ASSERT_NE(nullptr, locationProviderEngineImpl);
+
+    EXPECT_CALL(*m_mockLocationProviderPlatformInterface, getLocation())
+        .Times(Exactly(2))
+        .WillOnce(Throw(std::runtime_error("locationUnavailable")))
+        .WillOnce(Return(Location(37.8, -122.4)));
+    locationProviderEngineImpl->onLocationChanged(Location(47.6, -122.3));
+
+    // the cached location is returned when the platform fails, and the next query fetches the location again
+    ASSERT_EQ(47.6, locationProviderEngineImpl->getLocation().getLatitude());
+    ASSERT_EQ(37.8, locationProviderEngineImpl->getLocation().getLatitude());
+    locationProviderEngineImpl->shutdown();
+}
+
+/**
+ * @test getLocationAfterLocationServiceAccessDisabled
+ */
+TEST_F(LocationProviderEngineImplTest, test_getLocationAfterLocationServiceAccessDisabled) {
+    ASSERT_NE(nullptr, m_locationProviderEngineImpl);
+
+    EXPECT_CALL(*m_mockLocationProviderPlatformInterface, getLocation()).Times(Exactly(1)).WillOnce(Return(Location()));
+    m_locationProviderEngineImpl->onLocationChanged(Location(47.6, -122.3));
+    m_locationProviderEngineImpl->onLocationServiceAccessChanged(LocationServiceAccess::DISABLED);
+    ASSERT_FALSE(m_locationProviderEngineImpl->getLocation().isValid());
+}
+
+/**
+ * @test createWithInvalidFetchTimeout
+ */
+TEST_F(LocationProviderEngineImplTest, test_createWithInvalidFetchTimeout) {
+    auto locationProviderEngineImpl = LocationProviderEngineImpl::create(
+        m_mockLocationProviderPlatformInterface,
+        LocationProviderEngineImpl::DEFAULT_MAX_LOCATION_AGE,
+        std::chrono::milliseconds(0));
+    ASSERT_EQ(nullptr, locationProviderEngineImpl);
+}
@@ -0,0 +1,513 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <AACE/Engine/MessageBroker/Message.h>
+#include <AACE/Engine/MessageBroker/MessageBrokerImpl.h>
+#include <AACE/Engine/MessageBroker/PayloadStreamChannel.h>
+#include <AACE/Engine/MessageBroker/StreamManagerImpl.h>
+
+using namespace aace::engine::messageBroker;
+using Mode = aace::core::MessageStream::Mode;
+using Clock = std::chrono::steady_clock;
+
+/*
+ * The benchmarks are disabled, so they do not run with the unit tests. Every benchmark records its results as test
+ * properties, so running the suite with --gtest_also_run_disabled_tests --gtest_output=json:<path> (or xml:<path>)
+ * writes them in a machine-readable report which can be compared between releases.
+ */
+
+/// The size of a 10 ms frame of 16 kHz, 16-bit mono audio, as written by the platform for speech recognition
+static const size_t AUDIO_FRAME_SIZE = 320;
+
+/// The number of bytes in one second of 16 kHz, 16-bit mono audio
+static const size_t AUDIO_BYTES_PER_SECOND = 32000;
+
+/// Returns the value at @c percentile of sorted durations, in microseconds.
+static int64_t percentile(const std::vector<Clock::duration>& sorted, double percentile) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    auto index = std::min(sorted.size() - 1, static_cast<size_t>(percentile / 100 * sorted.size()));
+    return std::chrono::duration_cast<std::chrono::microseconds>(sorted[index]).count();
+}
+
+/// Creates a message with a payload of about @c payloadSize bytes.
+static std::string createMessage(
+    const std::string& id,
+    const std::string& topic,
+    const std::string& action,
+    size_t payloadSize) {
+    nlohmann::json message = {
+        {"header",
+         {{"id", id},
+          {"messageType", "Publish"},
+          {"version", "4.0"},
+          {"messageDescription", {{"topic", topic}, {"action", action}}}}}};
+    if (payloadSize > 0) {
+        message["payload"] = {{"data", std::string(payloadSize, 'x')}};
+    }
+    return message.dump();
+}
+
+/// Creates the reply to a message.
+static std::string createReply(const Message& message) {
+    nlohmann::json reply = {
+        {"header",
+         {{"id", "reply-" + message.messageId()},
+          {"messageType", "Reply"},
+          {"version", "4.0"},
+          {"messageDescription",
+           {{"topic", message.topic()}, {"action", message.action()}, {"replyToId", message.messageId()}}}}},
+        {"payload", {{"location", {{"latitude", 37.410}, {"longitude", -122.025}}}}}};
+    return reply.dump();
+}
+
+/// Creates an APL document of about @c size bytes, with the nested layouts of a rendered template.
+static std::string createAplDocument(size_t size) {
+    nlohmann::json items = nlohmann::json::array();
+    std::string document;
+    while (document.size() < size) {
+        items.push_back(
+            {{"type", "Container"},
+             {"direction", "row"},
+             {"items",
+              {{{"type", "Image"}, {"source", "https://example.com/image.png"}, {"width", "20vw"}},
+               {{"type", "Text"}, {"text", "Item " + std::to_string(items.size())}, {"fontSize", "24dp"}}}}});
+        if (items.size() % 64 == 0) {
+            document = nlohmann::json({{"type", "APL"}, {"version", "1.6"}, {"mainTemplate", {{"items", items}}}})
+                           .dump();
+        }
+    }
+    return document;
+}
+
+/// Creates a RenderDocument message embedding or referencing an APL document.
+static std::string createRenderDocument(
+    const std::string& id,
+    const std::string& document,
+    const std::string& streamId) {
+    nlohmann::json payload = {{"token", "token"}, {"windowId", "main"}};
+    if (streamId.empty()) {
+        payload["payload"] = document;
+    } else {
+        payload["streamId"] = streamId;
+    }
+    nlohmann::json message = {
+        {"header",
+         {{"id", id},
+          {"messageType", "Publish"},
+          {"version", "4.0"},
+          {"messageDescription", {{"topic", "APL"}, {"action", "RenderDocument"}}}}},
+        {"payload", payload}};
+    return message.dump();
+}
+
+/// Audio input stream, as registered by the engine for the platform to write to.
+class AudioSinkStream : public aace::core::MessageStream {
+public:
+    AudioSinkStream(size_t expectedBytes) : m_expectedBytes(expectedBytes), m_bytesWritten(0) {
+    }
+
+    ssize_t read(char* data, const size_t size) override {
+        return -1;
+    }
+
+    ssize_t write(const char* data, const size_t size) override {
+        m_bytesWritten += size;
+        return size;
+    }
+
+    bool isClosed() override {
+        return m_bytesWritten >= m_expectedBytes;
+    }
+
+    Mode getMode() override {
+        return Mode::WRITE;
+    }
+
+    size_t getBytesWritten() const {
+        return m_bytesWritten;
+    }
+
+private:
+    const size_t m_expectedBytes;
+    std::atomic<size_t> m_bytesWritten;
+};
+
+/// Audio output stream, as registered by the engine for the platform to read from.
+class AudioSourceStream : public aace::core::MessageStream {
+public:
+    AudioSourceStream(size_t size) : m_audio(size, 'a'), m_offset(0) {
+    }
+
+    ssize_t read(char* data, const size_t size) override {
+        auto count = std::min(size, m_audio.size() - m_offset);
+        std::copy_n(m_audio.data() + m_offset, count, data);
+        m_offset += count;
+        return count;
+    }
+
+    ssize_t write(const char* data, const size_t size) override {
+        return -1;
+    }
+
+    bool isClosed() override {
+        return m_offset >= m_audio.size();
+    }
+
+    Mode getMode() override {
+        return Mode::READ;
+    }
+
+private:
+    const std::string m_audio;
+    size_t m_offset;
+};
+
+/// Test harness for the throughput and latency of @c MessageBrokerImpl and @c StreamManagerImpl
+class MessageBrokerBenchmarkTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_broker = MessageBrokerImpl::create();
+        ASSERT_NE(m_broker, nullptr) << "Create message broker failed!";
+        m_broker->setMessageTimeout(std::chrono::milliseconds{2000});
+        m_streamManager = StreamManagerImpl::create();
+        ASSERT_NE(m_streamManager, nullptr) << "Create stream manager failed!";
+    }
+
+    void TearDown() override {
+        if (m_broker != nullptr) {
+            m_broker->shutdown();
+            m_broker.reset();
+        }
+    }
+
+protected:
+    /// Records the latency percentiles of a benchmark in the test report.
+    void report(const std::string& name, std::vector<Clock::duration> latencies) {
+        std::sort(latencies.begin(), latencies.end());
+        auto p50 = percentile(latencies, 50);
+        auto p90 = percentile(latencies, 90);
+        auto p99 = percentile(latencies, 99);
+        auto max = percentile(latencies, 100);
+        RecordProperty(name + ".samples", static_cast<int>(latencies.size()));
+        RecordProperty(name + ".p50Us", static_cast<int>(p50));
+        RecordProperty(name + ".p90Us", static_cast<int>(p90));
+        RecordProperty(name + ".p99Us", static_cast<int>(p99));
+        RecordProperty(name + ".maxUs", static_cast<int>(max));
+    }
+
+    /// Records the rate of a benchmark in the test report.
+    void report(const std::string& name, const std::string& unit, double count, Clock::duration duration) {
+        auto seconds = std::chrono::duration<double>(duration).count();
+        auto rate = static_cast<int>(count / seconds);
+        RecordProperty(name + "." + unit + "PerSecond", rate);
+    }
+
+    /**
+     * Publishes messages one at a time to a subscriber on the platform side, and returns the time from
+     * the publication of each message to its delivery.
+     */
+    std::vector<Clock::duration> measureLatency(const std::vector<std::string>& messages) {
+        std::mutex mutex;
+        std::condition_variable delivered;
+        Clock::time_point deliveryTime;
+        bool isDelivered = false;
+
+        m_broker->subscribe(
+            "Benchmark",
+            [&](const Message& message) {
+                std::lock_guard<std::mutex> lock(mutex);
+                deliveryTime = Clock::now();
+                isDelivered = true;
+                delivered.notify_one();
+            },
+            Message::Direction::OUTGOING);
+
+        std::vector<Clock::duration> latencies;
+        for (auto& message : messages) {
+            std::unique_lock<std::mutex> lock(mutex);
+            isDelivered = false;
+            auto start = Clock::now();
+            lock.unlock();
+            m_broker->publish(message).send();
+            lock.lock();
+            if (!delivered.wait_for(lock, std::chrono::seconds(2), [&] { return isDelivered; })) {
+                ADD_FAILURE() << "Message was not delivered!";
+                break;
+            }
+            latencies.push_back(deliveryTime - start);
+        }
+        return latencies;
+    }
+
+    std::shared_ptr<MessageBrokerImpl> m_broker;
+    std::shared_ptr<StreamManagerImpl> m_streamManager;
+};
+
+TEST_F(MessageBrokerBenchmarkTest, DISABLED_benchmarkPublishLatency) {
+    // the sizes of the messages published by the engine in a typical session: mostly small state changes
+    // and requests, some rendered templates and lists, and the occasional large document
+    const std::vector<std::pair<std::string, size_t>> mix = {
+        {"small", 256}, {"small", 256}, {"small", 512}, {"small", 128}, {"small", 256}, {"small", 512},
+        {"small", 256}, {"medium", 4096}, {"medium", 8192}, {"large", 65536}};
+    const int iterations = 100;
+
+    std::vector<std::string> messages;
+    for (int i = 0; i < iterations; i++) {
+        for (auto& next : mix) {
+            messages.push_back(createMessage(
+                "benchmark-" + std::to_string(messages.size()), "Benchmark", next.first, next.second));
+        }
+    }
+
+    auto latencies = measureLatency(messages);
+    ASSERT_EQ(latencies.size(), messages.size());
+    report("publishLatency.mix", latencies);
+}
+
+TEST_F(MessageBrokerBenchmarkTest, DISABLED_benchmarkFanOutThroughput) {
+    const int messageCount = 2000;
+    for (int subscriberCount : {1, 4, 16}) {
+        // the subscribers of the topic, the action, and all the messages, as registered by the engine services
+        std::atomic<int> deliveries(0);
+        std::promise<void> done;
+        const int expectedDeliveries = messageCount * subscriberCount;
+        auto handler = [&](const Message& message) {
+            if (++deliveries == expectedDeliveries) {
+                done.set_value();
+            }
+        };
+        auto topic = "FanOut" + std::to_string(subscriberCount);
+        for (int i = 0; i < subscriberCount; i++) {
+            switch (i % 3) {
+                case 0:
+                    m_broker->subscribe(topic, handler, Message::Direction::OUTGOING);
+                    break;
+                case 1:
+                    m_broker->subscribe(topic, "Action", handler, Message::Direction::OUTGOING);
+                    break;
+                default:
+                    m_broker->subscribe(topic, "Other", handler, Message::Direction::OUTGOING);
+                    m_broker->subscribe(topic, handler, Message::Direction::OUTGOING);
+                    break;
+            }
+        }
+
+        std::vector<std::string> messages;
+        for (int i = 0; i < messageCount; i++) {
+            messages.push_back(createMessage("fanout-" + std::to_string(i), topic, "Action", 256));
+        }
+
+        auto future = done.get_future();
+        auto start = Clock::now();
+        for (auto& message : messages) {
+            m_broker->publish(message).send();
+        }
+        ASSERT_EQ(future.wait_for(std::chrono::seconds(30)), std::future_status::ready)
+            << "Messages were not delivered!";
+        auto duration = Clock::now() - start;
+        EXPECT_EQ(deliveries, expectedDeliveries);
+
+        report("fanOut.subscribers" + std::to_string(subscriberCount), "messages", messageCount, duration);
+        report("fanOut.subscribers" + std::to_string(subscriberCount), "deliveries", deliveries, duration);
+    }
+}
+
+TEST_F(MessageBrokerBenchmarkTest, DISABLED_benchmarkSyncRoundTrip) {
+    const int iterations = 500;
+
+    // the platform replies to the request from the thread delivering it, like a handler answering from memory
+    m_broker->subscribe(
+        "LocationProvider",
+        [this](const Message& message) { m_broker->publish(createReply(message)).send(); },
+        Message::Direction::OUTGOING);
+
+    std::vector<Clock::duration> latencies;
+    for (int i = 0; i < iterations; i++) {
+        auto request = createMessage("sync-" + std::to_string(i), "LocationProvider", "GetLocation", 0);
+        auto start = Clock::now();
+        auto reply = m_broker->publish(request).get();
+        latencies.push_back(Clock::now() - start);
+        ASSERT_TRUE(reply.valid()) << "Invalid reply to message " << i;
+        ASSERT_EQ(reply.replyTo(), "sync-" + std::to_string(i));
+    }
+    report("syncRoundTrip.inline", latencies);
+
+    // the platform replies from another thread, as when it queries its own services
+    std::weak_ptr<MessageBrokerImpl> broker = m_broker;
+    m_broker->subscribe(
+        "NetworkInfoProvider",
+        [broker](const Message& message) {
+            std::thread([broker, message]() {
+                if (auto sp = broker.lock()) {
+                    sp->publish(createReply(message)).send();
+                }
+            }).detach();
+        },
+        Message::Direction::OUTGOING);
+
+    latencies.clear();
+    for (int i = 0; i < iterations; i++) {
+        auto request = createMessage("async-" + std::to_string(i), "NetworkInfoProvider", "GetNetworkStatus", 0);
+        auto start = Clock::now();
+        auto reply = m_broker->publish(request).get();
+        latencies.push_back(Clock::now() - start);
+        ASSERT_TRUE(reply.valid()) << "Invalid reply to message " << i;
+    }
+    report("syncRoundTrip.threaded", latencies);
+}
+
+TEST_F(MessageBrokerBenchmarkTest, DISABLED_benchmarkLargeAplPayloads) {
+    auto channel = PayloadStreamChannel::create(m_streamManager, 16 * 1024);
+    ASSERT_NE(channel, nullptr);
+    const int iterations = 20;
+
+    // the platform gets the document from the message, or reads it from the stream the message references
+    std::mutex mutex;
+    std::condition_variable rendered;
+    size_t renderedSize = 0;
+    m_broker->subscribe(
+        "APL",
+        "RenderDocument",
+        [&](const Message& message) {
+            auto payload = nlohmann::json::parse(message.payload());
+            std::string document;
+            if (payload.contains("streamId")) {
+                auto stream = m_streamManager->requestStreamHandler(payload["streamId"], Mode::READ);
+                std::vector<char> buffer(64 * 1024);
+                while (stream != nullptr && !stream->isClosed()) {
+                    auto count = stream->read(buffer.data(), buffer.size());
+                    if (count <= 0) {
+                        break;
+                    }
+                    document.append(buffer.data(), count);
+                }
+            } else {
+                document = payload["payload"];
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            renderedSize = document.size();
+            rendered.notify_one();
+        },
+        Message::Direction::OUTGOING);
+
+    for (size_t size : {100 * 1024, 500 * 1024, 1024 * 1024}) {
+        auto document = createAplDocument(size);
+        auto name = "aplPayload." + std::to_string(size / 1024) + "KB";
+
+        auto measure = [&](bool stream) {
+            std::vector<Clock::duration> latencies;
+            for (int i = 0; i < iterations; i++) {
+                std::unique_lock<std::mutex> lock(mutex);
+                renderedSize = 0;
+                lock.unlock();
+
+                // the time to build the message is part of the cost of sending the document
+                auto start = Clock::now();
+                auto id = name + "-" + std::to_string(i);
+                if (stream) {
+                    auto payload = document;
+                    auto streamId = channel->send(payload);
+                    EXPECT_FALSE(streamId.empty());
+                    m_broker->publish(createRenderDocument(id, "", streamId)).send();
+                } else {
+                    m_broker->publish(createRenderDocument(id, document, "")).send();
+                }
+
+                lock.lock();
+                if (!rendered.wait_for(lock, std::chrono::seconds(5), [&] { return renderedSize != 0; })) {
+                    ADD_FAILURE() << "Document was not rendered!";
+                    break;
+                }
+                latencies.push_back(Clock::now() - start);
+                EXPECT_EQ(renderedSize, document.size());
+            }
+            return latencies;
+        };
+
+        auto embedded = measure(false);
+        auto streamed = measure(true);
+        ASSERT_EQ(embedded.size(), static_cast<size_t>(iterations));
+        ASSERT_EQ(streamed.size(), static_cast<size_t>(iterations));
+        report(name + ".embedded", embedded);
+        report(name + ".streamed", streamed);
+    }
+}
+
+TEST_F(MessageBrokerBenchmarkTest, DISABLED_benchmarkAudioStreaming) {
+    const size_t seconds = 60;
+    const size_t size = seconds * AUDIO_BYTES_PER_SECOND;
+
+    // audio input: the platform writes 10 ms frames to the stream of the engine
+    {
+        auto sink = std::make_shared<AudioSinkStream>(size);
+        ASSERT_TRUE(m_streamManager->registerStreamHandler("audioInput", sink));
+        auto start = Clock::now();
+        auto stream = m_streamManager->requestStreamHandler("audioInput", Mode::WRITE);
+        ASSERT_NE(stream, nullptr);
+        std::vector<char> frame(AUDIO_FRAME_SIZE, 'a');
+        while (!stream->isClosed()) {
+            ASSERT_EQ(stream->write(frame.data(), frame.size()), static_cast<ssize_t>(frame.size()));
+        }
+        auto duration = Clock::now() - start;
+        EXPECT_EQ(sink->getBytesWritten(), size);
+        report("audioInput", "kilobytes", size / 1024.0, duration);
+        report("audioInput", "frames", size / AUDIO_FRAME_SIZE, duration);
+    }
+
+    // audio output: the platform reads the stream of the engine into its player buffer
+    {
+        ASSERT_TRUE(m_streamManager->registerStreamHandler("audioOutput", std::make_shared<AudioSourceStream>(size)));
+        auto start = Clock::now();
+        auto stream = m_streamManager->requestStreamHandler("audioOutput", Mode::READ);
+        ASSERT_NE(stream, nullptr);
+        std::vector<char> buffer(4096);
+        size_t bytesRead = 0;
+        while (!stream->isClosed()) {
+            auto count = stream->read(buffer.data(), buffer.size());
+            ASSERT_GT(count, 0);
+            bytesRead += count;
+        }
+        auto duration = Clock::now() - start;
+        EXPECT_EQ(bytesRead, size);
+        report("audioOutput", "kilobytes", size / 1024.0, duration);
+    }
+
+    // opening streams: one per utterance and per audio item
+    {
+        const int streamCount = 1000;
+        auto start = Clock::now();
+        for (int i = 0; i < streamCount; i++) {
+            auto streamId = "stream-" + std::to_string(i);
+            ASSERT_TRUE(m_streamManager->registerStreamHandler(streamId, std::make_shared<AudioSourceStream>(1)));
+            ASSERT_NE(m_streamManager->requestStreamHandler(streamId, Mode::READ), nullptr);
+        }
+        report("streamOpen", "streams", streamCount, Clock::now() - start);
+    }
+}
@@ -0,0 +1,234 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+#include <AACE/Core/MessageBroker.h>
+#include <AACE/Engine/MessageBroker/MessageBrokerImpl.h>
+#include <AACE/Engine/MessageBroker/MessageTrafficRecorder.h>
+#include <AACE/Test/Unit/MessageBroker/MessageTrafficReplayer.h>
+
+using namespace aace::engine::messageBroker;
+using MessageTrafficReplayer = aace::test::unit::core::MessageTrafficReplayer;
+
+static const std::string RECORDING_PATH = "/tmp/aace-message-traffic.jsonl";
+
+/// Connects to the message broker as the platform does through the Engine.
+class PlatformMessageBroker : public aace::core::MessageBroker {
+public:
+    PlatformMessageBroker(std::shared_ptr<MessageBrokerImpl> messageBroker) : m_messageBroker(messageBroker) {
+    }
+
+    void publish(const std::string& message) override {
+        m_messageBroker->publish(message, Message::Direction::INCOMING).send();
+    }
+
+    void subscribe(MessageHandler handler, const std::string& topic, const std::string& action) override {
+        m_messageBroker->subscribe(
+            topic, action, [handler](const Message& message) { handler(message.str()); }, Message::Direction::OUTGOING);
+    }
+
+    std::shared_ptr<aace::core::MessageStream> openStream(
+        const std::string& streamId,
+        aace::core::MessageStream::Mode mode) override {
+        return nullptr;
+    }
+
+private:
+    std::shared_ptr<MessageBrokerImpl> m_messageBroker;
+};
+
+static std::string createMessage(const std::string& id, const std::string& topic, const std::string& action) {
+    return nlohmann::json(
+               {{"header",
+                 {{"id", id},
+                  {"messageType", "Publish"},
+                  {"version", "4.0"},
+                  {"messageDescription", {{"topic", topic}, {"action", action}}}}}})
+        .dump(2);
+}
+
+static std::string createReply(const std::string& replyToId, const std::string& topic, const std::string& action) {
+    return nlohmann::json(
+               {{"header",
+                 {{"id", "reply-" + replyToId},
+                  {"messageType", "Reply"},
+                  {"version", "4.0"},
+                  {"messageDescription", {{"topic", topic}, {"action", action}, {"replyToId", replyToId}}}}},
+                {"payload", {{"location", {{"latitude", 37.410}, {"longitude", -122.025}}}}}})
+        .dump(2);
+}
+
+/// Test harness for @c MessageTrafficRecorder and @c MessageTrafficReplayer
+class MessageTrafficReplayerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        std::remove(RECORDING_PATH.c_str());
+        m_broker = MessageBrokerImpl::create();
+        m_broker->setMessageTimeout(std::chrono::milliseconds{500});
+        m_platform = std::make_shared<PlatformMessageBroker>(m_broker);
+
+        // the Engine requests the location whenever the platform starts a test
+        m_broker->subscribe(
+            "Test",
+            "Start",
+            [this](const Message& message) {
+                auto reply =
+                    m_broker->publish(createMessage(message.messageId() + "-request", "LocationProvider", "GetLocation"))
+                        .get();
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_replies.push_back(reply.valid());
+                m_repliesChanged.notify_all();
+            },
+            Message::Direction::INCOMING);
+    }
+
+    void TearDown() override {
+        m_broker->shutdown();
+        std::remove(RECORDING_PATH.c_str());
+    }
+
+    /// Waits until the Engine received the replies to its requests, since it cannot shut down while it waits for one.
+    std::vector<bool> waitForReplies(size_t count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_repliesChanged.wait_for(lock, std::chrono::seconds(5), [&] { return m_replies.size() >= count; });
+        return m_replies;
+    }
+
+    std::vector<nlohmann::json> readRecording() {
+        std::vector<nlohmann::json> entries;
+        std::ifstream file(RECORDING_PATH);
+        std::string line;
+        while (std::getline(file, line)) {
+            entries.push_back(nlohmann::json::parse(line));
+        }
+        return entries;
+    }
+
+protected:
+    std::shared_ptr<MessageBrokerImpl> m_broker;
+    std::shared_ptr<PlatformMessageBroker> m_platform;
+    std::vector<bool> m_replies;
+    std::mutex m_mutex;
+    std::condition_variable m_repliesChanged;
+};
+
+TEST_F(MessageTrafficReplayerTest, createRecorderWithInvalidPath) {
+    ASSERT_EQ(MessageTrafficRecorder::create(""), nullptr);
+    ASSERT_EQ(MessageTrafficRecorder::create("/nonexistent/recording.jsonl"), nullptr);
+    ASSERT_EQ(MessageTrafficRecorder::create(RECORDING_PATH, 0), nullptr);
+}
+
+TEST_F(MessageTrafficReplayerTest, recordBothDirections) {
+    auto recorder = MessageTrafficRecorder::create(RECORDING_PATH);
+    ASSERT_NE(recorder, nullptr);
+    m_broker->setTrafficRecorder(recorder);
+
+    // the platform answers the location requests of the Engine
+    m_platform->subscribe(
+        [this](const std::string& message) {
+            m_platform->publish(
+                createReply(nlohmann::json::parse(message)["header"]["id"], "LocationProvider", "GetLocation"));
+        },
+        "LocationProvider",
+        "GetLocation");
+
+    m_platform->publish(createMessage("start", "Test", "Start"));
+    ASSERT_EQ(waitForReplies(1), std::vector<bool>({true}));
+    recorder->flush();
+
+    auto entries = readRecording();
+    ASSERT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries[0]["direction"], "INCOMING");
+    EXPECT_EQ(entries[0]["message"], createMessage("start", "Test", "Start"));
+    EXPECT_EQ(entries[1]["direction"], "OUTGOING");
+    EXPECT_EQ(entries[2]["direction"], "INCOMING");
+    EXPECT_EQ(entries[2]["message"], createReply("start-request", "LocationProvider", "GetLocation"));
+    EXPECT_LE(entries[0]["time"].get<int64_t>(), entries[2]["time"].get<int64_t>());
+}
+
+TEST_F(MessageTrafficReplayerTest, recordUpToMaxSize) {
+    auto message = createMessage("start", "Test", "Start");
+    auto recorder = MessageTrafficRecorder::create(RECORDING_PATH, 2 * message.size() - 1);
+    ASSERT_NE(recorder, nullptr);
+
+    // the first message fits with its time and direction, but two messages do not
+    recorder->record(Message::Direction::INCOMING, message);
+    recorder->record(Message::Direction::INCOMING, message);
+    // the recording is stopped once a message is left out
+    recorder->record(Message::Direction::INCOMING, "{}");
+    recorder->flush();
+
+    auto entries = readRecording();
+    ASSERT_EQ(entries.size(), 1u);
+    EXPECT_EQ(entries[0]["message"], message);
+}
+
+TEST_F(MessageTrafficReplayerTest, recordEscapedMessageUpToMaxSize) {
+    auto message = createMessage("start", "Test", "Start");
+    auto recorder = MessageTrafficRecorder::create(RECORDING_PATH, message.size() + 10);
+    ASSERT_NE(recorder, nullptr);
+
+    // the message fits, but not with its escapes, time and direction, and the following messages are left out
+    recorder->record(Message::Direction::INCOMING, message);
+    recorder->record(Message::Direction::INCOMING, "{}");
+    recorder->flush();
+
+    EXPECT_TRUE(readRecording().empty());
+}
+
+TEST_F(MessageTrafficReplayerTest, replayWithoutRecording) {
+    ASSERT_EQ(MessageTrafficReplayer::create("/tmp/aace-missing-message-traffic.jsonl"), nullptr);
+}
+
+TEST_F(MessageTrafficReplayerTest, replayAnswersEngineRequests) {
+    {
+        std::ofstream file(RECORDING_PATH);
+        auto line = [&](int64_t time, const std::string& direction, const std::string& message) {
+            file << nlohmann::json({{"time", time}, {"direction", direction}, {"message", message}}).dump() << '\n';
+        };
+        for (int i = 0; i < 5; i++) {
+            auto id = "start-" + std::to_string(i);
+            line(i * 20000, "INCOMING", createMessage(id, "Test", "Start"));
+            line(i * 20000 + 100, "OUTGOING", createMessage(id + "-request", "LocationProvider", "GetLocation"));
+            line(i * 20000 + 200, "INCOMING", createReply(id + "-request", "LocationProvider", "GetLocation"));
+        }
+        // the Engine stopped while writing the last line
+        file << "{\"time\":100000,\"direc";
+    }
+    auto replayer = MessageTrafficReplayer::create(RECORDING_PATH);
+    ASSERT_NE(replayer, nullptr);
+
+    MessageTrafficReplayer::Options options;
+    options.rate = 10;
+    options.sessions = 4;
+    options.idleTimeout = std::chrono::milliseconds(100);
+    auto result = replayer->replay(m_platform, options);
+    EXPECT_EQ(waitForReplies(20), std::vector<bool>(20, true));
+
+    EXPECT_EQ(result.published, 20u);
+    EXPECT_EQ(result.replied, 20u);
+    EXPECT_EQ(result.received, 20u);
+    EXPECT_EQ(result.recorded, 5u);
+    EXPECT_GE(result.duration, std::chrono::milliseconds(8) + options.idleTimeout);
+}
@@ -0,0 +1,333 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// engine includes
+#include <AACE/Engine/Utils/Audio/PCM.h>
+#include <AACE/Engine/Utils/Audio/Resampler.h>
+
+using namespace aace::engine::utils::audio;
+using SimdLevel = pcm::SimdLevel;
+
+/// Number of samples used by the kernel tests, chosen so every vector implementation has a scalar tail.
+static const size_t TEST_SAMPLE_COUNT = 1027;
+
+/// Number of samples used by the benchmarks (one second of 48 kHz stereo audio).
+static const size_t BENCHMARK_SAMPLE_COUNT = 96000;
+
+/// Number of iterations used by the benchmarks.
+static const int BENCHMARK_ITERATIONS = 50;
+
+/// Test harness for the PCM kernels and @c Resampler.
+class PCMTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int> distribution(-32768, 32767);
+        m_samples.resize(TEST_SAMPLE_COUNT);
+        for (auto& sample : m_samples) {
+            sample = static_cast<int16_t>(distribution(generator));
+        }
+    }
+
+    void TearDown() override {
+        pcm::setSimdLevel(pcm::getSupportedSimdLevel());
+    }
+
+    /// Returns every instruction set supported by this CPU, other than scalar.
+    static std::vector<SimdLevel> vectorLevels() {
+        std::vector<SimdLevel> levels;
+        for (auto level : {SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::NEON}) {
+            if (pcm::setSimdLevel(level)) {
+                levels.push_back(level);
+            }
+        }
+        pcm::setSimdLevel(SimdLevel::SCALAR);
+        return levels;
+    }
+
+    static void expectNear(const std::vector<int16_t>& expected, const std::vector<int16_t>& actual, int tolerance) {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_LE(std::abs(expected[i] - actual[i]), tolerance) << "Mismatch at sample " << i;
+        }
+    }
+
+    static std::vector<int16_t> tone(unsigned int rate, double frequency, size_t count, double amplitude = 10000) {
+        std::vector<int16_t> samples(count);
+        for (size_t i = 0; i < count; i++) {
+            samples[i] = static_cast<int16_t>(amplitude * std::sin(2.0 * M_PI * frequency * i / rate));
+        }
+        return samples;
+    }
+
+    static double rms(const std::vector<int16_t>& samples, size_t skip) {
+        double sum = 0;
+        for (size_t i = skip; i < samples.size(); i++) {
+            sum += static_cast<double>(samples[i]) * samples[i];
+        }
+        return std::sqrt(sum / (samples.size() - skip));
+    }
+
+    static std::vector<int16_t> resample(
+        unsigned int inputRate,
+        unsigned int outputRate,
+        const std::vector<int16_t>& in) {
+        auto resampler = Resampler::create(inputRate, outputRate);
+        EXPECT_NE(resampler, nullptr);
+        std::vector<int16_t> out;
+        if (resampler == nullptr) {
+            return out;
+        }
+        // feed the input in uneven blocks to exercise the filter state between calls
+        size_t blockSizes[] = {441, 160, 1, 999};
+        size_t offset = 0;
+        for (size_t block = 0; offset < in.size(); block++) {
+            size_t count = std::min(blockSizes[block % 4], in.size() - offset);
+            std::vector<int16_t> buffer(resampler->getMaxOutputCount(count));
+            size_t written = 0;
+            EXPECT_TRUE(resampler->process(in.data() + offset, count, buffer.data(), buffer.size(), written));
+            out.insert(out.end(), buffer.begin(), buffer.begin() + written);
+            offset += count;
+        }
+        return out;
+    }
+
+    template <typename Function>
+    static double benchmark(Function function) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+            function();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / BENCHMARK_ITERATIONS;
+    }
+
+protected:
+    std::vector<int16_t> m_samples;
+};
+
+TEST_F(PCMTest, bytesToInt16HandlesUnalignedAndOddInput) {
+    // copy the samples to an odd address, followed by one stray byte
+    const char* raw = reinterpret_cast<const char*>(m_samples.data());
+    std::vector<char> bytes(TEST_SAMPLE_COUNT * 2 + 2);
+    std::copy(raw, raw + TEST_SAMPLE_COUNT * 2, bytes.begin() + 1);
+    std::vector<int16_t> samples(m_samples.size());
+    ASSERT_EQ(pcm::bytesToInt16(bytes.data() + 1, m_samples.size() * 2 + 1, samples.data()), m_samples.size());
+    ASSERT_EQ(samples, m_samples);
+}
+
+TEST_F(PCMTest, vectorKernelsMatchScalar) {
+    for (auto level : vectorLevels()) {
+        SCOPED_TRACE(pcm::toString(level));
+
+        // int16 to float
+        std::vector<float> expectedFloat(m_samples.size()), actualFloat(m_samples.size());
+        pcm::setSimdLevel(SimdLevel::SCALAR);
+        pcm::int16ToFloat(m_samples.data(), expectedFloat.data(), m_samples.size());
+        pcm::setSimdLevel(level);
+        pcm::int16ToFloat(m_samples.data(), actualFloat.data(), m_samples.size());
+        ASSERT_EQ(expectedFloat, actualFloat);
+
+        // float to int16, including values out of range
+        std::vector<float> floats(expectedFloat);
+        floats[0] = 1.5f;
+        floats[1] = -1.5f;
+        std::vector<int16_t> expected(m_samples.size()), actual(m_samples.size());
+        pcm::setSimdLevel(SimdLevel::SCALAR);
+        pcm::floatToInt16(floats.data(), expected.data(), floats.size());
+        pcm::setSimdLevel(level);
+        pcm::floatToInt16(floats.data(), actual.data(), floats.size());
+        ASSERT_EQ(actual[0], 32767);
+        ASSERT_EQ(actual[1], -32768);
+        expectNear(expected, actual, 1);
+
+        // constant gain with saturation
+        expected = actual = m_samples;
+        pcm::setSimdLevel(SimdLevel::SCALAR);
+        pcm::applyGain(expected.data(), expected.size(), 1.7f);
+        pcm::setSimdLevel(level);
+        pcm::applyGain(actual.data(), actual.size(), 1.7f);
+        expectNear(expected, actual, 1);
+
+        // gain ramps for mono and stereo
+        for (size_t channels : {1, 2}) {
+            size_t frames = m_samples.size() / channels;
+            expected = actual = m_samples;
+            pcm::setSimdLevel(SimdLevel::SCALAR);
+            pcm::applyGainRamp(expected.data(), frames, channels, 1.0f, 0.2f);
+            pcm::setSimdLevel(level);
+            pcm::applyGainRamp(actual.data(), frames, channels, 1.0f, 0.2f);
+            expectNear(expected, actual, 1);
+        }
+
+        // downmix
+        for (size_t channels : {2, 6}) {
+            size_t frames = m_samples.size() / channels;
+            expected.assign(frames, 0);
+            actual.assign(frames, 0);
+            pcm::setSimdLevel(SimdLevel::SCALAR);
+            pcm::downmixToMono(m_samples.data(), expected.data(), frames, channels);
+            pcm::setSimdLevel(level);
+            pcm::downmixToMono(m_samples.data(), actual.data(), frames, channels);
+            ASSERT_EQ(expected, actual);
+        }
+
+        // dot product
+        pcm::setSimdLevel(SimdLevel::SCALAR);
+        float expectedDot = pcm::dotProduct(expectedFloat.data(), actualFloat.data(), actualFloat.size());
+        pcm::setSimdLevel(level);
+        float actualDot = pcm::dotProduct(expectedFloat.data(), actualFloat.data(), actualFloat.size());
+        ASSERT_NEAR(expectedDot, actualDot, std::abs(expectedDot) * 1e-4);
+    }
+}
+
+TEST_F(PCMTest, kernelsRoundHalfToEven) {
+    // samples halfway between two integers, which every implementation rounds to the even one
+    std::vector<float> floats;
+    std::vector<int16_t> expected;
+    for (int sample = -20; sample < 20; sample++) {
+        floats.push_back((sample + 0.5f) / 32768.0f);
+        expected.push_back(static_cast<int16_t>(sample % 2 == 0 ? sample : sample + 1));
+    }
+    std::vector<int16_t> odd = {-7, -5, -3, -1, 1, 3, 5, 7};
+    std::vector<int16_t> expectedHalved = {-4, -2, -2, 0, 0, 2, 2, 4};
+
+    std::vector<SimdLevel> levels = {SimdLevel::SCALAR};
+    auto vector = vectorLevels();
+    levels.insert(levels.end(), vector.begin(), vector.end());
+    for (auto level : levels) {
+        SCOPED_TRACE(pcm::toString(level));
+        pcm::setSimdLevel(level);
+
+        // repeated so the vector implementations round the values rather than the scalar tail
+        std::vector<float> input;
+        std::vector<int16_t> expectedOutput;
+        for (int i = 0; i < 4; i++) {
+            input.insert(input.end(), floats.begin(), floats.end());
+            expectedOutput.insert(expectedOutput.end(), expected.begin(), expected.end());
+        }
+        std::vector<int16_t> actual(input.size());
+        pcm::floatToInt16(input.data(), actual.data(), input.size());
+        ASSERT_EQ(actual, expectedOutput);
+
+        std::vector<int16_t> samples, expectedSamples;
+        for (int i = 0; i < 8; i++) {
+            samples.insert(samples.end(), odd.begin(), odd.end());
+            expectedSamples.insert(expectedSamples.end(), expectedHalved.begin(), expectedHalved.end());
+        }
+        pcm::applyGain(samples.data(), samples.size(), 0.5f);
+        ASSERT_EQ(samples, expectedSamples);
+    }
+}
+
+TEST_F(PCMTest, downmixInPlace) {
+    std::vector<int16_t> stereo = {100, 200, -100, -300, 32767, 32767, -32768, -32768};
+    pcm::downmixToMono(stereo.data(), stereo.data(), 4, 2);
+    ASSERT_EQ(stereo[0], 150);
+    ASSERT_EQ(stereo[1], -200);
+    ASSERT_EQ(stereo[2], 32767);
+    ASSERT_EQ(stereo[3], -32768);
+}
+
+TEST_F(PCMTest, gainRampReachesTarget) {
+    std::vector<int16_t> samples(1000, 10000);
+    pcm::applyGainRamp(samples.data(), samples.size(), 1, 1.0f, 0.0f);
+    ASSERT_EQ(samples.front(), 10000);
+    ASSERT_LE(samples.back(), 20);
+    for (size_t i = 1; i < samples.size(); i++) {
+        ASSERT_LE(samples[i], samples[i - 1]) << "Ramp is not monotonic at sample " << i;
+    }
+}
+
+TEST_F(PCMTest, resamplerRejectsInvalidRates) {
+    ASSERT_EQ(Resampler::create(0, 16000), nullptr);
+    ASSERT_EQ(Resampler::create(48000, 0), nullptr);
+    ASSERT_EQ(Resampler::create(48001, 16000), nullptr);
+}
+
+TEST_F(PCMTest, resamplerRejectsTooSmallOutput) {
+    auto resampler = Resampler::create(48000, 16000);
+    ASSERT_NE(resampler, nullptr);
+    auto input = tone(48000, 1000, 960);
+    std::vector<int16_t> output(resampler->getMaxOutputCount(input.size()));
+    size_t written = 1;
+    ASSERT_FALSE(resampler->process(input.data(), input.size(), output.data(), output.size() - 1, written));
+    ASSERT_EQ(written, 0u);
+
+    // the rejected block was not consumed, so the stream matches a new resampler
+    auto expected = Resampler::create(48000, 16000);
+    std::vector<int16_t> expectedOutput(output.size());
+    size_t expectedWritten = 0;
+    ASSERT_TRUE(expected->process(input.data(), input.size(), expectedOutput.data(), output.size(), expectedWritten));
+    ASSERT_TRUE(resampler->process(input.data(), input.size(), output.data(), output.size(), written));
+    ASSERT_EQ(written, expectedWritten);
+    ASSERT_EQ(output, expectedOutput);
+}
+
+TEST_F(PCMTest, resamplerPreservesPassbandAndRejectsAliases) {
+    for (unsigned int inputRate : {48000u, 44100u}) {
+        SCOPED_TRACE(inputRate);
+        size_t count = inputRate / 2;
+
+        auto passband = resample(inputRate, 16000, tone(inputRate, 1000, count));
+        ASSERT_NEAR(passband.size(), count * 16000.0 / inputRate, 2);
+        ASSERT_NEAR(rms(passband, 100) / rms(tone(16000, 1000, 8000), 0), 1.0, 0.05);
+
+        // a 10 kHz tone would alias to 6 kHz at 16 kHz, and must be attenuated by at least 40 dB
+        auto stopband = resample(inputRate, 16000, tone(inputRate, 10000, count));
+        ASSERT_LT(rms(stopband, 100), rms(tone(16000, 1000, 8000), 0) / 100);
+    }
+}
+
+TEST_F(PCMTest, DISABLED_benchmarkKernels) {
+    std::vector<int16_t> input(BENCHMARK_SAMPLE_COUNT);
+    std::copy(m_samples.begin(), m_samples.end(), input.begin());
+    std::vector<int16_t> work(input.size());
+    std::vector<float> floats(input.size());
+
+    std::vector<SimdLevel> levels = {SimdLevel::SCALAR};
+    auto vector = vectorLevels();
+    levels.insert(levels.end(), vector.begin(), vector.end());
+
+    for (auto level : levels) {
+        pcm::setSimdLevel(level);
+        double toFloat = benchmark([&]() { pcm::int16ToFloat(input.data(), floats.data(), input.size()); });
+        double gain = benchmark([&]() {
+            work = input;
+            pcm::applyGainRamp(work.data(), work.size(), 1, 1.0f, 0.3f);
+        });
+        double downmix = benchmark([&]() { pcm::downmixToMono(input.data(), work.data(), input.size() / 2, 2); });
+        auto resampler = Resampler::create(48000, 16000);
+        double resample = benchmark([&]() {
+            resampler->reset();
+            size_t written = 0;
+            resampler->process(input.data(), input.size() / 2, work.data(), work.size(), written);
+        });
+        auto name = "kernels." + pcm::toString(level);
+        RecordProperty(name + ".int16ToFloatNs", static_cast<int>(toFloat));
+        RecordProperty(name + ".gainRampNs", static_cast<int>(gain));
+        RecordProperty(name + ".downmixNs", static_cast<int>(downmix));
+        RecordProperty(name + ".resample48kTo16kNs", static_cast<int>(resample));
+    }
+}
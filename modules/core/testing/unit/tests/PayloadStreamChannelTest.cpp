@@ -0,0 +1,95 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include <AACE/Engine/MessageBroker/PayloadStreamChannel.h>
+#include <AACE/Engine/MessageBroker/StreamManagerImpl.h>
+
+using namespace aace::engine::messageBroker;
+using Mode = aace::core::MessageStream::Mode;
+
+/// Test harness for @c PayloadStreamChannel.
+class PayloadStreamChannelTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_streamManager = StreamManagerImpl::create();
+        m_channel = PayloadStreamChannel::create(m_streamManager, 8, 32);
+        ASSERT_NE(m_channel, nullptr);
+    }
+
+    /// Opens a stream like the platform does, and reads it to the end.
+    std::string readStream(const std::string& streamId) {
+        auto stream = m_streamManager->requestStreamHandler(streamId, Mode::READ);
+        EXPECT_NE(stream, nullptr);
+        if (stream == nullptr) {
+            return "";
+        }
+        std::string result;
+        char buffer[5];
+        while (!stream->isClosed()) {
+            auto count = stream->read(buffer, sizeof(buffer));
+            EXPECT_GT(count, 0);
+            result.append(buffer, count);
+        }
+        return result;
+    }
+
+protected:
+    std::shared_ptr<StreamManagerImpl> m_streamManager;
+    std::shared_ptr<PayloadStreamChannel> m_channel;
+};
+
+TEST_F(PayloadStreamChannelTest, createWithInvalidArguments) {
+    ASSERT_EQ(PayloadStreamChannel::create(nullptr, 8), nullptr);
+    ASSERT_EQ(PayloadStreamChannel::create(m_streamManager, 0), nullptr);
+}
+
+TEST_F(PayloadStreamChannelTest, smallPayloadIsEmbedded) {
+    std::string payload = "{\"a\":1}";
+    ASSERT_EQ(m_channel->send(payload), "");
+    ASSERT_EQ(payload, "{\"a\":1}");
+}
+
+TEST_F(PayloadStreamChannelTest, largePayloadIsStreamed) {
+    std::string payload = "{\"document\":\"large\"}";
+    auto streamId = m_channel->send(payload);
+    ASSERT_FALSE(streamId.empty());
+    ASSERT_TRUE(payload.empty());
+    ASSERT_EQ(readStream(streamId), "{\"document\":\"large\"}");
+
+    // a stream can only be opened once, and only for reading
+    ASSERT_EQ(m_streamManager->requestStreamHandler(streamId, Mode::READ), nullptr);
+    payload = "{\"document\":\"other\"}";
+    streamId = m_channel->send(payload);
+    ASSERT_EQ(m_streamManager->requestStreamHandler(streamId, Mode::WRITE), nullptr);
+}
+
+TEST_F(PayloadStreamChannelTest, unopenedStreamsAreRemovedOldestFirst) {
+    std::string first = "0123456789abcdef";
+    std::string second = "fedcba9876543210";
+    std::string third = "0123456789";
+    auto firstId = m_channel->send(first);
+    auto secondId = m_channel->send(second);
+    auto thirdId = m_channel->send(third);
+
+    // the first stream was removed to keep the pending streams within 32 bytes
+    ASSERT_FALSE(m_streamManager->unregisterStreamHandler(firstId));
+    ASSERT_EQ(readStream(secondId), "fedcba9876543210");
+    ASSERT_EQ(readStream(thirdId), "0123456789");
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// testing includes
+#include <AACE/Test/Unit/Core/CoreTestHelper.h>
+// engine includes
+#include <AACE/Engine/Core/EngineImpl.h>
+#include <AACE/Engine/PropertyManager/PropertyManagerServiceInterface.h>
+// platform includes
+#include <AACE/PropertyManager/PropertyManager.h>
+
+using namespace aace::test::unit::core;
+using namespace aace::engine::propertyManager;
+
+static const std::string WAKEWORD_ENABLED = "aace.test.wakewordEnabled";
+static const std::chrono::seconds TIMEOUT(5);
+
+/// Records the replies of the Engine to the platform.
+class TestPropertyManager : public aace::propertyManager::PropertyManager {
+public:
+    void propertyStateChanged(const std::string& name, const std::string& value, const PropertyState state) override {
+    }
+
+    void propertyChanged(const std::string& name, const std::string& newValue) override {
+    }
+};
+
+/// Records the values notified to a listener.
+class TestPropertyListener : public PropertyListenerInterface {
+public:
+    void propertyChanged(const std::string& name, const std::string& newValue) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_values.push_back(newValue);
+        m_changed.notify_all();
+    }
+
+    /// Waits until @c count values were notified, and returns them.
+    std::vector<std::string> waitForValues(size_t count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_changed.wait_for(lock, TIMEOUT, [this, count] { return m_values.size() >= count; });
+        return m_values;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::vector<std::string> m_values;
+};
+
+/// Test harness for @c PropertyManagerEngineService class
+class PropertyManagerEngineServiceTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_engine = aace::engine::core::EngineImpl::create();
+        ASSERT_NE(m_engine, nullptr) << "Create engine failed!";
+        ASSERT_TRUE(m_engine->configure(CoreTestHelper::createDefaultConfiguration())) << "Configure engine failed!";
+        m_engine->registerPlatformInterface(std::make_shared<TestPropertyManager>());
+        ASSERT_TRUE(m_engine->start()) << "Start engine failed!";
+
+        m_propertyManager = m_engine->getServiceInterface<PropertyManagerServiceInterface>("aace.propertyManager");
+        ASSERT_NE(m_propertyManager, nullptr);
+
+        // the owner enables wake word only for "true", and reports its value as "true" or "false"
+        ASSERT_TRUE(m_propertyManager->registerProperty(PropertyDescription(
+            WAKEWORD_ENABLED,
+            [this](
+                const std::string& value,
+                bool& changed,
+                bool& async,
+                const PropertyDescription::SetterCallback& callback) {
+                bool enabled = value == "true";
+                changed = enabled != m_enabled;
+                m_enabled = enabled;
+                return true;
+            },
+            [this]() {
+                m_getterCalls++;
+                return m_enabled ? "true" : "false";
+            })));
+        m_listener = std::make_shared<TestPropertyListener>();
+        ASSERT_TRUE(m_propertyManager->addListener(WAKEWORD_ENABLED, m_listener));
+    }
+
+    void TearDown() override {
+        if (m_engine != nullptr) {
+            ASSERT_TRUE(m_engine->shutdown()) << "Shutdown engine failed!";
+            m_engine.reset();
+        }
+    }
+
+protected:
+    std::shared_ptr<aace::engine::core::EngineImpl> m_engine;
+    std::shared_ptr<PropertyManagerServiceInterface> m_propertyManager;
+    std::shared_ptr<TestPropertyListener> m_listener;
+    std::atomic<bool> m_enabled{true};
+    std::atomic<int> m_getterCalls{0};
+};
+
+TEST_F(PropertyManagerEngineServiceTest, getPropertyReadsOwnerOnce) {
+    EXPECT_EQ(m_propertyManager->getProperty(WAKEWORD_ENABLED), "true");
+    EXPECT_EQ(m_propertyManager->getProperty(WAKEWORD_ENABLED), "true");
+    EXPECT_EQ(m_getterCalls, 1);
+}
+
+TEST_F(PropertyManagerEngineServiceTest, setPropertyKeepsOwnerValue) {
+    // any value but "true" disables wake word, and the owner reports it as "false"
+    ASSERT_TRUE(m_propertyManager->setProperty(WAKEWORD_ENABLED, "yes", true));
+    EXPECT_EQ(m_listener->waitForValues(1), std::vector<std::string>({"false"}));
+    EXPECT_EQ(m_propertyManager->getProperty(WAKEWORD_ENABLED), "false");
+
+    ASSERT_TRUE(m_propertyManager->setProperty(WAKEWORD_ENABLED, "true", true));
+    EXPECT_EQ(m_listener->waitForValues(2), std::vector<std::string>({"false", "true"}));
+    EXPECT_EQ(m_propertyManager->getProperty(WAKEWORD_ENABLED), "true");
+}
+
+TEST_F(PropertyManagerEngineServiceTest, updatePropertyValueNotifiesListeners) {
+    m_enabled = false;
+    m_propertyManager->updatePropertyValue(WAKEWORD_ENABLED, "false");
+    EXPECT_EQ(m_listener->waitForValues(1), std::vector<std::string>({"false"}));
+    EXPECT_EQ(m_propertyManager->getProperty(WAKEWORD_ENABLED), "false");
+}
+
+TEST_F(PropertyManagerEngineServiceTest, unknownProperty) {
+    EXPECT_FALSE(m_propertyManager->setProperty("aace.test.unknown", "value", true));
+    EXPECT_EQ(m_propertyManager->getProperty("aace.test.unknown"), "");
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <AACE/Engine/PropertyManager/PropertyStore.h>
+
+using namespace aace::engine::propertyManager;
+
+static const std::string LOCALE = "aace.alexa.setting.locale";
+
+/// Test harness for @c PropertyStore class
+class PropertyStoreTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        ASSERT_TRUE(m_store.add(LOCALE));
+    }
+
+protected:
+    PropertyStore m_store;
+};
+
+TEST_F(PropertyStoreTest, addTwice) {
+    ASSERT_FALSE(m_store.add(LOCALE));
+}
+
+TEST_F(PropertyStoreTest, setIncrementsVersion) {
+    ASSERT_EQ(m_store.get(LOCALE), nullptr);
+
+    ASSERT_EQ(m_store.set(LOCALE, "en-US")->version, 1u);
+    ASSERT_EQ(m_store.set(LOCALE, "de-DE")->version, 2u);
+
+    auto value = m_store.get(LOCALE);
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(value->value, "de-DE");
+    EXPECT_EQ(value->version, 2u);
+}
+
+TEST_F(PropertyStoreTest, unknownProperty) {
+    EXPECT_EQ(m_store.get("unknown"), nullptr);
+    EXPECT_EQ(m_store.set("unknown", "value"), nullptr);
+    EXPECT_EQ(m_store.setIfEmpty("unknown", "value"), nullptr);
+    EXPECT_FALSE(m_store.requestNotification("unknown"));
+    EXPECT_EQ(m_store.takeNotification("unknown"), nullptr);
+}
+
+TEST_F(PropertyStoreTest, setIfEmptyKeepsSetValue) {
+    EXPECT_EQ(m_store.setIfEmpty(LOCALE, "en-US")->value, "en-US");
+
+    m_store.set(LOCALE, "de-DE");
+    auto value = m_store.setIfEmpty(LOCALE, "en-US");
+    EXPECT_EQ(value->value, "de-DE");
+    EXPECT_EQ(value->version, 2u);
+}
+
+TEST_F(PropertyStoreTest, coalesceNotifications) {
+    // the first change schedules a notification, the following ones are delivered with it
+    m_store.set(LOCALE, "en-US");
+    ASSERT_TRUE(m_store.requestNotification(LOCALE));
+    m_store.set(LOCALE, "de-DE");
+    ASSERT_FALSE(m_store.requestNotification(LOCALE));
+    m_store.set(LOCALE, "fr-FR");
+    ASSERT_FALSE(m_store.requestNotification(LOCALE));
+
+    auto value = m_store.takeNotification(LOCALE);
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(value->value, "fr-FR");
+
+    // a notification scheduled for a value already notified is skipped
+    ASSERT_TRUE(m_store.requestNotification(LOCALE));
+    EXPECT_EQ(m_store.takeNotification(LOCALE), nullptr);
+
+    m_store.set(LOCALE, "en-GB");
+    ASSERT_TRUE(m_store.requestNotification(LOCALE));
+    EXPECT_EQ(m_store.takeNotification(LOCALE)->value, "en-GB");
+}
+
+TEST_F(PropertyStoreTest, concurrentSet) {
+    const int threadCount = 4;
+    const int setCount = 1000;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; i++) {
+        threads.emplace_back([this, i, setCount] {
+            for (int j = 0; j < setCount; j++) {
+                m_store.set(LOCALE, std::to_string(i));
+                ASSERT_NE(m_store.get(LOCALE), nullptr);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(m_store.get(LOCALE)->version, static_cast<uint64_t>(threadCount * setCount));
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <climits>
+#include <functional>
+#include <iomanip>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+// engine includes
+#include <AACE/Engine/Utils/UUID/UUID.h>
+
+using namespace aace::engine::utils::uuid;
+
+/// The generator used before UUIDs were generated per thread, which serializes the callers on a mutex.
+static const std::string generateUUIDWithMutex() {
+    static std::independent_bits_engine<std::default_random_engine, CHAR_BIT, uint8_t> ibe(
+        std::random_device{}());
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto hex = [](std::independent_bits_engine<std::default_random_engine, CHAR_BIT, uint8_t>& ibe, int count) {
+        std::ostringstream oss;
+        for (int i = 0; i < count / 2; i++) {
+            oss << std::hex << std::setfill('0') << std::setw(2) << static_cast<int>(ibe());
+        }
+        return oss.str();
+    };
+
+    std::ostringstream uuidText;
+    uuidText << hex(ibe, 8) << "-" << hex(ibe, 4) << "-" << hex(ibe, 4) << "-" << hex(ibe, 4) << "-" << hex(ibe, 12);
+    return uuidText.str();
+}
+
+/// Test harness for the UUID generator
+class UUIDTest : public ::testing::Test {
+protected:
+    /// Generates UUIDs on @c threadCount threads, returning the number of UUIDs generated per second.
+    static double measureThroughput(std::function<const std::string()> generate, int threadCount, int count) {
+        std::vector<std::thread> threads;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < threadCount; i++) {
+            threads.emplace_back([generate, count]() {
+                size_t length = 0;
+                for (int j = 0; j < count; j++) {
+                    length += generate().size();
+                }
+                EXPECT_EQ(length, count * 36u);
+            });
+        }
+        for (auto& next : threads) {
+            next.join();
+        }
+        std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+        return threadCount * count / duration.count();
+    }
+};
+
+TEST_F(UUIDTest, generateUUIDFormat) {
+    for (int i = 0; i < 1000; i++) {
+        auto uuid = generateUUID();
+        ASSERT_EQ(uuid.size(), 36u);
+        for (size_t j = 0; j < uuid.size(); j++) {
+            if (j == 8 || j == 13 || j == 18 || j == 23) {
+                ASSERT_EQ(uuid[j], '-') << uuid;
+            } else {
+                ASSERT_TRUE(std::isxdigit(uuid[j]) && !std::isupper(uuid[j])) << uuid;
+            }
+        }
+
+        // version 4 and variant 1
+        ASSERT_EQ(uuid[14], '4') << uuid;
+        ASSERT_NE(std::string("89ab").find(uuid[19]), std::string::npos) << uuid;
+    }
+}
+
+TEST_F(UUIDTest, generateUUIDUniqueAcrossThreads) {
+    const int threadCount = 8;
+    const int count = 10000;
+    std::vector<std::vector<std::string>> generated(threadCount);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; i++) {
+        threads.emplace_back([&generated, i]() {
+            for (int j = 0; j < count; j++) {
+                generated[i].push_back(generateUUID());
+            }
+        });
+    }
+    for (auto& next : threads) {
+        next.join();
+    }
+
+    std::unordered_set<std::string> unique;
+    for (auto& next : generated) {
+        unique.insert(next.begin(), next.end());
+    }
+    EXPECT_EQ(unique.size(), static_cast<size_t>(threadCount * count));
+}
+
+TEST_F(UUIDTest, compare) {
+    EXPECT_TRUE(compare("0123abcd-ef01-4abc-8def-0123456789ab", "0123ABCD-EF01-4ABC-8DEF-0123456789AB"));
+    EXPECT_FALSE(compare("0123abcd-ef01-4abc-8def-0123456789ab", "0123abcd-ef01-4abc-8def-0123456789ac"));
+}
+
+TEST_F(UUIDTest, DISABLED_benchmarkContendedThroughput) {
+    const int threadCount = std::max(8u, std::thread::hardware_concurrency());
+    const int count = 20000;
+    auto mutexThroughput = measureThroughput(generateUUIDWithMutex, threadCount, count);
+    auto threadThroughput = measureThroughput(generateUUID, threadCount, count);
+
+    RecordProperty("uuid.threads", threadCount);
+    RecordProperty("uuid.mutexPerSecond", static_cast<int>(mutexThroughput));
+    RecordProperty("uuid.perThreadPerSecond", static_cast<int>(threadThroughput));
+}
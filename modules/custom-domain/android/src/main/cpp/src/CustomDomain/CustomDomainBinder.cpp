@@ -174,4 +174,21 @@ JNIEXPORT void JNICALL Java_com_amazon_aace_customDomain_CustomDomain_reportDire
         AACE_JNI_ERROR(TAG, __func__, ex.what());
     }
 }
+
+JNIEXPORT void JNICALL Java_com_amazon_aace_customDomain_CustomDomain_updateContext(
+    JNIEnv* env,
+    jobject /* this */,
+    jlong ref,
+    jstring contextNamespace,
+    jstring customContext) {
+    try {
+        auto customDomainBinder = CUSTOM_DOMAIN_BINDER(ref);
+        ThrowIfNull(customDomainBinder, "invalidCustomDomainBinder");
+
+        customDomainBinder->getCustomDomain()->updateContext(
+            JString(contextNamespace).toStdStr(), JString(customContext).toStdStr());
+    } catch (const std::exception& ex) {
+        AACE_JNI_ERROR(TAG, __func__, ex.what());
+    }
+}
 }
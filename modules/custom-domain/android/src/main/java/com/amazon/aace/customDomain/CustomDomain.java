@@ -202,6 +202,18 @@ abstract public class CustomDomain extends PlatformInterface {
         sendEvent(getNativeRef(), eventNamespace, name, payload, requiresContext, correlationToken, customContext);
     }
 
+    /**
+     * Notifies the engine of the current custom states under @c contextNamespace. The Engine reports the latest
+     * states in context without calling @c getContext(), which is still called for a namespace whose states have
+     * never been updated.
+     *
+     * @param [in] contextNamespace The namespace of the context.
+     * @param [in] customContext The context for @a contextNamespace, in the structure defined by @c getContext().
+     */
+    public final void updateContext(String contextNamespace, String customContext) {
+        updateContext(getNativeRef(), contextNamespace, customContext);
+    }
+
     // NativeRef implementation
     final protected long createNativeRef() {
         return createBinder();
@@ -218,4 +230,5 @@ abstract public class CustomDomain extends PlatformInterface {
             boolean requiresContext, String correlationToken, String customContext);
     private native void reportDirectiveHandlingResult(
             long nativeRef, String directiveNamespace, String messageId, ResultType result);
+    private native void updateContext(long nativeRef, String contextNamespace, String customContext);
 }
\ No newline at end of file
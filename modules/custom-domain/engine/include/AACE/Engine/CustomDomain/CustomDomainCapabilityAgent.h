@@ -32,6 +32,7 @@
 #include <acsdk/MultiAgentInterface/AgentManagerInterface.h>
 
 #include <AVSCommon/Utils/UUIDGeneration/UUIDGeneration.h>
+#include <AACE/Engine/Utils/Context/ContextSnapshot.h>
 #include "CustomDomainHandlerInterface.h"
 
 namespace aace {
@@ -153,6 +154,13 @@ public:
         alexaClientSDK::avsCommon::avs::ExceptionErrorType errorType =
             alexaClientSDK::avsCommon::avs::ExceptionErrorType::INTERNAL_ERROR);
 
+    /**
+     * Stores the context pushed by the platform for this namespace. From then on, the context is reported
+     * without calling getContext(), unless a candidate context was sent with the event.
+     * @param customContext The context for this namespace in string. Invalid context is ignored.
+     */
+    void contextChanged(const std::string& customContext);
+
 private:
     /**
      * Constructor.
@@ -245,6 +253,16 @@ private:
 
     using ContextRequestState = std::pair<alexaClientSDK::avsCommon::sdkInterfaces::ContextRequestToken, StatesMap>;
 
+    /**
+     * Parse the given context in string.
+     * @param customContext The context for this namespace in string
+     * @param [out] statesMap The states of this namespace
+     */
+    bool parseContext(const std::string& customContext, StatesMap& statesMap);
+
+    /// The states pushed by the platform, which are parsed once when they are pushed.
+    aace::engine::utils::context::ContextSnapshot<StatesMap> m_contextSnapshot;
+
     /**
      * Caches the context request token with its states being queried by Context Manager. It will be updated every time when Context Manager
      * queries a new context request token.
@@ -98,6 +98,7 @@ public:
         const std::string& directiveNamespace,
         const std::string& messageId,
         ResultType result) override;
+    void onUpdateContext(const std::string& contextNamespace, const std::string& customContext) override;
     /// @}
 
     /// @name CustomDomainHandlerInterface
@@ -298,12 +298,18 @@ void CustomDomainCapabilityAgent::executeProvideState(
     if (m_stateProviderCache.first != contextRequestToken) {
         // Check candidate cache first
         if (!getCandidateContextIfAvailable(contextRequestToken)) {
-            // If no candidate is available, query device instead
-            auto namespaceContext = m_customDomainHandler->getContext(m_namespace);
-            if (!parseAndUpdateContext(namespaceContext, contextRequestToken)) {
-                AACE_ERROR(LX(TAG, "executeProvideState").d("reason", "invalidContextFormat"));
-                m_contextManager->provideStateUnavailableResponse(stateProviderName, contextRequestToken, false);
-                return;
+            StatesMap statesMap;
+            if (m_contextSnapshot.get(m_namespace, statesMap)) {
+                // Use the context pushed by the device
+                m_stateProviderCache = std::make_pair(contextRequestToken, statesMap);
+            } else {
+                // If no context is available, query device instead
+                auto namespaceContext = m_customDomainHandler->getContext(m_namespace);
+                if (!parseAndUpdateContext(namespaceContext, contextRequestToken)) {
+                    AACE_ERROR(LX(TAG, "executeProvideState").d("reason", "invalidContextFormat"));
+                    m_contextManager->provideStateUnavailableResponse(stateProviderName, contextRequestToken, false);
+                    return;
+                }
             }
         }
     }
@@ -333,12 +339,32 @@ bool CustomDomainCapabilityAgent::getCandidateContextIfAvailable(const ContextRe
 bool CustomDomainCapabilityAgent::parseAndUpdateContext(
     const std::string& customContext,
     const ContextRequestToken contextRequestToken) {
+    StatesMap statesMap;
+    if (!parseContext(customContext, statesMap)) {
+        return false;
+    }
+
+    // Update m_stateProviderCache
+    m_stateProviderCache = std::make_pair(contextRequestToken, statesMap);
+    return true;
+}
+
+void CustomDomainCapabilityAgent::contextChanged(const std::string& customContext) {
+    AACE_INFO(LX(TAG));
+    StatesMap statesMap;
+    if (!parseContext(customContext, statesMap)) {
+        AACE_ERROR(LX(TAG, "contextChanged").d("reason", "invalidContextFormat"));
+        return;
+    }
+    m_contextSnapshot.update(m_namespace, std::move(statesMap));
+}
+
+bool CustomDomainCapabilityAgent::parseContext(const std::string& customContext, StatesMap& statesMap) {
     try {
         ThrowIf(customContext.empty(), "invalidContextProvided");
         auto contextJson = json::parse(customContext);
         ThrowIfNot(contextJson.contains("context") && contextJson["context"].is_array(), "invalidContextProvided");
 
-        StatesMap statesMap;
         for (auto& state : contextJson["context"]) {
             // Parse
             ThrowIfNot(state.contains("name") && state["name"].is_string(), "invalidStateName");
@@ -366,13 +392,10 @@ bool CustomDomainCapabilityAgent::parseAndUpdateContext(
             statesMap[NamespaceAndName{m_namespace, stateName}] =
                 CapabilityState{value.dump(), timeOfSample, uncertaintyInMilliseconds};
         }
-
-        // Update m_stateProviderCache
-        m_stateProviderCache = std::make_pair(contextRequestToken, statesMap);
         return true;
 
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "parseAndUpdateContext").d("reason", ex.what()));
+        AACE_ERROR(LX(TAG, "parseContext").d("reason", ex.what()));
         return false;
     }
 }
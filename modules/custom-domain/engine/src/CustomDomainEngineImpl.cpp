@@ -39,6 +39,7 @@ static const std::string METRIC_CUSTOM_DOMAIN_CANCEL_DIRECTIVE = "CancelDirectiv
 static const std::string METRIC_CUSTOM_DOMAIN_REPORT_DIRECTIVE_HANDLING_RESULT = "ReportDirectiveHandlingResult";
 static const std::string METRIC_CUSTOM_DOMAIN_GET_CONTEXT = "GetContext";
 static const std::string METRIC_CUSTOM_DOMAIN_SEND_EVENT = "SendEvent";
+static const std::string METRIC_CUSTOM_DOMAIN_UPDATE_CONTEXT = "UpdateContext";
 
 /// String constants in configuration
 static const std::string INTERFACES = "interfaces";
@@ -256,6 +257,17 @@ void CustomDomainEngineImpl::onSendEvent(
     m_capabilityAgentMap[eventNamespace]->sendEvent(name, payload, requiresContext, correlationToken, customContext);
 }
 
+void CustomDomainEngineImpl::onUpdateContext(const std::string& contextNamespace, const std::string& customContext) {
+    AACE_INFO(LX(TAG));
+    emitCounterMetrics(
+        METRIC_PROGRAM_NAME_SUFFIX, "onUpdateContext", {METRIC_CUSTOM_DOMAIN_UPDATE_CONTEXT, contextNamespace});
+    if (m_capabilityAgentMap.find(contextNamespace) == m_capabilityAgentMap.end()) {
+        AACE_ERROR(LX(TAG).d("reason", "invalidNamespace").d("namespace", contextNamespace));
+        return;
+    }
+    m_capabilityAgentMap[contextNamespace]->contextChanged(customContext);
+}
+
 }  // namespace customDomain
 }  // namespace engine
 }  // namespace aace
@@ -166,6 +166,17 @@ public:
         const std::string& correlationToken = "",
         const std::string& customContext = "");
 
+    /**
+    * Notifies the engine of the current custom states under @c contextNamespace. The Engine keeps the latest
+    * states and reports them in context without calling @c getContext(), so the platform should call this
+    * method whenever any of the states changes. @c getContext() is still called for a namespace whose states
+    * have never been updated.
+    *
+    * @param [in] contextNamespace The namespace of the context
+    * @param [in] customContext The context for @a contextNamespace, in the structure defined by @c getContext()
+    */
+    void updateContext(const std::string& contextNamespace, const std::string& customContext);
+
     /**
     * @internal
     * Sets the Engine interface delegate
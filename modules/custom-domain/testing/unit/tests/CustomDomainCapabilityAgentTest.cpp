@@ -308,6 +308,40 @@ TEST_F(CustomDomainCapabilityAgentTest, testProvideMultipleState) {
     m_wakeSetCompletedFuture.wait_for(TIMEOUT);
 }
 
+TEST_F(CustomDomainCapabilityAgentTest, testProvideStateFromUpdatedContext) {
+    alexaClientSDK::avsCommon::utils::WaitEvent waitEvent;
+
+    EXPECT_CALL(*m_mockContextManager, addStateProvider(testing::_, ::testing::NotNull())).Times(testing::Exactly(2));
+    std::shared_ptr<aace::engine::customDomain::CustomDomainCapabilityAgent> capAgent;
+    std::vector<std::string> states{"TEST_STATE_1", "TEST_STATE_2"};
+    capAgent = aace::engine::customDomain::CustomDomainCapabilityAgent::create(
+        "TEST_NAMESPACE",
+        "TEST_VERSION",
+        states,
+        m_mockHandler,
+        m_mockExceptionSender,
+        m_mockContextManager,
+        m_mockMessageSender);
+    EXPECT_NE(nullptr, capAgent);
+    EXPECT_CALL(*m_mockContextManager, provideStateResponse(testing::_, testing::_, testing::_))
+        .Times(testing::Exactly(4))
+        .WillOnce(testing::Return())
+        .WillOnce(testing::Return())
+        .WillOnce(testing::Return())
+        .WillOnce(testing::InvokeWithoutArgs([&waitEvent]() { waitEvent.wakeUp(); }));
+    EXPECT_CALL(*m_mockHandler, getContext(testing::_)).Times(testing::Exactly(0));
+
+    // invalid context is ignored, and the valid context is reported for every request without querying the device
+    capAgent->contextChanged("{}");
+    capAgent->contextChanged(TEST_CONTEXT);
+    for (ContextRequestToken token : {42, 43}) {
+        for (const auto& state : states) {
+            capAgent->provideState(NamespaceAndName{"TEST_NAMESPACE", state}, token);
+        }
+    }
+    EXPECT_TRUE(waitEvent.wait(TIMEOUT));
+}
+
 TEST_F(CustomDomainCapabilityAgentTest, testCancelDirective) {
     auto attachmentManager = std::make_shared<testing::StrictMock<aace::test::unit::avs::MockAttachmentManager>>();
     auto avsMessageHeader = std::make_shared<alexaClientSDK::avsCommon::avs::AVSMessageHeader>(
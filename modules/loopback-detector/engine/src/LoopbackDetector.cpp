@@ -23,18 +23,27 @@ namespace aace {
 namespace engine {
 namespace loopbackDetector {
 
-/// The maximum number of readers of the stream.
-static const size_t MAX_READERS = 2;
+/// The default maximum number of readers of the stream.
+static const size_t DEFAULT_MAX_READERS = 2;
 
-/// The amount of audio data to keep in the ring buffer.
-static const std::chrono::seconds AMOUNT_OF_AUDIO_DATA_IN_BUFFER = std::chrono::seconds(5);
+/// The default amount of audio data to keep in the ring buffer.
+static const std::chrono::seconds DEFAULT_AMOUNT_OF_AUDIO_DATA_IN_BUFFER = std::chrono::seconds(5);
 
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.alexa.LoopbackDetector");
 
-LoopbackDetector::LoopbackDetector(const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat) :
+const alexa::AudioInputStreamConfiguration LoopbackDetector::DEFAULT_AUDIO_INPUT_STREAM_CONFIGURATION(
+    DEFAULT_AMOUNT_OF_AUDIO_DATA_IN_BUFFER,
+    DEFAULT_MAX_READERS);
+
+LoopbackDetector::LoopbackDetector(
+    const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
+    const alexa::AudioInputStreamConfiguration& audioInputStreamConfiguration,
+    std::unique_ptr<utils::audio::EnergyGate> energyGate) :
         alexaClientSDK::avsCommon::utils::RequiresShutdown(TAG),
         m_audioFormat(audioFormat),
+        m_audioInputStreamConfiguration(audioInputStreamConfiguration),
+        m_energyGate(std::move(energyGate)),
         m_wordSize(audioFormat.sampleSizeInBits / CHAR_BIT) {
 }
 
@@ -50,18 +59,11 @@ bool LoopbackDetector::initialize(
             "LoopbackDetector", audio::AudioManagerInterface::AudioInputType::LOOPBACK);
         ThrowIfNull(m_audioInputChannel, "invalidAudioInputChannel");
 
-        ThrowIfNot(initializeAudioInputStream(), "initializeAudioInputStreamFailed");
-
         m_wakewordEngineAdapter = wakewordEngineAdapter;
         ThrowIfNull(m_wakewordEngineAdapter, "invalidWakewordEngineAdapter");
 
-        ThrowIfNot(
-            m_wakewordEngineAdapter->initialize(defaultLocale, m_audioInputStream, m_audioFormat),
-            "wakewordInitializeFailed");
-        m_wakewordEngineAdapter->addKeyWordObserver(shared_from_this());
-
-        // Enable WW
-        ThrowIfNot(m_wakewordEngineAdapter->enable(), "enableFailed");
+        // the stream and wakeword detection are initialized when the first loopback audio is written
+        m_locale = defaultLocale;
 
         // tell the platform interface to start providing audio input
         ThrowIfNot(startAudioInput(), "platformStartAudioInputFailed");
@@ -77,11 +79,14 @@ std::shared_ptr<LoopbackDetector> LoopbackDetector::create(
     const std::string& defaultLocale,
     const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
     std::shared_ptr<audio::AudioManagerInterface> audioManager,
-    std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter) {
+    std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter,
+    const alexa::AudioInputStreamConfiguration& audioInputStreamConfiguration,
+    std::unique_ptr<utils::audio::EnergyGate> energyGate) {
     std::shared_ptr<LoopbackDetector> loopbackDetector = nullptr;
 
     try {
-        loopbackDetector = std::shared_ptr<LoopbackDetector>(new LoopbackDetector(audioFormat));
+        loopbackDetector = std::shared_ptr<LoopbackDetector>(
+            new LoopbackDetector(audioFormat, audioInputStreamConfiguration, std::move(energyGate)));
 
         ThrowIfNot(
             loopbackDetector->initialize(defaultLocale, audioManager, wakewordEngineAdapter),
@@ -98,27 +103,57 @@ std::shared_ptr<LoopbackDetector> LoopbackDetector::create(
 }
 
 void LoopbackDetector::doShutdown() {
+    std::lock_guard<std::mutex> lock(m_audioInputStreamMutex);
+
     if (m_audioInputWriter != nullptr) {
         m_audioInputWriter->close();
         m_audioInputWriter.reset();
     }
 
     if (m_wakewordEngineAdapter != nullptr) {
-        m_wakewordEngineAdapter->disable();
-        m_wakewordEngineAdapter->removeKeyWordObserver(shared_from_this());
+        if (m_detectionInitialized) {
+            m_wakewordEngineAdapter->disable();
+            m_wakewordEngineAdapter->removeKeyWordObserver(shared_from_this());
+        }
         m_wakewordEngineAdapter.reset();
     }
+
+    m_audioInputStream.reset();
+    m_detectionFailed = true;
 }
 
-bool LoopbackDetector::initializeAudioInputStream() {
+bool LoopbackDetector::initializeDetectionLocked() {
     try {
-        size_t size = alexaClientSDK::avsCommon::avs::AudioInputStream::calculateBufferSize(
-            m_audioFormat.sampleRateHz * AMOUNT_OF_AUDIO_DATA_IN_BUFFER.count(), m_wordSize, MAX_READERS);
-        auto buffer = std::make_shared<alexaClientSDK::avsCommon::avs::AudioInputStream::Buffer>(size);
-        ThrowIfNull(buffer, "couldNotCreateAudioInputBuffer");
+        ThrowIf(m_detectionFailed, "detectionUnavailable");
+        ThrowIfNull(m_wakewordEngineAdapter, "invalidWakewordEngineAdapter");
 
+        ThrowIfNot(initializeAudioInputStream(), "initializeAudioInputStreamFailed");
+
+        ThrowIfNot(
+            m_wakewordEngineAdapter->initialize(m_locale, m_audioInputStream, m_audioFormat),
+            "wakewordInitializeFailed");
+        m_wakewordEngineAdapter->addKeyWordObserver(shared_from_this());
+
+        // Enable WW
+        ThrowIfNot(m_wakewordEngineAdapter->enable(), "enableFailed");
+
+        m_detectionInitialized = true;
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "initializeDetectionLocked").d("reason", ex.what()));
+        // don't retry for every audio frame
+        m_detectionFailed = true;
+        m_audioInputWriter.reset();
+        m_audioInputStream.reset();
+        return false;
+    }
+}
+
+bool LoopbackDetector::initializeAudioInputStream() {
+    try {
         // create the audio input stream
-        m_audioInputStream = alexaClientSDK::avsCommon::avs::AudioInputStream::create(buffer, m_wordSize, MAX_READERS);
+        m_audioInputStream = m_audioInputStreamConfiguration.createStream(m_audioFormat);
         ThrowIfNull(m_audioInputStream, "couldNotCreateAudioInputStream");
 
         // create the audio input writer
@@ -176,12 +211,29 @@ bool LoopbackDetector::stopAudioInput() {
 
 ssize_t LoopbackDetector::write(const int16_t* data, const size_t size) {
     try {
+        std::lock_guard<std::mutex> lock(m_audioInputStreamMutex);
+        if (!m_detectionInitialized) {
+            ThrowIfNot(initializeDetectionLocked(), "initializeDetectionFailed");
+        }
         ThrowIfNull(m_audioInputWriter, "nullAudioInputWriter");
 
-        ssize_t result = m_audioInputWriter->write(data, size);
+        if (m_energyGate == nullptr) {
+            ssize_t result = m_audioInputWriter->write(data, size);
+            ThrowIf(result < 0, "errorWritingData");
+            return result;
+        }
+
+        // the wakeword engine blocks on the stream, so audio that is gated costs no inference
+        ssize_t result = 0;
+        m_energyGate->process(data, size, [this, &result](const int16_t* samples, size_t count) {
+            if (result >= 0) {
+                ssize_t written = m_audioInputWriter->write(samples, count);
+                result = written < 0 ? written : result;
+            }
+        });
         ThrowIf(result < 0, "errorWritingData");
 
-        return result;
+        return static_cast<ssize_t>(size);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "write").d("reason", ex.what()));
         return -1;
@@ -19,14 +19,17 @@
 #define AACE_ENGINE_LOOPBACKDETECTOR_LOOPBACK_DETECTOR_H
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <chrono>
 #include <AVSCommon/Utils/RequiresShutdown.h>
 #include <AVSCommon/Utils/AudioFormat.h>
 #include <AVSCommon/SDKInterfaces/KeyWordObserverInterface.h>
 #include <AACE/Engine/Audio/AudioManagerInterface.h>
+#include <AACE/Engine/Alexa/AudioInputStreamConfiguration.h>
 #include <AACE/Engine/Alexa/InitiatorVerifier.h>
 #include <AACE/Engine/Alexa/WakewordEngineAdapter.h>
+#include <AACE/Engine/Utils/Audio/EnergyGate.h>
 
 namespace aace {
 namespace engine {
@@ -38,7 +41,10 @@ class LoopbackDetector
         , public std::enable_shared_from_this<LoopbackDetector>
         , public alexa::InitiatorVerifier {
 private:
-    LoopbackDetector(const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat);
+    LoopbackDetector(
+        const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
+        const alexa::AudioInputStreamConfiguration& audioInputStreamConfiguration,
+        std::unique_ptr<utils::audio::EnergyGate> energyGate);
 
     bool initialize(
         const std::string& defaultLocale,
@@ -46,11 +52,17 @@ private:
         std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter);
 
 public:
+    /// The default sizing of the loopback audio input stream: 5 seconds of audio and 2 readers.
+    static const alexa::AudioInputStreamConfiguration DEFAULT_AUDIO_INPUT_STREAM_CONFIGURATION;
+
     static std::shared_ptr<LoopbackDetector> create(
         const std::string& defaultLocale,
         const alexaClientSDK::avsCommon::utils::AudioFormat& audioFormat,
         std::shared_ptr<audio::AudioManagerInterface> audioManager,
-        std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter = nullptr);
+        std::shared_ptr<alexa::WakewordEngineAdapter> wakewordEngineAdapter = nullptr,
+        const alexa::AudioInputStreamConfiguration& audioInputStreamConfiguration =
+            DEFAULT_AUDIO_INPUT_STREAM_CONFIGURATION,
+        std::unique_ptr<utils::audio::EnergyGate> energyGate = nullptr);
 
     bool shouldBlock(const std::string& wakeword, const std::chrono::milliseconds& timeout) override;
 
@@ -67,6 +79,12 @@ protected:
     virtual void doShutdown() override;
 
 private:
+    /**
+     * Allocates the audio input stream and starts wakeword detection on it. This is deferred until the
+     * platform first provides loopback audio, so the ring buffer is not resident when nothing is played.
+     * Only call this function on a thread holding @c m_audioInputStreamMutex.
+     */
+    bool initializeDetectionLocked();
     bool initializeAudioInputStream();
 
     bool startAudioInput();
@@ -75,8 +93,18 @@ private:
 
 private:
     alexaClientSDK::avsCommon::utils::AudioFormat m_audioFormat;
+    alexa::AudioInputStreamConfiguration m_audioInputStreamConfiguration;
+    std::string m_locale;
+
+    /// Serializes creation, use and release of the audio input stream and writer.
+    std::mutex m_audioInputStreamMutex;
     std::shared_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream> m_audioInputStream;
     std::unique_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream::Writer> m_audioInputWriter;
+    bool m_detectionInitialized = false;
+    bool m_detectionFailed = false;
+
+    /// Drops loopback audio that is too quiet to contain the wakeword, or @c nullptr to pass all audio.
+    std::unique_ptr<utils::audio::EnergyGate> m_energyGate;
 
     std::shared_ptr<audio::AudioInputChannelInterface> m_audioInputChannel;
     audio::AudioInputChannelInterface::ChannelId m_currentChannelId =
@@ -42,18 +42,50 @@ static const std::string FACTORY_NAME("aace.loopbackDetector");
 REGISTER_SERVICE(LoopbackDetectorEngineService);
 
 LoopbackDetectorEngineService::LoopbackDetectorEngineService(const core::ServiceDescription& description) :
-        core::EngineService(description) {
+        core::EngineService(description),
+        m_audioInputStreamConfiguration(LoopbackDetector::DEFAULT_AUDIO_INPUT_STREAM_CONFIGURATION),
+        m_energyGateEnabled(true) {
 }
 
-bool LoopbackDetectorEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool LoopbackDetectorEngineService::configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) {
     try {
-        auto document = aace::engine::utils::json::parse(configuration);
-        ThrowIfNull(document, "parseConfigurationStreamFailed");
+        const auto& configRoot = *configuration;
+        ThrowIfNot(configRoot.is_object(), "invalidConfiguration");
 
-        auto configRoot = document->GetObject();
+        if (configRoot.contains("wakewordEngine") && configRoot.at("wakewordEngine").is_string()) {
+            m_wakewordEngineName = configRoot.at("wakewordEngine").get<std::string>();
+        }
+
+        if (configRoot.contains("audioBuffer")) {
+            ThrowIfNot(
+                m_audioInputStreamConfiguration.configure(configRoot.at("audioBuffer")),
+                "invalidAudioBufferConfiguration");
+        }
 
-        if (configRoot.HasMember("wakewordEngine") && configRoot["wakewordEngine"].IsString()) {
-            m_wakewordEngineName = configRoot["wakewordEngine"].GetString();
+        if (configRoot.contains("energyGate")) {
+            const auto& energyGate = configRoot.at("energyGate");
+            ThrowIfNot(energyGate.is_object(), "invalidEnergyGateConfiguration");
+            if (energyGate.contains("enabled")) {
+                ThrowIfNot(energyGate.at("enabled").is_boolean(), "invalidEnergyGateEnabled");
+                m_energyGateEnabled = energyGate.at("enabled").get<bool>();
+            }
+            if (energyGate.contains("openThreshold")) {
+                ThrowIfNot(energyGate.at("openThreshold").is_number(), "invalidEnergyGateOpenThreshold");
+                m_energyGateConfiguration.openThreshold = energyGate.at("openThreshold").get<float>();
+            }
+            if (energyGate.contains("closeThreshold")) {
+                ThrowIfNot(energyGate.at("closeThreshold").is_number(), "invalidEnergyGateCloseThreshold");
+                m_energyGateConfiguration.closeThreshold = energyGate.at("closeThreshold").get<float>();
+            }
+            if (energyGate.contains("hangover")) {
+                ThrowIfNot(energyGate.at("hangover").is_number_unsigned(), "invalidEnergyGateHangover");
+                m_energyGateConfiguration.hangover =
+                    std::chrono::milliseconds(energyGate.at("hangover").get<uint32_t>());
+            }
+            if (energyGate.contains("preRoll")) {
+                ThrowIfNot(energyGate.at("preRoll").is_number_unsigned(), "invalidEnergyGatePreRoll");
+                m_energyGateConfiguration.preRoll = std::chrono::milliseconds(energyGate.at("preRoll").get<uint32_t>());
+            }
         }
 
         return true;
@@ -114,7 +146,19 @@ bool LoopbackDetectorEngineService::prepareVerifier() {
         ThrowIfNull(propertyManager, "nullPropertyManagerServiceInterface");
         auto locale = propertyManager->getProperty(aace::alexa::property::LOCALE);
 
-        m_loopbackDetector = LoopbackDetector::create(locale, audioFormat, audioManager, secondaryAdapter);
+        std::unique_ptr<utils::audio::EnergyGate> energyGate;
+        if (m_energyGateEnabled) {
+            energyGate = utils::audio::EnergyGate::create(audioFormat.sampleRateHz, m_energyGateConfiguration);
+            ThrowIfNull(energyGate, "createEnergyGateFailed");
+        }
+
+        m_loopbackDetector = LoopbackDetector::create(
+            locale,
+            audioFormat,
+            audioManager,
+            secondaryAdapter,
+            m_audioInputStreamConfiguration,
+            std::move(energyGate));
         ThrowIfNull(m_loopbackDetector, "Failed to create LoopbackDetector");
 
         return true;
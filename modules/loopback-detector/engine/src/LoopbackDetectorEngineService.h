@@ -36,7 +36,7 @@ public:
     virtual ~LoopbackDetectorEngineService() = default;
 
 protected:
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) override;
     bool preRegister() override;
     bool shutdown() override;
 
@@ -45,6 +45,9 @@ private:
     bool prepareVerifier();
 
     std::string m_wakewordEngineName;
+    alexa::AudioInputStreamConfiguration m_audioInputStreamConfiguration;
+    bool m_energyGateEnabled;
+    utils::audio::EnergyGate::Configuration m_energyGateConfiguration;
     std::shared_ptr<LoopbackDetector> m_loopbackDetector;
 };
 
@@ -15,6 +15,7 @@
 
 #include "AACE/Engine/Messaging/MessagingEngineImpl.h"
 #include "AACE/Engine/Core/EngineMacros.h"
+#include <AACE/Engine/Utils/Event/EventBuilder.h>
 #include <AACE/Engine/Utils/Metrics/Metrics.h>
 #include <nlohmann/json.hpp>
 
@@ -24,6 +25,7 @@ namespace aace {
 namespace engine {
 namespace messaging {
 
+using namespace aace::engine::utils::event;
 using namespace aace::engine::utils::metrics;
 
 // String to identify log entries originating from this file.
@@ -129,14 +131,16 @@ void MessagingEngineImpl::sendMessage(
     emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "sendMessage", {METRIC_MESSAGING_SEND_MESSAGE});
     if (m_messagingPlatformInterface != nullptr) {
         try {
-            auto messageJson = json::parse(payload);
-            if (messageJson.find("messagePayload") != messageJson.end()) {
-                auto messagePayload = messageJson["messagePayload"];
-                if (messagePayload.find("text") != messagePayload.end() && messagePayload["text"].is_string()) {
-                    auto message = messagePayload["text"].get<std::string>();
-                    if (messageJson.find("recipients") != messageJson.end()) {
-                        auto recipients = messageJson["recipients"].dump();
-                        m_messagingPlatformInterface->sendMessage(token, message, recipients);
+            // the recipients are passed to the platform as they are in the payload
+            std::unordered_map<std::string, std::string> members{{"messagePayload", ""}, {"recipients", ""}};
+            ThrowIfNot(getMembers(payload, members), "invalidPayload");
+            if (!members["messagePayload"].empty()) {
+                auto messagePayload = json::parse(members["messagePayload"]);
+                auto text = messagePayload.find("text");
+                if (text != messagePayload.end() && text->is_string()) {
+                    const auto& recipients = members["recipients"];
+                    if (!recipients.empty()) {
+                        m_messagingPlatformInterface->sendMessage(token, text->get<std::string>(), recipients);
                     } else {
                         AACE_ERROR(LX(TAG).d("missingRecipients", payload));
                     }
@@ -160,12 +164,15 @@ void MessagingEngineImpl::updateMessagesStatus(
     emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "updateMessagesStatus", {METRIC_MESSAGING_UPDATE_MESSAGES_STATUS});
     if (m_messagingPlatformInterface != nullptr) {
         try {
-            auto messageJson = json::parse(payload);
-            if (messageJson.find("conversationId") != messageJson.end() && messageJson["conversationId"].is_string()) {
-                auto conversationId = messageJson["conversationId"].get<std::string>();
-                if (messageJson.find("statusMap") != messageJson.end()) {
-                    auto statusMap = messageJson["statusMap"].dump();
-                    m_messagingPlatformInterface->updateMessagesStatus(token, conversationId, statusMap);
+            // the status map is passed to the platform as it is in the payload
+            std::unordered_map<std::string, std::string> members{{"conversationId", ""}, {"statusMap", ""}};
+            ThrowIfNot(getMembers(payload, members), "invalidPayload");
+            const auto& conversationId = members["conversationId"];
+            if (!conversationId.empty() && conversationId.front() == '"') {
+                const auto& statusMap = members["statusMap"];
+                if (!statusMap.empty()) {
+                    m_messagingPlatformInterface->updateMessagesStatus(
+                        token, json::parse(conversationId).get<std::string>(), statusMap);
                 } else {
                     AACE_ERROR(LX(TAG).d("missingStatusMap", payload));
                 }
@@ -64,7 +64,7 @@ public:
 protected:
     /// aace::engine::core::EngineService
     /// @{
-    bool configure(std::shared_ptr<std::istream> configuration) override;
+    bool configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) override;
     bool setup() override;
     bool preRegister() override;
     bool postRegister() override;
@@ -42,9 +42,9 @@ MetricsProxyEngineService::MetricsProxyEngineService(const aace::engine::core::S
         aace::engine::core::EngineService(description) {
 }
 
-bool MetricsProxyEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool MetricsProxyEngineService::configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) {
     try {
-        auto document = nlohmann::json::parse(*configuration);
+        auto& document = *configuration;
         if (document.contains(CONFIG_KEY_ASSISTANTS) && document[CONFIG_KEY_ASSISTANTS].is_array()) {
             for (auto& item : document[CONFIG_KEY_ASSISTANTS]) {
                 if (item.contains(CONFIG_KEY_ID) && item[CONFIG_KEY_ID].is_number_unsigned()) {
@@ -29,6 +29,7 @@
 #include <AASB/Message/Navigation/Navigation/NavigateToPreviousWaypointMessage.h>
 #include <AASB/Message/Navigation/Navigation/NavigationErrorMessage.h>
 #include <AASB/Message/Navigation/Navigation/NavigationEventMessage.h>
+#include <AASB/Message/Navigation/Navigation/NavigationStateChangedMessage.h>
 #include <AASB/Message/Navigation/Navigation/RoadRegulation.h>
 #include <AASB/Message/Navigation/Navigation/ShowAlternativeRoutesMessage.h>
 #include <AASB/Message/Navigation/Navigation/ShowAlternativeRoutesSucceededMessage.h>
@@ -219,6 +220,23 @@ bool AASBNavigation::initialize(std::shared_ptr<aace::engine::messageBroker::Mes
                 }
             });
 
+        messageBroker->subscribe(
+            aasb::message::navigation::navigation::NavigationStateChangedMessage::topic(),
+            aasb::message::navigation::navigation::NavigationStateChangedMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+                    aasb::message::navigation::navigation::NavigationStateChangedMessage::Payload payload =
+                        nlohmann::json::parse(message.payload());
+                    sp->navigationStateChanged(payload.navigationState);
+
+                    AACE_INFO(LX(TAG, "NavigationStateChangedMessage").m("MessageRouted"));
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG, "NavigationStateChangedMessage").d("reason", ex.what()));
+                }
+            });
+
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -706,6 +706,18 @@ abstract public class Navigation extends PlatformInterface {
         showAlternativeRoutesSucceeded(getNativeRef(), payload);
     }
 
+    /**
+     * Notifies the Engine of a change in the navigation state. Once the navigation state is pushed with this
+     * method, the Engine reports it in context without calling {@link #getNavigationState()}, so it must be
+     * pushed every time the state changes.
+     *
+     * @param navigationState The navigation state in the format returned by {@link #getNavigationState()}, or an
+     * empty string if not navigating
+     */
+    final protected void navigationStateChanged(String navigationState) {
+        navigationStateChanged(getNativeRef(), navigationState);
+    }
+
     // NativeRef implementation
     final protected long createNativeRef() {
         return createBinder();
@@ -721,6 +733,7 @@ abstract public class Navigation extends PlatformInterface {
     private native void navigationError(long nativeRef, ErrorType type, ErrorCode code, String description);
     private native void navigationEvent(long nativeRef, EventName event);
     private native void showAlternativeRoutesSucceeded(long nativeRef, String payload);
+    private native void navigationStateChanged(long nativeRef, String navigationState);
 }
 
 // END OF FILE
@@ -27,6 +27,8 @@
 #include <AVSCommon/Utils/Threading/Executor.h>
 #include <AVSCommon/SDKInterfaces/MessageSenderInterface.h>
 
+#include <AACE/Engine/Utils/Context/ContextSnapshot.h>
+
 #include "NavigationHandlerInterface.h"
 
 namespace aace {
@@ -90,6 +92,14 @@ public:
         aace::navigation::NavigationEngineInterface::ErrorCode code,
         const std::string& description);
 
+    /**
+     * Stores the navigation state pushed by the platform, which is reported in context from then on
+     * instead of querying the platform.
+     *
+     * @param [in] navigationState The navigation state JSON, or an empty string if not navigating.
+     */
+    void navigationStateChanged(const std::string& navigationState);
+
 private:
     NavigationCapabilityAgent(
         std::shared_ptr<aace::engine::navigation::NavigationHandlerInterface> navigationHandler,
@@ -195,9 +205,10 @@ private:
     void navigateToPreviousWaypointError(AgentId::IdType agentId, std::string code, std::string description);
 
     /**
-     * Check Navigation State for validity
+     * Check Navigation State for validity and serialize it as the NavigationState context payload.
+     * An empty navigation state is reported as not navigating.
      */
-    bool isNavigationStateValid(std::string navigationState);
+    bool serializeNavigationState(const std::string& navigationState, std::string& payload);
 
     /**
      * @name Executor Thread Variables
@@ -224,6 +235,9 @@ private:
 
     /// The last known NavigationState payload
     std::string m_navigationStatePayload;
+
+    /// The NavigationState payload pushed by the platform.
+    aace::engine::utils::context::ContextSnapshot<std::string> m_navigationStateSnapshot;
 };
 
 }  // namespace navigation
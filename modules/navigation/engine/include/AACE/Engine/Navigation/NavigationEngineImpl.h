@@ -101,6 +101,7 @@ public:
         NavigationEngineInterface::ErrorCode code,
         const std::string& description) override;
     void onShowAlternativeRoutesSucceeded(const std::string& payload) override;
+    void onNavigationStateChanged(const std::string& navigationState) override;
     /// @}
 
 protected:
@@ -22,6 +22,7 @@
 
 #include "AACE/Engine/Navigation/NavigationCapabilityAgent.h"
 #include "AACE/Engine/Core/EngineMacros.h"
+#include "AACE/Engine/Utils/Event/EventBuilder.h"
 
 namespace aace {
 namespace engine {
@@ -29,6 +30,7 @@ namespace navigation {
 
 using AgentId = alexaClientSDK::avsCommon::avs::AgentId;
 using NamespaceAndName = alexaClientSDK::avsCommon::avs::NamespaceAndName;
+using namespace aace::engine::utils::event;
 
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.navigation.NavigationCapabilityAgent");
@@ -324,29 +326,35 @@ void NavigationCapabilityAgent::navigationError( AgentId::IdType agentId, aace::
     });
 }
 
+void NavigationCapabilityAgent::navigationStateChanged( const std::string& navigationState )
+{
+    // validate and serialize once, so that provideState can answer from the snapshot
+    std::string payload;
+    if( serializeNavigationState( navigationState, payload ) ) {
+        m_navigationStateSnapshot.update( NAVIGATION_STATE.name, payload );
+    }
+}
+
 void NavigationCapabilityAgent::executeProvideState( const NamespaceAndName& stateProviderName, const unsigned int stateRequestToken )
 {
     try
     {
         ThrowIfNull( m_contextManager, "contextManagerIsNull" );
-        bool payloadChanged = false;
         std::string payload;
-        auto agentId = stateProviderName.getAgentId();
-
-        payload = m_navigationHandler->getNavigationState(agentId);
 
-        if( payload.empty() && m_navigationStatePayload.compare(DEFAULT_NAVIGATION_STATE_PAYLOAD) != 0 ) {
-            payload = DEFAULT_NAVIGATION_STATE_PAYLOAD;
-            payloadChanged = true;
-        } else if ( !payload.empty() && payload.compare( m_navigationStatePayload ) != 0 ){
-            payloadChanged = true;
+        // query the platform only if it has never pushed its navigation state
+        if( !m_navigationStateSnapshot.get( NAVIGATION_STATE.name, payload ) ) {
+            auto agentId = stateProviderName.getAgentId();
+            if( !serializeNavigationState( m_navigationHandler->getNavigationState( agentId ), payload ) ) {
+                // report the last valid state as unchanged
+                payload = m_navigationStatePayload;
+            }
         }
 
-        if( payloadChanged ) {
-            if ( isNavigationStateValid( payload )  ) {
-                // set the context NavigationState
-                ThrowIf( m_contextManager->setState( NAVIGATION_STATE, m_navigationStatePayload, alexaClientSDK::avsCommon::avs::StateRefreshPolicy::SOMETIMES, stateRequestToken ) != alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS, "contextManagerSetStateFailed" );
-            }
+        if( payload.compare( m_navigationStatePayload ) != 0 ) {
+            // set the context NavigationState
+            m_navigationStatePayload = payload;
+            ThrowIf( m_contextManager->setState( NAVIGATION_STATE, m_navigationStatePayload, alexaClientSDK::avsCommon::avs::StateRefreshPolicy::SOMETIMES, stateRequestToken ) != alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS, "contextManagerSetStateFailed" );
         } else {
             // send empty if no change
             ThrowIf( m_contextManager->setState( NAVIGATION_STATE, "", alexaClientSDK::avsCommon::avs::StateRefreshPolicy::SOMETIMES, stateRequestToken ) != alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS, "contextManagerSetStateEmptyPayloadFailed" );
@@ -430,32 +438,20 @@ std::string NavigationCapabilityAgent::getWaypointErrorCode( aace::navigation::N
 void NavigationCapabilityAgent::startNavigationSuccess(AgentId::IdType agentId) {
     std::string navigationState;
     navigationState = m_navigationHandler->getNavigationState(agentId);
-    rapidjson::Document context( rapidjson::kObjectType );
-    rapidjson::Document payload( rapidjson::kObjectType );
-    rapidjson::Document::AllocatorType& allocator = payload.GetAllocator();
 
-    context.Parse( navigationState.c_str() );
-
-    rapidjson::Document waypointsArray( rapidjson::kArrayType );
-    if ( context.HasMember( "waypoints" ) ) {
-        for (auto &point : context["waypoints"].GetArray()) {
-            waypointsArray.PushBack(point, allocator);
-        }
+    // the waypoints and shapes are composed into the event as the platform reported them
+    std::unordered_map<std::string, std::string> members{ { "waypoints", "" }, { "shapes", "" } };
+    if( !getMembers( navigationState, members ) ) {
+        AACE_WARN(LX(TAG).d("reason", "invalidNavigationState"));
     }
-    payload.AddMember( "waypoints", waypointsArray, allocator );
-
-    rapidjson::Document shapesArray( rapidjson::kArrayType );
-    if ( context.HasMember( "shapes" ) ) {
-        for ( auto& point : context["shapes"].GetArray() ) {
-            shapesArray.PushBack( point, allocator );
+    for( auto& member : members ) {
+        if( member.second.empty() || member.second.front() != '[' ) {
+            member.second = "[]";
         }
     }
-    payload.AddMember( "shapes", shapesArray, allocator );
 
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer( buffer );
-    ThrowIfNot(payload.Accept( writer ), "failedToWriteJsonDocument" );
-    auto navEvent = buildJsonEventString( START_NAVIGATION_SUCCESS, "", buffer.GetString() );
+    std::string payload = "{\"waypoints\":" + members["waypoints"] + ",\"shapes\":" + members["shapes"] + "}";
+    auto navEvent = buildEvent( NAMESPACE, START_NAVIGATION_SUCCESS, "", payload );
     auto request = std::make_shared<alexaClientSDK::avsCommon::avs::MessageRequest>(agentId,  navEvent.second);
     m_messageSender->sendMessage( request );
 }
@@ -476,15 +472,19 @@ void NavigationCapabilityAgent::navigateToPreviousWaypointSuccess(AgentId::IdTyp
 {
     std::string navigationState;
     navigationState = m_navigationHandler->getNavigationState(agentId);
-    rapidjson::Document context( rapidjson::kObjectType );
-    rapidjson::Document payload( rapidjson::kObjectType );
-    rapidjson::Document::AllocatorType& allocator = payload.GetAllocator();
 
-    context.Parse( navigationState.c_str() );
+    // only the waypoints are parsed, without the shapes of the route
+    std::unordered_map<std::string, std::string> members{ { "waypoints", "" } };
+    rapidjson::Document waypoints;
+    if( getMembers( navigationState, members ) && !members["waypoints"].empty() ) {
+        waypoints.Parse( members["waypoints"].c_str() );
+    }
 
+    rapidjson::Document payload( rapidjson::kObjectType );
+    rapidjson::Document::AllocatorType& allocator = payload.GetAllocator();
     rapidjson::Document waypointObject( rapidjson::kObjectType );
-    if ( context.HasMember( "waypoints" ) && context["waypoints"].GetArray().Size() > 0 ) {
-        payload.AddMember( "waypoint", context["waypoints"].GetArray()[0].GetObject(), allocator );
+    if ( waypoints.IsArray() && waypoints.Size() > 0 && waypoints[0].IsObject() ) {
+        payload.AddMember( "waypoint", waypoints[0].GetObject(), allocator );
     } else {
         payload.AddMember( "waypoint", waypointObject, allocator );
     }
@@ -551,13 +551,13 @@ void NavigationCapabilityAgent::showPreviousWaypointsError( AgentId::IdType agen
     m_messageSender->sendMessage( request );
 }
 
-bool NavigationCapabilityAgent::isNavigationStateValid( std::string navigationState )
+bool NavigationCapabilityAgent::serializeNavigationState( const std::string& navigationState, std::string& payload )
 {
     AACE_VERBOSE(LX(TAG).d("navigationState",navigationState));
     try
     {
         rapidjson::Document document;
-        document.Parse<0>( navigationState.c_str() );
+        document.Parse<0>( navigationState.empty() ? DEFAULT_NAVIGATION_STATE_PAYLOAD.c_str() : navigationState.c_str() );
 
         if( document.HasParseError() ) {
             rapidjson::ParseErrorCode ok = document.GetParseError();
@@ -656,10 +656,7 @@ bool NavigationCapabilityAgent::isNavigationStateValid( std::string navigationSt
         rapidjson::StringBuffer buffer;
         rapidjson::Writer<rapidjson::StringBuffer> writer( buffer );
         document.Accept( writer );
-        navigationState = buffer.GetString();
-
-        // set current navigation state payload
-        m_navigationStatePayload = navigationState;
+        payload = buffer.GetString();
         return true;
     } catch( std::exception& ex ) {
         AACE_ERROR(LX(TAG).d("reason",ex.what() ));
@@ -56,6 +56,7 @@ static const std::string METRIC_NAVIGATION_ANNOUNCE_ROADREGULATION = "AnnounceRo
 static const std::string METRIC_NAVIGATION_NAVIGATION_EVENT = "NavigationEvent";
 static const std::string METRIC_NAVIGATION_NAVIGATION_ERROR = "NavigationError";
 static const std::string METRIC_NAVIGATION_SHOW_ALTERNATIVE_ROUTES_SUCCEEDED = "ShowAlternativeRoutesSucceeded";
+static const std::string METRIC_NAVIGATION_NAVIGATION_STATE_CHANGED = "NavigationStateChanged";
 
 static const std::string ALT_ROUTE_INQUERY_TYPE_DEFAULT = "DEFAULT";
 static const std::string ALT_ROUTE_INQUERY_TYPE_SHORTER_TIME = "SHORTER_TIME";
@@ -303,6 +304,15 @@ std::string NavigationEngineImpl::getNavigationState(AgentId::IdType agentId) {
     return m_navigationPlatformInterface->getNavigationState();
 }
 
+void NavigationEngineImpl::onNavigationStateChanged(const std::string& navigationState) {
+    AACE_DEBUG(LX(TAG));
+    emitCounterMetrics(
+        METRIC_PROGRAM_NAME_SUFFIX, "onNavigationStateChanged", {METRIC_NAVIGATION_NAVIGATION_STATE_CHANGED});
+    if (m_navigationCapabilityAgent != nullptr) {
+        m_navigationCapabilityAgent->navigationStateChanged(navigationState);
+    }
+}
+
 void NavigationEngineImpl::onNavigationEvent(EventName event) {
     AACE_DEBUG(LX(TAG));
     std::stringstream ss;
@@ -419,7 +429,8 @@ void NavigationEngineImpl::onShowAlternativeRoutesSucceeded(const std::string& p
     std::vector<std::string> labels;
     std::vector<aace::engine::navigation::RouteSavings> savingsList;
     try {
-        nlohmann::json payloadJson = nlohmann::json::parse(payload);
+        // the payload is parsed once, and its members are read in place
+        const nlohmann::json payloadJson = nlohmann::json::parse(payload);
 
         std::string inquiryType = payloadJson.at("inquiryType");
         if (inquiryType == ALT_ROUTE_INQUERY_TYPE_DEFAULT) {
@@ -433,7 +444,7 @@ void NavigationEngineImpl::onShowAlternativeRoutesSucceeded(const std::string& p
             return;
         }
 
-        nlohmann::json alternateRouteJson = payloadJson.at("alternateRoute");
+        const nlohmann::json& alternateRouteJson = payloadJson.at("alternateRoute");
         labels = alternateRouteJson.at("labels").get<std::vector<std::string>>();
         if (labels.empty()) {
             AACE_ERROR(LX(TAG).m("alternateRoute.labels must be nonempty"));
@@ -441,12 +452,12 @@ void NavigationEngineImpl::onShowAlternativeRoutesSucceeded(const std::string& p
         }
 
         if (alternateRouteJson.contains("savings")) {
-            nlohmann::json savingsJson = alternateRouteJson.at("savings");
-            for (auto& saving : savingsJson.items()) {
-                double amount = saving.value().at("amount");
+            const nlohmann::json& savingsJson = alternateRouteJson.at("savings");
+            for (auto& saving : savingsJson) {
+                double amount = saving.at("amount");
 
                 aace::engine::navigation::RouteSavingsType savingsType;
-                const std::string& savingsTypeStr = saving.value().at("type");
+                const std::string& savingsTypeStr = saving.at("type");
                 if (savingsTypeStr == ALT_ROUTE_SAVINGS_TYPE_DISTANCE) {
                     savingsType = aace::engine::navigation::RouteSavingsType::DISTANCE;
                 } else if (savingsTypeStr == ALT_ROUTE_SAVINGS_TYPE_TIME) {
@@ -457,7 +468,7 @@ void NavigationEngineImpl::onShowAlternativeRoutesSucceeded(const std::string& p
                 }
 
                 aace::engine::navigation::SavingsUnit savingsUnit;
-                const std::string& savingsUnitStr = saving.value().at("unit");
+                const std::string& savingsUnitStr = saving.at("unit");
                 if (savingsUnitStr == ALT_ROUTE_SAVINGS_UNIT_MINUTE) {
                     savingsUnit = aace::engine::navigation::SavingsUnit::MINUTE;
                 } else if (savingsUnitStr == ALT_ROUTE_SAVINGS_UNIT_HOUR) {
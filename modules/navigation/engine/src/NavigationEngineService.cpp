@@ -18,12 +18,7 @@
 #include "AACE/Engine/Navigation/NavigationEngineService.h"
 #include "AACE/Engine/Alexa/AlexaEngineService.h"
 #include "AACE/Engine/Core/EngineMacros.h"
-
-#include <rapidjson/document.h>
-#include <rapidjson/prettywriter.h>
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/error/en.h>
-#include <rapidjson/istreamwrapper.h>
+#include "AACE/Engine/Utils/JSON/JSON.h"
 
 namespace aace {
 namespace engine {
@@ -39,20 +34,13 @@ NavigationEngineService::NavigationEngineService(const aace::engine::core::Servi
         aace::engine::core::EngineService(description) {
 }
 
-bool NavigationEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool NavigationEngineService::configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) {
     try {
-        rapidjson::IStreamWrapper isw(*configuration);
-        rapidjson::Document document;
-
-        document.ParseStream(isw);
-
-        ThrowIf(document.HasParseError(), GetParseError_En(document.GetParseError()));
-        ThrowIfNot(document.IsObject(), "invalidConfigurationStream");
-
-        auto root = document.GetObject();
+        const auto& root = *configuration;
+        ThrowIfNot(root.is_object(), "invalidConfiguration");
 
-        if (root.HasMember("providerName") && root["providerName"].IsString()) {
-            m_navigationProviderName = root["providerName"].GetString();
+        if (root.contains("providerName") && root.at("providerName").is_string()) {
+            m_navigationProviderName = root.at("providerName").get<std::string>();
             AACE_DEBUG(LX(TAG, "configure").d("providerName", m_navigationProviderName));
         }
         return true;
@@ -448,6 +448,16 @@ public:
      */
     void showAlternativeRoutesSucceeded(const std::string& payload);
 
+    /**
+     * Notifies the Engine of a change in the navigation state. Once the navigation state is pushed with this
+     * function, the Engine reports it in context without calling @c getNavigationState(), so it must be
+     * pushed every time the state changes.
+     *
+     * @param [in] navigationState The navigation state in the format returned by @c getNavigationState(),
+     *             or an empty string if not navigating
+     */
+    void navigationStateChanged(const std::string& navigationState);
+
     void setEngineInterface(std::shared_ptr<NavigationEngineInterface> navigationEngineInterface);
 
 private:
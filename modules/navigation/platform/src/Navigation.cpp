@@ -38,6 +38,12 @@ void Navigation::showAlternativeRoutesSucceeded(const std::string& payload) {
     }
 }
 
+void Navigation::navigationStateChanged(const std::string& navigationState) {
+    if (m_navigationEngineInterface != nullptr) {
+        m_navigationEngineInterface->onNavigationStateChanged(navigationState);
+    }
+}
+
 void Navigation::setEngineInterface(std::shared_ptr<NavigationEngineInterface> navigationEngineInterface) {
     m_navigationEngineInterface = navigationEngineInterface;
 }
@@ -39,6 +39,10 @@ static const std::string UNKNOWN_DIRECTIVE{"Unknown"};
 
 static const alexaClientSDK::avsCommon::avs::NamespaceAndName STARTNAVIGATION{NAMESPACE, "StartNavigation"};
 static const alexaClientSDK::avsCommon::avs::NamespaceAndName CANCELNAVIGATION{NAMESPACE, "CancelNavigation"};
+static const alexaClientSDK::avsCommon::avs::NamespaceAndName NAVIGATIONSTATE{NAMESPACE, "NavigationState"};
+
+static const std::string NAVIGATING_STATE{
+    R"({"state":"NAVIGATING","waypoints":[],"shapes":[[47.6,-122.3],[47.7,-122.4]]})"};
 
 static const std::string MESSAGE_ID("messageId");
 
@@ -235,6 +239,46 @@ TEST_F(NavigationCapabilityAgentTest, testCancelNavigationDirective) {
     m_wakeSetCompletedFuture.wait_for(TIMEOUT);
 }
 
+TEST_F(NavigationCapabilityAgentTest, testProvideStateFromPushedNavigationState) {
+    auto contextManager = m_alexaMockFactory->getContextManagerInterfaceMock();
+    std::promise<std::string> statePromise;
+    auto stateFuture = statePromise.get_future();
+
+    EXPECT_CALL(*m_testNavigationHandler, getNavigationState(testing::_)).Times(testing::Exactly(0));
+    EXPECT_CALL(*contextManager, setState(testing::_, testing::_, testing::_, 1))
+        .WillOnce(testing::DoAll(
+            testing::WithArg<1>(
+                testing::Invoke([&statePromise](const std::string& payload) { statePromise.set_value(payload); })),
+            testing::Return(alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS)));
+
+    m_capAgent->navigationStateChanged(NAVIGATING_STATE);
+    m_capAgent->provideState(NAVIGATIONSTATE, 1);
+
+    ASSERT_EQ(std::future_status::ready, stateFuture.wait_for(TIMEOUT));
+    EXPECT_EQ(NAVIGATING_STATE, stateFuture.get());
+}
+
+TEST_F(NavigationCapabilityAgentTest, testProvideStateIgnoresInvalidPushedNavigationState) {
+    auto contextManager = m_alexaMockFactory->getContextManagerInterfaceMock();
+    std::promise<std::string> statePromise;
+    auto stateFuture = statePromise.get_future();
+
+    EXPECT_CALL(*m_testNavigationHandler, getNavigationState(testing::_))
+        .Times(testing::Exactly(1))
+        .WillOnce(testing::Return(NAVIGATING_STATE));
+    EXPECT_CALL(*contextManager, setState(testing::_, testing::_, testing::_, 1))
+        .WillOnce(testing::DoAll(
+            testing::WithArg<1>(
+                testing::Invoke([&statePromise](const std::string& payload) { statePromise.set_value(payload); })),
+            testing::Return(alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS)));
+
+    m_capAgent->navigationStateChanged(R"({"state":"DRIVING"})");
+    m_capAgent->provideState(NAVIGATIONSTATE, 1);
+
+    ASSERT_EQ(std::future_status::ready, stateFuture.wait_for(TIMEOUT));
+    EXPECT_EQ(NAVIGATING_STATE, stateFuture.get());
+}
+
 }  // namespace navigation
 }  // namespace unit
 }  // namespace test
@@ -15,6 +15,7 @@
 
 #include "AACE/Engine/PhoneCallController/PhoneCallControllerCapabilityAgent.h"
 #include "AACE/Engine/Core/EngineMacros.h"
+#include "AACE/Engine/Utils/Event/EventBuilder.h"
 
 #include "rapidjson/document.h"
 #include "rapidjson/prettywriter.h"
@@ -29,6 +30,7 @@ namespace phoneCallController {
 
 using AgentId = alexaClientSDK::avsCommon::avs::AgentId;
 using NamespaceAndName = alexaClientSDK::avsCommon::avs::NamespaceAndName;
+using namespace aace::engine::utils::event;
 
 static const std::string TAG("aace.phoneCallController.PhoneCallControllerCapabilityAgent");
 
@@ -542,93 +544,59 @@ void PhoneCallControllerCapabilityAgent::updateContextManager(const std::string&
 }
 
 std::string PhoneCallControllerCapabilityAgent::getContextString() {
-    try {
-        rapidjson::Document document(rapidjson::kObjectType);
-
-        rapidjson::StringBuffer buffer;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-        rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
-
-        rapidjson::Value device(rapidjson::kObjectType);
-        device.AddMember(
-            "connectionState",
-            rapidjson::Value(connectionStateToString(m_connectionState).c_str(), allocator),
-            allocator);
-        document.AddMember("device", device, allocator);
-
-        rapidjson::Value configuration(rapidjson::kObjectType);
-        rapidjson::Value callingFeature(rapidjson::kArrayType);
-        for (auto it : m_deviceConfigurationMap) {
-            rapidjson::Value tempConfig(rapidjson::kObjectType);
-            tempConfig.AddMember(
-                rapidjson::Value(configurationFeatureToString(it.first).c_str(), allocator),
-                rapidjson::Value().SetBool(it.second),
-                allocator);
-            callingFeature.PushBack(tempConfig, allocator);
-        }
-        rapidjson::Value tempConfig(rapidjson::kObjectType);
-        tempConfig.AddMember("OVERRIDE_RINGTONE_SUPPORTED", rapidjson::Value().SetBool(false), allocator);
-        callingFeature.PushBack(tempConfig, allocator);
-
-        configuration.AddMember("callingFeature", callingFeature, allocator);
-        document.AddMember("configuration", configuration, allocator);
+    // the context is written directly, since it is reported with every call state change
+    std::string context;
+    context.append("{\"device\":{\"connectionState\":");
+    appendString(context, connectionStateToString(m_connectionState));
+
+    context.append("},\"configuration\":{\"callingFeature\":[");
+    for (auto& it : m_deviceConfigurationMap) {
+        context.push_back('{');
+        appendString(context, configurationFeatureToString(it.first));
+        context.append(it.second ? ":true}," : ":false},");
+    }
+    context.append("{\"OVERRIDE_RINGTONE_SUPPORTED\":false}]}");
 
-        rapidjson::Value allCalls(rapidjson::kArrayType);
-        for (auto it : m_allCallsMap) {
-            if (it.second == CallState::IDLE) {
-                continue;
-            }
-            rapidjson::Value tempCall(rapidjson::kObjectType);
-            tempCall.AddMember("callId", rapidjson::Value(it.first.c_str(), allocator), allocator);
-            tempCall.AddMember(
-                "callState", rapidjson::Value(callStateToString(it.second).c_str(), allocator), allocator);
-            allCalls.PushBack(tempCall, allocator);
+    context.append(",\"allCalls\":[");
+    bool firstCall = true;
+    for (auto& it : m_allCallsMap) {
+        if (it.second == CallState::IDLE) {
+            continue;
         }
-        document.AddMember("allCalls", allCalls, allocator);
-
-        if (callExist(m_currentCallId) && getCallState(m_currentCallId) != CallState::IDLE) {
-            rapidjson::Value currentCall(rapidjson::kObjectType);
-            currentCall.AddMember("callId", rapidjson::Value(m_currentCallId.c_str(), allocator), allocator);
-            document.AddMember("currentCall", currentCall, allocator);
+        if (!firstCall) {
+            context.push_back(',');
         }
+        firstCall = false;
+        context.append("{\"callId\":");
+        appendString(context, it.first);
+        context.append(",\"callState\":");
+        appendString(context, callStateToString(it.second));
+        context.push_back('}');
+    }
+    context.push_back(']');
 
-        ThrowIfNot(document.Accept(writer), "failedToWriteJsonDocument");
-        return buffer.GetString();
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return "";
+    if (callExist(m_currentCallId) && getCallState(m_currentCallId) != CallState::IDLE) {
+        context.append(",\"currentCall\":{\"callId\":");
+        appendString(context, m_currentCallId);
+        context.push_back('}');
     }
+    context.push_back('}');
+
+    return context;
 }
 
 const std::pair<std::string, std::string> PhoneCallControllerCapabilityAgent::buildEventAndUpdateContext(
     const std::string& eventName,
     const std::string& payload) {
-    const std::pair<std::string, std::string> emptyPair;
     std::string context = getContextString();
-    rapidjson::Document contextPayload;
-    if (contextPayload.Parse(context.c_str()).HasParseError()) {
-        AACE_ERROR(LX(TAG).d("reason", "failedToParseContextPayload"));
-        return emptyPair;
-    }
-    rapidjson::Document document(rapidjson::kArrayType);
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-    rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
-
-    rapidjson::Value contextObject(rapidjson::kObjectType);
-    contextObject.AddMember("payload", contextPayload, allocator);
-    rapidjson::Value header(rapidjson::kObjectType);
-    header.AddMember("namespace", rapidjson::Value(NAMESPACE.c_str(), allocator), allocator);
-    header.AddMember("name", rapidjson::Value("PhoneCallControllerState", allocator), allocator);
-    contextObject.AddMember("header", header, allocator);
-    document.PushBack(contextObject, allocator);
-
-    if (!document.Accept(writer)) {
-        AACE_ERROR(LX(TAG).d("reason", "failedToCreateContextWithHeader"));
-        return emptyPair;
-    }
+
+    // the context reported to the context manager is composed into the event as it is
+    std::string eventContext("[");
+    appendContextState(eventContext, NAMESPACE, "PhoneCallControllerState", context);
+    eventContext.push_back(']');
+
     updateContextManager(context);
-    return buildJsonEventString(eventName, "", payload, buffer.GetString());
+    return buildEvent(NAMESPACE, eventName, "", payload, eventContext);
 }
 
 void PhoneCallControllerCapabilityAgent::executeOnFocusChanged(
@@ -16,11 +16,10 @@
 #include "AACE/Engine/PhoneCallController/PhoneCallControllerRESTAgent.h"
 
 #include <AVSCommon/Utils/UUIDGeneration/UUIDGeneration.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpPost.h>
-#include <AVSCommon/Utils/LibcurlUtils/HttpGet.h>
 #include <AVSCommon/Utils/LibcurlUtils/HttpResponseCodes.h>
 #include <AVSCommon/Utils/LibcurlUtils/HTTPResponse.h>
 #include <AACE/Engine/Core/EngineMacros.h>
+#include <AACE/Engine/Alexa/HttpClientPool.h>
 #include "AACE/Engine/Utils/JSON/JSON.h"
 
 namespace aace {
@@ -128,12 +127,7 @@ static alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse doPost(
     const std::string& data,
     std::chrono::seconds timeout) {
     try {
-        // Creating the HttpPost on every doPost is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpPost = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpPost::create();
-        ThrowIfNull(httpPost, "nullHttpPost");
-
-        return httpPost->doPost(url, headerLines, data, timeout);
+        return aace::engine::alexa::HttpClientPool::getInstance()->doPost(url, headerLines, data, timeout);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "doPost").d("reason", ex.what()));
         return alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse();
@@ -151,12 +145,7 @@ static alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse doGet(
     const std::string& url,
     const std::vector<std::string>& headers) {
     try {
-        // Creating the HttpGet on every doGet is by design to ensure that curl in libcurlUtils uses the
-        // latest provided curl options.
-        auto httpGet = alexaClientSDK::avsCommon::utils::libcurlUtils::HttpGet::create();
-        ThrowIfNull(httpGet, "nullHttpGet");
-
-        return httpGet->doGet(url, headers, DEFAULT_HTTP_TIMEOUT);
+        return aace::engine::alexa::HttpClientPool::getInstance()->doGet(url, headers, DEFAULT_HTTP_TIMEOUT);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "doGet").d("reason", ex.what()));
         return alexaClientSDK::avsCommon::utils::libcurlUtils::HTTPResponse();
@@ -40,10 +40,10 @@ TextToSpeechProviderEngineService::TextToSpeechProviderEngineService(
         aace::engine::core::EngineService(description) {
 }
 
-bool TextToSpeechProviderEngineService::configure(std::shared_ptr<std::istream> configuration) {
+bool TextToSpeechProviderEngineService::configure(
+    std::shared_ptr<const aace::engine::utils::json::Value> configuration) {
     try {
-        json jconfiguration;
-        jconfiguration = json::parse(*configuration);
+        auto& jconfiguration = *configuration;
         ThrowIfNull(jconfiguration, "emptyTextToSpeechProviderConfiguration");
         auto voices = jconfiguration.value("voices", json::array());
         ThrowIf(voices.empty(), "emptyVoiceArrayInTextToSpeechProviderConfiguration");
@@ -52,9 +52,6 @@ public:
     void capabilitiesReceived(const std::string& requestId, const std::string& capabilities) override;
 
 private:
-    std::string m_currentToken;
-    std::shared_ptr<aace::core::MessageStream> m_handler;
-
     std::weak_ptr<aace::engine::messageBroker::MessageBrokerInterface> m_messageBroker;
     std::weak_ptr<aace::engine::messageBroker::StreamManagerInterface> m_streamManager;
 
@@ -112,15 +112,15 @@ void AASBTextToSpeech::prepareSpeechCompleted(
         auto streamId = aace::engine::utils::uuid::generateUUID();
 
         // generate a unique token id
-        m_currentToken = aace::engine::utils::uuid::generateUUID();
+        auto token = aace::engine::utils::uuid::generateUUID();
 
         // create the stream handler
-        m_handler = std::make_shared<AudioOutputStreamHandler>(preparedAudio);
-        ThrowIfNot(m_streamManager_lock->registerStreamHandler(streamId, m_handler), "registerStreamHandlerFailed");
+        auto handler = std::make_shared<AudioOutputStreamHandler>(preparedAudio);
+        ThrowIfNot(m_streamManager_lock->registerStreamHandler(streamId, handler), "registerStreamHandlerFailed");
 
         aasb::message::textToSpeech::textToSpeech::PrepareSpeechCompletedMessage message;
         message.payload.streamId = streamId;
-        message.payload.token = m_currentToken;
+        message.payload.token = token;
         message.payload.encoding =
             static_cast<aasb::message::textToSpeech::textToSpeech::AudioStreamEncoding>(preparedAudio->getEncoding());
         message.payload.properties = {};
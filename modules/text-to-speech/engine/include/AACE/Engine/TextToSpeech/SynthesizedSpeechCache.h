@@ -0,0 +1,128 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_TEXTTOSPEECH_SYNTHESIZED_SPEECH_CACHE_H
+#define AACE_ENGINE_TEXTTOSPEECH_SYNTHESIZED_SPEECH_CACHE_H
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <AACE/Audio/AudioStream.h>
+
+namespace aace {
+namespace engine {
+namespace textToSpeech {
+
+/**
+ * Least recently used cache of synthesized speech, bounded by the total size of the cached audio.
+ *
+ * Speech is cached while the platform reads it: @c record() wraps the stream returned by a provider,
+ * and the audio is added to the cache only once a read of the closed stream returns no data. Speech
+ * which is larger than the cache, or which is not read to the end, is not cached. @c get() returns a new stream
+ * which replays the cached audio from memory. All functions are thread safe.
+ */
+class SynthesizedSpeechCache : public std::enable_shared_from_this<SynthesizedSpeechCache> {
+private:
+    SynthesizedSpeechCache(size_t maxBytes);
+
+public:
+    /**
+     * Creates a cache.
+     *
+     * @param maxBytes The maximum total size of the cached audio.
+     * @return The new cache, or @c nullptr if @c maxBytes is 0.
+     */
+    static std::shared_ptr<SynthesizedSpeechCache> create(size_t maxBytes);
+
+    /**
+     * Returns the key of the speech synthesized from a request.
+     *
+     * @param provider The name of the provider the speech is requested from.
+     * @param text The text or SSML to synthesize.
+     * @param requestPayload The serialized request payload, which selects the voice and locale.
+     */
+    static std::string createKey(
+        const std::string& provider,
+        const std::string& text,
+        const std::string& requestPayload);
+
+    /**
+     * Returns a stream which replays cached speech.
+     *
+     * @param key The key of the speech.
+     * @param [out] metadata The metadata the provider returned with the speech.
+     * @return The stream, or @c nullptr if the speech is not cached.
+     */
+    std::shared_ptr<aace::audio::AudioStream> get(const std::string& key, std::string& metadata);
+
+    /**
+     * Returns a stream which reads @c stream, and adds the audio to the cache once a read returns no data after
+     * @c stream is closed.
+     *
+     * @param key The key of the speech.
+     * @param stream The stream returned by the provider.
+     * @param metadata The metadata the provider returned with the speech.
+     */
+    std::shared_ptr<aace::audio::AudioStream> record(
+        const std::string& key,
+        std::shared_ptr<aace::audio::AudioStream> stream,
+        const std::string& metadata);
+
+    /// Returns the maximum total size of the cached audio.
+    size_t getMaxBytes() const;
+
+    /// Returns the total size of the cached audio.
+    size_t getSize();
+
+    /// Removes all cached speech.
+    void clear();
+
+    /// Cached speech, which is not modified once it has been added to the cache.
+    struct Entry {
+        std::vector<char> audio;
+        aace::audio::AudioFormat audioFormat;
+        aace::audio::AudioStream::MediaType mediaType;
+        std::vector<std::pair<std::string, std::string>> properties;
+        std::string metadata;
+    };
+
+private:
+    /// Adds recorded speech to the cache, removing the least recently used speech to make room for it.
+    void add(const std::string& key, std::shared_ptr<const Entry> entry);
+
+    class ReplayAudioStream;
+    class RecordingAudioStream;
+
+    const size_t m_maxBytes;
+
+    std::mutex m_mutex;
+    size_t m_size;
+
+    /// Keys in order of use, most recently used first.
+    std::list<std::string> m_lruKeys;
+    std::unordered_map<std::string, std::pair<std::shared_ptr<const Entry>, std::list<std::string>::iterator>>
+        m_entries;
+};
+
+}  // namespace textToSpeech
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_TEXTTOSPEECH_SYNTHESIZED_SPEECH_CACHE_H
@@ -16,13 +16,16 @@
 #ifndef AACE_ENGINE_TEXTTOSPEECH_TEXTTOSPEECH_ENGINE_IMPL_H
 #define AACE_ENGINE_TEXTTOSPEECH_TEXTTOSPEECH_ENGINE_IMPL_H
 
+#include <atomic>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <AACE/Engine/Utils/Threading/Executor.h>
 
 #include "AACE/TextToSpeech/TextToSpeech.h"
 #include "AACE/TextToSpeech/TextToSpeechEngineInterface.h"
+#include "SynthesizedSpeechCache.h"
 #include "TextToSpeechServiceInterface.h"
 
 namespace aace {
@@ -33,12 +36,31 @@ class TextToSpeechEngineImpl : public aace::textToSpeech::TextToSpeechEngineInte
 private:
     TextToSpeechEngineImpl(std::shared_ptr<aace::textToSpeech::TextToSpeech> textToSpeechPlatformInterface);
 
-    bool initialize(std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface);
+    bool initialize(
+        std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface,
+        size_t maxConcurrentRequests,
+        size_t cacheMaxBytes);
 
 public:
+    /// The default number of speech synthesis requests waiting for a provider at the same time.
+    static const size_t DEFAULT_MAX_CONCURRENT_REQUESTS;
+
+    /// The default maximum size of the synthesized speech cache.
+    static const size_t DEFAULT_CACHE_MAX_BYTES;
+
+    /**
+     * Creates the engine implementation of the @c TextToSpeech platform interface.
+     *
+     * @param textToSpeechPlatformInterface The platform interface.
+     * @param textToSpeechServiceInterface The service which provides the text to speech providers.
+     * @param maxConcurrentRequests The number of speech synthesis requests waiting for a provider at the same time.
+     * @param cacheMaxBytes The maximum size of the synthesized speech cache, or 0 to disable the cache.
+     */
     static std::shared_ptr<TextToSpeechEngineImpl> create(
         std::shared_ptr<aace::textToSpeech::TextToSpeech> textToSpeechPlatformInterface,
-        std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface);
+        std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface,
+        size_t maxConcurrentRequests = DEFAULT_MAX_CONCURRENT_REQUESTS,
+        size_t cacheMaxBytes = DEFAULT_CACHE_MAX_BYTES);
 
     // TextToSpeechEngineInterface
     bool onPrepareSpeech(
@@ -54,6 +76,7 @@ private:
     bool executeOnPrepareSpeech(
         const std::string& speechId,
         const std::string& text,
+        const std::string& provider,
         std::shared_ptr<TextToSpeechSynthesizerInterface> textToSpeechProvider,
         const std::string& options);
     bool executeOnGetCapabilities(
@@ -63,7 +86,21 @@ private:
     std::shared_ptr<aace::textToSpeech::TextToSpeech> m_textToSpeechPlatformInterface;
     std::weak_ptr<TextToSpeechServiceInterface> m_textToSpeechServiceInterface;
 
-    // executor for speech synthesis requests
+    /// A thread waiting for speech synthesis requests, and the number of requests submitted to it.
+    struct PrepareSpeechWorker {
+        aace::engine::utils::threading::Executor executor;
+        std::atomic<size_t> pendingRequests{0};
+    };
+
+    /// Returns the worker with the fewest pending requests.
+    PrepareSpeechWorker* selectPrepareSpeechWorker();
+
+    std::vector<std::unique_ptr<PrepareSpeechWorker>> m_prepareSpeechWorkers;
+
+    /// Cache of synthesized speech, or @c nullptr if caching is disabled.
+    std::shared_ptr<SynthesizedSpeechCache> m_synthesizedSpeechCache;
+
+    // executor for capabilities requests and cached speech
     aace::engine::utils::threading::Executor m_executor;
 };
 
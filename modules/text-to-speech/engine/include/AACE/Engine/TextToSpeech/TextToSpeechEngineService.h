@@ -49,6 +49,7 @@ public:
 protected:
     bool registerPlatformInterface(std::shared_ptr<aace::core::PlatformInterface> platformInterface) override;
     bool initialize() override;
+    bool configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) override;
     bool shutdown() override;
 
 private:
@@ -63,6 +64,8 @@ private:
 
 private:
     std::shared_ptr<TextToSpeechEngineImpl> m_textToSpeechEngineImpl;
+    size_t m_maxConcurrentRequests = TextToSpeechEngineImpl::DEFAULT_MAX_CONCURRENT_REQUESTS;
+    size_t m_cacheMaxBytes = TextToSpeechEngineImpl::DEFAULT_CACHE_MAX_BYTES;
     std::mutex m_textToSpeechProviderMutex;
     std::string m_preferedProvider;
     // Map to store Text To Speech provider name and the associated Text To Speech Providers
@@ -0,0 +1,293 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "AACE/Engine/Core/EngineMacros.h"
+#include "AACE/Engine/TextToSpeech/SynthesizedSpeechCache.h"
+
+namespace aace {
+namespace engine {
+namespace textToSpeech {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.textToSpeech.SynthesizedSpeechCache");
+
+/// Number of bytes read ahead to find whether a closed stream has speech left.
+static const size_t READ_AHEAD_SIZE = 4096;
+
+//
+// ReplayAudioStream
+//
+
+class SynthesizedSpeechCache::ReplayAudioStream : public aace::audio::AudioStream {
+public:
+    ReplayAudioStream(std::shared_ptr<const Entry> entry) : m_entry(std::move(entry)), m_offset(0) {
+    }
+
+    ssize_t read(char* data, const size_t size) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto count = std::min(size, m_entry->audio.size() - m_offset);
+        std::memcpy(data, m_entry->audio.data() + m_offset, count);
+        m_offset += count;
+        return static_cast<ssize_t>(count);
+    }
+
+    bool isClosed() override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_offset >= m_entry->audio.size();
+    }
+
+    Encoding getEncoding() override {
+        return getAudioFormat().getEncoding();
+    }
+
+    AudioFormat getAudioFormat() override {
+        return m_entry->audioFormat;
+    }
+
+    MediaType getMediaType() override {
+        return m_entry->mediaType;
+    }
+
+    std::vector<aace::audio::AudioStreamProperty> getProperties() override {
+        std::vector<aace::audio::AudioStreamProperty> properties;
+        properties.reserve(m_entry->properties.size());
+        for (const auto& property : m_entry->properties) {
+            properties.emplace_back(property.first, property.second);
+        }
+        return properties;
+    }
+
+private:
+    const std::shared_ptr<const Entry> m_entry;
+    std::mutex m_mutex;
+    size_t m_offset;
+};
+
+//
+// RecordingAudioStream
+//
+
+class SynthesizedSpeechCache::RecordingAudioStream : public aace::audio::AudioStream {
+public:
+    RecordingAudioStream(
+        std::weak_ptr<SynthesizedSpeechCache> cache,
+        size_t maxBytes,
+        const std::string& key,
+        std::shared_ptr<aace::audio::AudioStream> stream,
+        const std::string& metadata) :
+            m_cache(std::move(cache)),
+            m_maxBytes(maxBytes),
+            m_key(key),
+            m_stream(std::move(stream)),
+            m_entry(std::make_shared<Entry>()),
+            m_recording(true) {
+        m_entry->audioFormat = m_stream->getAudioFormat();
+        m_entry->mediaType = m_stream->getMediaType();
+        for (auto& property : m_stream->getProperties()) {
+            m_entry->properties.emplace_back(property.getKey(), property.getValue());
+        }
+        m_entry->metadata = metadata;
+    }
+
+    ssize_t read(char* data, const size_t size) override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_readAhead.empty()) {
+                auto count = std::min(size, m_readAhead.size());
+                std::memcpy(data, m_readAhead.data(), count);
+                m_readAhead.erase(m_readAhead.begin(), m_readAhead.begin() + count);
+                recordLocked(data, static_cast<ssize_t>(count));
+                return static_cast<ssize_t>(count);
+            }
+        }
+        auto count = m_stream->read(data, size);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        recordLocked(data, count);
+        return count;
+    }
+
+    bool isClosed() override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_stream->isClosed()) {
+            return false;
+        }
+        if (m_recording && m_readAhead.empty()) {
+            // a reader may stop once the stream is closed, without the empty read which ends the speech, so read
+            // ahead to find whether the speech is complete, and keep any speech left for the next reads
+            char data[READ_AHEAD_SIZE];
+            auto count = m_stream->read(data, sizeof(data));
+            if (count > 0) {
+                m_readAhead.assign(data, data + count);
+            } else {
+                recordLocked(data, count);
+            }
+        }
+        return true;
+    }
+
+    Encoding getEncoding() override {
+        return m_stream->getEncoding();
+    }
+
+    AudioFormat getAudioFormat() override {
+        return m_stream->getAudioFormat();
+    }
+
+    MediaType getMediaType() override {
+        return m_stream->getMediaType();
+    }
+
+    std::vector<aace::audio::AudioStreamProperty> getProperties() override {
+        return m_stream->getProperties();
+    }
+
+private:
+    void recordLocked(const char* data, ssize_t count) {
+        if (!m_recording) {
+            return;
+        }
+        if (count < 0 || m_entry->audio.size() + count > m_maxBytes) {
+            // the speech can not be cached
+            stopRecordingLocked();
+            return;
+        }
+        if (count == 0 && m_stream->isClosed()) {
+            // a provider may close its stream before the reader drained it, so only an empty read ends the speech
+            addToCacheLocked();
+            return;
+        }
+        m_entry->audio.insert(m_entry->audio.end(), data, data + count);
+    }
+
+    void addToCacheLocked() {
+        auto cache = m_cache.lock();
+        if (cache != nullptr && !m_entry->audio.empty()) {
+            cache->add(m_key, m_entry);
+        }
+        stopRecordingLocked();
+    }
+
+    void stopRecordingLocked() {
+        m_recording = false;
+        m_entry.reset();
+    }
+
+    const std::weak_ptr<SynthesizedSpeechCache> m_cache;
+    const size_t m_maxBytes;
+    const std::string m_key;
+    const std::shared_ptr<aace::audio::AudioStream> m_stream;
+
+    std::mutex m_mutex;
+    std::shared_ptr<Entry> m_entry;
+    bool m_recording;
+
+    /// Speech read ahead from the closed stream by @c isClosed(), which is returned by the next reads.
+    std::vector<char> m_readAhead;
+};
+
+//
+// SynthesizedSpeechCache
+//
+
+SynthesizedSpeechCache::SynthesizedSpeechCache(size_t maxBytes) : m_maxBytes(maxBytes), m_size(0) {
+}
+
+std::shared_ptr<SynthesizedSpeechCache> SynthesizedSpeechCache::create(size_t maxBytes) {
+    try {
+        ThrowIf(maxBytes == 0, "invalidMaxBytes");
+        return std::shared_ptr<SynthesizedSpeechCache>(new SynthesizedSpeechCache(maxBytes));
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+std::string SynthesizedSpeechCache::createKey(
+    const std::string& provider,
+    const std::string& text,
+    const std::string& requestPayload) {
+    // the lengths keep the fields apart, whatever characters they contain
+    return std::to_string(provider.size()) + ":" + provider + std::to_string(requestPayload.size()) + ":" +
+           requestPayload + text;
+}
+
+std::shared_ptr<aace::audio::AudioStream> SynthesizedSpeechCache::get(const std::string& key, std::string& metadata) {
+    std::shared_ptr<const Entry> entry;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(key);
+        if (it == m_entries.end()) {
+            return nullptr;
+        }
+        m_lruKeys.splice(m_lruKeys.begin(), m_lruKeys, it->second.second);
+        entry = it->second.first;
+    }
+    metadata = entry->metadata;
+    return std::make_shared<ReplayAudioStream>(entry);
+}
+
+std::shared_ptr<aace::audio::AudioStream> SynthesizedSpeechCache::record(
+    const std::string& key,
+    std::shared_ptr<aace::audio::AudioStream> stream,
+    const std::string& metadata) {
+    if (stream == nullptr) {
+        return nullptr;
+    }
+    return std::make_shared<RecordingAudioStream>(shared_from_this(), m_maxBytes, key, stream, metadata);
+}
+
+size_t SynthesizedSpeechCache::getMaxBytes() const {
+    return m_maxBytes;
+}
+
+size_t SynthesizedSpeechCache::getSize() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_size;
+}
+
+void SynthesizedSpeechCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_lruKeys.clear();
+    m_size = 0;
+}
+
+void SynthesizedSpeechCache::add(const std::string& key, std::shared_ptr<const Entry> entry) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+        // the same speech was synthesized again by a concurrent request
+        m_size -= it->second.first->audio.size();
+        m_lruKeys.erase(it->second.second);
+        m_entries.erase(it);
+    }
+    while (!m_lruKeys.empty() && m_size + entry->audio.size() > m_maxBytes) {
+        auto last = m_entries.find(m_lruKeys.back());
+        m_size -= last->second.first->audio.size();
+        m_entries.erase(last);
+        m_lruKeys.pop_back();
+    }
+    m_lruKeys.push_front(key);
+    m_size += entry->audio.size();
+    m_entries[key] = std::make_pair(std::move(entry), m_lruKeys.begin());
+    AACE_DEBUG(LX(TAG).d("size", m_size).d("entries", m_entries.size()));
+}
+
+}  // namespace textToSpeech
+}  // namespace engine
+}  // namespace aace
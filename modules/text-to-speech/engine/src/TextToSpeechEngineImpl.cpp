@@ -54,20 +54,46 @@ static const std::string METRIC_TEXT_TO_SPEECH_GET_CAPABILITIES = "GetCapabiliti
 static const std::string METRIC_TEXT_TO_SPEECH_PREPARE_SPEECH_COMPLETED = "PrepareSpeechCompleted";
 static const std::string METRIC_TEXT_TO_SPEECH_PREPARE_SPEECH_FAILED = "PrepareSpeechFailed";
 static const std::string METRIC_TEXT_TO_SPEECH_CAPABILITIES_RECEIVED = "CapabilitiesReceived";
+static const std::string METRIC_TEXT_TO_SPEECH_CACHE_HIT = "CacheHit";
+static const std::string METRIC_TEXT_TO_SPEECH_CACHE_MISS = "CacheMiss";
+
+/// Timer metric for the time from a speech synthesis request until the speech is available
+static const std::string METRIC_TEXT_TO_SPEECH_PREPARE_SPEECH_LATENCY = "PrepareSpeechLatency";
+
+const size_t TextToSpeechEngineImpl::DEFAULT_MAX_CONCURRENT_REQUESTS = 4;
+const size_t TextToSpeechEngineImpl::DEFAULT_CACHE_MAX_BYTES = 2 * 1024 * 1024;
 
 TextToSpeechEngineImpl::TextToSpeechEngineImpl(
     std::shared_ptr<aace::textToSpeech::TextToSpeech> textToSpeechPlatformInterface) :
         m_textToSpeechPlatformInterface(textToSpeechPlatformInterface) {
 }
 
-bool TextToSpeechEngineImpl::initialize(std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface) {
-    m_textToSpeechServiceInterface = textToSpeechServiceInterface;
-    return true;
+bool TextToSpeechEngineImpl::initialize(
+    std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface,
+    size_t maxConcurrentRequests,
+    size_t cacheMaxBytes) {
+    try {
+        ThrowIf(maxConcurrentRequests == 0, "invalidMaxConcurrentRequests");
+        m_textToSpeechServiceInterface = textToSpeechServiceInterface;
+        for (size_t i = 0; i < maxConcurrentRequests; i++) {
+            m_prepareSpeechWorkers.emplace_back(new PrepareSpeechWorker());
+        }
+        if (cacheMaxBytes > 0) {
+            m_synthesizedSpeechCache = SynthesizedSpeechCache::create(cacheMaxBytes);
+            ThrowIfNull(m_synthesizedSpeechCache, "createSynthesizedSpeechCacheFailed");
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
 }
 
 std::shared_ptr<TextToSpeechEngineImpl> TextToSpeechEngineImpl::create(
     std::shared_ptr<aace::textToSpeech::TextToSpeech> textToSpeechPlatformInterface,
-    std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface) {
+    std::shared_ptr<TextToSpeechServiceInterface> textToSpeechServiceInterface,
+    size_t maxConcurrentRequests,
+    size_t cacheMaxBytes) {
     try {
         ThrowIfNull(textToSpeechPlatformInterface, "nullTextToSpeechPlatformInterface");
         ThrowIfNull(textToSpeechServiceInterface, "nullTextToSpeechServiceInterface");
@@ -75,7 +101,8 @@ std::shared_ptr<TextToSpeechEngineImpl> TextToSpeechEngineImpl::create(
             std::shared_ptr<TextToSpeechEngineImpl>(new TextToSpeechEngineImpl(textToSpeechPlatformInterface));
 
         ThrowIfNot(
-            textToSpeechEngineImpl->initialize(textToSpeechServiceInterface), "initializeTextToSpeechEngineImplFailed");
+            textToSpeechEngineImpl->initialize(textToSpeechServiceInterface, maxConcurrentRequests, cacheMaxBytes),
+            "initializeTextToSpeechEngineImplFailed");
 
         // Set the Engine Interface reference
         textToSpeechPlatformInterface->setEngineInterface(textToSpeechEngineImpl);
@@ -105,7 +132,7 @@ bool TextToSpeechEngineImpl::onPrepareSpeech(
         ThrowIfNull(m_textToSpeechServiceInterface_lock, "nullTextToSpeechServiceInterface");
         auto textToSpeechProvider = m_textToSpeechServiceInterface_lock->getTextToSpeechProvider(provider);
         ThrowIfNull(textToSpeechProvider, "nullTextToSpeechProvider");
-        return executeOnPrepareSpeech(speechId, text, textToSpeechProvider, options);
+        return executeOnPrepareSpeech(speechId, text, provider, textToSpeechProvider, options);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         return false;
@@ -129,6 +156,7 @@ bool TextToSpeechEngineImpl::onGetCapabilities(const std::string& requestId, con
 bool TextToSpeechEngineImpl::executeOnPrepareSpeech(
     const std::string& speechId,
     const std::string& text,
+    const std::string& provider,
     std::shared_ptr<TextToSpeechSynthesizerInterface> textToSpeechProvider,
     const std::string& options) {
     try {
@@ -136,61 +164,108 @@ bool TextToSpeechEngineImpl::executeOnPrepareSpeech(
         ThrowIfNull(m_textToSpeechPlatformInterface, "nullTextToSpeechPlatformInterface");
         auto textToSpeechPlatformInterface = m_textToSpeechPlatformInterface;
         std::string requestPayload;
-        std::string requestTimeout;
+        std::string cacheKey;
         if (!options.empty()) {
             nlohmann::json optionsPayload = nlohmann::json::parse(options);
             if (optionsPayload.contains(REQUEST_PAYLOAD_KEY)) {
                 requestPayload = optionsPayload.at(REQUEST_PAYLOAD_KEY).dump();
+                cacheKey = SynthesizedSpeechCache::createKey(provider, text, requestPayload);
             } else {
                 requestPayload = options;
+                // the serialized payload has sorted keys, so requests for the same voice share a key
+                cacheKey = SynthesizedSpeechCache::createKey(provider, text, optionsPayload.dump());
+            }
+        } else {
+            cacheKey = SynthesizedSpeechCache::createKey(provider, text, EMPTY_STRING);
+        }
+
+        auto synthesizedSpeechCache = m_synthesizedSpeechCache;
+        if (synthesizedSpeechCache != nullptr) {
+            std::string metadata;
+            auto cachedSpeech = synthesizedSpeechCache->get(cacheKey, metadata);
+            if (cachedSpeech != nullptr) {
+                emitCounterMetrics(
+                    METRIC_PROGRAM_NAME_SUFFIX, "executeOnPrepareSpeech", METRIC_TEXT_TO_SPEECH_CACHE_HIT, 1);
+                m_executor.submit([speechId, cachedSpeech, metadata, textToSpeechPlatformInterface] {
+                    emitCounterMetrics(
+                        METRIC_PROGRAM_NAME_SUFFIX,
+                        "executeOnPrepareSpeech",
+                        METRIC_TEXT_TO_SPEECH_PREPARE_SPEECH_COMPLETED,
+                        1);
+                    textToSpeechPlatformInterface->prepareSpeechCompleted(speechId, cachedSpeech, metadata);
+                });
+                return true;
             }
+            emitCounterMetrics(
+                METRIC_PROGRAM_NAME_SUFFIX, "executeOnPrepareSpeech", METRIC_TEXT_TO_SPEECH_CACHE_MISS, 1);
         }
-        m_executor.submit(
-            [speechId, text, textToSpeechProvider, requestTimeout, requestPayload, textToSpeechPlatformInterface] {
-                try {
-                    AACE_DEBUG(LX(TAG).m("Executing prepare speech"));
-                    auto prepareSpeechFuture = textToSpeechProvider->prepareSpeech(speechId, text, requestPayload);
-                    auto status = prepareSpeechFuture.wait_for(DEFAULT_REQUEST_TIMEOUT);
-                    if (status == std::future_status::timeout) {
+
+        // the worker waits for the provider, so requests queue only when every worker is waiting
+        auto worker = selectPrepareSpeechWorker();
+        worker->pendingRequests++;
+        auto requestTime = std::chrono::steady_clock::now();
+        worker->executor.submit([speechId,
+                                 text,
+                                 textToSpeechProvider,
+                                 requestPayload,
+                                 cacheKey,
+                                 requestTime,
+                                 synthesizedSpeechCache,
+                                 textToSpeechPlatformInterface,
+                                 worker] {
+            try {
+                AACE_DEBUG(LX(TAG).m("Executing prepare speech"));
+                auto prepareSpeechFuture = textToSpeechProvider->prepareSpeech(speechId, text, requestPayload);
+                auto status = prepareSpeechFuture.wait_for(DEFAULT_REQUEST_TIMEOUT);
+                if (status == std::future_status::timeout) {
+                    emitCounterMetrics(
+                        METRIC_PROGRAM_NAME_SUFFIX,
+                        "executeOnPrepareSpeech",
+                        METRIC_TEXT_TO_SPEECH_PREPARE_SPEECH_FAILED,
+                        1);
+                    textToSpeechPlatformInterface->prepareSpeechFailed(speechId, REQUEST_TIMED_OUT);
+                } else {
+                    auto prepareSpeechResult = prepareSpeechFuture.get();
+                    auto speechId = prepareSpeechResult.getSpeechId();
+                    auto failureReason = prepareSpeechResult.getFailureReason();
+                    auto metadata = prepareSpeechResult.getSpeechMetadata();
+                    auto synthesizedSpeech = prepareSpeechResult.getPreparedAudio();
+                    if (!failureReason.empty()) {
                         emitCounterMetrics(
                             METRIC_PROGRAM_NAME_SUFFIX,
                             "executeOnPrepareSpeech",
                             METRIC_TEXT_TO_SPEECH_PREPARE_SPEECH_FAILED,
                             1);
-                        textToSpeechPlatformInterface->prepareSpeechFailed(speechId, REQUEST_TIMED_OUT);
+                        textToSpeechPlatformInterface->prepareSpeechFailed(speechId, failureReason);
                     } else {
-                        auto prepareSpeechResult = prepareSpeechFuture.get();
-                        auto speechId = prepareSpeechResult.getSpeechId();
-                        auto failureReason = prepareSpeechResult.getFailureReason();
-                        auto metadata = prepareSpeechResult.getSpeechMetadata();
-                        auto synthesizedSpeech = prepareSpeechResult.getPreparedAudio();
-                        if (!failureReason.empty()) {
-                            emitCounterMetrics(
-                                METRIC_PROGRAM_NAME_SUFFIX,
-                                "executeOnPrepareSpeech",
-                                METRIC_TEXT_TO_SPEECH_PREPARE_SPEECH_FAILED,
-                                1);
-                            textToSpeechPlatformInterface->prepareSpeechFailed(speechId, failureReason);
-                        } else {
-                            emitCounterMetrics(
-                                METRIC_PROGRAM_NAME_SUFFIX,
-                                "executeOnPrepareSpeech",
-                                METRIC_TEXT_TO_SPEECH_PREPARE_SPEECH_COMPLETED,
-                                1);
-                            textToSpeechPlatformInterface->prepareSpeechCompleted(
-                                speechId, synthesizedSpeech, metadata);
+                        emitCounterMetrics(
+                            METRIC_PROGRAM_NAME_SUFFIX,
+                            "executeOnPrepareSpeech",
+                            METRIC_TEXT_TO_SPEECH_PREPARE_SPEECH_COMPLETED,
+                            1);
+                        emitTimerMetrics(
+                            METRIC_PROGRAM_NAME_SUFFIX,
+                            "executeOnPrepareSpeech",
+                            METRIC_TEXT_TO_SPEECH_PREPARE_SPEECH_LATENCY,
+                            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - requestTime)
+                                .count());
+                        if (synthesizedSpeechCache != nullptr && synthesizedSpeech != nullptr) {
+                            synthesizedSpeech = synthesizedSpeechCache->record(cacheKey, synthesizedSpeech, metadata);
                         }
+                        textToSpeechPlatformInterface->prepareSpeechCompleted(speechId, synthesizedSpeech, metadata);
                     }
-                } catch (std::exception& ex) {
-                    AACE_ERROR(LX(TAG).d("reason", ex.what()));
-                    emitCounterMetrics(
-                        METRIC_PROGRAM_NAME_SUFFIX,
-                        "executeOnPrepareSpeech",
-                        METRIC_TEXT_TO_SPEECH_PREPARE_SPEECH_FAILED,
-                        1);
-                    textToSpeechPlatformInterface->prepareSpeechFailed(speechId, INTERNAL_ERROR);
                 }
-            });
+            } catch (std::exception& ex) {
+                AACE_ERROR(LX(TAG).d("reason", ex.what()));
+                emitCounterMetrics(
+                    METRIC_PROGRAM_NAME_SUFFIX,
+                    "executeOnPrepareSpeech",
+                    METRIC_TEXT_TO_SPEECH_PREPARE_SPEECH_FAILED,
+                    1);
+                textToSpeechPlatformInterface->prepareSpeechFailed(speechId, INTERNAL_ERROR);
+            }
+            worker->pendingRequests--;
+        });
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -198,6 +273,16 @@ bool TextToSpeechEngineImpl::executeOnPrepareSpeech(
     }
 }
 
+TextToSpeechEngineImpl::PrepareSpeechWorker* TextToSpeechEngineImpl::selectPrepareSpeechWorker() {
+    auto selected = m_prepareSpeechWorkers.front().get();
+    for (auto& worker : m_prepareSpeechWorkers) {
+        if (worker->pendingRequests < selected->pendingRequests) {
+            selected = worker.get();
+        }
+    }
+    return selected;
+}
+
 bool TextToSpeechEngineImpl::executeOnGetCapabilities(
     const std::string& requestId,
     std::shared_ptr<TextToSpeechSynthesizerInterface> textToSpeechProvider) {
@@ -238,6 +323,9 @@ void TextToSpeechEngineImpl::shutdown() {
         m_textToSpeechPlatformInterface->setEngineInterface(nullptr);
         m_textToSpeechPlatformInterface.reset();
     }
+    for (auto& worker : m_prepareSpeechWorkers) {
+        worker->executor.shutdown();
+    }
     m_executor.shutdown();
 }
 
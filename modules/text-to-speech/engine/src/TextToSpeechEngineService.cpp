@@ -16,6 +16,8 @@
 #include "AACE/Engine/Core/EngineMacros.h"
 #include "AACE/Engine/TextToSpeech/TextToSpeechEngineService.h"
 
+#include <nlohmann/json.hpp>
+
 namespace aace {
 namespace engine {
 namespace textToSpeech {
@@ -43,6 +45,32 @@ bool TextToSpeechEngineService::initialize() {
     }
 }
 
+bool TextToSpeechEngineService::configure(std::shared_ptr<const aace::engine::utils::json::Value> configuration) {
+    try {
+        auto& jconfiguration = *configuration;
+        ThrowIfNot(jconfiguration.is_object(), "invalidTextToSpeechConfiguration");
+        if (jconfiguration.contains("maxConcurrentRequests")) {
+            auto& maxConcurrentRequests = jconfiguration.at("maxConcurrentRequests");
+            ThrowIfNot(
+                maxConcurrentRequests.is_number_unsigned() && maxConcurrentRequests.get<size_t>() > 0,
+                "invalidMaxConcurrentRequests");
+            m_maxConcurrentRequests = maxConcurrentRequests.get<size_t>();
+        }
+        if (jconfiguration.contains("cache")) {
+            auto& cache = jconfiguration.at("cache");
+            ThrowIfNot(cache.is_object(), "invalidCacheConfiguration");
+            if (cache.contains("maxBytes")) {
+                ThrowIfNot(cache.at("maxBytes").is_number_unsigned(), "invalidCacheMaxBytes");
+                m_cacheMaxBytes = cache.at("maxBytes").get<size_t>();
+            }
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG, "configure").d("reason", ex.what()));
+        return false;
+    }
+}
+
 bool TextToSpeechEngineService::shutdown() {
     AACE_INFO(LX(TAG));
     if (m_textToSpeechEngineImpl != nullptr) {
@@ -70,8 +98,8 @@ bool TextToSpeechEngineService::registerPlatformInterfaceType(
     try {
         ThrowIfNotNull(m_textToSpeechEngineImpl, "platformInterfaceAlreadyRegistered");
 
-        m_textToSpeechEngineImpl =
-            aace::engine::textToSpeech::TextToSpeechEngineImpl::create(textToSpeech, shared_from_this());
+        m_textToSpeechEngineImpl = aace::engine::textToSpeech::TextToSpeechEngineImpl::create(
+            textToSpeech, shared_from_this(), m_maxConcurrentRequests, m_cacheMaxBytes);
         ThrowIfNull(m_textToSpeechEngineImpl, "createTextToSpeechEngineImplFailed");
 
         return true;
@@ -0,0 +1,250 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <AACE/Audio/AudioStream.h>
+#include <AACE/Engine/TextToSpeech/SynthesizedSpeechCache.h>
+
+using namespace aace::engine::textToSpeech;
+
+/// Audio stream which provides its data in chunks, and is closed once @c close() is called.
+class TestAudioStream : public aace::audio::AudioStream {
+public:
+    /**
+     * @param closed Whether the provider has already written all the data.
+     * @param closedWhenDrained Whether the stream reports that it is closed only once all the data was read.
+     */
+    TestAudioStream(const std::string& data, bool closed = true, bool closedWhenDrained = true) :
+            m_data(data),
+            m_offset(0),
+            m_available(data.size()),
+            m_closed(closed),
+            m_closedWhenDrained(closedWhenDrained) {
+    }
+
+    /// Makes only the first @c count bytes available until @c close() is called.
+    void setAvailable(size_t count) {
+        m_available = count;
+    }
+
+    void close() {
+        m_available = m_data.size();
+        m_closed = true;
+    }
+
+    ssize_t read(char* data, const size_t size) override {
+        auto count = std::min(size, m_available - m_offset);
+        std::memcpy(data, m_data.data() + m_offset, count);
+        m_offset += count;
+        return static_cast<ssize_t>(count);
+    }
+
+    bool isClosed() override {
+        return m_closed && (!m_closedWhenDrained || m_offset >= m_data.size());
+    }
+
+    AudioFormat getAudioFormat() override {
+        return AudioFormat(AudioFormat::Encoding::MP3);
+    }
+
+    MediaType getMediaType() override {
+        return MediaType::MPEG;
+    }
+
+    std::vector<aace::audio::AudioStreamProperty> getProperties() override {
+        std::vector<aace::audio::AudioStreamProperty> properties;
+        properties.emplace_back("voice", "test");
+        return properties;
+    }
+
+private:
+    std::string m_data;
+    size_t m_offset;
+    size_t m_available;
+    bool m_closed;
+    bool m_closedWhenDrained;
+};
+
+/// Test harness for @c SynthesizedSpeechCache.
+class SynthesizedSpeechCacheTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_cache = SynthesizedSpeechCache::create(16);
+        ASSERT_NE(m_cache, nullptr);
+    }
+
+    /// Reads a stream to the end in small chunks, as the platform does.
+    static std::string readAll(std::shared_ptr<aace::audio::AudioStream> stream) {
+        std::string result;
+        char buffer[3];
+        while (!stream->isClosed()) {
+            auto count = stream->read(buffer, sizeof(buffer));
+            if (count <= 0) {
+                break;
+            }
+            result.append(buffer, count);
+        }
+        // the end of the stream is reported by a read of 0 bytes
+        EXPECT_EQ(stream->read(buffer, sizeof(buffer)), 0);
+        return result;
+    }
+
+    /// Records speech in the cache by reading it to the end.
+    void put(const std::string& key, const std::string& data) {
+        auto stream = m_cache->record(key, std::make_shared<TestAudioStream>(data), "metadata-" + key);
+        ASSERT_EQ(readAll(stream), data);
+    }
+
+    bool contains(const std::string& key) {
+        std::string metadata;
+        return m_cache->get(key, metadata) != nullptr;
+    }
+
+protected:
+    std::shared_ptr<SynthesizedSpeechCache> m_cache;
+};
+
+TEST_F(SynthesizedSpeechCacheTest, createWithoutSpace) {
+    ASSERT_EQ(SynthesizedSpeechCache::create(0), nullptr);
+}
+
+TEST_F(SynthesizedSpeechCacheTest, keysDoNotMixFields) {
+    ASSERT_NE(SynthesizedSpeechCache::createKey("a", "bc", ""), SynthesizedSpeechCache::createKey("ab", "c", ""));
+    ASSERT_NE(
+        SynthesizedSpeechCache::createKey("p", "text", "{}"), SynthesizedSpeechCache::createKey("p", "}text", "{"));
+    ASSERT_EQ(
+        SynthesizedSpeechCache::createKey("p", "text", "{}"), SynthesizedSpeechCache::createKey("p", "text", "{}"));
+}
+
+TEST_F(SynthesizedSpeechCacheTest, recordedSpeechIsReplayed) {
+    std::string metadata;
+    ASSERT_EQ(m_cache->get("turn", metadata), nullptr);
+    put("turn", "turn left");
+
+    auto replay = m_cache->get("turn", metadata);
+    ASSERT_NE(replay, nullptr);
+    ASSERT_EQ(metadata, "metadata-turn");
+    ASSERT_EQ(replay->getEncoding(), aace::audio::AudioFormat::Encoding::MP3);
+    ASSERT_EQ(replay->getMediaType(), aace::audio::AudioStream::MediaType::MPEG);
+    auto properties = replay->getProperties();
+    ASSERT_EQ(properties.size(), 1u);
+    ASSERT_EQ(properties[0].getKey(), "voice");
+    ASSERT_EQ(properties[0].getValue(), "test");
+    ASSERT_EQ(readAll(replay), "turn left");
+
+    // every replay starts from the beginning
+    ASSERT_EQ(readAll(m_cache->get("turn", metadata)), "turn left");
+    ASSERT_EQ(m_cache->getSize(), 9u);
+}
+
+TEST_F(SynthesizedSpeechCacheTest, speechIsCachedOnlyWhenReadToTheEnd) {
+    auto source = std::make_shared<TestAudioStream>("arriving", false);
+    source->setAvailable(4);
+    auto stream = m_cache->record("arrive", source, "");
+    char buffer[16];
+    ASSERT_EQ(stream->read(buffer, sizeof(buffer)), 4);
+
+    // no data is available yet, but the stream is not closed
+    ASSERT_EQ(stream->read(buffer, sizeof(buffer)), 0);
+    ASSERT_FALSE(contains("arrive"));
+
+    source->close();
+    ASSERT_EQ(stream->read(buffer, sizeof(buffer)), 4);
+    ASSERT_EQ(stream->read(buffer, sizeof(buffer)), 0);
+    ASSERT_TRUE(contains("arrive"));
+
+    // a stream which is abandoned is not cached
+    stream = m_cache->record("abandoned", std::make_shared<TestAudioStream>("abandoned"), "");
+    ASSERT_EQ(stream->read(buffer, 4), 4);
+    stream.reset();
+    ASSERT_FALSE(contains("abandoned"));
+}
+
+TEST_F(SynthesizedSpeechCacheTest, streamClosedBeforeDrainedIsCachedWhole) {
+    // the provider closes the stream while the reader has buffered data left to read
+    auto source = std::make_shared<TestAudioStream>("turn right", false, false);
+    source->setAvailable(4);
+    auto stream = m_cache->record("turn", source, "");
+    char buffer[3];
+    ASSERT_EQ(stream->read(buffer, sizeof(buffer)), 3);
+    source->close();
+    ASSERT_TRUE(stream->isClosed());
+    ASSERT_FALSE(contains("turn"));
+
+    std::string result("tur");
+    ssize_t count;
+    while ((count = stream->read(buffer, sizeof(buffer))) > 0) {
+        ASSERT_FALSE(contains("turn"));
+        result.append(buffer, count);
+    }
+    ASSERT_EQ(result, "turn right");
+
+    std::string metadata;
+    auto replay = m_cache->get("turn", metadata);
+    ASSERT_NE(replay, nullptr);
+    ASSERT_EQ(readAll(replay), "turn right");
+}
+
+TEST_F(SynthesizedSpeechCacheTest, readerStoppingWhenClosedCachesSpeech) {
+    // the reader stops once the stream is closed, without reading 0 bytes
+    auto stream = m_cache->record("left", std::make_shared<TestAudioStream>("turn left"), "");
+    std::string result;
+    char buffer[4];
+    while (!stream->isClosed()) {
+        auto count = stream->read(buffer, sizeof(buffer));
+        ASSERT_GT(count, 0);
+        result.append(buffer, count);
+    }
+    ASSERT_EQ(result, "turn left");
+    ASSERT_TRUE(contains("left"));
+}
+
+TEST_F(SynthesizedSpeechCacheTest, leastRecentlyUsedSpeechIsEvicted) {
+    put("first", "111111");
+    put("second", "222222");
+    ASSERT_TRUE(contains("first"));
+
+    put("third", "333333");
+    ASSERT_TRUE(contains("first"));
+    ASSERT_FALSE(contains("second"));
+    ASSERT_TRUE(contains("third"));
+    ASSERT_EQ(m_cache->getSize(), 12u);
+
+    // speech which does not fit into the cache does not evict anything
+    put("large", "0123456789abcdefg");
+    ASSERT_FALSE(contains("large"));
+    ASSERT_EQ(m_cache->getSize(), 12u);
+
+    m_cache->clear();
+    ASSERT_FALSE(contains("first"));
+    ASSERT_EQ(m_cache->getSize(), 0u);
+}
+
+TEST_F(SynthesizedSpeechCacheTest, replayOutlivesEviction) {
+    put("first", "11111111");
+    std::string metadata;
+    auto replay = m_cache->get("first", metadata);
+    put("second", "22222222");
+    put("third", "33333333");
+    ASSERT_FALSE(contains("first"));
+    ASSERT_EQ(readAll(replay), "11111111");
+}
@@ -16,6 +16,15 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
 #include <AACE/TextToSpeech/TextToSpeech.h>
 #include <AACE/Audio/AudioStream.h>
 #include <AACE/Engine/TextToSpeech/TextToSpeechEngineImpl.h>
@@ -232,6 +241,259 @@ TEST_F(TextToSpeechEngineImplTest, getCapabilitiesWithInvalidProvider) {
         << "Call to onPrepareSpeech() expected to fail!";
 }
 
+using TextToSpeechEngineImpl = aace::engine::textToSpeech::TextToSpeechEngineImpl;
+
+/// Time a local provider takes to synthesize speech.
+static const std::chrono::milliseconds SYNTHESIS_DELAY(100);
+
+/// Number of requests used by the benchmarks.
+static const int BENCHMARK_REQUEST_COUNT = 16;
+
+/**
+ * Audio stream with synthesized speech, which is available at once.
+ */
+class LocalAudioStream : public aace::audio::AudioStream {
+public:
+    LocalAudioStream(const std::string& data) : m_data(data), m_offset(0) {
+    }
+
+    ssize_t read(char* data, const size_t size) override {
+        auto count = std::min(size, m_data.size() - m_offset);
+        std::memcpy(data, m_data.data() + m_offset, count);
+        m_offset += count;
+        return static_cast<ssize_t>(count);
+    }
+
+    bool isClosed() override {
+        return m_offset >= m_data.size();
+    }
+
+private:
+    std::string m_data;
+    size_t m_offset;
+};
+
+/**
+ * Local stand-in for the text to speech provider, which answers every request after @c SYNTHESIS_DELAY.
+ */
+class LocalTextToSpeechProvider : public aace::engine::textToSpeech::TextToSpeechSynthesizerInterface {
+public:
+    std::future<aace::engine::textToSpeech::PrepareSpeechResult> prepareSpeech(
+        const std::string& speechId,
+        const std::string& text,
+        const std::string& requestPayload) override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_requestCount++;
+            m_inFlight++;
+            m_maxInFlight = std::max(m_maxInFlight, m_inFlight);
+            m_cv.notify_all();
+        }
+        // like the provider, answer from another thread
+        return std::async(std::launch::async, [this, speechId, text, requestPayload] {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait_for(lock, std::chrono::seconds(5), [this] { return m_inFlight >= m_holdUntilInFlight; });
+            }
+            std::this_thread::sleep_for(SYNTHESIS_DELAY);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_inFlight--;
+            }
+            return aace::engine::textToSpeech::PrepareSpeechResult(
+                speechId, std::make_shared<LocalAudioStream>(requestPayload + text), "metadata");
+        });
+    }
+
+    std::future<std::string> getCapabilities(const std::string& requestId) override {
+        std::promise<std::string> promise;
+        promise.set_value("{}");
+        return promise.get_future();
+    }
+
+    int getRequestCount() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_requestCount;
+    }
+
+    /// Holds each request until @c count requests are in flight, or for at most 5 seconds.
+    void holdUntilInFlight(int count) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_holdUntilInFlight = count;
+    }
+
+    /// The largest number of requests which were in flight at the same time.
+    int getMaxInFlight() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_maxInFlight;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    int m_requestCount = 0;
+    int m_inFlight = 0;
+    int m_maxInFlight = 0;
+    int m_holdUntilInFlight = 0;
+};
+
+/**
+ * Text to speech platform implementation which plays synthesized speech by reading it to the end.
+ */
+class LocalTextToSpeechPlatform : public aace::textToSpeech::TextToSpeech {
+public:
+    void prepareSpeechCompleted(
+        const std::string& speechId,
+        std::shared_ptr<aace::audio::AudioStream> preparedAudio,
+        const std::string& metadata) override {
+        std::string speech;
+        char buffer[64];
+        while (!preparedAudio->isClosed()) {
+            auto count = preparedAudio->read(buffer, sizeof(buffer));
+            if (count <= 0) {
+                break;
+            }
+            speech.append(buffer, count);
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_results[speechId] = speech;
+        m_cv.notify_all();
+    }
+
+    void prepareSpeechFailed(const std::string& speechId, const std::string& reason) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_results[speechId] = "failed:" + reason;
+        m_cv.notify_all();
+    }
+
+    void capabilitiesReceived(const std::string& requestId, const std::string& capabilities) override {
+    }
+
+    /// Waits for the result of a request, which is the speech or the failure reason.
+    std::string waitForResult(const std::string& speechId) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        EXPECT_TRUE(m_cv.wait_for(lock, std::chrono::seconds(5), [this, speechId] {
+            return m_results.find(speechId) != m_results.end();
+        }));
+        return m_results[speechId];
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::unordered_map<std::string, std::string> m_results;
+};
+
+/**
+ * Tests the @c TextToSpeechEngineImpl request pipeline with a local provider.
+ */
+class TextToSpeechEngineImplPipelineTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_platform = std::make_shared<LocalTextToSpeechPlatform>();
+        m_provider = std::make_shared<LocalTextToSpeechProvider>();
+        m_service = std::make_shared<testing::NiceMock<MockTextToSpeechServiceInterface>>();
+        ON_CALL(*m_service, getTextToSpeechProvider(testing::_)).WillByDefault(testing::Return(m_provider));
+    }
+
+    void TearDown() override {
+        if (m_engineImpl != nullptr) {
+            m_engineImpl->shutdown();
+        }
+    }
+
+    void createEngineImpl(
+        size_t maxConcurrentRequests = TextToSpeechEngineImpl::DEFAULT_MAX_CONCURRENT_REQUESTS,
+        size_t cacheMaxBytes = TextToSpeechEngineImpl::DEFAULT_CACHE_MAX_BYTES) {
+        if (m_engineImpl != nullptr) {
+            m_engineImpl->shutdown();
+        }
+        m_engineImpl = TextToSpeechEngineImpl::create(m_platform, m_service, maxConcurrentRequests, cacheMaxBytes);
+        ASSERT_NE(m_engineImpl, nullptr);
+    }
+
+    /// Requests speech for each text, and returns the time until all speech was played.
+    double prepareSpeech(const std::string& prefix, const std::vector<std::string>& texts) {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < texts.size(); i++) {
+            EXPECT_TRUE(m_engineImpl->onPrepareSpeech(
+                prefix + std::to_string(i), texts[i], "text-to-speech-provider", R"({"voiceId":"Alexa"})"));
+        }
+        for (size_t i = 0; i < texts.size(); i++) {
+            EXPECT_EQ(m_platform->waitForResult(prefix + std::to_string(i)), R"({"voiceId":"Alexa"})" + texts[i]);
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    static std::vector<std::string> prompts(const std::string& text) {
+        std::vector<std::string> result;
+        for (int i = 0; i < BENCHMARK_REQUEST_COUNT; i++) {
+            result.push_back(text + " " + std::to_string(i));
+        }
+        return result;
+    }
+
+protected:
+    std::shared_ptr<LocalTextToSpeechPlatform> m_platform;
+    std::shared_ptr<LocalTextToSpeechProvider> m_provider;
+    std::shared_ptr<testing::NiceMock<MockTextToSpeechServiceInterface>> m_service;
+    std::shared_ptr<TextToSpeechEngineImpl> m_engineImpl;
+};
+
+/**
+ * @test createWithoutConcurrentRequests
+ */
+TEST_F(TextToSpeechEngineImplPipelineTest, createWithoutConcurrentRequests) {
+    EXPECT_EQ(nullptr, TextToSpeechEngineImpl::create(m_platform, m_service, 0));
+}
+
+/**
+ * @test prepareSpeechRequestsRunConcurrently
+ */
+TEST_F(TextToSpeechEngineImplPipelineTest, prepareSpeechRequestsRunConcurrently) {
+    createEngineImpl(4, 0);
+    m_provider->holdUntilInFlight(4);
+    prepareSpeech("speech", {"turn left", "turn right", "continue", "arrive"});
+    EXPECT_EQ(m_provider->getRequestCount(), 4);
+    EXPECT_EQ(m_provider->getMaxInFlight(), 4) << "Requests did not reach the provider at the same time!";
+}
+
+/**
+ * @test repeatedPromptIsServedFromCache
+ */
+TEST_F(TextToSpeechEngineImplPipelineTest, repeatedPromptIsServedFromCache) {
+    createEngineImpl();
+    prepareSpeech("first", {"turn left"});
+    EXPECT_EQ(m_provider->getRequestCount(), 1);
+
+    prepareSpeech("second", {"turn left"});
+    EXPECT_EQ(m_provider->getRequestCount(), 1);
+
+    // another voice is synthesized again
+    EXPECT_TRUE(
+        m_engineImpl->onPrepareSpeech("third", "turn left", "text-to-speech-provider", R"({"voiceId":"Other"})"));
+    EXPECT_EQ(m_platform->waitForResult("third"), R"({"voiceId":"Other"}turn left)");
+    EXPECT_EQ(m_provider->getRequestCount(), 2);
+}
+
+/**
+ * @test benchmarkPrepareSpeech
+ */
+TEST_F(TextToSpeechEngineImplPipelineTest, DISABLED_benchmarkPrepareSpeech) {
+    createEngineImpl(1, 0);
+    double serial = prepareSpeech("serial", prompts("serial"));
+
+    createEngineImpl();
+    double concurrent = prepareSpeech("concurrent", prompts("concurrent"));
+    double cached = prepareSpeech("cached", prompts("concurrent"));
+
+    RecordProperty("prepareSpeech.requests", BENCHMARK_REQUEST_COUNT);
+    RecordProperty("prepareSpeech.synthesisMs", static_cast<int>(SYNTHESIS_DELAY.count()));
+    RecordProperty("prepareSpeech.serialMs", static_cast<int>(serial));
+    RecordProperty("prepareSpeech.concurrentMs", static_cast<int>(concurrent));
+    RecordProperty("prepareSpeech.cachedMs", static_cast<int>(cached));
+}
+
 }  // namespace textToSpeech
 }  // namespace unit
 }  // namespace test
@@ -0,0 +1,164 @@
+/*
+ * Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <AACE/Core/Engine.h>
+#include <AACE/Core/EngineConfiguration.h>
+
+using Clock = std::chrono::steady_clock;
+using json = nlohmann::json;
+
+/*
+ * Measures the cold start of an Engine with every module linked into the Sample App. Each iteration removes the
+ * files given with --reset, such as the storage database, then creates, configures, starts and shuts down an
+ * Engine. The Engine writes its lifecycle trace, from which the tool reports the services which took the longest.
+ */
+
+static void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options] <config>..." << std::endl
+              << std::endl
+              << "Starts an Engine configured with the configuration files several times, and prints the cold start"
+              << std::endl
+              << "time and the services which took the longest to start." << std::endl
+              << std::endl
+              << "Options:" << std::endl
+              << "  --iterations <count>  The number of cold starts measured (5)" << std::endl
+              << "  --reset <path>        A file removed before each start, such as the storage database" << std::endl
+              << "  --trace <path>        The path of the lifecycle trace (/tmp/aace-cold-start-trace.json)"
+              << std::endl
+              << "  --slowest <count>     The number of services reported as the slowest to start (10)" << std::endl;
+}
+
+static std::shared_ptr<aace::core::config::EngineConfiguration> createTraceConfiguration(const std::string& path) {
+    json configuration = {{"aace.engine", {{"lifecycleTracePath", path}}}};
+    return aace::core::config::StreamConfiguration::create(std::make_shared<std::stringstream>(configuration.dump()));
+}
+
+/// Adds the time of each service in every phase of a trace to @c serviceTimes, in microseconds.
+static bool addServiceTimes(const std::string& path, std::map<std::string, int64_t>& serviceTimes) {
+    std::ifstream file(path);
+    auto trace = json::parse(file, nullptr, false);
+    if (trace.is_discarded() || !trace.contains("traceEvents")) {
+        return false;
+    }
+    for (auto& next : trace["traceEvents"]) {
+        if (next.value("ph", "") == "X" && next.value("cat", "") != "engine") {
+            serviceTimes[next.value("name", "")] += next.value("dur", int64_t(0));
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    int iterations = 5;
+    size_t slowestCount = 10;
+    std::string tracePath = "/tmp/aace-cold-start-trace.json";
+    std::vector<std::string> resetPaths;
+    std::vector<std::string> configPaths;
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (arg == "--iterations" && hasValue) {
+                iterations = std::stoi(argv[++i]);
+            } else if (arg == "--reset" && hasValue) {
+                resetPaths.push_back(argv[++i]);
+            } else if (arg == "--trace" && hasValue) {
+                tracePath = argv[++i];
+            } else if (arg == "--slowest" && hasValue) {
+                slowestCount = std::stoul(argv[++i]);
+            } else if (arg.compare(0, 2, "--") == 0) {
+                printUsage(argv[0]);
+                return 1;
+            } else {
+                configPaths.push_back(arg);
+            }
+        }
+    } catch (std::exception& ex) {
+        std::cerr << "Invalid option value: " << ex.what() << std::endl;
+        return 1;
+    }
+    if (configPaths.empty() || iterations <= 0) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::vector<Clock::duration> startTimes;
+    std::map<std::string, int64_t> serviceTimes;
+    for (int i = 0; i < iterations; i++) {
+        for (auto& next : resetPaths) {
+            std::remove(next.c_str());
+        }
+        std::remove(tracePath.c_str());
+
+        // the configuration files are read again for each start, as the platform reads them
+        auto startTime = Clock::now();
+        std::vector<std::shared_ptr<aace::core::config::EngineConfiguration>> configurationList;
+        for (auto& next : configPaths) {
+            auto configuration = aace::core::config::ConfigurationFile::create(next);
+            if (configuration == nullptr) {
+                std::cerr << "Cannot read the configuration " << next << std::endl;
+                return 1;
+            }
+            configurationList.push_back(configuration);
+        }
+        configurationList.push_back(createTraceConfiguration(tracePath));
+
+        auto engine = aace::core::Engine::create();
+        if (engine == nullptr || !engine->configure(configurationList) || !engine->start()) {
+            std::cerr << "Cannot start the Engine" << std::endl;
+            return 1;
+        }
+        startTimes.push_back(Clock::now() - startTime);
+
+        // the trace is written once the engine is started
+        if (!addServiceTimes(tracePath, serviceTimes)) {
+            std::cerr << "Cannot read the lifecycle trace " << tracePath << std::endl;
+            return 1;
+        }
+        engine->shutdown();
+    }
+
+    std::sort(startTimes.begin(), startTimes.end());
+    auto toMilliseconds = [](Clock::duration duration) {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+    };
+    std::cout << "iterations: " << startTimes.size() << std::endl
+              << "median: " << toMilliseconds(startTimes[startTimes.size() / 2]) << " ms" << std::endl
+              << "max: " << toMilliseconds(startTimes.back()) << " ms" << std::endl;
+
+    using ServiceTime = std::pair<std::string, int64_t>;
+    std::vector<ServiceTime> slowest(serviceTimes.begin(), serviceTimes.end());
+    std::sort(slowest.begin(), slowest.end(), [](const ServiceTime& a, const ServiceTime& b) {
+        return a.second > b.second;
+    });
+    slowest.resize(std::min(slowest.size(), slowestCount));
+    for (auto& next : slowest) {
+        std::cout << next.first << ": " << next.second / iterations << " us" << std::endl;
+    }
+    return 0;
+}